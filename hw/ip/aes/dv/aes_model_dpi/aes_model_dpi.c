@@ -144,14 +144,6 @@ void c_dpi_aes_crypt_message(unsigned char impl_i, unsigned char op_i,
     key_len = 32;
   }
 
-  if (impl == 0) {
-    // The C model is currently not supported.
-    printf(
-        "ERROR: c_dpi_aes_crypt_message() currently supports OpenSSL/BoringSSL "
-        "only\n");
-    return;
-  }
-
   // Get key from simulator.
   unsigned char *key = aes_key_get(key_i);
 
@@ -183,7 +175,6 @@ void c_dpi_aes_crypt_message(unsigned char impl_i, unsigned char op_i,
       (unsigned char *)malloc(data_len * sizeof(unsigned char));
   assert(ref_out);
 
-  // OpenSSL/BoringSSL
   if ((int)data_len % 16) {
     printf(
         "ERROR: Message length must be a multiple of 16 bytes (the block "
@@ -192,10 +183,12 @@ void c_dpi_aes_crypt_message(unsigned char impl_i, unsigned char op_i,
   }
 
   if (impl == 0) {
-    // The C model is currently not supported.
-    printf(
-        "ERROR: c_dpi_aes_crypt_message() currently supports OpenSSL/BoringSSL "
-        "only\n");
+    // The fast C model caches the key schedule across calls.
+    if (!op) {
+      aes_encrypt_message(ref_out, iv, ref_in, data_len, key, key_len, mode);
+    } else {
+      aes_decrypt_message(ref_out, iv, ref_in, data_len, key, key_len, mode);
+    }
   } else {  // OpenSSL/BoringSSL
     if (!op) {
       crypto_encrypt(ref_out, iv, ref_in, data_len, key, key_len, mode);
@@ -210,6 +203,7 @@ void c_dpi_aes_crypt_message(unsigned char impl_i, unsigned char op_i,
   // Free memory.
   free(iv);
   free(key);
+  free(ref_in);
 }
 
 void c_dpi_aes_sub_bytes(const unsigned char op_i, const svBitVecVal *data_i,
@@ -7,6 +7,7 @@
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 int aes_encrypt_block(const unsigned char *plain_text, const unsigned char *key,
                       const int key_len, unsigned char *cipher_text) {
@@ -1002,3 +1003,330 @@ void aes_rcon_prev(unsigned char *rcon, int key_len) {
 
   return;
 }
+
+// T-tables for the fast cipher implementation. Table k holds the contribution
+// of a state byte in row k to its output column after SubBytes and
+// MixColumns (or their inverses), i.e., the tables only differ by a rotation.
+static uint32_t aes_te[4][256];
+static uint32_t aes_td[4][256];
+static int aes_tables_ready = 0;
+
+// Single-entry key schedule cache used by aes_key_schedule_get().
+static aes_key_schedule_t aes_key_schedule_cache;
+static int aes_key_schedule_cache_valid = 0;
+
+static uint32_t aes_rotl8(uint32_t in) { return (in << 8) | (in >> 24); }
+
+static uint32_t aes_load_word(const unsigned char *in) {
+  return ((uint32_t)in[0] << 0) | ((uint32_t)in[1] << 8) |
+         ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static void aes_store_word(unsigned char *out, uint32_t in) {
+  out[0] = (unsigned char)(in >> 0);
+  out[1] = (unsigned char)(in >> 8);
+  out[2] = (unsigned char)(in >> 16);
+  out[3] = (unsigned char)(in >> 24);
+}
+
+static uint32_t aes_sub_word(uint32_t in) {
+  return ((uint32_t)sbox[(in >> 0) & 0xFF] << 0) |
+         ((uint32_t)sbox[(in >> 8) & 0xFF] << 8) |
+         ((uint32_t)sbox[(in >> 16) & 0xFF] << 16) |
+         ((uint32_t)sbox[(in >> 24) & 0xFF] << 24);
+}
+
+static void aes_tables_init(void) {
+  if (aes_tables_ready) {
+    return;
+  }
+
+  for (int i = 0; i < 256; i++) {
+    // Forward: column (2, 1, 1, 3) * S(x)
+    unsigned char s = sbox[i];
+    unsigned char s2 = aes_mul2(s);
+    unsigned char s3 = s2 ^ s;
+    aes_te[0][i] = ((uint32_t)s2 << 0) | ((uint32_t)s << 8) |
+                   ((uint32_t)s << 16) | ((uint32_t)s3 << 24);
+
+    // Inverse: column (e, 9, d, b) * InvS(x)
+    unsigned char t = inv_sbox[i];
+    unsigned char t2 = aes_mul2(t);
+    unsigned char t4 = aes_mul4(t);
+    unsigned char t8 = aes_mul2(t4);
+    unsigned char t9 = t8 ^ t;
+    unsigned char tb = t8 ^ t2 ^ t;
+    unsigned char td = t8 ^ t4 ^ t;
+    unsigned char te = t8 ^ t4 ^ t2;
+    aes_td[0][i] = ((uint32_t)te << 0) | ((uint32_t)t9 << 8) |
+                   ((uint32_t)td << 16) | ((uint32_t)tb << 24);
+
+    for (int k = 1; k < 4; k++) {
+      aes_te[k][i] = aes_rotl8(aes_te[k - 1][i]);
+      aes_td[k][i] = aes_rotl8(aes_td[k - 1][i]);
+    }
+  }
+
+  aes_tables_ready = 1;
+
+  return;
+}
+
+int aes_key_schedule_init(aes_key_schedule_t *sched, const unsigned char *key,
+                          const int key_len) {
+  int num_rounds = aes_get_num_rounds(key_len);
+  if (num_rounds < 0) {
+    printf("ERROR: aes_get_num_rounds() failed\n");
+    return -EINVAL;
+  }
+
+  aes_tables_init();
+
+  sched->key_len = key_len;
+  sched->num_rounds = num_rounds;
+  memcpy(sched->key, key, key_len);
+
+  // Forward key expansion as specified in FIPS 197.
+  const int num_k = key_len / 4;
+  const int num_words = 4 * (num_rounds + 1);
+  uint32_t *w = sched->enc_round_keys;
+  unsigned char rcon = 0;
+  for (int i = 0; i < num_k; i++) {
+    w[i] = aes_load_word(&key[4 * i]);
+  }
+  for (int i = num_k; i < num_words; i++) {
+    uint32_t temp = w[i - 1];
+    if (i % num_k == 0) {
+      // RotWord, SubWord, Rcon
+      aes_rcon_next(&rcon);
+      temp = aes_sub_word((temp >> 8) | (temp << 24)) ^ rcon;
+    } else if (num_k == 8 && i % num_k == 4) {
+      temp = aes_sub_word(temp);
+    }
+    w[i] = w[i - num_k] ^ temp;
+  }
+
+  // Decryption round keys for the Equivalent Inverse Cipher: reverse the
+  // round order and apply InvMixColumns to all but the first and last round
+  // key.
+  uint32_t *dw = sched->dec_round_keys;
+  for (int rnd = 0; rnd <= num_rounds; rnd++) {
+    for (int j = 0; j < 4; j++) {
+      uint32_t rk = w[4 * (num_rounds - rnd) + j];
+      if (rnd > 0 && rnd < num_rounds) {
+        rk = aes_td[0][sbox[(rk >> 0) & 0xFF]] ^
+             aes_td[1][sbox[(rk >> 8) & 0xFF]] ^
+             aes_td[2][sbox[(rk >> 16) & 0xFF]] ^
+             aes_td[3][sbox[(rk >> 24) & 0xFF]];
+      }
+      dw[4 * rnd + j] = rk;
+    }
+  }
+
+  return 0;
+}
+
+const aes_key_schedule_t *aes_key_schedule_get(const unsigned char *key,
+                                               const int key_len) {
+  if (aes_key_schedule_cache_valid &&
+      aes_key_schedule_cache.key_len == key_len &&
+      !memcmp(aes_key_schedule_cache.key, key, key_len)) {
+    return &aes_key_schedule_cache;
+  }
+
+  aes_key_schedule_cache_valid = 0;
+  if (aes_key_schedule_init(&aes_key_schedule_cache, key, key_len)) {
+    return NULL;
+  }
+  aes_key_schedule_cache_valid = 1;
+
+  return &aes_key_schedule_cache;
+}
+
+void aes_encrypt_block_fast(const aes_key_schedule_t *sched,
+                            const unsigned char *plain_text,
+                            unsigned char *cipher_text) {
+  const uint32_t *rk = sched->enc_round_keys;
+  uint32_t s[4], t[4];
+
+  for (int j = 0; j < 4; j++) {
+    s[j] = aes_load_word(&plain_text[4 * j]) ^ rk[j];
+  }
+
+  // SubBytes, ShiftRows and MixColumns combined: row r of output column j
+  // takes its input from column j + r.
+  for (int rnd = 1; rnd < sched->num_rounds; rnd++) {
+    rk += 4;
+    for (int j = 0; j < 4; j++) {
+      t[j] = aes_te[0][(s[j] >> 0) & 0xFF] ^
+             aes_te[1][(s[(j + 1) & 3] >> 8) & 0xFF] ^
+             aes_te[2][(s[(j + 2) & 3] >> 16) & 0xFF] ^
+             aes_te[3][(s[(j + 3) & 3] >> 24) & 0xFF] ^ rk[j];
+    }
+    memcpy(s, t, sizeof(s));
+  }
+
+  // Last round without MixColumns
+  rk += 4;
+  for (int j = 0; j < 4; j++) {
+    t[j] = ((uint32_t)sbox[(s[j] >> 0) & 0xFF] << 0) |
+           ((uint32_t)sbox[(s[(j + 1) & 3] >> 8) & 0xFF] << 8) |
+           ((uint32_t)sbox[(s[(j + 2) & 3] >> 16) & 0xFF] << 16) |
+           ((uint32_t)sbox[(s[(j + 3) & 3] >> 24) & 0xFF] << 24);
+    aes_store_word(&cipher_text[4 * j], t[j] ^ rk[j]);
+  }
+
+  return;
+}
+
+void aes_decrypt_block_fast(const aes_key_schedule_t *sched,
+                            const unsigned char *cipher_text,
+                            unsigned char *plain_text) {
+  const uint32_t *rk = sched->dec_round_keys;
+  uint32_t s[4], t[4];
+
+  for (int j = 0; j < 4; j++) {
+    s[j] = aes_load_word(&cipher_text[4 * j]) ^ rk[j];
+  }
+
+  // InvSubBytes, InvShiftRows and InvMixColumns combined: row r of output
+  // column j takes its input from column j - r.
+  for (int rnd = 1; rnd < sched->num_rounds; rnd++) {
+    rk += 4;
+    for (int j = 0; j < 4; j++) {
+      t[j] = aes_td[0][(s[j] >> 0) & 0xFF] ^
+             aes_td[1][(s[(j + 3) & 3] >> 8) & 0xFF] ^
+             aes_td[2][(s[(j + 2) & 3] >> 16) & 0xFF] ^
+             aes_td[3][(s[(j + 1) & 3] >> 24) & 0xFF] ^ rk[j];
+    }
+    memcpy(s, t, sizeof(s));
+  }
+
+  // Last round without InvMixColumns
+  rk += 4;
+  for (int j = 0; j < 4; j++) {
+    t[j] = ((uint32_t)inv_sbox[(s[j] >> 0) & 0xFF] << 0) |
+           ((uint32_t)inv_sbox[(s[(j + 3) & 3] >> 8) & 0xFF] << 8) |
+           ((uint32_t)inv_sbox[(s[(j + 2) & 3] >> 16) & 0xFF] << 16) |
+           ((uint32_t)inv_sbox[(s[(j + 1) & 3] >> 24) & 0xFF] << 24);
+    aes_store_word(&plain_text[4 * j], t[j] ^ rk[j]);
+  }
+
+  return;
+}
+
+/**
+ * Increment a 128-bit big-endian counter block by one.
+ *
+ * @param  ctr Counter block
+ */
+static void aes_ctr_inc(unsigned char *ctr) {
+  for (int i = 15; i >= 0; i--) {
+    if (++ctr[i]) {
+      break;
+    }
+  }
+
+  return;
+}
+
+/**
+ * Encrypt or decrypt an entire message using the fast C model.
+ *
+ * @param  output    Output data, must be a multiple of 16 bytes
+ * @param  iv        16-byte initialization vector
+ * @param  input     Input data, must be a multiple of 16 bytes
+ * @param  input_len Length of the input data in bytes
+ * @param  key       Encryption key
+ * @param  key_len   Encryption key length in bytes (16, 24, 32)
+ * @param  mode      AES cipher mode @see crypto_mode.
+ * @param  op        Operation: 0 = encrypt, 1 = decrypt
+ * @return Length of the output data in bytes, -1 in case of error
+ */
+static int aes_crypt_message(unsigned char *output, const unsigned char *iv,
+                             const unsigned char *input, int input_len,
+                             const unsigned char *key, int key_len,
+                             crypto_mode_t mode, int op) {
+  if (input_len % 16) {
+    printf("ERROR: input_len = %i is not a multiple of 16\n", input_len);
+    return -1;
+  }
+
+  const aes_key_schedule_t *sched = aes_key_schedule_get(key, key_len);
+  if (sched == NULL) {
+    printf("ERROR: aes_key_schedule_get() failed\n");
+    return -1;
+  }
+
+  // chain holds the previous cipher text block (CBC, CFB), the previous
+  // key stream block (OFB) or the counter (CTR).
+  unsigned char chain[16];
+  unsigned char block[16];
+  memcpy(chain, iv, 16);
+
+  for (int j = 0; j < input_len; j += 16) {
+    const unsigned char *in = &input[j];
+    unsigned char *out = &output[j];
+
+    if (mode == kCryptoAesEcb) {
+      if (!op) {
+        aes_encrypt_block_fast(sched, in, out);
+      } else {
+        aes_decrypt_block_fast(sched, in, out);
+      }
+    } else if (mode == kCryptoAesCbc) {
+      if (!op) {
+        for (int i = 0; i < 16; i++) {
+          block[i] = in[i] ^ chain[i];
+        }
+        aes_encrypt_block_fast(sched, block, out);
+        memcpy(chain, out, 16);
+      } else {
+        aes_decrypt_block_fast(sched, in, block);
+        for (int i = 0; i < 16; i++) {
+          block[i] ^= chain[i];
+        }
+        memcpy(chain, in, 16);
+        memcpy(out, block, 16);
+      }
+    } else if (mode == kCryptoAesCfb) {
+      aes_encrypt_block_fast(sched, chain, block);
+      for (int i = 0; i < 16; i++) {
+        // The feedback is always the cipher text.
+        chain[i] = op ? in[i] : (unsigned char)(in[i] ^ block[i]);
+        out[i] = in[i] ^ block[i];
+      }
+    } else if (mode == kCryptoAesOfb) {
+      aes_encrypt_block_fast(sched, chain, block);
+      memcpy(chain, block, 16);
+      for (int i = 0; i < 16; i++) {
+        out[i] = in[i] ^ block[i];
+      }
+    } else if (mode == kCryptoAesCtr) {
+      aes_encrypt_block_fast(sched, chain, block);
+      aes_ctr_inc(chain);
+      for (int i = 0; i < 16; i++) {
+        out[i] = in[i] ^ block[i];
+      }
+    } else {
+      printf("ERROR: mode = %i not supported\n", (int)mode);
+      return -1;
+    }
+  }
+
+  return input_len;
+}
+
+int aes_encrypt_message(unsigned char *output, const unsigned char *iv,
+                        const unsigned char *input, int input_len,
+                        const unsigned char *key, int key_len,
+                        crypto_mode_t mode) {
+  return aes_crypt_message(output, iv, input, input_len, key, key_len, mode, 0);
+}
+
+int aes_decrypt_message(unsigned char *output, const unsigned char *iv,
+                        const unsigned char *input, int input_len,
+                        const unsigned char *key, int key_len,
+                        crypto_mode_t mode) {
+  return aes_crypt_message(output, iv, input, input_len, key, key_len, mode, 1);
+}
@@ -5,6 +5,26 @@
 #ifndef OPENTITAN_HW_IP_AES_MODEL_AES_H_
 #define OPENTITAN_HW_IP_AES_MODEL_AES_H_
 
+#include <stdint.h>
+
+#include "crypto.h"
+
+/**
+ * Expanded key schedule for the fast 32-bit table-based cipher
+ * implementation.
+ *
+ * The round keys are stored as little-endian column words, i.e., byte 0 of
+ * a column is in bits 7:0. The decryption round keys are stored in the
+ * order required by the Equivalent Inverse Cipher.
+ */
+typedef struct aes_key_schedule {
+  int key_len;
+  int num_rounds;
+  unsigned char key[32];
+  uint32_t enc_round_keys[60];
+  uint32_t dec_round_keys[60];
+} aes_key_schedule_t;
+
 /**
  * Encrypt one data block (16 Bytes) in ECB mode.
  *
@@ -30,6 +50,92 @@ int aes_decrypt_block(const unsigned char *cipher_text,
                       const unsigned char *key, const int key_len,
                       unsigned char *plain_text);
 
+/**
+ * Expand the full key schedule for the fast cipher implementation.
+ *
+ * @param  sched   Key schedule to initialize
+ * @param  key     Initial encryption key
+ * @param  key_len Key length in bytes (16, 24, 32)
+ * @return 0 on success, -ERRNO otherwise
+ */
+int aes_key_schedule_init(aes_key_schedule_t *sched, const unsigned char *key,
+                          const int key_len);
+
+/**
+ * Get the key schedule for a key, re-using the previously expanded schedule
+ * if the key did not change since the last call.
+ *
+ * @param  key     Initial encryption key
+ * @param  key_len Key length in bytes (16, 24, 32)
+ * @return Pointer to the cached key schedule, NULL on error
+ */
+const aes_key_schedule_t *aes_key_schedule_get(const unsigned char *key,
+                                               const int key_len);
+
+/**
+ * Encrypt one data block (16 Bytes) in ECB mode using T-tables.
+ *
+ * @param  sched       Expanded key schedule
+ * @param  plain_text  Input block to encrypt
+ * @param  cipher_text Encrypted output block
+ */
+void aes_encrypt_block_fast(const aes_key_schedule_t *sched,
+                            const unsigned char *plain_text,
+                            unsigned char *cipher_text);
+
+/**
+ * Decrypt one data block (16 Bytes) in ECB mode using T-tables.
+ *
+ * @param  sched       Expanded key schedule
+ * @param  cipher_text Encrypted input block
+ * @param  plain_text  Decrypted output block
+ */
+void aes_decrypt_block_fast(const aes_key_schedule_t *sched,
+                            const unsigned char *cipher_text,
+                            unsigned char *plain_text);
+
+/**
+ * Encrypt an entire message using the fast C model.
+ *
+ * Uses the same interface as crypto_encrypt() such that both implementations
+ * can be used interchangeably.
+ *
+ * @param  output    Output cipher text, must be a multiple of 16 bytes
+ * @param  iv        16-byte initialization vector
+ * @param  input     Input plain text to encode, must be a multiple of 16 bytes
+ * @param  input_len Length of the input plain text in bytes, must be a multiple
+ *                   of 16
+ * @param  key       Encryption key
+ * @param  key_len   Encryption key length in bytes (16, 24, 32)
+ * @param  mode      AES cipher mode @see crypto_mode.
+ * @return Length of the output cipher text in bytes, -1 in case of error
+ */
+int aes_encrypt_message(unsigned char *output, const unsigned char *iv,
+                        const unsigned char *input, int input_len,
+                        const unsigned char *key, int key_len,
+                        crypto_mode_t mode);
+
+/**
+ * Decrypt an entire message using the fast C model.
+ *
+ * Uses the same interface as crypto_decrypt() such that both implementations
+ * can be used interchangeably.
+ *
+ * @param  output    Output plain text, must be a multiple of 16 bytes
+ * @param  iv        16-byte initialization vector
+ * @param  input     Input cipher text to decode, must be a multiple of 16 bytes
+ * @param  input_len Length of the input cipher text in bytes, must be a
+ *                   multiple of 16
+ * @param  key       Encryption key, decryption key is derived internally
+ * @param  key_len   Encryption key length in bytes (16, 24, 32)
+ * @param  mode      AES cipher mode @see crypto_mode.
+ * @return Length of the output plain text in bytes, -1 in case of error
+ */
+int aes_decrypt_message(unsigned char *output, const unsigned char *iv,
+                        const unsigned char *input, int input_len,
+                        const unsigned char *key, int key_len,
+                        crypto_mode_t mode);
+
 /**
  * Print block of data in readable format to stdout
  *
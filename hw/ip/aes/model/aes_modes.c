@@ -118,6 +118,68 @@ static int crypto_compare(const unsigned char *cipher_text,
   return 0;
 }
 
+static int model_compare(const unsigned char *cipher_text,
+                         const unsigned char *iv,
+                         const unsigned char *plain_text, int len,
+                         const unsigned char *key, int key_len,
+                         crypto_mode_t mode) {
+  int ret_len;
+  int ret = 0;
+
+  unsigned char *data_out = (unsigned char *)malloc(len * sizeof(unsigned char));
+  if (data_out == NULL) {
+    printf("ERROR: malloc() failed\n");
+    return 1;
+  }
+
+  // Enc
+  ret_len = aes_encrypt_message(data_out, iv, plain_text, len, key, key_len,
+                                mode);
+  if (ret_len != len) {
+    printf("ERROR: ret_len = %i, expected %i. Aborting now\n", ret_len, len);
+    ret = 1;
+  } else {
+    for (int j = 0; j < len / 16; ++j) {
+      if (check_block(&data_out[j * 16], &cipher_text[j * 16], 1)) {
+        printf("ERROR: C model encrypt output does not match NIST example "
+               "cipher text\n");
+        ret = 1;
+        break;
+      }
+    }
+  }
+  if (!ret) {
+    printf("SUCCESS: C model encrypt output matches NIST example cipher text\n");
+  }
+
+  // Dec
+  if (!ret) {
+    ret_len = aes_decrypt_message(data_out, iv, cipher_text, len, key,
+                                  key_len, mode);
+    if (ret_len != len) {
+      printf("ERROR: ret_len = %i, expected %i. Aborting now\n", ret_len, len);
+      ret = 1;
+    } else {
+      for (int j = 0; j < len / 16; ++j) {
+        if (check_block(&data_out[j * 16], &plain_text[j * 16], 1)) {
+          printf("ERROR: C model decrypt output does not match NIST example "
+                 "plain text\n");
+          ret = 1;
+          break;
+        }
+      }
+    }
+    if (!ret) {
+      printf(
+          "SUCCESS: C model decrypt output matches NIST example plain text\n");
+    }
+  }
+
+  free(data_out);
+
+  return ret;
+}
+
 int main(int argc, char *argv[]) {
   const int len = 64;
   int key_len;
@@ -154,6 +216,10 @@ int main(int argc, char *argv[]) {
                        mode)) {
       return 1;
     }
+    if (model_compare(cipher_text, iv, kAesModesPlainText, len, key, key_len,
+                      mode)) {
+      return 1;
+    }
   }
 
   /////////
@@ -184,6 +250,10 @@ int main(int argc, char *argv[]) {
                        mode)) {
       return 1;
     }
+    if (model_compare(cipher_text, iv, kAesModesPlainText, len, key, key_len,
+                      mode)) {
+      return 1;
+    }
   }
 
   /////////
@@ -215,6 +285,10 @@ int main(int argc, char *argv[]) {
                        mode)) {
       return 1;
     }
+    if (model_compare(cipher_text, iv, kAesModesPlainText, len, key, key_len,
+                      mode)) {
+      return 1;
+    }
   }
 
   /////////
@@ -245,6 +319,10 @@ int main(int argc, char *argv[]) {
                        mode)) {
       return 1;
     }
+    if (model_compare(cipher_text, iv, kAesModesPlainText, len, key, key_len,
+                      mode)) {
+      return 1;
+    }
   }
 
   /////////
@@ -275,6 +353,10 @@ int main(int argc, char *argv[]) {
                        mode)) {
       return 1;
     }
+    if (model_compare(cipher_text, iv, kAesModesPlainText, len, key, key_len,
+                      mode)) {
+      return 1;
+    }
   }
 
   return 0;
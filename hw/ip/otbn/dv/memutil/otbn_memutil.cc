@@ -6,6 +6,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <fstream>
 #include <gelf.h>
 #include <iostream>
 #include <libelf.h>
@@ -71,6 +72,77 @@ void OtbnMemUtil::OnElfLoaded(Elf *elf_file) {
     }
     break;
   }
+
+  // Add any warps from a loop warp table on top of the ones from symbols.
+  for (const auto &warp : table_loop_warp_) {
+    AddLoopWarp(warp.first.first, warp.first.second, warp.second);
+  }
+}
+
+void OtbnMemUtil::LoadLoopWarpTable(const std::string &table_path) {
+  std::ifstream table(table_path);
+  if (!table) {
+    std::ostringstream oss;
+    oss << "Cannot open loop warp table at `" << table_path << "'.";
+    throw std::runtime_error(oss.str());
+  }
+
+  // Each line is "0xADDR FROM TO", where FROM and TO are decimal. Anything
+  // after a '#' is a comment.
+  std::regex line_re(
+      "\\s*0[xX]([0-9a-fA-F]+)\\s+([0-9]+)\\s+([0-9]+)\\s*");
+
+  LoopWarps new_warps;
+  std::string line;
+  for (int lineno = 1; std::getline(table, line); ++lineno) {
+    line = line.substr(0, line.find('#'));
+    if (line.find_first_not_of(" \t\r") == std::string::npos)
+      continue;
+
+    std::smatch match;
+    bool good = std::regex_match(line, match, line_re);
+
+    unsigned long addr = 0, from_cnt = 0, to_cnt = 0;
+    if (good) {
+      errno = 0;
+      addr = strtoul(match[1].str().c_str(), nullptr, 16);
+      from_cnt = strtoul(match[2].str().c_str(), nullptr, 10);
+      to_cnt = strtoul(match[3].str().c_str(), nullptr, 10);
+      good = (errno == 0) && (addr % 4 == 0) && (from_cnt <= to_cnt) &&
+             (addr <= std::numeric_limits<uint32_t>::max()) &&
+             (to_cnt <= std::numeric_limits<uint32_t>::max());
+    }
+
+    if (good) {
+      auto key = std::make_pair((uint32_t)addr, (uint32_t)from_cnt);
+      good = new_warps.insert(std::make_pair(key, (uint32_t)to_cnt)).second;
+    }
+
+    if (!good) {
+      std::ostringstream oss;
+      oss << "Invalid or duplicate loop warp on line " << lineno << " of `"
+          << table_path << "': `" << line << "'.";
+      throw std::runtime_error(oss.str());
+    }
+  }
+
+  // Check for clashes with the warps we already have before changing
+  // anything, so that a bad table leaves us as we were.
+  for (const auto &warp : new_warps) {
+    if (loop_warp_.count(warp.first) || table_loop_warp_.count(warp.first)) {
+      std::ostringstream oss;
+      oss << "Loop warp table at `" << table_path
+          << "' has a warp for address 0x" << std::hex << warp.first.first
+          << " and initial count " << std::dec << warp.first.second
+          << ", which is already defined.";
+      throw std::runtime_error(oss.str());
+    }
+  }
+
+  for (const auto &warp : new_warps) {
+    AddLoopWarp(warp.first.first, warp.first.second, warp.second);
+    table_loop_warp_.insert(warp);
+  }
 }
 
 void OtbnMemUtil::OnSymbol(const std::string &name, uint32_t value) {
@@ -290,6 +362,19 @@ svBit OtbnMemUtilGetLoopWarp(OtbnMemUtil *mem_util,
   return to32 != from32;
 }
 
+svBit OtbnMemUtilLoadLoopWarpTable(OtbnMemUtil *mem_util,
+                                   const char *table_path) {
+  assert(mem_util);
+  assert(table_path);
+  try {
+    mem_util->LoadLoopWarpTable(table_path);
+    return sv_1;
+  } catch (const std::exception &err) {
+    std::cerr << "Failed to load loop warp table: " << err.what() << "\n";
+    return sv_0;
+  }
+}
+
 int OtbnMemUtilGetNumLoopWarps(OtbnMemUtil *mem_util) {
   assert(mem_util);
 
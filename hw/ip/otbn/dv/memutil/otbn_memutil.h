@@ -43,6 +43,14 @@ class OtbnMemUtil : public DpiMemUtil {
   // Read-only access to the table of loop warps
   const LoopWarps &GetLoopWarps() const { return loop_warp_; }
 
+  // Read a loop warp table from the file at the given path (see
+  // otbnsim/sim/loop_profile.py for the format, which is what the ISS
+  // writes when run with --find-loop-warps). The warps are added to those
+  // defined by symbols in the ELF file and are kept across ELF loads.
+  //
+  // If something goes wrong, throws a std::exception.
+  void LoadLoopWarpTable(const std::string &table_path);
+
  private:
   void OnElfLoaded(Elf *elf_file) override;
 
@@ -55,6 +63,10 @@ class OtbnMemUtil : public DpiMemUtil {
   ScrambledEcc32MemArea imem_, dmem_;
   int expected_end_addr_;
   LoopWarps loop_warp_;
+
+  // Loop warps read by LoadLoopWarpTable. These get merged into loop_warp_
+  // each time we load an ELF file.
+  LoopWarps table_loop_warp_;
 };
 
 // DPI-accessible wrappers
@@ -115,6 +127,11 @@ svBit OtbnMemUtilGetLoopWarp(OtbnMemUtil *mem_util,
                              /* bit [31:0] */ const svBitVecVal *from_cnt,
                              /* output bit [31:0] */ svBitVecVal *to_cnt);
 
+// Read a loop warp table and add its warps to those from ELF symbols. Returns
+// 1'b1 on success. Prints a message to stderr and returns 1'b0 on failure.
+svBit OtbnMemUtilLoadLoopWarpTable(OtbnMemUtil *mem_util,
+                                   const char *table_path);
+
 // Get the number of loop warps
 int OtbnMemUtilGetNumLoopWarps(OtbnMemUtil *mem_util);
 
@@ -31,6 +31,8 @@ package otbn_memutil_pkg;
                                                      bit [31:0]        from_cnt,
                                                      output bit [31:0] to_cnt);
 
+  import "DPI-C" function bit OtbnMemUtilLoadLoopWarpTable(chandle mem_util, string table_path);
+
   import "DPI-C" function int OtbnMemUtilGetNumLoopWarps(chandle mem_util);
 
   import "DPI-C" function void OtbnMemUtilGetLoopWarpByIndex(chandle           mem_util,
@@ -7,6 +7,7 @@
 #include <cassert>
 #include <cstring>
 #include <fcntl.h>
+#include <fstream>
 #include <ftw.h>
 #include <iomanip>
 #include <iostream>
@@ -623,6 +624,58 @@ void ISSWrapper::get_regs(std::array<uint32_t, 32> *gprs,
   }
 }
 
+void ISSWrapper::get_dirty_regs(uint32_t req_gpr_mask, uint32_t req_wdr_mask,
+                                uint32_t *gpr_mask, uint32_t *wdr_mask,
+                                std::array<uint32_t, 32> *gprs,
+                                std::array<u256_t, 32> *wdrs) {
+  assert(gpr_mask && wdr_mask && gprs && wdrs);
+
+  std::string path(make_tmp_path("dirty_regs"));
+
+  std::ostringstream oss;
+  oss << "dump_dirty_regs " << path << " 0x" << std::hex << req_gpr_mask
+      << " 0x" << req_wdr_mask << "\n";
+  run_command(oss.str(), nullptr);
+
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  if (!in) {
+    std::ostringstream err;
+    err << "Cannot open the file '" << path << "'.";
+    throw std::runtime_error(err.str());
+  }
+
+  // Read a little-endian 32-bit word from the file
+  auto read_u32 = [&in, &path]() -> uint32_t {
+    uint8_t bytes[4];
+    if (!in.read(reinterpret_cast<char *>(bytes), 4)) {
+      std::ostringstream err;
+      err << "Unexpected end of file when reading registers from " << path
+          << ".";
+      throw std::runtime_error(err.str());
+    }
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) |
+           ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+  };
+
+  *gpr_mask = read_u32();
+  *wdr_mask = read_u32();
+
+  uint32_t gpr_dump_mask = *gpr_mask | req_gpr_mask;
+  uint32_t wdr_dump_mask = *wdr_mask | req_wdr_mask;
+
+  for (int i = 0; i < 32; ++i) {
+    if ((gpr_dump_mask >> i) & 1)
+      (*gprs)[i] = read_u32();
+  }
+  for (int i = 0; i < 32; ++i) {
+    if ((wdr_dump_mask >> i) & 1) {
+      for (int j = 0; j < 8; ++j) {
+        (*wdrs)[i].words[j] = read_u32();
+      }
+    }
+  }
+}
+
 std::vector<uint32_t> ISSWrapper::get_call_stack() {
   std::vector<std::string> lines;
   run_command("print_call_stack\n", &lines);
@@ -146,6 +146,16 @@ struct ISSWrapper {
   // Read contents of the register file
   void get_regs(std::array<uint32_t, 32> *gprs, std::array<u256_t, 32> *wdrs);
 
+  // Read the registers that have been written since the start of the current
+  // operation, transferring them in binary form. On return, *gpr_mask and
+  // *wdr_mask hold bitmasks of the written registers. The values of these
+  // registers, plus those of any registers in req_gpr_mask / req_wdr_mask, are
+  // written to gprs and wdrs. Other entries are left unchanged.
+  void get_dirty_regs(uint32_t req_gpr_mask, uint32_t req_wdr_mask,
+                      uint32_t *gpr_mask, uint32_t *wdr_mask,
+                      std::array<uint32_t, 32> *gprs,
+                      std::array<u256_t, 32> *wdrs);
+
   // Read the contents of the call stack
   std::vector<uint32_t> get_call_stack();
 
@@ -66,6 +66,12 @@ module otbn_core_model
   initial begin
     model_handle = otbn_model_init(MemScope, DesignScope);
     assert(model_handle != null);
+
+    // By default, the end-of-operation check only compares registers that were modified. Pass
+    // +otbn_full_reg_check to compare all of them.
+    if ($test$plusargs("otbn_full_reg_check")) begin
+      void'(otbn_set_full_reg_check(model_handle, 1'b1));
+    end
   end
   final begin
     otbn_model_destroy(model_handle);
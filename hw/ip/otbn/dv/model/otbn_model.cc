@@ -20,6 +20,8 @@
 
 extern "C" {
 int otbn_rf_peek(int index, svBitVecVal *val);
+int otbn_rf_snapshot();
+int otbn_rf_dirty_mask(svBitVecVal *mask);
 int otbn_stack_element_peek(int index, svBitVecVal *val);
 }
 
@@ -119,9 +121,12 @@ static void write_words_to_file(const std::string &path,
   }
 }
 
+// Peek the registers whose bits are set in mask from the RTL register file at
+// reg_scope. Other entries of the returned array are zero.
 template <typename T>
-static std::array<T, 32> get_rtl_regs(const std::string &reg_scope) {
-  std::array<T, 32> ret;
+static std::array<T, 32> get_rtl_regs(const std::string &reg_scope,
+                                      uint32_t mask = UINT32_MAX) {
+  std::array<T, 32> ret = {};
   static_assert(sizeof(T) <= 256 / 8, "Can only copy 256 bits");
 
   SVScoped scoped(reg_scope);
@@ -132,6 +137,9 @@ static std::array<T, 32> get_rtl_regs(const std::string &reg_scope) {
   svBitVecVal buf[256 / 8 / sizeof(svBitVecVal)];
 
   for (int i = 0; i < 32; ++i) {
+    if (!((mask >> i) & 1))
+      continue;
+
     if (!otbn_rf_peek(i, buf)) {
       std::ostringstream oss;
       oss << "Failed to peek into RTL to get value of register " << i
@@ -144,6 +152,30 @@ static std::array<T, 32> get_rtl_regs(const std::string &reg_scope) {
   return ret;
 }
 
+// Take a snapshot of the RTL register file at reg_scope. A later call to
+// get_rtl_dirty_mask() reports the registers that changed since then.
+static void snapshot_rtl_regs(const std::string &reg_scope) {
+  SVScoped scoped(reg_scope);
+  otbn_rf_snapshot();
+}
+
+// Get a bitmask of the registers in the RTL register file at reg_scope that
+// changed since the last call to snapshot_rtl_regs(). If there was no such
+// call, all registers are reported as changed.
+static uint32_t get_rtl_dirty_mask(const std::string &reg_scope) {
+  SVScoped scoped(reg_scope);
+
+  svBitVecVal mask;
+  if (!otbn_rf_dirty_mask(&mask)) {
+    std::ostringstream oss;
+    oss << "Failed to get modified registers from RTL at scope `" << reg_scope
+        << "'.";
+    throw std::runtime_error(oss.str());
+  }
+
+  return mask;
+}
+
 template <typename T>
 static std::vector<T> get_stack(const std::string &stack_scope) {
   std::vector<T> ret;
@@ -264,6 +296,13 @@ int OtbnModel::start_operation(command_t command) {
     }
 
     iss->start_operation(iss_command);
+
+    // The ISS tracks the registers written since the start of an execution.
+    // Do the same in the RTL, so that check_regs() only has to look at those.
+    if (command == Execute && has_rtl() && !full_reg_check_) {
+      snapshot_rtl_regs(rf_base_scope());
+      snapshot_rtl_regs(rf_bignum_scope());
+    }
   } catch (const std::runtime_error &err) {
     std::cerr << "Error when starting " << cmd_desc
               << " operation: " << err.what() << "\n";
@@ -571,6 +610,11 @@ int OtbnModel::disable_stack_check() {
   return 0;
 }
 
+int OtbnModel::set_full_reg_check(bool enable) {
+  full_reg_check_ = enable;
+  return 0;
+}
+
 int OtbnModel::step_crc(const svBitVecVal *item /* bit [47:0] */,
                         svBitVecVal *state /* bit [31:0] */) {
   ISSWrapper *iss = ensure_wrapper();
@@ -748,26 +792,49 @@ bool OtbnModel::check_dmem(ISSWrapper &iss) const {
   return bad_count == 0;
 }
 
-bool OtbnModel::check_regs(ISSWrapper &iss) const {
-  std::string base_scope =
-      design_scope_ +
-      ".u_otbn_rf_base.gen_rf_base_ff.u_otbn_rf_base_inner.u_snooper";
-  std::string wide_scope =
-      design_scope_ +
-      ".u_otbn_rf_bignum.gen_rf_bignum_ff.u_otbn_rf_bignum_inner.u_snooper";
+std::string OtbnModel::rf_base_scope() const {
+  return design_scope_ +
+         ".u_otbn_rf_base.gen_rf_base_ff.u_otbn_rf_base_inner.u_snooper";
+}
+
+std::string OtbnModel::rf_bignum_scope() const {
+  return design_scope_ +
+         ".u_otbn_rf_bignum.gen_rf_bignum_ff.u_otbn_rf_bignum_inner.u_snooper";
+}
 
-  auto rtl_gprs = get_rtl_regs<uint32_t>(base_scope);
-  auto rtl_wdrs = get_rtl_regs<ISSWrapper::u256_t>(wide_scope);
+bool OtbnModel::check_regs(ISSWrapper &iss) const {
+  std::string base_scope = rf_base_scope();
+  std::string wide_scope = rf_bignum_scope();
+
+  std::array<uint32_t, 32> iss_gprs = {};
+  std::array<ISSWrapper::u256_t, 32> iss_wdrs = {};
+
+  // Masks of the registers that we compare
+  uint32_t gpr_mask = UINT32_MAX, wdr_mask = UINT32_MAX;
+
+  if (full_reg_check_) {
+    iss.get_regs(&iss_gprs, &iss_wdrs);
+  } else {
+    // Only compare registers that have been modified by the RTL or the ISS
+    // since the start of the operation. The ISS sends the values of the ones
+    // it modified anyway and we ask it for the ones only the RTL modified.
+    uint32_t rtl_gpr_mask = get_rtl_dirty_mask(base_scope);
+    uint32_t rtl_wdr_mask = get_rtl_dirty_mask(wide_scope);
+    uint32_t iss_gpr_mask, iss_wdr_mask;
+    iss.get_dirty_regs(rtl_gpr_mask, rtl_wdr_mask, &iss_gpr_mask,
+                       &iss_wdr_mask, &iss_gprs, &iss_wdrs);
+    gpr_mask = rtl_gpr_mask | iss_gpr_mask;
+    wdr_mask = rtl_wdr_mask | iss_wdr_mask;
+  }
 
-  std::array<uint32_t, 32> iss_gprs;
-  std::array<ISSWrapper::u256_t, 32> iss_wdrs;
-  iss.get_regs(&iss_gprs, &iss_wdrs);
+  auto rtl_gprs = get_rtl_regs<uint32_t>(base_scope, gpr_mask);
+  auto rtl_wdrs = get_rtl_regs<ISSWrapper::u256_t>(wide_scope, wdr_mask);
 
   bool good = true;
 
   for (int i = 0; i < 32; ++i) {
     // Register index 1 is call stack, which is checked separately
-    if (i == 1)
+    if (i == 1 || !((gpr_mask >> i) & 1))
       continue;
 
     if (rtl_gprs[i] != iss_gprs[i]) {
@@ -781,6 +848,9 @@ bool OtbnModel::check_regs(ISSWrapper &iss) const {
     }
   }
   for (int i = 0; i < 32; ++i) {
+    if (!((wdr_mask >> i) & 1))
+      continue;
+
     if (0 != memcmp(rtl_wdrs[i].words, iss_wdrs[i].words,
                     sizeof(rtl_wdrs[i].words))) {
       std::ios old_state(nullptr);
@@ -1039,6 +1109,11 @@ int otbn_disable_stack_check(OtbnModel *model) {
   return model->disable_stack_check();
 }
 
+int otbn_set_full_reg_check(OtbnModel *model, svBit enable) {
+  assert(model);
+  return model->set_full_reg_check(enable != 0);
+}
+
 int otbn_model_step_crc(OtbnModel *model, svBitVecVal *item /* bit [47:0] */,
                         svBitVecVal *state /* inout bit [31:0] */) {
   assert(model && item && state);
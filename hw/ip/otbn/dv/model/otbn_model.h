@@ -129,6 +129,11 @@ class OtbnModel {
   // Disable stack integrity checks
   int disable_stack_check();
 
+  // If enable is true, compare all registers at the end of an operation.
+  // Otherwise (the default), only compare registers that the ISS or the RTL
+  // modified since the start of the operation.
+  int set_full_reg_check(bool enable);
+
  private:
   // Constructs an ISS wrapper if necessary. If something goes wrong, this
   // function prints a message and then returns null. If ensure is true, it
@@ -147,6 +152,10 @@ class OtbnModel {
   // on mismatch. Throws a std::runtime_error on failure.
   bool check_dmem(ISSWrapper &iss) const;
 
+  // Scopes of the register file snoopers in the design
+  std::string rf_base_scope() const;
+  std::string rf_bignum_scope() const;
+
   // Compare contents of ISS registers with those from the design. Prints
   // messages to stderr on failure or mismatch. Returns true on success; false
   // on mismatch. Throws a std::runtime_error on failure.
@@ -167,6 +176,7 @@ class OtbnModel {
   std::string design_scope_;
 
   bool stack_check_enabled_ = true;
+  bool full_reg_check_ = false;
 };
 
 #endif  // OPENTITAN_HW_IP_OTBN_DV_MODEL_OTBN_MODEL_H_
@@ -119,6 +119,10 @@ int otbn_set_no_sec_wipe_chk(OtbnModel *model);
 // Disable stack integrity checks
 int otbn_disable_stack_check(OtbnModel *model);
 
+// Compare all registers at the end of an operation (if enable is set) rather
+// than just the ones that were modified.
+int otbn_set_full_reg_check(OtbnModel *model, svBit enable);
+
 // Step the CRC calculation for item
 //
 // state is an inout parameter and should be updated in-place. This is
@@ -3,7 +3,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 // Backdoor interface that can be bound into an OTBN register file and exports a function to peek at
-// the memory contents.
+// the memory contents. It also exports functions to take a snapshot of the register file and to get
+// a bitmap of the registers that changed since then, which the model uses to limit its
+// end-of-operation checks to modified registers.
 
 `ifndef SYNTHESIS
 interface otbn_rf_snooper_if #(
@@ -15,6 +17,8 @@ interface otbn_rf_snooper_if #(
 );
 
   export "DPI-C" function otbn_rf_peek;
+  export "DPI-C" function otbn_rf_snapshot;
+  export "DPI-C" function otbn_rf_dirty_mask;
 
   // Number of data bits per integrity code
   localparam int IntgGranule = IntegrityEnabled ? 32 : Width;
@@ -43,5 +47,30 @@ interface otbn_rf_snooper_if #(
     return 1;
   endfunction
 
+  // Register file contents at the last call to otbn_rf_snapshot
+  logic [Width-1:0] rf_snapshot [Depth];
+
+  function automatic int otbn_rf_snapshot();
+    for (int i = 0; i < Depth; ++i) begin
+      rf_snapshot[i] = rf[i];
+    end
+    return 1;
+  endfunction
+
+  // Set bit i of mask if register i differs from its value at the last call to otbn_rf_snapshot.
+  function automatic int otbn_rf_dirty_mask(output bit [31:0] mask);
+    // Function only works for register files with 32 registers or fewer
+    if (Depth > 32) begin
+      return 0;
+    end
+
+    mask = '0;
+    for (int i = 0; i < Depth; ++i) begin
+      mask[i] = rf[i] !== rf_snapshot[i];
+    end
+
+    return 1;
+  endfunction
+
 endinterface
 `endif // SYNTHESIS
@@ -0,0 +1,194 @@
+# Copyright lowRISC contributors (OpenTitan project).
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+
+'''Automatic discovery of loop warps
+
+Long-running OTBN programs spend most of their simulated time running the
+same loop bodies over and over again. A loop warp (see sim.py) lets a
+simulation skip loop iterations by jumping the loop counter forward. Both the
+ISS and the RTL simulation apply the same warps, so their end states still
+agree even though the program computes something different.
+
+LoopProfiler watches an execution of a program in the ISS and finds the loops
+that are safe to warp: those that always run the same number of iterations
+and whose bodies have no externally visible side effects (no DMEM writes, no
+requests to the EDN and no ECALL or error). The warps that it finds can be written
+out as a loop warp table, which is understood by the --loop-warps argument of
+standalone.py and by OtbnMemUtil (see otbn_memutil.h).
+
+A loop warp table is a text file with one warp per line, of the form
+
+  ADDR FROM TO
+
+where ADDR is the address of the first instruction of a loop body (in hex,
+with a leading 0x) and FROM and TO are decimal iteration counts. Anything
+after a '#' is a comment.
+
+'''
+
+from typing import Dict, List, Set, TextIO
+
+from .insn import BNWSRR, CSRRS, CSRRW, ECALL, LOOP, LOOPI
+from .isa import OTBNInsn
+from .state import OTBNState
+
+# Loop warps, in the format of sim.LoopWarps. This is spelled out here rather
+# than imported to avoid a circular dependency.
+LoopWarps = Dict[int, Dict[int, int]]
+
+# CSR indices whose access causes an EDN request (RND_PREFETCH and RND)
+_RND_CSRS = [0x7d8, 0xfc0]
+
+# The WSR index of RND
+_RND_WSR = 0x1
+
+
+class _LoopInfo:
+    '''What we have seen of the executions of one loop'''
+    def __init__(self, start_addr: int, iterations: int) -> None:
+        self.start_addr = start_addr
+        self.iterations: Set[int] = {iterations}
+        self.executions = 0
+        self.has_side_effects = False
+
+
+def _insn_requests_entropy(insn: OTBNInsn) -> bool:
+    '''Does insn read from (or prefetch) RND?'''
+    if isinstance(insn, (CSRRS, CSRRW)):
+        return insn.csr in _RND_CSRS
+    if isinstance(insn, BNWSRR):
+        return insn.wsr == _RND_WSR
+    return False
+
+
+class LoopProfiler:
+    def __init__(self, program: List[OTBNInsn]) -> None:
+        self.program = program
+
+        # Loops that we've seen, keyed by the address of the LOOP or LOOPI
+        # instruction.
+        self._loops: Dict[int, _LoopInfo] = {}
+
+    def _mark_active_loops(self, state: OTBNState) -> None:
+        '''Mark all loops on the loop stack as having side effects'''
+        for level in state.loop_stack.stack:
+            info = self._loops.get(level.get_loop_insn_addr())
+            if info is not None:
+                info.has_side_effects = True
+
+    def record_insn(self, insn: OTBNInsn, state_bc: OTBNState) -> None:
+        '''Record the execution of an instruction.
+
+        insn is the currently executed instruction. state_bc is the state of
+        OTBN before the instruction is committed.
+
+        '''
+        pc = state_bc.pc
+
+        if isinstance(insn, (LOOP, LOOPI)):
+            assert state_bc.in_loop()
+            level = state_bc.loop_stack.stack[-1]
+            info = self._loops.get(pc)
+            if info is None:
+                info = _LoopInfo(level.start_addr, level.loop_count)
+                self._loops[pc] = info
+            else:
+                info.iterations.add(level.loop_count)
+            info.executions += 1
+
+        side_effects = (bool(state_bc.dmem.changes()) or
+                        isinstance(insn, ECALL) or
+                        _insn_requests_entropy(insn) or
+                        state_bc.pending_halt)
+        if side_effects:
+            self._mark_active_loops(state_bc)
+
+    def finish(self, state: OTBNState) -> None:
+        '''Called at the end of the execution.
+
+        Any loop that is still running at this point stopped early (probably
+        because of an error), so isn't a candidate for warping.
+
+        '''
+        self._mark_active_loops(state)
+
+    def get_warps(self, keep: int = 2) -> LoopWarps:
+        '''Return warps for the loops that can be skipped.
+
+        Each warped loop still runs its first keep iterations and its last
+        iteration. Loops that would not get any shorter are ignored.
+
+        '''
+        assert keep >= 1
+        warps: LoopWarps = {}
+        for info in self._loops.values():
+            if info.has_side_effects or len(info.iterations) != 1:
+                continue
+
+            # A warp applies to the innermost loop when the instruction at
+            # its address retires. If the loop body starts with another loop
+            # instruction, the innermost loop at that point is the new inner
+            # loop, so we can't warp the outer one.
+            first_insn = self.program[info.start_addr >> 2]
+            if isinstance(first_insn, (LOOP, LOOPI)):
+                continue
+
+            iterations = next(iter(info.iterations))
+
+            # Warp from the last kept iteration to the penultimate iteration.
+            # The loop then runs one more (final) iteration.
+            from_cnt = keep - 1
+            to_cnt = iterations - 2
+            if to_cnt <= from_cnt:
+                continue
+
+            warps.setdefault(info.start_addr, {})[from_cnt] = to_cnt
+
+        return warps
+
+    def dump_warps(self, keep: int = 2) -> str:
+        '''Render the result of get_warps as a loop warp table'''
+        lines = ['# Loop warp table: ADDR FROM TO']
+        for addr, addr_warps in sorted(self.get_warps(keep).items()):
+            info = self._loops[addr - 4]
+            for from_cnt, to_cnt in sorted(addr_warps.items()):
+                lines.append('{:#x} {} {}  # {} iterations, {} executions'
+                             .format(addr, from_cnt, to_cnt,
+                                     next(iter(info.iterations)),
+                                     info.executions))
+        return '\n'.join(lines) + '\n'
+
+
+def read_loop_warp_table(table: TextIO) -> LoopWarps:
+    '''Parse a loop warp table, as written by LoopProfiler.dump_warps.'''
+    warps: LoopWarps = {}
+    for lineno, line in enumerate(table, 1):
+        line = line.split('#', 1)[0].strip()
+        if not line:
+            continue
+
+        parts = line.split()
+        try:
+            if len(parts) != 3 or not parts[0].lower().startswith('0x'):
+                raise ValueError()
+            addr = int(parts[0], 16)
+            from_cnt = int(parts[1], 10)
+            to_cnt = int(parts[2], 10)
+        except ValueError:
+            raise ValueError('Line {} of loop warp table is not of the form '
+                             '"0xADDR FROM TO": {!r}'
+                             .format(lineno, line)) from None
+
+        if addr < 0 or addr & 3 or from_cnt < 0 or to_cnt < from_cnt:
+            raise ValueError('Invalid loop warp on line {} of loop warp '
+                             'table: {!r}'.format(lineno, line))
+
+        addr_warps = warps.setdefault(addr, {})
+        if from_cnt in addr_warps:
+            raise ValueError('Duplicate loop warp for address {:#x} and '
+                             'initial count {} on line {} of loop warp table.'
+                             .format(addr, from_cnt, lineno))
+        addr_warps[from_cnt] = to_cnt
+
+    return warps
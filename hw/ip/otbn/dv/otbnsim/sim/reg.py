@@ -100,6 +100,10 @@ class RegFile:
         self._width = width
         self._registers = [Reg(self, i, width, 0) for i in range(depth)]
         self._pending_writes: Set[int] = set()
+        # Registers that have had a write committed since the last call to
+        # clear_dirty(). This lets the DV model limit its end-of-operation
+        # comparison to registers that might have changed.
+        self._dirty: Set[int] = set()
 
     def mark_written(self, idx: int) -> None:
         '''Mark a register as having been written'''
@@ -124,6 +128,7 @@ class RegFile:
         for idx in self._pending_writes:
             assert 0 <= idx < len(self._registers)
             self._registers[idx].commit()
+        self._dirty.update(self._pending_writes)
         self._pending_writes.clear()
 
     def abort(self) -> None:
@@ -132,6 +137,17 @@ class RegFile:
             self._registers[idx].abort()
         self._pending_writes.clear()
 
+    def clear_dirty(self) -> None:
+        '''Forget which registers have been written'''
+        self._dirty.clear()
+
+    def dirty_mask(self) -> int:
+        '''Get a bitmask of the registers written since clear_dirty()'''
+        mask = 0
+        for idx in self._dirty:
+            mask |= 1 << idx
+        return mask
+
     def peek_unsigned_values(self) -> List[int]:
         '''Get a list of the (unsigned) values of the registers'''
         return [reg.read_unsigned(backdoor=True) for reg in self._registers]
@@ -7,6 +7,7 @@ from typing import Dict, Iterator, List, Optional, Tuple
 from .constants import ErrBits, LcTx, Status, read_lc_tx_t
 from .decode import EmptyInsn
 from .isa import OTBNInsn
+from .loop_profile import LoopProfiler
 from .state import OTBNState, FsmState
 from .stats import ExecutionStats
 from .trace import Trace
@@ -28,6 +29,7 @@ class OTBNSim:
         self.program: List[OTBNInsn] = []
         self.loop_warps: LoopWarps = {}
         self.stats: Optional[ExecutionStats] = None
+        self.loop_profiler: Optional[LoopProfiler] = None
         self.symbols: Dict[str, int] = {}
         self._execute_generator: Optional[Iterator[None]] = None
         self._next_insn: Optional[OTBNInsn] = None
@@ -52,13 +54,17 @@ class OTBNSim:
         '''
         self.state.dmem.load_le_words(data, has_validity, word_offset=0)
 
-    def start(self, collect_stats: bool) -> None:
+    def start(self, collect_stats: bool, profile_loops: bool = False) -> None:
         '''Prepare to start the execution.
 
-        Use run() or step() to actually execute the program.
+        Use run() or step() to actually execute the program. If profile_loops
+        is true, watch the execution for loops that could be warped (see
+        loop_profile.py).
 
         '''
         self.stats = ExecutionStats(self.program) if collect_stats else None
+        self.loop_profiler = (LoopProfiler(self.program)
+                              if profile_loops else None)
         self._execute_generator = None
         self._next_insn = None
         self.state.start()
@@ -119,6 +125,8 @@ class OTBNSim:
 
         if self.stats is not None:
             self.stats.record_insn(insn, self.state)
+        if self.loop_profiler is not None:
+            self.loop_profiler.record_insn(insn, self.state)
 
         halting = self.state.stop_if_pending_halt()
         changes = self.state.changes()
@@ -367,6 +367,8 @@ class OTBNState:
         self.wsrs.on_start()
         self.loop_stack = LoopStack()
         self.gprs.empty_call_stack()
+        self.gprs.clear_dirty()
+        self.wdrs.clear_dirty()
 
         # Poison the requester so that we'll discard the rest of any in-flight
         # request.
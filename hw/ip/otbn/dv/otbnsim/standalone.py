@@ -8,6 +8,7 @@ import os
 import sys
 
 from sim.load_elf import load_elf
+from sim.loop_profile import read_loop_warp_table
 from sim.standalonesim import StandaloneSim
 from sim.stats import ExecutionStatAnalyzer
 from shared.testcase import OtbnTestCase
@@ -45,6 +46,22 @@ def main() -> int:
               "Use '-' to write to STDOUT.")
     )
 
+    parser.add_argument(
+        '--loop-warps',
+        metavar="FILE",
+        type=argparse.FileType('r'),
+        help=("apply the loop warps in this loop warp table (as written by "
+              "--find-loop-warps) on top of any in the ELF file.")
+    )
+    parser.add_argument(
+        '--find-loop-warps',
+        metavar="FILE",
+        type=argparse.FileType('w'),
+        help=("after execution, write a loop warp table for the loops that "
+              "can be skipped without externally visible side effects to "
+              "this file. Use '-' to write to STDOUT.")
+    )
+
     args = parser.parse_args()
 
     collect_stats = args.dump_stats is not None
@@ -57,6 +74,23 @@ def main() -> int:
     sim = StandaloneSim()
     exp_end_addr = load_elf(sim, args.elf)
 
+    if args.loop_warps:
+        try:
+            table_warps = read_loop_warp_table(args.loop_warps)
+        except ValueError as err:
+            print('Failed to read loop warp table: {}'.format(err),
+                  file=sys.stderr)
+            return 1
+        for addr, addr_warps in table_warps.items():
+            for from_cnt, to_cnt in addr_warps.items():
+                if from_cnt in sim.loop_warps.get(addr, {}):
+                    print('Loop warp table entry for address {:#x} and '
+                          'initial count {} clashes with a loop warp symbol '
+                          'in the ELF file.'.format(addr, from_cnt),
+                          file=sys.stderr)
+                    return 1
+                sim.add_loop_warp(addr, from_cnt, to_cnt)
+
     testcase = None
     if args.testcase:
         testcase = OtbnTestCase.from_hjson(args.testcase.read(), sim.symbols)
@@ -71,7 +105,7 @@ def main() -> int:
 
     sim.state.ext_regs.commit()
 
-    sim.start(collect_stats)
+    sim.start(collect_stats, profile_loops=args.find_loop_warps is not None)
 
     if testcase and testcase.entrypoint:
         sim.state.pc = testcase.entrypoint
@@ -85,6 +119,11 @@ def main() -> int:
                   file=sys.stderr)
             return 1
 
+    if args.find_loop_warps is not None:
+        assert sim.loop_profiler is not None
+        sim.loop_profiler.finish(sim.state)
+        args.find_loop_warps.write(sim.loop_profiler.dump_warps())
+
     if args.dump_dmem is not None:
         args.dump_dmem.write(sim.dump_data())
 
@@ -39,6 +39,12 @@ prefixed with "0x" if they are hexadecimal.
 
     print_regs              Write the hex contents of all registers to stdout
 
+    dump_dirty_regs <path> <gpr_mask> <wdr_mask>
+
+                            Write the registers modified since the start of
+                            the operation (plus those requested by the masks)
+                            to <path> in binary form.
+
     edn_rnd_step            Send 32b RND Data to the model.
 
     edn_rnd_cdc_done        Finish the RND data write process by signalling RTL
@@ -279,6 +285,51 @@ def on_print_regs(sim: OTBNSim, args: List[str]) -> Optional[OTBNSim]:
     return None
 
 
+def on_dump_dirty_regs(sim: OTBNSim, args: List[str]) -> Optional[OTBNSim]:
+    '''Dump modified registers in binary form to a file
+
+    The arguments are the path of the file, followed by masks of GPRs and WDRs
+    whose values should be dumped even if they haven't been written since the
+    operation started.
+
+    The file starts with the masks of GPRs and WDRs written since the start of
+    the operation (each as a little-endian 32-bit word). This is followed by
+    the values of all GPRs (4 bytes each) and then all WDRs (32 bytes each)
+    that are either written or requested, in ascending order of index and as
+    little-endian numbers.
+
+    '''
+    check_arg_count('dump_dirty_regs', 3, args)
+
+    path = args[0]
+    req_gpr_mask = read_word('gpr_mask', args[1], 32)
+    req_wdr_mask = read_word('wdr_mask', args[2], 32)
+
+    print('DUMP_DIRTY_REGS {!r}'.format(path))
+
+    gpr_mask = sim.state.gprs.dirty_mask()
+    wdr_mask = sim.state.wdrs.dirty_mask()
+
+    data = bytearray()
+    data += gpr_mask.to_bytes(4, 'little')
+    data += wdr_mask.to_bytes(4, 'little')
+
+    gpr_vals = sim.state.gprs.peek_unsigned_values()
+    for idx, value in enumerate(gpr_vals):
+        if ((gpr_mask | req_gpr_mask) >> idx) & 1:
+            data += value.to_bytes(4, 'little')
+
+    wdr_vals = sim.state.wdrs.peek_unsigned_values()
+    for idx, value in enumerate(wdr_vals):
+        if ((wdr_mask | req_wdr_mask) >> idx) & 1:
+            data += value.to_bytes(32, 'little')
+
+    with open(path, 'wb') as handle:
+        handle.write(data)
+
+    return None
+
+
 def on_print_call_stack(sim: OTBNSim, args: List[str]) -> Optional[OTBNSim]:
     '''Print call stack to stdout. First element is the bottom of the stack'''
     check_arg_count('print_call_stack', 0, args)
@@ -414,6 +465,7 @@ _HANDLERS = {
     'load_i': on_load_i,
     'dump_d': on_dump_d,
     'print_regs': on_print_regs,
+    'dump_dirty_regs': on_dump_dirty_regs,
     'print_call_stack': on_print_call_stack,
     'reset': on_reset,
     'edn_rnd_step': on_edn_rnd_step,
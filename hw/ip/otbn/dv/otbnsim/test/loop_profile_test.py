@@ -0,0 +1,95 @@
+# Copyright lowRISC contributors (OpenTitan project).
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+
+import io
+from typing import Dict
+
+import py
+
+from shared.reg_dump import parse_reg_dump
+from sim.loop_profile import LoopProfiler, read_loop_warp_table
+from sim.standalonesim import StandaloneSim
+import testutil
+
+_ASM = """
+  /* A loop with no side effects: it can be warped. */
+  loopi 10, 2
+    addi x2, x2, 1
+    addi x3, x3, 2
+
+  /* A loop that writes to DMEM: it must not be warped. */
+  loopi 10, 2
+    addi x4, x4, 1
+    sw   x4, 0(x0)
+
+  /* A loop that is too short to get any shorter. */
+  loopi 3, 1
+    addi x5, x5, 1
+
+  ecall
+"""
+
+
+def _profile_asm_str(assembly: str,
+                     tmpdir: py.path.local) -> LoopProfiler:
+    sim = testutil.prepare_sim_for_asm_str(assembly, tmpdir, False)
+    sim.start(False, profile_loops=True)
+    sim.run(verbose=False, dump_file=None)
+
+    # Ensure that the execution was successful.
+    assert sim.state.ext_regs.read('ERR_BITS', False) == 0
+
+    assert sim.loop_profiler is not None
+    sim.loop_profiler.finish(sim.state)
+    return sim.loop_profiler
+
+
+def _run_with_warps(sim: StandaloneSim, table: str) -> Dict[str, int]:
+    '''Run sim with the warps in table applied and return the final GPRs.'''
+    for addr, addr_warps in read_loop_warp_table(io.StringIO(table)).items():
+        for from_cnt, to_cnt in addr_warps.items():
+            sim.add_loop_warp(addr, from_cnt, to_cnt)
+
+    dump = io.StringIO()
+    sim.run(verbose=False, dump_file=dump)
+    assert sim.state.ext_regs.read('ERR_BITS', False) == 0
+    return parse_reg_dump(dump.getvalue())
+
+
+def test_find_loop_warps(tmpdir: py.path.local) -> None:
+    '''Check that only the side-effect free loop gets warped.'''
+    profiler = _profile_asm_str(_ASM, tmpdir)
+
+    # The first loop body starts at 0x4. We keep two iterations, then jump to
+    # the penultimate one.
+    assert profiler.get_warps() == {0x4: {1: 8}}
+    assert profiler.get_warps(keep=3) == {0x4: {2: 8}}
+
+
+def test_apply_found_loop_warps(tmpdir: py.path.local) -> None:
+    '''Check that a generated loop warp table skips iterations.'''
+    table = _profile_asm_str(_ASM, tmpdir).dump_warps()
+
+    sim = testutil.prepare_sim_for_asm_str(_ASM, tmpdir, False)
+    regs = _run_with_warps(sim, table)
+
+    # The warped loop runs iterations 0, 1 and 9. The others run in full.
+    assert regs['x2'] == 3
+    assert regs['x3'] == 6
+    assert regs['x4'] == 10
+    assert regs['x5'] == 3
+
+
+def test_read_loop_warp_table() -> None:
+    '''Check parsing of loop warp tables.'''
+    table = '# A comment\n\n0x10 1 20  # trailing comment\n0x10 30 40\n'
+    assert read_loop_warp_table(io.StringIO(table)) == {0x10: {1: 20, 30: 40}}
+
+    for bad in ['10 1 20\n', '0x10 1\n', '0x12 1 20\n', '0x10 5 4\n',
+                '0x10 1 2\n0x10 1 3\n']:
+        try:
+            read_loop_warp_table(io.StringIO(bad))
+        except ValueError:
+            continue
+        assert False, 'Parsed bad loop warp table {!r}'.format(bad)
@@ -132,6 +132,12 @@ interface otbn_model_if
                     "Failed to disable stack integrity checks", "otbn_model_if")
   endfunction
 
+  function automatic void otbn_set_full_reg_check(bit enable);
+    `uvm_info("otbn_model_if", $sformatf("Setting full register check to %0d", enable), UVM_HIGH);
+    `DV_CHECK_FATAL(u_model.otbn_set_full_reg_check(handle, enable) == 0,
+                    "Failed to set full register check", "otbn_model_if")
+  endfunction
+
   // The err signal is asserted by the model if it fails to find the DUT or if it finds a mismatch
   // in results. It should never go high.
   `ASSERT(NoModelErrs, !err)
@@ -0,0 +1,570 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "otbn_top_fuzz.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <getopt.h>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+#include "otbn_memutil.h"
+#include "otbn_trace_source.h"
+
+namespace {
+struct DirDeleter {
+  void operator()(DIR *dir) const { closedir(dir); }
+};
+typedef std::unique_ptr<DIR, DirDeleter> dir_ptr;
+
+const char kCorpusSuffix[] = ".otbnfz";
+
+// addi x0, x0, 0
+const uint32_t kNop = 0x00000013;
+
+// Instruction bits that we use to classify instructions for coverage: the
+// major opcode, funct3 and bit 30 (which distinguishes e.g. ADD and SUB).
+const uint32_t kInsnClassMask = 0x4000707f;
+
+// Stop fuzzing after this many failures. A broken model or RTL will tend to
+// fail on every test case and we don't want to spend the whole run
+// minimizing the same problem.
+const uint64_t kMaxFailures = 8;
+
+const uint32_t kInterestingWords[] = {0x00000000, 0x00000001, 0x7fffffff,
+                                      0x80000000, 0xffffffff};
+
+bool HasCorpusSuffix(const char *name) {
+  size_t len = strlen(name);
+  size_t suffix_len = sizeof(kCorpusSuffix) - 1;
+  return len > suffix_len &&
+         0 == strcmp(name + len - suffix_len, kCorpusSuffix);
+}
+
+// FNV-1a hash, used to give corpus files stable names
+uint64_t HashInput(const std::vector<uint8_t> &imem,
+                   const std::vector<uint8_t> &dmem) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const std::vector<uint8_t> *mem : {&imem, &dmem}) {
+    for (uint8_t byte : *mem) {
+      hash = (hash ^ byte) * 0x100000001b3ULL;
+    }
+  }
+  return hash;
+}
+
+std::chrono::steady_clock::time_point start_time;
+}  // namespace
+
+OtbnTopFuzzer::OtbnTopFuzzer(OtbnMemUtil &mem_util)
+    : mem_util_(mem_util),
+      enabled_(false),
+      iters_(0),
+      max_cycles_(20000),
+      max_minimize_runs_(1000),
+      num_seeds_(0),
+      mode_(Seeding),
+      seed_idx_(0),
+      iters_done_(0),
+      min_fail_bits_(0),
+      min_runs_(0),
+      min_chunk_(0),
+      min_pos_(0),
+      min_in_dmem_(false),
+      resume_mode_(Seeding),
+      first_case_(true),
+      new_coverage_(false),
+      last_insn_(0),
+      num_execs_(0),
+      num_timeouts_(0),
+      num_failures_(0) {}
+
+OtbnTopFuzzer::~OtbnTopFuzzer() {
+  if (enabled_)
+    OtbnTraceSource::get().RemoveListener(this);
+}
+
+bool OtbnTopFuzzer::ParseCLIArguments(int argc, char **argv, bool &exit_app) {
+  const struct option long_options[] = {
+      {"otbn-fuzz-iters", required_argument, nullptr, 'i'},
+      {"otbn-fuzz-seed", required_argument, nullptr, 's'},
+      {"otbn-fuzz-corpus", required_argument, nullptr, 'c'},
+      {"otbn-fuzz-max-cycles", required_argument, nullptr, 'm'},
+      {"otbn-fuzz-minimize-runs", required_argument, nullptr, 'r'},
+      {"help", no_argument, nullptr, 'h'},
+      {nullptr, no_argument, nullptr, 0}};
+
+  uint64_t seed = 1;
+
+  // Reset the command parsing index in-case other utils have already parsed
+  // some arguments
+  optind = 1;
+  while (1) {
+    int c = getopt_long(argc, argv, "-h", long_options, nullptr);
+    if (c == -1) {
+      break;
+    }
+
+    switch (c) {
+      case 0:
+      case 1:
+        break;
+      case 'i':
+        enabled_ = true;
+        iters_ = strtoull(optarg, nullptr, 0);
+        break;
+      case 's':
+        seed = strtoull(optarg, nullptr, 0);
+        break;
+      case 'c':
+        corpus_dir_ = optarg;
+        break;
+      case 'm':
+        max_cycles_ = strtoul(optarg, nullptr, 0);
+        break;
+      case 'r':
+        max_minimize_runs_ = strtoul(optarg, nullptr, 0);
+        break;
+      case 'h':
+        std::cout
+            << "Differential fuzzing:\n\n"
+               "--otbn-fuzz-iters=N\n"
+               "  Enable fuzzing and run N mutated test cases after the\n"
+               "  loaded ELF file and any inputs in the corpus\n\n"
+               "--otbn-fuzz-seed=N\n"
+               "  Seed for the mutator (default 1)\n\n"
+               "--otbn-fuzz-corpus=DIR\n"
+               "  Read seed inputs from DIR and write new and failing inputs "
+               "to it\n\n"
+               "--otbn-fuzz-max-cycles=N\n"
+               "  Give up on a test case after N cycles (default 20000)\n\n"
+               "--otbn-fuzz-minimize-runs=N\n"
+               "  Run at most N test cases to minimize each failure "
+               "(default 1000)\n\n";
+        break;
+    }
+  }
+
+  if (!enabled_)
+    return true;
+
+  if (max_cycles_ == 0) {
+    std::cerr << "ERROR: --otbn-fuzz-max-cycles must be positive.\n";
+    return false;
+  }
+
+  rng_.seed(seed);
+  InitBuffers();
+  if (!LoadCorpus())
+    return false;
+
+  OtbnTraceSource::get().AddListener(this);
+  start_time = std::chrono::steady_clock::now();
+  return true;
+}
+
+void OtbnTopFuzzer::InitBuffers() {
+  uint32_t imem_bytes = mem_util_.GetMemArea(true).GetSizeBytes();
+  uint32_t dmem_bytes = mem_util_.GetMemArea(false).GetSizeBytes();
+
+  cur_.imem.assign(imem_bytes, 0);
+  cur_.dmem.assign(dmem_bytes, 0);
+  min_best_ = cur_;
+
+  // Reserve space for the coverage points that we expect to see, so that we
+  // don't spend time rehashing during the run.
+  coverage_.reserve(1 << 16);
+}
+
+bool OtbnTopFuzzer::ReadInput(const std::string &path, Input *input) const {
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+    return false;
+
+  input->imem.assign(cur_.imem.size(), 0);
+  input->dmem.assign(cur_.dmem.size(), 0);
+  file.read(reinterpret_cast<char *>(input->imem.data()), input->imem.size());
+  file.read(reinterpret_cast<char *>(input->dmem.data()), input->dmem.size());
+
+  // Check that we read exactly the expected number of bytes
+  return file && file.peek() == std::char_traits<char>::eof();
+}
+
+void OtbnTopFuzzer::WriteInput(const Input &input,
+                               const std::string &prefix) const {
+  std::ostringstream oss;
+  oss << (corpus_dir_.empty() ? "." : corpus_dir_) << "/" << prefix
+      << std::hex << std::setfill('0') << std::setw(16)
+      << HashInput(input.imem, input.dmem) << kCorpusSuffix;
+
+  std::ofstream file(oss.str(), std::ios::binary);
+  file.write(reinterpret_cast<const char *>(input.imem.data()),
+             input.imem.size());
+  file.write(reinterpret_cast<const char *>(input.dmem.data()),
+             input.dmem.size());
+  if (!file) {
+    std::cerr << "WARNING: Failed to write fuzzer input to `" << oss.str()
+              << "'.\n";
+  }
+}
+
+bool OtbnTopFuzzer::LoadCorpus() {
+  if (corpus_dir_.empty())
+    return true;
+
+  dir_ptr dir(opendir(corpus_dir_.c_str()));
+  if (!dir) {
+    std::cerr << "ERROR: Cannot open corpus directory `" << corpus_dir_
+              << "'.\n";
+    return false;
+  }
+
+  // Sort the file names so that runs are reproducible
+  std::vector<std::string> names;
+  for (;;) {
+    struct dirent *entry = readdir(dir.get());
+    if (!entry)
+      break;
+    if (entry->d_type != DT_REG || !HasCorpusSuffix(entry->d_name))
+      continue;
+    names.push_back(entry->d_name);
+  }
+  std::sort(names.begin(), names.end());
+
+  for (const std::string &name : names) {
+    Input input;
+    std::string path = corpus_dir_ + "/" + name;
+    if (!ReadInput(path, &input)) {
+      std::cerr << "ERROR: `" << path
+                << "' is not a valid fuzzer input (wrong size?).\n";
+      return false;
+    }
+    corpus_.push_back(std::move(input));
+  }
+
+  num_seeds_ = corpus_.size();
+  return true;
+}
+
+void OtbnTopFuzzer::AddSeedFromStagedElf() {
+  Input input;
+  input.imem.assign(cur_.imem.size(), 0);
+  input.dmem.assign(cur_.dmem.size(), 0);
+
+  bool found_any = false;
+  for (bool is_imem : {true, false}) {
+    std::vector<uint8_t> &mem = is_imem ? input.imem : input.dmem;
+    for (const auto &seg : mem_util_.GetSegs(is_imem)) {
+      uint32_t lo = seg.first.lo;
+      const std::vector<uint8_t> &data = seg.second;
+      if (lo >= mem.size())
+        continue;
+      size_t len = std::min(data.size(), mem.size() - lo);
+      memcpy(&mem[lo], data.data(), len);
+      found_any = true;
+    }
+  }
+
+  if (found_any)
+    corpus_.push_back(std::move(input));
+}
+
+void OtbnTopFuzzer::AcceptTraceString(const std::string &trace,
+                                      unsigned int cycle_count) {
+  // Walk the lines of the record in place. We're looking for an 'E' line
+  // (an instruction that retired) and a "> FLAGSn" line (the flags that it
+  // wrote). See the tracer README for the format.
+  const char *text = trace.c_str();
+  size_t size = trace.size();
+
+  bool have_insn = false;
+  uint32_t insn = 0;
+  uint64_t flag_bits = 0;
+
+  size_t pos = 0;
+  while (pos < size) {
+    const char *line = text + pos;
+    const char *eol = static_cast<const char *>(memchr(line, '\n', size - pos));
+    size_t len = eol ? eol - line : size - pos;
+    pos += len + 1;
+
+    // "E PC: 0x00000158, insn: 0x01acd08b"
+    if (len >= 34 && line[0] == 'E' && 0 == strncmp(line + 18, "insn: ", 6)) {
+      insn = strtoul(line + 24, nullptr, 16);
+      have_insn = true;
+      continue;
+    }
+
+    // "> FLAGS0: {C: 1, M: 0, L: 1, Z: 0}"
+    if (len >= 34 && 0 == strncmp(line, "> FLAGS", 7)) {
+      uint64_t group = line[7] == '1';
+      uint64_t cmlz = ((line[14] == '1') << 3) | ((line[20] == '1') << 2) |
+                      ((line[26] == '1') << 1) | (line[32] == '1');
+      flag_bits = 0x20 | (group << 4) | cmlz;
+    }
+  }
+
+  if (!have_insn)
+    return;
+
+  last_insn_ = insn;
+  uint64_t key = (flag_bits << 32) | (insn & kInsnClassMask);
+  if (coverage_.insert(key).second)
+    new_coverage_ = true;
+}
+
+uint32_t OtbnTopFuzzer::GetWord(const std::vector<uint8_t> &mem,
+                                uint32_t idx) const {
+  assert(4 * idx + 4 <= mem.size());
+  uint32_t word;
+  memcpy(&word, &mem[4 * idx], 4);
+  return word;
+}
+
+void OtbnTopFuzzer::SetWord(std::vector<uint8_t> *mem, uint32_t idx,
+                            uint32_t value) const {
+  assert(4 * idx + 4 <= mem->size());
+  memcpy(&(*mem)[4 * idx], &value, 4);
+}
+
+uint32_t OtbnTopFuzzer::ProgWords(const Input &input) const {
+  uint32_t n = input.imem.size() / 4;
+  while (n > 0 && GetWord(input.imem, n - 1) == 0)
+    --n;
+  return n;
+}
+
+void OtbnTopFuzzer::Mutate(Input *input) {
+  uint32_t imem_words = input->imem.size() / 4;
+  uint32_t dmem_words = input->dmem.size() / 4;
+  uint32_t n = std::max(ProgWords(*input), 1u);
+
+  int num_mutations = 1 + rng_() % 4;
+  for (int m = 0; m < num_mutations; ++m) {
+    uint32_t i = rng_() % n;
+    switch (rng_() % 6) {
+      case 0:
+        // Flip a bit of an instruction
+        SetWord(&input->imem, i,
+                GetWord(input->imem, i) ^ (1u << (rng_() % 32)));
+        break;
+
+      case 1: {
+        // Replace an instruction with one from another corpus entry
+        const Input &other = corpus_[rng_() % corpus_.size()];
+        uint32_t other_n = ProgWords(other);
+        if (other_n)
+          SetWord(&input->imem, i, GetWord(other.imem, rng_() % other_n));
+      } break;
+
+      case 2: {
+        // Swap two instructions
+        uint32_t j = rng_() % n;
+        uint32_t tmp = GetWord(input->imem, i);
+        SetWord(&input->imem, i, GetWord(input->imem, j));
+        SetWord(&input->imem, j, tmp);
+      } break;
+
+      case 3:
+        // Duplicate an instruction, shifting the rest of the program up
+        if (n < imem_words) {
+          memmove(&input->imem[4 * (i + 1)], &input->imem[4 * i],
+                  4 * (n - i));
+          ++n;
+        }
+        break;
+
+      case 4: {
+        // Write an interesting (or random) value to a DMEM word
+        uint32_t j = rng_() % dmem_words;
+        size_t num_interesting =
+            sizeof(kInterestingWords) / sizeof(kInterestingWords[0]);
+        uint32_t k = rng_() % (num_interesting + 1);
+        SetWord(&input->dmem, j,
+                k < num_interesting ? kInterestingWords[k] : (uint32_t)rng_());
+      } break;
+
+      case 5: {
+        // Flip a bit in DMEM
+        uint32_t j = rng_() % dmem_words;
+        SetWord(&input->dmem, j,
+                GetWord(input->dmem, j) ^ (1u << (rng_() % 32)));
+      } break;
+    }
+  }
+}
+
+bool OtbnTopFuzzer::PrepareMinimizeCandidate() {
+  if (min_runs_ >= max_minimize_runs_)
+    return false;
+
+  // First pass: replace ever smaller chunks of the program with NOPs
+  if (!min_in_dmem_) {
+    uint32_t n = ProgWords(min_best_);
+    while (min_chunk_ >= 1) {
+      if (min_pos_ >= n) {
+        min_chunk_ /= 2;
+        min_pos_ = 0;
+        continue;
+      }
+
+      uint32_t lo = min_pos_;
+      uint32_t hi = std::min(n, lo + min_chunk_);
+      min_pos_ = hi;
+
+      bool changed = false;
+      cur_ = min_best_;
+      for (uint32_t i = lo; i < hi; ++i) {
+        if (GetWord(cur_.imem, i) != kNop) {
+          SetWord(&cur_.imem, i, kNop);
+          changed = true;
+        }
+      }
+      if (changed)
+        return true;
+    }
+
+    min_in_dmem_ = true;
+    min_pos_ = 0;
+  }
+
+  // Second pass: zero DMEM words one at a time
+  uint32_t dmem_words = min_best_.dmem.size() / 4;
+  while (min_pos_ < dmem_words) {
+    uint32_t idx = min_pos_++;
+    if (GetWord(min_best_.dmem, idx) != 0) {
+      cur_ = min_best_;
+      SetWord(&cur_.dmem, idx, 0);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool OtbnTopFuzzer::PrepareNext() {
+  if (mode_ == Seeding) {
+    if (seed_idx_ < num_seeds_) {
+      cur_ = corpus_[seed_idx_++];
+      return true;
+    }
+    mode_ = Fuzzing;
+  }
+
+  assert(mode_ == Fuzzing);
+  if (iters_done_ >= iters_ || num_failures_ >= kMaxFailures)
+    return false;
+
+  if (corpus_.empty()) {
+    std::cerr << "ERROR: No inputs to fuzz. Load an ELF file or pass "
+                 "--otbn-fuzz-corpus.\n";
+    return false;
+  }
+
+  ++iters_done_;
+  cur_ = corpus_[rng_() % corpus_.size()];
+  Mutate(&cur_);
+  return true;
+}
+
+void OtbnTopFuzzer::LoadCur() const {
+  mem_util_.GetMemArea(true).Write(0, cur_.imem);
+  mem_util_.GetMemArea(false).Write(0, cur_.dmem);
+}
+
+bool OtbnTopFuzzer::NextCase(uint32_t fail_bits, uint32_t err_bits,
+                             bool timeout) {
+  assert(enabled_);
+
+  if (first_case_) {
+    // The first test case is the ELF file that was loaded with --load-elf (if
+    // any). Use it as a seed.
+    AddSeedFromStagedElf();
+    first_case_ = false;
+  }
+
+  ++num_execs_;
+  num_timeouts_ += timeout;
+
+  // The error bits at the end of the run, together with the last
+  // instruction, are a coverage point.
+  uint64_t end_key =
+      (1ULL << 63) | ((uint64_t)err_bits << 32) | (last_insn_ & kInsnClassMask);
+  if (coverage_.insert(end_key).second)
+    new_coverage_ = true;
+
+  bool keep_going = true;
+  if (mode_ == Minimizing) {
+    ++min_runs_;
+    if (fail_bits & min_fail_bits_)
+      min_best_ = cur_;
+
+    if (!PrepareMinimizeCandidate()) {
+      WriteInput(min_best_, "fail-");
+      std::cout << "Fuzzer: minimized failure after " << min_runs_
+                << " runs.\n";
+      mode_ = resume_mode_;
+      keep_going = PrepareNext();
+    }
+  } else if (fail_bits) {
+    ++num_failures_;
+    std::cout << "Fuzzer: test case " << num_execs_
+              << " failed (mismatch bits 0x" << std::hex << fail_bits
+              << std::dec << "). Minimizing.\n";
+
+    min_best_ = cur_;
+    min_fail_bits_ = fail_bits;
+    min_runs_ = 0;
+    min_chunk_ = std::max(ProgWords(cur_) / 2, 1u);
+    min_pos_ = 0;
+    min_in_dmem_ = false;
+    resume_mode_ = mode_;
+    mode_ = Minimizing;
+
+    if (!PrepareMinimizeCandidate()) {
+      WriteInput(min_best_, "fail-");
+      mode_ = resume_mode_;
+      keep_going = PrepareNext();
+    }
+  } else {
+    if (new_coverage_ && !timeout && mode_ == Fuzzing) {
+      corpus_.push_back(cur_);
+      if (!corpus_dir_.empty())
+        WriteInput(cur_, "cov-");
+    }
+    keep_going = PrepareNext();
+  }
+
+  new_coverage_ = false;
+  last_insn_ = 0;
+
+  if (!keep_going)
+    return false;
+
+  LoadCur();
+  return true;
+}
+
+void OtbnTopFuzzer::PrintStats(std::ostream &os) const {
+  double secs = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start_time)
+                    .count();
+
+  os << "Fuzzing statistics:\n"
+     << "  Executions:      " << num_execs_ << "\n"
+     << "  Execs per hour:  "
+     << (secs > 0 ? (uint64_t)(num_execs_ * 3600 / secs) : 0) << "\n"
+     << "  Corpus size:     " << corpus_.size() << "\n"
+     << "  Coverage points: " << coverage_.size() << "\n"
+     << "  Timeouts:        " << num_timeouts_ << "\n"
+     << "  Failures:        " << num_failures_ << "\n";
+}
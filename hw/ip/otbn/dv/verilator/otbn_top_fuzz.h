@@ -0,0 +1,144 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_HW_IP_OTBN_DV_VERILATOR_OTBN_TOP_FUZZ_H_
+#define OPENTITAN_HW_IP_OTBN_DV_VERILATOR_OTBN_TOP_FUZZ_H_
+
+#include <cstdint>
+#include <iosfwd>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "otbn_trace_listener.h"
+#include "sim_ctrl_extension.h"
+
+class OtbnMemUtil;
+
+/**
+ * A coverage-guided differential fuzzer for OTBN.
+ *
+ * This is a SimCtrlExtension for otbn_top_sim. When enabled (with
+ * --otbn-fuzz-iters), otbn_top_sim doesn't stop after the first execution.
+ * Instead, it calls NextCase() with the result, which mutates an input from
+ * the corpus, backdoor loads it into IMEM and DMEM and then otbn_top_sim
+ * resets OTBN and the model and runs again. All of this happens in a single
+ * simulator process and the buffers for the test cases are allocated up
+ * front.
+ *
+ * Coverage comes from the RTL trace (see otbn_trace_listener.h). A test case
+ * is added to the corpus if it sees an (instruction, flags) combination or an
+ * (instruction, error bits) combination at the end of the run that we haven't
+ * seen before.
+ *
+ * A test case fails if the model reports a mismatch with the RTL. Failing test
+ * cases are minimized (by replacing instructions with NOPs and zeroing DMEM
+ * words for as long as the failure persists) and then written to the corpus
+ * directory with a "fail-" prefix. To replay them, point --otbn-fuzz-corpus at
+ * a directory containing them and run with --otbn-fuzz-iters=0.
+ *
+ * Corpus files (*.otbnfz) hold the raw contents of IMEM followed by the raw
+ * contents of DMEM.
+ */
+class OtbnTopFuzzer : public SimCtrlExtension, public OtbnTraceListener {
+ public:
+  explicit OtbnTopFuzzer(OtbnMemUtil &mem_util);
+  ~OtbnTopFuzzer();
+
+  bool ParseCLIArguments(int argc, char **argv, bool &exit_app) override;
+
+  void AcceptTraceString(const std::string &trace,
+                         unsigned int cycle_count) override;
+
+  // The number of cycles after which a test case times out. This is zero if
+  // fuzzing isn't enabled.
+  uint32_t GetMaxCycles() const { return enabled_ ? max_cycles_ : 0; }
+
+  // Called by otbn_top_sim at the end of each test case. fail_bits is nonzero
+  // if there was a mismatch between the model and the RTL. err_bits are the
+  // error bits from the RTL and timeout is true if the execution didn't finish
+  // in time.
+  //
+  // Returns true if the next test case has been loaded into memory and the
+  // simulation should reset OTBN and run it. Returns false when we're done.
+  bool NextCase(uint32_t fail_bits, uint32_t err_bits, bool timeout);
+
+  // Print statistics about the fuzzing run
+  void PrintStats(std::ostream &os) const;
+
+  bool Enabled() const { return enabled_; }
+  bool FoundFailures() const { return num_failures_ != 0; }
+
+ private:
+  // The contents of IMEM and DMEM for a test case
+  struct Input {
+    std::vector<uint8_t> imem, dmem;
+  };
+
+  enum Mode { Seeding, Fuzzing, Minimizing };
+
+  void InitBuffers();
+  bool LoadCorpus();
+  bool ReadInput(const std::string &path, Input *input) const;
+  void WriteInput(const Input &input, const std::string &prefix) const;
+  void AddSeedFromStagedElf();
+
+  // Fill in cur_ with the next test case to run. Returns false if there is
+  // nothing more to do.
+  bool PrepareNext();
+  bool PrepareMinimizeCandidate();
+  void Mutate(Input *input);
+  void LoadCur() const;
+
+  uint32_t ProgWords(const Input &input) const;
+  uint32_t GetWord(const std::vector<uint8_t> &mem, uint32_t idx) const;
+  void SetWord(std::vector<uint8_t> *mem, uint32_t idx, uint32_t value) const;
+
+  OtbnMemUtil &mem_util_;
+
+  bool enabled_;
+  uint64_t iters_;
+  uint32_t max_cycles_;
+  uint32_t max_minimize_runs_;
+  std::string corpus_dir_;
+  std::mt19937_64 rng_;
+
+  std::vector<Input> corpus_;
+
+  // The number of inputs read from the corpus directory. We run each of these
+  // once (unmutated) before we start fuzzing.
+  size_t num_seeds_;
+
+  // The test case that is currently running
+  Input cur_;
+
+  Mode mode_;
+  size_t seed_idx_;
+  uint64_t iters_done_;
+
+  // Minimization state: the smallest failing input that we have found, the
+  // failure bits that we are trying to reproduce and where we are in the
+  // search.
+  Input min_best_;
+  uint32_t min_fail_bits_;
+  uint32_t min_runs_;
+  uint32_t min_chunk_;
+  uint32_t min_pos_;
+  bool min_in_dmem_;
+  Mode resume_mode_;
+
+  bool first_case_;
+
+  // Coverage state
+  std::unordered_set<uint64_t> coverage_;
+  bool new_coverage_;
+  uint32_t last_insn_;
+
+  uint64_t num_execs_;
+  uint64_t num_timeouts_;
+  uint64_t num_failures_;
+};
+
+#endif  // OPENTITAN_HW_IP_OTBN_DV_VERILATOR_OTBN_TOP_FUZZ_H_
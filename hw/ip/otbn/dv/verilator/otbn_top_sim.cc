@@ -14,6 +14,7 @@
 #include "log_trace_listener.h"
 #include "otbn_memutil.h"
 #include "otbn_model.h"
+#include "otbn_top_fuzz.h"
 #include "otbn_trace_checker.h"
 #include "otbn_trace_source.h"
 #include "sv_scoped.h"
@@ -98,10 +99,69 @@ class OtbnTraceUtil : public SimCtrlExtension {
 
 static otbn_top_sim *verilator_top;
 static OtbnMemUtil otbn_memutil("TOP.otbn_top_sim");
+static OtbnTopFuzzer otbn_fuzzer(otbn_memutil);
+
+// The loop counts of the loops that the RTL is currently running. This is
+// updated by OtbnTopApplyLoopWarp.
+static std::vector<uint32_t> loop_count_stack;
+
+/**
+ * SimCtrlExtension that adds a '--otbn-loop-warps' command line option. If
+ * set, it loads a loop warp table (as written by the ISS when run with
+ * --find-loop-warps) into otbn_memutil. Both the model and
+ * OtbnTopApplyLoopWarp then skip the loop iterations that it describes.
+ */
+class OtbnLoopWarpUtil : public SimCtrlExtension {
+ private:
+  void PrintHelp() {
+    std::cout << "Loop warp utilities:\n\n"
+                 "--otbn-loop-warps=FILE\n"
+                 "  Apply the loop warps in the loop warp table at FILE\n\n";
+  }
+
+ public:
+  virtual bool ParseCLIArguments(int argc, char **argv, bool &exit_app) {
+    const struct option long_options[] = {
+        {"otbn-loop-warps", required_argument, nullptr, 'w'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, no_argument, nullptr, 0}};
+
+    // Reset the command parsing index in-case other utils have already parsed
+    // some arguments
+    optind = 1;
+    while (1) {
+      int c = getopt_long(argc, argv, "-h", long_options, nullptr);
+      if (c == -1) {
+        break;
+      }
+
+      switch (c) {
+        case 0:
+        case 1:
+          break;
+        case 'w':
+          try {
+            otbn_memutil.LoadLoopWarpTable(optarg);
+          } catch (const std::exception &err) {
+            std::cerr << "ERROR: Failed to load loop warp table: "
+                      << err.what() << std::endl;
+            return false;
+          }
+          break;
+        case 'h':
+          PrintHelp();
+          break;
+      }
+    }
+
+    return true;
+  }
+};
 
 int main(int argc, char **argv) {
   VerilatorMemUtil memutil(&otbn_memutil);
   OtbnTraceUtil traceutil;
+  OtbnLoopWarpUtil loopwarputil;
 
   otbn_top_sim top;
   // Make the otbn_top_sim object visible to OtbnTopApplyLoopWarp.
@@ -115,6 +175,8 @@ int main(int argc, char **argv) {
                  VerilatorSimCtrlFlags::ResetPolarityNegative);
   simctrl.RegisterExtension(&memutil);
   simctrl.RegisterExtension(&traceutil);
+  simctrl.RegisterExtension(&loopwarputil);
+  simctrl.RegisterExtension(&otbn_fuzzer);
 
   std::cout << "Simulation of OTBN" << std::endl
             << "==================" << std::endl
@@ -128,6 +190,11 @@ int main(int argc, char **argv) {
     return ret_code;
   }
 
+  if (otbn_fuzzer.Enabled()) {
+    otbn_fuzzer.PrintStats(std::cout);
+    return otbn_fuzzer.FoundFailures() ? 1 : 0;
+  }
+
   svSetScope(svGetScopeFromName("TOP.otbn_top_sim"));
 
   svBit model_err = otbn_err_get();
@@ -231,8 +298,6 @@ auto get_loop_counter(LoopControllerT *loop_controller, uint32_t counter_idx)
 // updating the top of the loop stack if necessary to match loop warp symbols
 // in the ELF file.
 extern "C" void OtbnTopApplyLoopWarp() {
-  static std::vector<uint32_t> loop_count_stack;
-
   // See not in OtbnTopInstallLoopWarps for why this upcast is needed.
   Votbn_top_sim &top = *verilator_top;
 
@@ -293,6 +358,11 @@ extern "C" void OtbnTopApplyLoopWarp() {
 // finished. We use it to dump out the current RTL state before secure wipe
 // zeroes everything out.
 extern "C" void OtbnTopDumpState() {
+  // There's no point dumping the state of every fuzzing test case.
+  if (otbn_fuzzer.Enabled()) {
+    return;
+  }
+
   std::cout << "Call Stack:" << std::endl;
   std::cout << "-----------" << std::endl;
   for (int i = 0; i < otbn_base_call_stack_get_size(); ++i) {
@@ -350,3 +420,20 @@ extern "C" void OtbnTopDumpState() {
               << std::endl;
   }
 }
+
+// This is executed over DPI from an initial block. If fuzzing is enabled, it
+// returns the number of cycles after which a test case times out. Otherwise it
+// returns zero.
+extern "C" unsigned int OtbnTopFuzzMaxCycles() {
+  return otbn_fuzzer.GetMaxCycles();
+}
+
+// This is executed over DPI at the end of each fuzzing test case. If it
+// returns 1, the next test case has been loaded into the memories and
+// otbn_top_sim resets everything to run it.
+extern "C" svBit OtbnTopFuzzNextCase(unsigned int fail_bits,
+                                     unsigned int err_bits, svBit timeout) {
+  // The RTL loop stack gets cleared by the reset, so clear our copy too.
+  loop_count_stack.clear();
+  return otbn_fuzzer.NextCase(fail_bits, err_bits, timeout != 0) ? 1 : 0;
+}
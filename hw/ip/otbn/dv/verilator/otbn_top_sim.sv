@@ -22,6 +22,18 @@ module otbn_top_sim (
   localparam logic [127:0] TestScrambleKey   = 128'h48ecf6c738f0f108a5b08620695ffd4d;
   localparam logic [63:0]  TestScrambleNonce = 64'hf88c2578fa4cd123;
 
+  // Reset for everything in the simulation. This is IO_RST_N, but the fuzzing harness (see
+  // otbn_top_fuzz.h) also asserts it between test cases.
+  logic      rst_n;
+
+  // The number of cycles before a fuzzing test case times out, or zero if we're not fuzzing.
+  // OtbnTopFuzzMaxCycles is defined in otbn_top_sim.cc.
+  import "DPI-C" function int unsigned OtbnTopFuzzMaxCycles();
+  int unsigned fuzz_max_cycles;
+  initial begin
+    fuzz_max_cycles = OtbnTopFuzzMaxCycles();
+  end
+
   logic      otbn_done, otbn_done_r, otbn_done_rr;
   core_err_bits_t core_err_bits;
   err_bits_t otbn_err_bits, otbn_err_bits_r, otbn_err_bits_rr;
@@ -73,7 +85,7 @@ module otbn_top_sim (
     .SecSkipUrndReseedAtStart ( 1'b0         )
   ) u_otbn_core (
     .clk_i                       ( IO_CLK                     ),
-    .rst_ni                      ( IO_RST_N                   ),
+    .rst_ni                      ( rst_n                      ),
 
     .start_i                     ( otbn_start_r               ),
     .done_o                      ( otbn_done                  ),
@@ -140,7 +152,7 @@ module otbn_top_sim (
     .FixedEdnVals ( FixedEdnVals )
   ) u_mock_rnd_edn(
     .clk_i      ( IO_CLK       ),
-    .rst_ni     ( IO_RST_N     ),
+    .rst_ni     ( rst_n        ),
 
     .edn_req_i  ( rnd_req  ),
     .edn_rsp_o  ( rnd_rsp  ),
@@ -161,7 +173,7 @@ module otbn_top_sim (
     .FixedEdnVals ( FixedEdnVals )
   ) u_mock_urnd_edn(
     .clk_i      ( IO_CLK       ),
-    .rst_ni     ( IO_RST_N     ),
+    .rst_ni     ( rst_n        ),
 
     .edn_req_i  ( urnd_req ),
     .edn_rsp_o  ( urnd_rsp ),
@@ -203,8 +215,8 @@ module otbn_top_sim (
   // Also keep a delayed copy of the done signal.  This is necessary to align with the status of
   // OTBN and the model, which lags one cycle behind the completion of the OTBN core.
   logic init_sec_wipe_done_q, init_sec_wipe_done_qq;
-  always_ff @(posedge IO_CLK, negedge IO_RST_N) begin
-    if (!IO_RST_N) begin
+  always_ff @(posedge IO_CLK, negedge rst_n) begin
+    if (!rst_n) begin
       init_sec_wipe_done_q  <= 1'b0;
       init_sec_wipe_done_qq <= 1'b0;
     end else begin
@@ -215,8 +227,8 @@ module otbn_top_sim (
 
   // Pulse otbn_start for 1 cycle after the initial secure wipe is done.
   // Flop `done_o` from otbn_core to match up with model done signal.
-  always @(posedge IO_CLK or negedge IO_RST_N) begin
-    if (!IO_RST_N) begin
+  always @(posedge IO_CLK or negedge rst_n) begin
+    if (!rst_n) begin
       otbn_start       <= 1'b0;
       otbn_start_r     <= 1'b0;
       otbn_start_done  <= 1'b0;
@@ -258,7 +270,7 @@ module otbn_top_sim (
     .ReplicateKeyStream ( 1             )
   ) u_dmem (
     .clk_i            ( IO_CLK            ),
-    .rst_ni           ( IO_RST_N          ),
+    .rst_ni           ( rst_n             ),
 
     .key_valid_i      ( 1'b1              ),
     .key_i            ( TestScrambleKey   ),
@@ -305,7 +317,7 @@ module otbn_top_sim (
     .EnableParity    ( 0             )
   ) u_imem (
     .clk_i            ( IO_CLK                  ),
-    .rst_ni           ( IO_RST_N                ),
+    .rst_ni           ( rst_n                   ),
 
     .key_valid_i      ( 1'b1                    ),
     .key_i            ( TestScrambleKey         ),
@@ -335,8 +347,8 @@ module otbn_top_sim (
   // When OTBN is done let a few more cycles run then finish simulation
   logic [1:0] finish_counter;
 
-  always @(posedge IO_CLK or negedge IO_RST_N) begin
-    if (!IO_RST_N) begin
+  always @(posedge IO_CLK or negedge rst_n) begin
+    if (!rst_n) begin
       finish_counter <= 2'd0;
     end else begin
       if (otbn_done_r) begin
@@ -347,7 +359,7 @@ module otbn_top_sim (
         finish_counter <= finish_counter + 2'd1;
       end
 
-      if (finish_counter == 2'd3) begin
+      if (finish_counter == 2'd3 && fuzz_max_cycles == 0) begin
         $finish;
       end
     end
@@ -370,8 +382,8 @@ module otbn_top_sim (
   ) u_otbn_core_model (
     .clk_i                 ( IO_CLK ),
     .clk_edn_i             ( IO_CLK ),
-    .rst_ni                ( IO_RST_N ),
-    .rst_edn_ni            ( IO_RST_N ),
+    .rst_ni                ( rst_n ),
+    .rst_edn_ni            ( rst_n ),
 
     .cmd_i                 ( otbn_pkg::CmdExecute ),
     .cmd_en_i              ( otbn_start ),
@@ -406,8 +418,8 @@ module otbn_top_sim (
   bit done_mismatch_latched, err_bits_mismatch_latched, cnt_mismatch_latched;
   bit model_err_latched, loop_warp_model_err;
 
-  always_ff @(posedge IO_CLK or negedge IO_RST_N) begin
-    if (!IO_RST_N) begin
+  always_ff @(posedge IO_CLK or negedge rst_n) begin
+    if (!rst_n) begin
       done_mismatch_latched     <= 1'b0;
       err_bits_mismatch_latched <= 1'b0;
       cnt_mismatch_latched      <= 1'b0;
@@ -446,27 +458,73 @@ module otbn_top_sim (
                          model_err_latched};
 
   int bad_cycles;
-  always_ff @(negedge IO_CLK or negedge IO_RST_N) begin
-    if (!IO_RST_N) begin
+  always_ff @(negedge IO_CLK or negedge rst_n) begin
+    if (!rst_n) begin
       bad_cycles <= 0;
     end else begin
       if (err_latched) begin
         bad_cycles <= bad_cycles + 1;
       end
-      if (bad_cycles >= 3) begin
+      if (bad_cycles >= 3 && fuzz_max_cycles == 0) begin
         $error("Mismatch or model error (see message above)");
       end
     end
   end
 
+  // Fuzzing
+  //
+  // If fuzzing is enabled (fuzz_max_cycles is nonzero), we don't stop when OTBN is done or the
+  // model reports a mismatch. Instead, we pass the result to the fuzzer, which loads the next test
+  // case into the memories, and then hold everything in reset for a few cycles to start again.
+
+  // Defined in otbn_top_sim.cc
+  import "DPI-C" context function bit OtbnTopFuzzNextCase(int unsigned fail_bits,
+                                                          int unsigned err_bits,
+                                                          bit          timeout);
+
+  logic [1:0]  fuzz_rst_cnt;
+  int unsigned case_cycles;
+  logic        fuzz_case_done, fuzz_timeout;
+
+  assign fuzz_timeout = case_cycles >= fuzz_max_cycles;
+  assign fuzz_case_done = (fuzz_max_cycles != 0) && (fuzz_rst_cnt == 2'd0) &&
+                          (finish_counter == 2'd3 || bad_cycles >= 3 || fuzz_timeout);
+
+  always_ff @(posedge IO_CLK or negedge IO_RST_N) begin
+    if (!IO_RST_N) begin
+      fuzz_rst_cnt <= 2'd0;
+      case_cycles  <= 0;
+    end else begin
+      if (fuzz_rst_cnt != 2'd0) begin
+        fuzz_rst_cnt <= fuzz_rst_cnt - 2'd1;
+        case_cycles  <= 0;
+      end else begin
+        case_cycles <= case_cycles + 1;
+      end
+
+      if (fuzz_case_done) begin
+        if (OtbnTopFuzzNextCase({28'd0, done_mismatch_latched, err_bits_mismatch_latched,
+                                 cnt_mismatch_latched, model_err_latched},
+                                32'(otbn_err_bits_rr),
+                                fuzz_timeout && finish_counter != 2'd3 && bad_cycles < 3)) begin
+          fuzz_rst_cnt <= 2'd3;
+        end else begin
+          $finish;
+        end
+      end
+    end
+  end
+
+  assign rst_n = IO_RST_N & (fuzz_rst_cnt == 2'd0);
+
   // Defined in otbn_top_sim.cc
   import "DPI-C" context function int OtbnTopInstallLoopWarps();
   import "DPI-C" context function void OtbnTopApplyLoopWarp();
   import "DPI-C" context function void OtbnTopDumpState();
   bit warps_installed;
 
-  always_ff @(negedge IO_CLK or negedge IO_RST_N) begin
-    if (!IO_RST_N) begin
+  always_ff @(negedge IO_CLK or negedge rst_n) begin
+    if (!rst_n) begin
       warps_installed <= 1'b0;
     end else begin
       if (!warps_installed) begin
@@ -478,13 +536,13 @@ module otbn_top_sim (
       warps_installed <= 1'b1;
     end
   end
-  always_ff @(posedge IO_CLK or negedge IO_RST_N) begin
-    if (IO_RST_N) begin
+  always_ff @(posedge IO_CLK or negedge rst_n) begin
+    if (rst_n) begin
       OtbnTopApplyLoopWarp();
     end
   end
-  always_ff @(negedge IO_CLK or negedge IO_RST_N) begin
-    if (IO_RST_N && u_otbn_core.u_otbn_controller.start_secure_wipe) begin
+  always_ff @(negedge IO_CLK or negedge rst_n) begin
+    if (rst_n && u_otbn_core.u_otbn_controller.start_secure_wipe) begin
       // When OTBN starts a secure wipe this indicates the program has either terminated (executed
       // 'ecall') or hit an error, either way the execution is done. The state must be dumped as the
       // secure wipe is started so we can dump the final execution state not the all zeros state
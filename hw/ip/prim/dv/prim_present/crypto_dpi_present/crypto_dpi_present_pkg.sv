@@ -24,6 +24,18 @@ package crypto_dpi_present_pkg;
                                                        bit [DataWidth-1:0]        in,
                                                        output bit [DataWidth-1:0] out);
 
+  // Batched variants of the above: run all rounds for every block of `in` in a single call. `out`
+  // must have num_rounds entries per input block, entry [b*num_rounds + i] holds the state of
+  // block b after round i+1 (counting from the last round down for decryption).
+  import "DPI-C" function void c_dpi_present_encrypt_blocks(chandle                   h,
+                                                            int unsigned              num_rounds,
+                                                            input bit [DataWidth-1:0] in[],
+                                                            output bit [DataWidth-1:0] out[]);
+  import "DPI-C" function void c_dpi_present_decrypt_blocks(chandle                   h,
+                                                            int unsigned              num_rounds,
+                                                            input bit [DataWidth-1:0] in[],
+                                                            output bit [DataWidth-1:0] out[]);
+
   // This function encrypts the input plaintext with the PRESENT encryption algorithm.
   //
   // This produces a list of all intermediate values produced after each round of the algorithm,
@@ -35,19 +47,11 @@ package crypto_dpi_present_pkg;
     input int unsigned          num_rounds,
     output bit [DataWidth-1:0]  ciphertext
   );
+    bit [DataWidth-1:0] blocks[] = '{plaintext};
+    bit [DataWidth-1:0] states[];
 
-    bit [DataWidth-1:0] round_in, round_out;
-    chandle h = c_dpi_present_mk(key_size, key);
-
-    round_out = plaintext;
-    for (int i = 1; i <= num_rounds; i++) begin
-      round_in = round_out;
-      c_dpi_present_enc_round(h, i, i == num_rounds, round_in, round_out);
-    end
-    ciphertext = round_out;
-
-    c_dpi_present_free(h);
-
+    sv_dpi_present_encrypt_blocks(blocks, key, key_size, num_rounds, states);
+    ciphertext = states[num_rounds-1];
   endfunction
 
   // This function decrypts the input ciphertext with the PRESENT decryption algorithm.
@@ -61,16 +65,52 @@ package crypto_dpi_present_pkg;
     input int unsigned          num_rounds,
     output bit [DataWidth-1:0]  plaintext
   );
+    bit [DataWidth-1:0] blocks[] = '{ciphertext};
+    bit [DataWidth-1:0] states[];
+
+    sv_dpi_present_decrypt_blocks(blocks, key, key_size, num_rounds, states);
+    plaintext = states[num_rounds-1];
+  endfunction
+
+  // This function encrypts a list of plaintext blocks with the PRESENT encryption algorithm using
+  // a single DPI call.
+  //
+  // round_states receives num_rounds entries per block: entry [b*num_rounds + i] is the state of
+  // block b after round i+1, the last entry of each block is its ciphertext.
+  function automatic void sv_dpi_present_encrypt_blocks(
+    input bit [DataWidth-1:0]   plaintexts[],
+    input bit [MaxKeyWidth-1:0] key,
+    input int unsigned          key_size,
+    input int unsigned          num_rounds,
+    output bit [DataWidth-1:0]  round_states[]
+  );
+
+    chandle h = c_dpi_present_mk(key_size, key);
+
+    round_states = new[plaintexts.size() * num_rounds];
+    c_dpi_present_encrypt_blocks(h, num_rounds, plaintexts, round_states);
+
+    c_dpi_present_free(h);
+
+  endfunction
+
+  // This function decrypts a list of ciphertext blocks with the PRESENT decryption algorithm using
+  // a single DPI call.
+  //
+  // round_states receives num_rounds entries per block: entry [b*num_rounds + i] is the state of
+  // block b after undoing round num_rounds-i, the last entry of each block is its plaintext.
+  function automatic void sv_dpi_present_decrypt_blocks(
+    input bit [DataWidth-1:0]   ciphertexts[],
+    input bit [MaxKeyWidth-1:0] key,
+    input int unsigned          key_size,
+    input int unsigned          num_rounds,
+    output bit [DataWidth-1:0]  round_states[]
+  );
 
-    bit [DataWidth-1:0] round_in, round_out;
     chandle h = c_dpi_present_mk(key_size, key);
 
-    round_in = ciphertext;
-    for (int i = num_rounds; i > 0; i--) begin
-      c_dpi_present_dec_round(h, i, i == num_rounds, round_in, round_out);
-      round_in = round_out;
-    end
-    plaintext = round_out;
+    round_states = new[ciphertexts.size() * num_rounds];
+    c_dpi_present_decrypt_blocks(h, num_rounds, ciphertexts, round_states);
 
     c_dpi_present_free(h);
 
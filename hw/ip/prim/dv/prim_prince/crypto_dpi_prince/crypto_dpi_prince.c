@@ -6,6 +6,7 @@
 extern "C" {
 #endif
 
+#include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -13,6 +14,138 @@ extern "C" {
 #include "prince_ref.h"
 #include "svdpi.h"
 
+// Lookup tables for the table-based PRINCE engine used by the batched DPI
+// functions. The S-box tables substitute both nibbles of a byte at once. All
+// other layers are linear, so they are tabulated per byte position and the
+// output is the XOR of 8 lookups. The tables are derived from the reference
+// layer functions in prince_ref.h.
+static uint8_t prince_s8[256];
+static uint8_t prince_s8_inv[256];
+static uint64_t prince_m_prime_tab[8][256];
+static uint64_t prince_m_tab[8][256];
+static uint64_t prince_m_inv_tab[8][256];
+static int prince_tables_ready = 0;
+
+static const unsigned int kPrinceCheckInterval = 1024;
+static unsigned int prince_check_count = 0;
+
+static void prince_tables_init(void) {
+  if (prince_tables_ready) {
+    return;
+  }
+  for (unsigned int i = 0; i < 256; i++) {
+    prince_s8[i] = (uint8_t)prince_s_layer(i);
+    prince_s8_inv[i] = (uint8_t)prince_s_inv_layer(i);
+    for (unsigned int pos = 0; pos < 8; pos++) {
+      const uint64_t in = (uint64_t)i << (8 * pos);
+      prince_m_prime_tab[pos][i] = prince_m_prime_layer(in);
+      prince_m_tab[pos][i] = prince_m_layer(in);
+      prince_m_inv_tab[pos][i] = prince_m_inv_layer(in);
+    }
+  }
+  prince_tables_ready = 1;
+}
+
+static uint64_t prince_s_layer_fast(const uint8_t *s8, const uint64_t in) {
+  uint64_t out = 0;
+  for (unsigned int pos = 0; pos < 8; pos++) {
+    out |= (uint64_t)s8[(in >> (8 * pos)) & 0xFF] << (8 * pos);
+  }
+  return out;
+}
+
+static uint64_t prince_lin_layer_fast(const uint64_t tab[8][256],
+                                      const uint64_t in) {
+  uint64_t out = 0;
+  for (unsigned int pos = 0; pos < 8; pos++) {
+    out ^= tab[pos][(in >> (8 * pos)) & 0xFF];
+  }
+  return out;
+}
+
+/**
+ * Table-based equivalent of prince_core().
+ */
+static uint64_t prince_core_fast(const uint64_t core_input,
+                                 const uint64_t k0_new, const uint64_t k1,
+                                 int num_half_rounds) {
+  uint64_t state = core_input ^ k1 ^ prince_round_constant(0);
+  for (int round = 1; round <= num_half_rounds; round++) {
+    state = prince_lin_layer_fast(prince_m_tab,
+                                  prince_s_layer_fast(prince_s8, state));
+    state ^= ((round % 2 == 1) ? k0_new : k1) ^ prince_round_constant(round);
+  }
+  state = prince_s_layer_fast(prince_s8, state);
+  state = prince_lin_layer_fast(prince_m_prime_tab, state);
+  state = prince_s_layer_fast(prince_s8_inv, state);
+  for (int round = 1; round <= num_half_rounds; round++) {
+    state ^= (((num_half_rounds + round + 1) % 2 == 1) ? k0_new : k1) ^
+             prince_round_constant(10 - num_half_rounds + round);
+    state = prince_s_layer_fast(prince_s8_inv,
+                                prince_lin_layer_fast(prince_m_inv_tab, state));
+  }
+  return state ^ k1 ^ prince_round_constant(11);
+}
+
+/**
+ * Table-based equivalent of prince_enc_dec_uint64().
+ */
+static uint64_t prince_enc_dec_fast(const uint64_t input, const uint64_t enc_k0,
+                                    const uint64_t enc_k1, int decrypt,
+                                    int num_half_rounds, int old_key_schedule) {
+  const uint64_t prince_alpha = 0xc0ac29b7c97c50dd;
+  const uint64_t k1 = enc_k1 ^ (decrypt ? prince_alpha : 0);
+  const uint64_t k0_new =
+      (old_key_schedule) ? k1 : enc_k0 ^ (decrypt ? prince_alpha : 0);
+  const uint64_t enc_k0_prime = prince_k0_to_k0_prime(enc_k0);
+  const uint64_t k0 = decrypt ? enc_k0_prime : enc_k0;
+  const uint64_t k0_prime = decrypt ? enc_k0 : enc_k0_prime;
+  return prince_core_fast(input ^ k0, k0_new, k1, num_half_rounds) ^ k0_prime;
+}
+
+/**
+ * Encrypt/decrypt all blocks of data_i for 1 to num_half_rounds half rounds.
+ *
+ * data_o receives num_half_rounds entries per block, entry
+ * [b * num_half_rounds + i] is the result for block b using i + 1 half
+ * rounds. One in kPrinceCheckInterval blocks (starting with the very first
+ * one) is cross-checked against the reference implementation, and a mismatch
+ * aborts the simulation.
+ */
+static void prince_crypt_blocks(const svOpenArrayHandle data_i, uint64_t key0,
+                                uint64_t key1, int decrypt,
+                                int num_half_rounds, int old_key_schedule,
+                                svOpenArrayHandle data_o) {
+  const int num_blocks = svSize(data_i, 1);
+  assert(svSize(data_o, 1) == num_blocks * num_half_rounds);
+
+  prince_tables_init();
+
+  svBitVecVal w32s[2];
+  for (int b = 0; b < num_blocks; b++) {
+    svGetBitArrElem1VecVal(w32s, data_i, svLow(data_i, 1) + b);
+    const uint64_t input = ((uint64_t)w32s[1] << 32) | w32s[0];
+    const int check = prince_check_count++ % kPrinceCheckInterval == 0;
+    for (int i = 1; i <= num_half_rounds; i++) {
+      const uint64_t output = prince_enc_dec_fast(input, key0, key1, decrypt,
+                                                  i, old_key_schedule);
+      if (check &&
+          output != prince_enc_dec_uint64(input, key0, key1, decrypt, i,
+                                          old_key_schedule)) {
+        fprintf(stderr,
+                "ERROR: PRINCE table-based engine mismatch for %d half "
+                "rounds\n",
+                i);
+        abort();
+      }
+      w32s[1] = (svBitVecVal)(output >> 32);
+      w32s[0] = (svBitVecVal)output;
+      svPutBitArrElem1VecVal(data_o, w32s,
+                             svLow(data_o, 1) + b * num_half_rounds + i - 1);
+    }
+  }
+}
+
 extern uint64_t c_dpi_prince_encrypt(uint64_t plaintext, uint64_t key0,
                                      uint64_t key1, int num_half_rounds,
                                      int old_key_schedule) {
@@ -28,6 +161,24 @@ extern uint64_t c_dpi_prince_decrypt(const uint64_t ciphertext,
                                old_key_schedule);
 }
 
+extern void c_dpi_prince_encrypt_blocks(const svOpenArrayHandle data_i,
+                                        uint64_t key0, uint64_t key1,
+                                        int num_half_rounds,
+                                        int old_key_schedule,
+                                        svOpenArrayHandle data_o) {
+  prince_crypt_blocks(data_i, key0, key1, 0, num_half_rounds, old_key_schedule,
+                      data_o);
+}
+
+extern void c_dpi_prince_decrypt_blocks(const svOpenArrayHandle data_i,
+                                        uint64_t key0, uint64_t key1,
+                                        int num_half_rounds,
+                                        int old_key_schedule,
+                                        svOpenArrayHandle data_o) {
+  prince_crypt_blocks(data_i, key0, key1, 1, num_half_rounds, old_key_schedule,
+                      data_o);
+}
+
 #ifdef _cplusplus
 }
 #endif
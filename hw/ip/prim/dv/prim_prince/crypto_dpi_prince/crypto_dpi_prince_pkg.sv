@@ -27,6 +27,27 @@ package crypto_dpi_prince_pkg;
     input int unsigned      new_key_schedule
   );
 
+  // Batched variants of the above: process every block of data_i for 1 to num_half_rounds
+  // half-rounds in a single call. data_o must have num_half_rounds entries per input block, entry
+  // [b*num_half_rounds + i] holds the result for block b using i+1 half-rounds.
+  import "DPI-C" context function void c_dpi_prince_encrypt_blocks(
+    input bit [63:0]        data_i[],
+    input longint unsigned  key0,
+    input longint unsigned  key1,
+    input int unsigned      num_half_rounds,
+    input int unsigned      old_key_schedule,
+    output bit [63:0]       data_o[]
+  );
+
+  import "DPI-C" context function void c_dpi_prince_decrypt_blocks(
+    input bit [63:0]        data_i[],
+    input longint unsigned  key0,
+    input longint unsigned  key1,
+    input int unsigned      num_half_rounds,
+    input int unsigned      old_key_schedule,
+    output bit [63:0]       data_o[]
+  );
+
   //////////////////////////////////////////////////////
   // SV wrapper functions to be used by the testbench //
   //////////////////////////////////////////////////////
@@ -37,12 +58,11 @@ package crypto_dpi_prince_pkg;
     input bit                             old_key_schedule,
     output bit [NumRoundsHalf-1:0][63:0]  ciphertext
   );
+    bit [63:0] blocks[] = '{plaintext};
+    bit [63:0] results[];
+    sv_dpi_prince_encrypt_blocks(blocks, key, old_key_schedule, results);
     for (int i = 0; i < NumRoundsHalf; i++) begin
-      ciphertext[i] = c_dpi_prince_encrypt(plaintext,
-                                           key[127:64], // k0 gets assigned the MSB halve
-                                           key[63:0],   // k1 gets assigned the LSB halve
-                                           i+1,
-                                           old_key_schedule);
+      ciphertext[i] = results[i];
     end
   endfunction
 
@@ -61,4 +81,42 @@ package crypto_dpi_prince_pkg;
     end
   endfunction
 
+  // Encrypts a list of blocks with all numbers of half-rounds using a single DPI call.
+  //
+  // ciphertexts receives NumRoundsHalf entries per block, entry [b*NumRoundsHalf + i] is the
+  // result for block b using i+1 half-rounds.
+  function automatic void sv_dpi_prince_encrypt_blocks(
+    input bit [63:0]    plaintexts[],
+    input bit [127:0]   key,
+    input bit           old_key_schedule,
+    output bit [63:0]   ciphertexts[]
+  );
+    ciphertexts = new[plaintexts.size() * NumRoundsHalf];
+    c_dpi_prince_encrypt_blocks(plaintexts,
+                                key[127:64],  // k0 gets assigned the MSB halve
+                                key[63:0],    // k1 gets assigned the LSB halve
+                                NumRoundsHalf,
+                                old_key_schedule,
+                                ciphertexts);
+  endfunction
+
+  // Decrypts a list of blocks with all numbers of half-rounds using a single DPI call.
+  //
+  // plaintexts receives NumRoundsHalf entries per block, entry [b*NumRoundsHalf + i] is the
+  // result for block b using i+1 half-rounds.
+  function automatic void sv_dpi_prince_decrypt_blocks(
+    input bit [63:0]    ciphertexts[],
+    input bit [127:0]   key,
+    input bit           old_key_schedule,
+    output bit [63:0]   plaintexts[]
+  );
+    plaintexts = new[ciphertexts.size() * NumRoundsHalf];
+    c_dpi_prince_decrypt_blocks(ciphertexts,
+                                key[127:64],  // k0 gets assigned the MSB halve
+                                key[63:0],    // k1 gets assigned the LSB halve
+                                NumRoundsHalf,
+                                old_key_schedule,
+                                plaintexts);
+  endfunction
+
 endpackage
@@ -21,6 +21,17 @@ static uint32_t crc32_internal_add8(uint32_t ctx, uint8_t byte) {
   return ctx;
 }
 
+OT_WARN_UNUSED_RESULT
+static uint32_t crc32_internal_add16(uint32_t ctx, uint16_t halfword) {
+  ctx ^= halfword;
+  asm(".option push;"
+      ".option arch, +zbr0p93;"
+      "crc32.h %0, %1;"
+      ".option pop;"
+      : "+r"(ctx));
+  return ctx;
+}
+
 OT_WARN_UNUSED_RESULT
 static uint32_t crc32_internal_add32(uint32_t ctx, uint32_t word) {
   ctx ^= word;
@@ -60,6 +71,12 @@ static uint32_t crc32_internal_add8(uint32_t ctx, uint8_t byte) {
   return ctx;
 }
 
+OT_WARN_UNUSED_RESULT
+static uint32_t crc32_internal_add16(uint32_t ctx, uint16_t halfword) {
+  ctx = crc32_internal_add8(ctx, halfword & UINT8_MAX);
+  return crc32_internal_add8(ctx, (uint8_t)(halfword >> 8));
+}
+
 OT_WARN_UNUSED_RESULT
 static uint32_t crc32_internal_add32(uint32_t ctx, uint32_t word) {
   char *bytes = (char *)&word;
@@ -80,6 +97,11 @@ void crc32_add32(uint32_t *ctx, uint32_t word) {
   *ctx = crc32_internal_add32(*ctx, word);
 }
 
+void crc32_add48(uint32_t *ctx, uint32_t word, uint16_t halfword) {
+  uint32_t state = crc32_internal_add32(*ctx, word);
+  *ctx = crc32_internal_add16(state, halfword);
+}
+
 void crc32_add(uint32_t *ctx, const void *buf, size_t len) {
   const char *data = buf;
   uint32_t state = *ctx;
@@ -37,6 +37,18 @@ void crc32_add8(uint32_t *ctx, uint8_t byte);
  */
 void crc32_add32(uint32_t *ctx, uint32_t word);
 
+/**
+ * Adds a 48-bit item to a CRC32.
+ *
+ * Equivalent to adding the six bytes of `word` and `halfword` in little-endian
+ * order with `crc32_add()`, without staging them in memory first.
+ *
+ * @param[in, out] ctx Context variable.
+ * @param word Low 32 bits of the item.
+ * @param halfword High 16 bits of the item.
+ */
+void crc32_add48(uint32_t *ctx, uint32_t word, uint16_t halfword);
+
 /**
  * Adds a buffer to a CRC32.
  *
@@ -87,5 +87,28 @@ TEST_F(CrcTest, Crc32Add32) {
   EXPECT_EQ(crc32_finish(&ctx), kExpCrc);
 }
 
+TEST_F(CrcTest, Crc32Add48) {
+  uint32_t ctx;
+  crc32_init(&ctx);
+  constexpr uint32_t kExpCrc = 0x9508ac14;
+
+  // Same bytes as in `Crc32Add32`, split into a 48-bit and a 16-bit item.
+  crc32_add48(&ctx, 0xcafecafe, 0xb002);
+  crc32_add8(&ctx, 0xad);
+  crc32_add8(&ctx, 0x1b);
+
+  EXPECT_EQ(crc32_finish(&ctx), kExpCrc);
+}
+
+TEST_F(CrcTest, Crc32Add48MatchesAdd) {
+  const uint8_t kItem[] = {0x78, 0x56, 0x34, 0x12, 0xcd, 0x7b};
+
+  uint32_t ctx;
+  crc32_init(&ctx);
+  crc32_add48(&ctx, 0x12345678, 0x7bcd);
+
+  EXPECT_EQ(crc32_finish(&ctx), crc32(kItem, sizeof(kItem)));
+}
+
 }  // namespace
 }  // namespace crc32_unittest
@@ -17,6 +17,10 @@ void crc32_add32(uint32_t *ctx, uint32_t word) {
   MockCrc32::Instance().Add32(ctx, word);
 }
 
+void crc32_add48(uint32_t *ctx, uint32_t word, uint16_t halfword) {
+  MockCrc32::Instance().Add48(ctx, word, halfword);
+}
+
 void crc32_add(uint32_t *ctx, const void *buf, size_t len) {
   MockCrc32::Instance().Add(ctx, buf, len);
 }
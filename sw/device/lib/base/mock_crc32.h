@@ -19,6 +19,7 @@ class MockCrc32 : public global_mock::GlobalMock<MockCrc32> {
   MOCK_METHOD(void, Init, (uint32_t *));
   MOCK_METHOD(void, Add8, (uint32_t *, uint8_t));
   MOCK_METHOD(void, Add32, (uint32_t *, uint32_t));
+  MOCK_METHOD(void, Add48, (uint32_t *, uint32_t, uint16_t));
   MOCK_METHOD(void, Add, (uint32_t *, const void *, size_t));
   MOCK_METHOD(uint32_t, Finish, (const uint32_t *));
   MOCK_METHOD(uint32_t, Crc32, (const void *, size_t));
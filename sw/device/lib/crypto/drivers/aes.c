@@ -343,6 +343,83 @@ status_t aes_update(aes_block_t *dest, const aes_block_t *src) {
   return OTCRYPTO_OK;
 }
 
+static_assert(kAesBlockNumWords == 4,
+              "The AES data register accessors assume 4-word blocks.");
+
+/**
+ * Reads one block from the AES output registers.
+ *
+ * The caller must check that the output is valid.
+ *
+ * @param[out] dest Output block.
+ */
+static inline void aes_data_out_read(aes_block_t *dest) {
+  uint32_t offset = aes_base() + AES_DATA_OUT_0_REG_OFFSET;
+  dest->data[0] = abs_mmio_read32(offset);
+  dest->data[1] = abs_mmio_read32(offset + sizeof(uint32_t));
+  dest->data[2] = abs_mmio_read32(offset + 2 * sizeof(uint32_t));
+  dest->data[3] = abs_mmio_read32(offset + 3 * sizeof(uint32_t));
+}
+
+/**
+ * Writes one block to the AES input registers.
+ *
+ * The caller must check that the hardware is ready for input.
+ *
+ * @param src Input block.
+ */
+static inline void aes_data_in_write(const aes_block_t *src) {
+  uint32_t offset = aes_base() + AES_DATA_IN_0_REG_OFFSET;
+  abs_mmio_write32(offset, src->data[0]);
+  abs_mmio_write32(offset + sizeof(uint32_t), src->data[1]);
+  abs_mmio_write32(offset + 2 * sizeof(uint32_t), src->data[2]);
+  abs_mmio_write32(offset + 3 * sizeof(uint32_t), src->data[3]);
+}
+
+status_t aes_update_blocks(aes_block_t *dest, const aes_block_t *src,
+                           size_t nblocks) {
+  if (nblocks == 0) {
+    return OTCRYPTO_OK;
+  }
+  if (dest == NULL || src == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Keep up to three blocks in flight: software reads block `out` while the
+  // hardware processes block `out + 1` and software writes block `in`. With
+  // fewer than three blocks, only keep one block in the input registers.
+  const size_t depth = nblocks >= 3 ? 2 : 1;
+  size_t in = 0;
+  size_t out = 0;
+
+  // Prime the pipeline.
+  for (; in < depth; ++in) {
+    HARDENED_TRY(spin_until(AES_STATUS_INPUT_READY_BIT));
+    aes_data_in_write(&src[in]);
+  }
+
+  // Steady state: alternate between reading output and writing input.
+  for (; in < nblocks; ++in, ++out) {
+    HARDENED_TRY(spin_until(AES_STATUS_OUTPUT_VALID_BIT));
+    aes_data_out_read(&dest[out]);
+    HARDENED_TRY(spin_until(AES_STATUS_INPUT_READY_BIT));
+    aes_data_in_write(&src[in]);
+  }
+
+  // Drain the pipeline.
+  for (; out < nblocks; ++out) {
+    HARDENED_TRY(spin_until(AES_STATUS_OUTPUT_VALID_BIT));
+    aes_data_out_read(&dest[out]);
+  }
+
+  // Check that the loops ran for the correct number of iterations.
+  HARDENED_CHECK_EQ(launder32(in), nblocks);
+  HARDENED_CHECK_EQ(launder32(out), nblocks);
+  HARDENED_CHECK_EQ(in, out);
+
+  return OTCRYPTO_OK;
+}
+
 status_t aes_end(aes_block_t *iv) {
   uint32_t ctrl_reg = AES_CTRL_SHADOWED_REG_RESVAL;
   ctrl_reg = bitfield_bit32_write(ctrl_reg,
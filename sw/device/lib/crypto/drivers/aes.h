@@ -161,6 +161,30 @@ status_t aes_decrypt_begin(const aes_key_t key, const aes_block_t *iv);
 OT_WARN_UNUSED_RESULT
 status_t aes_update(aes_block_t *dest, const aes_block_t *src);
 
+/**
+ * Runs a batch of blocks through the AES cipher.
+ *
+ * Equivalent to calling `aes_update` once per block and reading the outputs,
+ * but keeps the input and output registers busy at the same time: output
+ * block `i` is read while the hardware works on block `i + 1` and block
+ * `i + 2` is written. Iteration counts are checked once per batch.
+ *
+ * The pipeline must be empty (no output pending) when this is called, and it
+ * is empty again on return, so several batches may be run between
+ * `aes_*_begin` and `aes_end`.
+ *
+ * `dest` may be equal to `src` for in-place operation, but the buffers must
+ * not otherwise overlap.
+ *
+ * @param[out] dest Output blocks (`nblocks` long).
+ * @param src Input blocks (`nblocks` long).
+ * @param nblocks Number of blocks.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+status_t aes_update_blocks(aes_block_t *dest, const aes_block_t *src,
+                           size_t nblocks);
+
 /**
  * Completes an AES session by clearing control settings and key material.
  *
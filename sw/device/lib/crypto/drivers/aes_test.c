@@ -111,6 +111,22 @@ static status_t run_aes_test(void) {
 
   CHECK_ARRAYS_EQ(final_iv.data, kFinalIv.data, kAesBlockNumWords);
 
+  LOG_INFO("Repeating with batched updates.");
+  TRY(aes_encrypt_begin(key, &kIv));
+
+  // Run one single-block batch and one multi-block batch, in place, so that
+  // both pipeline depths are exercised.
+  aes_block_t blocks[ARRAYSIZE(kPlaintext)];
+  memcpy(blocks, kPlaintext, sizeof(blocks));
+  TRY(aes_update_blocks(blocks, blocks, 1));
+  TRY(aes_update_blocks(&blocks[1], &blocks[1], ARRAYSIZE(blocks) - 1));
+
+  CHECK_ARRAYS_EQ((uint32_t *)blocks, (uint32_t *)kCiphertext,
+                  sizeof(blocks) / (sizeof(uint32_t)));
+
+  TRY(aes_end(&final_iv));
+  CHECK_ARRAYS_EQ(final_iv.data, kFinalIv.data, kAesBlockNumWords);
+
   return OTCRYPTO_OK;
 }
 
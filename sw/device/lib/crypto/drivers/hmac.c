@@ -333,31 +333,42 @@ static status_t hmac_context_wipe(hmac_ctx_t *ctx) {
  * Write given byte array into the `MSG_FIFO`. This function should only be
  * called when HMAC HWIP is already running and expecting further message bytes.
  *
+ * The HMAC block applies back-pressure on the interconnect while the FIFO is
+ * full, so no status polling is needed between writes.
+ *
  * @param message The incoming message buffer to be fed into HMAC_FIFO.
  * @param message_len The length of `message` in bytes.
  * @return Result of the operation.
  */
 static status_t msg_fifo_write(const uint8_t *message, size_t message_len) {
-  // TODO(#23191): Should we handle backpressure here?
   // Begin by writing a one byte at a time until the data is aligned.
   size_t i = 0;
-  const uint32_t kBase = hmac_base();
+  const uint32_t kFifoAddr = hmac_base() + HMAC_MSG_FIFO_REG_OFFSET;
   for (; misalignment32_of((uintptr_t)(&message[i])) > 0 &&
          launder32(i) < message_len;
        i++) {
-    abs_mmio_write8(kBase + HMAC_MSG_FIFO_REG_OFFSET, message[i]);
+    abs_mmio_write8(kFifoAddr, message[i]);
+  }
+
+  // Write four words at a time as long as there are four full words.
+  for (; launder32(i + 4 * sizeof(uint32_t)) <= message_len;
+       i += 4 * sizeof(uint32_t)) {
+    abs_mmio_write32(kFifoAddr, read_32(&message[i]));
+    abs_mmio_write32(kFifoAddr, read_32(&message[i + 4]));
+    abs_mmio_write32(kFifoAddr, read_32(&message[i + 8]));
+    abs_mmio_write32(kFifoAddr, read_32(&message[i + 12]));
   }
 
   // Write one word at a time as long as there is a full word available.
   for (; launder32(i + sizeof(uint32_t)) <= message_len;
        i += sizeof(uint32_t)) {
     uint32_t next_word = read_32(&message[i]);
-    abs_mmio_write32(kBase + HMAC_MSG_FIFO_REG_OFFSET, next_word);
+    abs_mmio_write32(kFifoAddr, next_word);
   }
 
   // For the last few bytes, we need to write one byte at a time again.
   for (; launder32(i) < message_len; i++) {
-    abs_mmio_write8(kBase + HMAC_MSG_FIFO_REG_OFFSET, message[i]);
+    abs_mmio_write8(kFifoAddr, message[i]);
   }
   // Check that the loops ran for the correct number of iterations.
   HARDENED_CHECK_EQ(i, message_len);
@@ -465,6 +465,29 @@ static status_t kmac_set_prefix_regs(const unsigned char *func_name,
   return OTCRYPTO_OK;
 }
 
+/**
+ * Token of the streaming operation holding the KMAC block, or 0 if none.
+ */
+static uint32_t kmac_stream_session = 0;
+
+/**
+ * Check that no streaming operation holds the KMAC block.
+ *
+ * A streaming operation leaves the block in the absorb or squeeze state
+ * between calls, so other operations must fail instead of waiting for it to
+ * become idle.
+ *
+ * @return `OTCRYPTO_RECOV_ERR` if the block is held, OK otherwise.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_check_unclaimed(void) {
+  if (launder32(kmac_stream_session) != 0) {
+    return OTCRYPTO_RECOV_ERR;
+  }
+  HARDENED_CHECK_EQ(kmac_stream_session, 0);
+  return OTCRYPTO_OK;
+}
+
 /**
  * Initializes the KMAC configuration.
  *
@@ -493,6 +516,7 @@ OT_WARN_UNUSED_RESULT
 static status_t kmac_init(kmac_operation_t operation,
                           kmac_security_str_t security_str,
                           hardened_bool_t hw_backed) {
+  HARDENED_TRY(kmac_check_unclaimed());
   HARDENED_TRY(wait_status_bit(KMAC_STATUS_SHA3_IDLE_BIT, 1));
 
   // If the operation is KMAC, ensure that the entropy complex has been
@@ -592,71 +616,132 @@ static status_t kmac_write_key_block(kmac_blinded_key_t *key) {
 }
 
 /**
- * Common routine for feeding message blocks during SHA/SHAKE/cSHAKE/KMAC.
+ * Issue a command to the KMAC block.
  *
- * Before running this, the operation type must be configured with kmac_init.
- * Then, we can use this function to feed various bytes of data to the KMAC
- * core. Note that this is a one-shot implementation, and it does not support
- * streaming mode.
- *
- * This routine does not check input parameters for consistency. For instance,
- * one can invoke SHA-3_224 with digest_len=32, which will produce 256 bits of
- * digest. The caller is responsible for ensuring that the digest length and
- * mode are consistent.
+ * @param cmd Value for the CMD field (e.g. `KMAC_CMD_CMD_VALUE_START`).
+ */
+static void kmac_issue_cmd(uint32_t cmd) {
+  uint32_t cmd_reg = KMAC_CMD_REG_RESVAL;
+  cmd_reg = bitfield_field32_write(cmd_reg, KMAC_CMD_CMD_FIELD, cmd);
+  abs_mmio_write32(kmac_base() + KMAC_CMD_REG_OFFSET, cmd_reg);
+}
+
+/**
+ * Start absorbing a new message.
  *
- * The caller must ensure that `message_len` bytes (rounded up to the next 32b
- * word) are allocated at the location pointed to by `message`, and similarly
- * that `digest_len_words` 32-bit words are allocated at the location pointed
- * to by `digest`. If `masked_digest` is set, then `digest` must contain 2x
- * `digest_len_words` to fit both shares.
+ * Waits for the block to be idle and issues the start command, so that
+ * messages written to MSG_FIFO are forwarded to Keccak.
  *
- * @param operation The operation type.
- * @param message Input message string.
- * @param message_len Message length in bytes.
- * @param digest The struct to which the result will be written.
- * @param digest_len_words Requested digest length in 32-bit words.
- * @param masked_digest Whether to return the digest in two shares.
  * @return Error code.
  */
 OT_WARN_UNUSED_RESULT
-static status_t kmac_process_msg_blocks(kmac_operation_t operation,
-                                        const uint8_t *message,
-                                        size_t message_len, uint32_t *digest,
-                                        size_t digest_len_words,
-                                        hardened_bool_t masked_digest) {
+static status_t kmac_absorb_start(void) {
   // Block until KMAC is idle.
   HARDENED_TRY(wait_status_bit(KMAC_STATUS_SHA3_IDLE_BIT, 1));
+  kmac_issue_cmd(KMAC_CMD_CMD_VALUE_START);
+  return wait_status_bit(KMAC_STATUS_SHA3_ABSORB_BIT, 1);
+}
 
-  // Issue the start command, so that messages written to MSG_FIFO are forwarded
-  // to Keccak
-  const uint32_t kBase = kmac_base();
-  uint32_t cmd_reg = KMAC_CMD_REG_RESVAL;
-  cmd_reg = bitfield_field32_write(cmd_reg, KMAC_CMD_CMD_FIELD,
-                                   KMAC_CMD_CMD_VALUE_START);
-  abs_mmio_write32(kBase + KMAC_CMD_REG_OFFSET, cmd_reg);
-  HARDENED_TRY(wait_status_bit(KMAC_STATUS_SHA3_ABSORB_BIT, 1));
+/**
+ * Get the number of bytes that can be written to MSG_FIFO without stalling.
+ *
+ * Reads the STATUS register once and converts the free FIFO entries to bytes.
+ * Also checks the alert bits in the same way as `wait_status_bit`.
+ *
+ * @param[out] free_bytes Number of free bytes in MSG_FIFO.
+ * @return Error code.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_fifo_free_bytes(size_t *free_bytes) {
+  uint32_t reg = abs_mmio_read32(kmac_base() + KMAC_STATUS_REG_OFFSET);
+  if (bitfield_bit32_read(reg, KMAC_STATUS_ALERT_FATAL_FAULT_BIT)) {
+    return OTCRYPTO_FATAL_ERR;
+  }
+  if (bitfield_bit32_read(reg, KMAC_STATUS_ALERT_RECOV_CTRL_UPDATE_ERR_BIT)) {
+    return OTCRYPTO_RECOV_ERR;
+  }
+  uint32_t fifo_depth =
+      bitfield_field32_read(reg, KMAC_STATUS_FIFO_DEPTH_FIELD);
+  if (fifo_depth > KMAC_PARAM_NUM_ENTRIES_MSG_FIFO) {
+    return OTCRYPTO_FATAL_ERR;
+  }
+  *free_bytes = (KMAC_PARAM_NUM_ENTRIES_MSG_FIFO - fifo_depth) *
+                KMAC_PARAM_NUM_BYTES_MSG_FIFO_ENTRY;
+  return OTCRYPTO_OK;
+}
+
+/**
+ * Write message bytes to MSG_FIFO.
+ *
+ * The block must be in the absorb state. The message may have any alignment.
+ *
+ * Rather than polling STATUS before every write, this reads the FIFO depth
+ * once and then writes as many bytes as fit in the free entries. Bursts end
+ * on a word boundary of the message where possible, so that only the first
+ * and last few bytes of the message are written one byte at a time.
+ *
+ * @param message Input message string.
+ * @param message_len Message length in bytes.
+ * @return Error code.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_msg_write(const uint8_t *message, size_t message_len) {
+  const uint32_t kFifoAddr = kmac_base() + KMAC_MSG_FIFO_REG_OFFSET;
 
-  // Begin by writing a one byte at a time until the data is aligned.
   size_t i = 0;
-  for (; misalignment32_of((uintptr_t)(&message[i])) > 0 && i < message_len;
-       i++) {
-    HARDENED_TRY(wait_status_bit(KMAC_STATUS_FIFO_FULL_BIT, 0));
-    abs_mmio_write8(kBase + KMAC_MSG_FIFO_REG_OFFSET, message[i]);
-  }
+  while (launder32(i) < message_len) {
+    size_t burst_len;
+    HARDENED_TRY(kmac_fifo_free_bytes(&burst_len));
+    size_t burst_end = message_len;
+    if (message_len - i > burst_len) {
+      // The FIFO is full if `burst_len` is zero, in which case this loop
+      // polls STATUS again.
+      burst_end = i + burst_len;
+      if (burst_len >= sizeof(uint32_t)) {
+        burst_end -= misalignment32_of((uintptr_t)(&message[burst_end]));
+      }
+    }
 
-  // Write one word at a time as long as there is a full word available.
-  for (; i + sizeof(uint32_t) <= message_len; i += sizeof(uint32_t)) {
-    HARDENED_TRY(wait_status_bit(KMAC_STATUS_FIFO_FULL_BIT, 0));
-    uint32_t next_word = read_32(&message[i]);
-    abs_mmio_write32(kBase + KMAC_MSG_FIFO_REG_OFFSET, next_word);
-  }
+    // Write one byte at a time until the data is aligned.
+    for (; misalignment32_of((uintptr_t)(&message[i])) > 0 && i < burst_end;
+         i++) {
+      abs_mmio_write8(kFifoAddr, message[i]);
+    }
+
+    // Write the aligned body four words at a time.
+    for (; i + 4 * sizeof(uint32_t) <= burst_end; i += 4 * sizeof(uint32_t)) {
+      abs_mmio_write32(kFifoAddr, read_32(&message[i]));
+      abs_mmio_write32(kFifoAddr, read_32(&message[i + 4]));
+      abs_mmio_write32(kFifoAddr, read_32(&message[i + 8]));
+      abs_mmio_write32(kFifoAddr, read_32(&message[i + 12]));
+    }
+    for (; i + sizeof(uint32_t) <= burst_end; i += sizeof(uint32_t)) {
+      abs_mmio_write32(kFifoAddr, read_32(&message[i]));
+    }
 
-  // For the last few bytes, we need to write one byte at a time again.
-  for (; i < message_len; i++) {
-    HARDENED_TRY(wait_status_bit(KMAC_STATUS_FIFO_FULL_BIT, 0));
-    abs_mmio_write8(kmac_base() + KMAC_MSG_FIFO_REG_OFFSET, message[i]);
+    // For the last few bytes, we need to write one byte at a time again.
+    for (; i < burst_end; i++) {
+      abs_mmio_write8(kFifoAddr, message[i]);
+    }
   }
+  // Check that the loops ran for the correct number of iterations.
+  HARDENED_CHECK_EQ(i, message_len);
+
+  return OTCRYPTO_OK;
+}
 
+/**
+ * Finish absorbing and wait for the block to enter the squeeze state.
+ *
+ * For KMAC, first appends `right_encode(digest_len_bits)` to the message.
+ *
+ * @param operation The operation type.
+ * @param digest_len_words Requested digest length in 32-bit words.
+ * @return Error code.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_absorb_finish(kmac_operation_t operation,
+                                   size_t digest_len_words) {
   // If operation=KMAC, then we need to write `right_encode(digest->len)`
   if (operation == kKmacOperationKmac) {
     uint32_t digest_len_bits = 8 * sizeof(uint32_t) * digest_len_words;
@@ -673,57 +758,78 @@ static status_t kmac_process_msg_blocks(kmac_operation_t operation,
     uint8_t bytes_written;
     HARDENED_TRY(little_endian_encode(digest_len_bits, buf, &bytes_written));
     buf[bytes_written] = bytes_written;
-    uint8_t *fifo_dst = (uint8_t *)(kBase + KMAC_MSG_FIFO_REG_OFFSET);
+    uint8_t *fifo_dst = (uint8_t *)(kmac_base() + KMAC_MSG_FIFO_REG_OFFSET);
     memcpy(fifo_dst, buf, bytes_written + 1);
   }
 
   // Issue the process command, so that squeezing phase can start
-  cmd_reg = KMAC_CMD_REG_RESVAL;
-  cmd_reg = bitfield_field32_write(cmd_reg, KMAC_CMD_CMD_FIELD,
-                                   KMAC_CMD_CMD_VALUE_PROCESS);
-  abs_mmio_write32(kBase + KMAC_CMD_REG_OFFSET, cmd_reg);
+  kmac_issue_cmd(KMAC_CMD_CMD_VALUE_PROCESS);
 
   // Wait until squeezing is done
-  HARDENED_TRY(wait_status_bit(KMAC_STATUS_SHA3_SQUEEZE_BIT, 1));
-
-  uint32_t cfg_reg = abs_mmio_read32(kBase + KMAC_CFG_SHADOWED_REG_OFFSET);
-  uint32_t keccak_str =
-      bitfield_field32_read(cfg_reg, KMAC_CFG_SHADOWED_KSTRENGTH_FIELD);
-  size_t keccak_rate_words;
-  HARDENED_TRY(kmac_get_keccak_rate_words(keccak_str, &keccak_rate_words));
+  return wait_status_bit(KMAC_STATUS_SHA3_SQUEEZE_BIT, 1);
+}
 
-  // Finally, we can read the two shares of digest and XOR them.
+/**
+ * Read digest words from the Keccak state.
+ *
+ * The block must be in the squeeze state. Reading starts at word
+ * `*state_offset` of the current block of state; when a block is used up,
+ * `CMD.RUN` is issued to generate the next one. On return, `*state_offset`
+ * holds the number of words read from the current block, so that a later call
+ * can continue from there.
+ *
+ * If `masked_digest` is set, then `digest` must contain 2x `digest_len_words`
+ * to fit both shares.
+ *
+ * @param[out] digest Output buffer for the result.
+ * @param digest_len_words Requested digest length in 32-bit words.
+ * @param masked_digest Whether to return the digest in two shares.
+ * @param keccak_rate_words Keccak rate in 32-bit words.
+ * @param[in,out] state_offset Words already read from the current block.
+ * @return Error code.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_state_read(uint32_t *digest, size_t digest_len_words,
+                                hardened_bool_t masked_digest,
+                                size_t keccak_rate_words,
+                                size_t *state_offset) {
+  const uint32_t kBase = kmac_base();
   size_t idx = 0;
 
   while (launder32(idx) < digest_len_words) {
-    // Since we always read in increments of the Keccak rate, the index at
-    // start should always be a multiple of the rate.
-    HARDENED_CHECK_EQ(idx % keccak_rate_words, 0);
+    // If we read all the words of the current block and still need more
+    // digest, issue `CMD.RUN` to generate more state.
+    if (launder32(*state_offset) == keccak_rate_words) {
+      HARDENED_CHECK_EQ(*state_offset, keccak_rate_words);
+      kmac_issue_cmd(KMAC_CMD_CMD_VALUE_RUN);
+      *state_offset = 0;
+    }
+    HARDENED_CHECK_LT(*state_offset, keccak_rate_words);
 
     // Poll the status register until in the 'squeeze' state.
     HARDENED_TRY(wait_status_bit(KMAC_STATUS_SHA3_SQUEEZE_BIT, 1));
 
-    // Read words from the state registers (either `digest_len_words` or the
-    // maximum number of words available).
-    size_t offset = 0;
+    // Read words from the state registers (either the remaining digest words
+    // or the maximum number of words available).
+    size_t num_words = keccak_rate_words - *state_offset;
+    if (num_words > digest_len_words - idx) {
+      num_words = digest_len_words - idx;
+    }
+    const uint32_t kShare0 =
+        kBase + KMAC_STATE_REG_OFFSET + *state_offset * sizeof(uint32_t);
+    const uint32_t kShare1 = kShare0 + kKmacStateShareSize;
+    size_t i;
     if (launder32(masked_digest) == kHardenedBoolTrue) {
       HARDENED_CHECK_EQ(masked_digest, kHardenedBoolTrue);
       // Read the digest into each share in turn. Do this in separate loops so
       // corresponding shares aren't handled close together.
-      for (offset = 0; launder32(idx + offset) < digest_len_words &&
-                       offset < keccak_rate_words;
-           offset++) {
-        digest[idx + offset] = abs_mmio_read32(kBase + KMAC_STATE_REG_OFFSET +
-                                               offset * sizeof(uint32_t));
+      for (i = 0; launder32(i) < num_words; i++) {
+        digest[idx + i] = abs_mmio_read32(kShare0 + i * sizeof(uint32_t));
       }
-      for (offset = 0; launder32(idx + offset) < digest_len_words &&
-                       offset < keccak_rate_words;
-           offset++) {
-        digest[idx + offset + digest_len_words] =
-            abs_mmio_read32(kBase + KMAC_STATE_REG_OFFSET +
-                            kKmacStateShareSize + offset * sizeof(uint32_t));
+      for (i = 0; launder32(i) < num_words; i++) {
+        digest[idx + i + digest_len_words] =
+            abs_mmio_read32(kShare1 + i * sizeof(uint32_t));
       }
-      idx += offset;
     } else {
       // Skip right to the hardened check here instead of returning
       // `OTCRYPTO_BAD_ARGS` if the value is not `kHardenedBoolFalse`; this
@@ -731,39 +837,83 @@ static status_t kmac_process_msg_blocks(kmac_operation_t operation,
       // valid and should be suspicious if it's not.
       HARDENED_CHECK_EQ(masked_digest, kHardenedBoolFalse);
       // Unmask the digest as we read it.
-      for (; launder32(idx) < digest_len_words && offset < keccak_rate_words;
-           offset++) {
-        digest[idx] = abs_mmio_read32(kBase + KMAC_STATE_REG_OFFSET +
-                                      offset * sizeof(uint32_t));
-        digest[idx] ^=
-            abs_mmio_read32(kBase + KMAC_STATE_REG_OFFSET +
-                            kKmacStateShareSize + offset * sizeof(uint32_t));
-        idx++;
+      for (i = 0; launder32(i) < num_words; i++) {
+        digest[idx + i] = abs_mmio_read32(kShare0 + i * sizeof(uint32_t));
+        digest[idx + i] ^= abs_mmio_read32(kShare1 + i * sizeof(uint32_t));
       }
     }
-
-    // If we read all the remaining words and still need more digest, issue
-    // `CMD.RUN` to generate more state.
-    if (launder32(offset) == keccak_rate_words && idx < digest_len_words) {
-      HARDENED_CHECK_EQ(offset, keccak_rate_words);
-      cmd_reg = KMAC_CMD_REG_RESVAL;
-      cmd_reg = bitfield_field32_write(cmd_reg, KMAC_CMD_CMD_FIELD,
-                                       KMAC_CMD_CMD_VALUE_RUN);
-      abs_mmio_write32(kBase + KMAC_CMD_REG_OFFSET, cmd_reg);
-    }
+    HARDENED_CHECK_EQ(i, num_words);
+    idx += num_words;
+    *state_offset += num_words;
   }
   HARDENED_CHECK_EQ(idx, digest_len_words);
 
+  return OTCRYPTO_OK;
+}
+
+/**
+ * Release the KMAC block after squeezing, so that it goes back to idle mode.
+ *
+ * @return Error code.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_squeeze_done(void) {
   // Poll the status register until in the 'squeeze' state.
   HARDENED_TRY(wait_status_bit(KMAC_STATUS_SHA3_SQUEEZE_BIT, 1));
+  kmac_issue_cmd(KMAC_CMD_CMD_VALUE_DONE);
+  return OTCRYPTO_OK;
+}
 
-  // Release the KMAC core, so that it goes back to idle mode
-  cmd_reg = KMAC_CMD_REG_RESVAL;
-  cmd_reg = bitfield_field32_write(cmd_reg, KMAC_CMD_CMD_FIELD,
-                                   KMAC_CMD_CMD_VALUE_DONE);
-  abs_mmio_write32(kBase + KMAC_CMD_REG_OFFSET, cmd_reg);
+/**
+ * Common routine for feeding message blocks during SHA/SHAKE/cSHAKE/KMAC.
+ *
+ * Before running this, the operation type must be configured with kmac_init.
+ * Then, we can use this function to feed various bytes of data to the KMAC
+ * core. Note that this is a one-shot implementation; see `kmac_stream_start`
+ * for streaming mode.
+ *
+ * This routine does not check input parameters for consistency. For instance,
+ * one can invoke SHA-3_224 with digest_len=32, which will produce 256 bits of
+ * digest. The caller is responsible for ensuring that the digest length and
+ * mode are consistent.
+ *
+ * The caller must ensure that `message_len` bytes (rounded up to the next 32b
+ * word) are allocated at the location pointed to by `message`, and similarly
+ * that `digest_len_words` 32-bit words are allocated at the location pointed
+ * to by `digest`. If `masked_digest` is set, then `digest` must contain 2x
+ * `digest_len_words` to fit both shares.
+ *
+ * @param operation The operation type.
+ * @param message Input message string.
+ * @param message_len Message length in bytes.
+ * @param digest The struct to which the result will be written.
+ * @param digest_len_words Requested digest length in 32-bit words.
+ * @param masked_digest Whether to return the digest in two shares.
+ * @return Error code.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_process_msg_blocks(kmac_operation_t operation,
+                                        const uint8_t *message,
+                                        size_t message_len, uint32_t *digest,
+                                        size_t digest_len_words,
+                                        hardened_bool_t masked_digest) {
+  HARDENED_TRY(kmac_absorb_start());
+  HARDENED_TRY(kmac_msg_write(message, message_len));
+  HARDENED_TRY(kmac_absorb_finish(operation, digest_len_words));
 
-  return OTCRYPTO_OK;
+  uint32_t cfg_reg =
+      abs_mmio_read32(kmac_base() + KMAC_CFG_SHADOWED_REG_OFFSET);
+  uint32_t keccak_str =
+      bitfield_field32_read(cfg_reg, KMAC_CFG_SHADOWED_KSTRENGTH_FIELD);
+  size_t keccak_rate_words;
+  HARDENED_TRY(kmac_get_keccak_rate_words(keccak_str, &keccak_rate_words));
+
+  // Finally, we can read the two shares of digest and XOR them.
+  size_t state_offset = 0;
+  HARDENED_TRY(kmac_state_read(digest, digest_len_words, masked_digest,
+                               keccak_rate_words, &state_offset));
+
+  return kmac_squeeze_done();
 }
 
 /**
@@ -837,6 +987,7 @@ status_t kmac_cshake_128(const uint8_t *message, size_t message_len,
                          const unsigned char *func_name, size_t func_name_len,
                          const unsigned char *cust_str, size_t cust_str_len,
                          uint32_t *digest, size_t digest_len) {
+  HARDENED_TRY(kmac_check_unclaimed());
   HARDENED_TRY(wait_status_bit(KMAC_STATUS_SHA3_IDLE_BIT, 1));
   HARDENED_TRY(
       kmac_set_prefix_regs(func_name, func_name_len, cust_str, cust_str_len));
@@ -848,6 +999,7 @@ status_t kmac_cshake_256(const uint8_t *message, size_t message_len,
                          const unsigned char *func_name, size_t func_name_len,
                          const unsigned char *cust_str, size_t cust_str_len,
                          uint32_t *digest, size_t digest_len) {
+  HARDENED_TRY(kmac_check_unclaimed());
   HARDENED_TRY(wait_status_bit(KMAC_STATUS_SHA3_IDLE_BIT, 1));
   HARDENED_TRY(
       kmac_set_prefix_regs(func_name, func_name_len, cust_str, cust_str_len));
@@ -884,3 +1036,223 @@ status_t kmac_kmac_256(kmac_blinded_key_t *key, hardened_bool_t masked_digest,
   return kmac_process_msg_blocks(kKmacOperationKmac, message, message_len,
                                  digest, digest_len, masked_digest);
 }
+
+/**
+ * Get the operation type and security strength for a streaming mode.
+ *
+ * @param mode Streaming mode.
+ * @param[out] operation Operation type.
+ * @param[out] strength Security strength.
+ * @return Error code.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_stream_mode_params(kmac_stream_mode_t mode,
+                                        kmac_operation_t *operation,
+                                        kmac_security_str_t *strength) {
+  switch (launder32(mode)) {
+    case kKmacStreamModeSha3_224:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeSha3_224);
+      *operation = kKmacOperationSha3;
+      *strength = kKmacSecurityStrength224;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeSha3_256:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeSha3_256);
+      *operation = kKmacOperationSha3;
+      *strength = kKmacSecurityStrength256;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeSha3_384:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeSha3_384);
+      *operation = kKmacOperationSha3;
+      *strength = kKmacSecurityStrength384;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeSha3_512:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeSha3_512);
+      *operation = kKmacOperationSha3;
+      *strength = kKmacSecurityStrength512;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeShake128:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeShake128);
+      *operation = kKmacOperationShake;
+      *strength = kKmacSecurityStrength128;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeShake256:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeShake256);
+      *operation = kKmacOperationShake;
+      *strength = kKmacSecurityStrength256;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeCshake128:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeCshake128);
+      *operation = kKmacOperationCshake;
+      *strength = kKmacSecurityStrength128;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeCshake256:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeCshake256);
+      *operation = kKmacOperationCshake;
+      *strength = kKmacSecurityStrength256;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeKmac128:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeKmac128);
+      *operation = kKmacOperationKmac;
+      *strength = kKmacSecurityStrength128;
+      return OTCRYPTO_OK;
+    case kKmacStreamModeKmac256:
+      HARDENED_CHECK_EQ(mode, kKmacStreamModeKmac256);
+      *operation = kKmacOperationKmac;
+      *strength = kKmacSecurityStrength256;
+      return OTCRYPTO_OK;
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+}
+
+/**
+ * Check that a streaming operation still holds the KMAC block.
+ *
+ * If the token matches but the block is not in the expected state, another
+ * client has interfered with it; the block is released and an error
+ * returned so that the caller fails cleanly.
+ *
+ * @param stream State of the streaming operation.
+ * @param squeezing Whether the block should be squeezing (else absorbing).
+ * @return Error code.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_stream_check(const kmac_stream_t *stream,
+                                  hardened_bool_t squeezing) {
+  if (stream->session == 0 ||
+      launder32(stream->session) != kmac_stream_session) {
+    return OTCRYPTO_RECOV_ERR;
+  }
+  HARDENED_CHECK_EQ(stream->session, kmac_stream_session);
+  if (stream->squeezing != squeezing) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Check the rate and squeeze offset, which bound reads from the state
+  // registers, in case the caller changed them in between calls.
+  kmac_operation_t operation;
+  kmac_security_str_t strength;
+  size_t keccak_rate_words;
+  HARDENED_TRY(kmac_stream_mode_params(stream->mode, &operation, &strength));
+  HARDENED_TRY(kmac_get_keccak_rate_words(strength, &keccak_rate_words));
+  if (launder32(stream->keccak_rate_words) != keccak_rate_words ||
+      stream->squeeze_offset > keccak_rate_words) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_CHECK_EQ(stream->keccak_rate_words, keccak_rate_words);
+  HARDENED_CHECK_LE(stream->squeeze_offset, keccak_rate_words);
+
+  uint32_t reg = abs_mmio_read32(kmac_base() + KMAC_STATUS_REG_OFFSET);
+  uint32_t state_bit = KMAC_STATUS_SHA3_ABSORB_BIT;
+  if (squeezing == kHardenedBoolTrue) {
+    state_bit = KMAC_STATUS_SHA3_SQUEEZE_BIT;
+  }
+  if (!bitfield_bit32_read(reg, state_bit)) {
+    kmac_stream_session = 0;
+    return OTCRYPTO_RECOV_ERR;
+  }
+  return OTCRYPTO_OK;
+}
+
+status_t kmac_stream_start(kmac_stream_mode_t mode, kmac_blinded_key_t *key,
+                           const unsigned char *func_name,
+                           size_t func_name_len, const unsigned char *cust_str,
+                           size_t cust_str_len, kmac_stream_t *stream) {
+  if (stream == NULL || (func_name == NULL && func_name_len != 0) ||
+      (cust_str == NULL && cust_str_len != 0)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  kmac_operation_t operation;
+  kmac_security_str_t strength;
+  HARDENED_TRY(kmac_stream_mode_params(mode, &operation, &strength));
+
+  hardened_bool_t hw_backed = kHardenedBoolFalse;
+  if (operation == kKmacOperationKmac) {
+    if (key == NULL) {
+      return OTCRYPTO_BAD_ARGS;
+    }
+    hw_backed = key->hw_backed;
+  } else if (key != NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Fails if another streaming operation holds the block.
+  HARDENED_TRY(kmac_init(operation, strength, hw_backed));
+
+  if (operation == kKmacOperationKmac) {
+    HARDENED_TRY(kmac_write_key_block(key));
+    HARDENED_TRY(kmac_set_prefix_regs(kKmacFuncNameKMAC,
+                                      sizeof(kKmacFuncNameKMAC), cust_str,
+                                      cust_str_len));
+  } else if (operation == kKmacOperationCshake) {
+    HARDENED_TRY(kmac_set_prefix_regs(func_name, func_name_len, cust_str,
+                                      cust_str_len));
+  }
+
+  HARDENED_TRY(kmac_get_keccak_rate_words(strength,
+                                          &stream->keccak_rate_words));
+  HARDENED_TRY(kmac_absorb_start());
+
+  // Claim the block. The token only needs to be unique among operations
+  // that are live at the same time; it must not be 0.
+  kmac_stream_session = ibex_rnd32_read() | 1;
+  stream->session = kmac_stream_session;
+  stream->mode = mode;
+  stream->squeeze_offset = 0;
+  stream->squeezing = kHardenedBoolFalse;
+  return OTCRYPTO_OK;
+}
+
+status_t kmac_stream_absorb(kmac_stream_t *stream, const uint8_t *message,
+                            size_t message_len) {
+  if (stream == NULL || (message == NULL && message_len != 0)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_TRY(kmac_stream_check(stream, kHardenedBoolFalse));
+  return kmac_msg_write(message, message_len);
+}
+
+status_t kmac_stream_process(kmac_stream_t *stream, size_t digest_len) {
+  if (stream == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_TRY(kmac_stream_check(stream, kHardenedBoolFalse));
+
+  kmac_operation_t operation;
+  kmac_security_str_t strength;
+  HARDENED_TRY(kmac_stream_mode_params(stream->mode, &operation, &strength));
+  HARDENED_TRY(kmac_absorb_finish(operation, digest_len));
+
+  stream->squeeze_offset = 0;
+  stream->squeezing = kHardenedBoolTrue;
+  return OTCRYPTO_OK;
+}
+
+status_t kmac_stream_squeeze(kmac_stream_t *stream, uint32_t *digest,
+                             size_t digest_len) {
+  if (stream == NULL || (digest == NULL && digest_len != 0)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_TRY(kmac_stream_check(stream, kHardenedBoolTrue));
+  return kmac_state_read(digest, digest_len,
+                         /*masked_digest=*/kHardenedBoolFalse,
+                         stream->keccak_rate_words, &stream->squeeze_offset);
+}
+
+status_t kmac_stream_end(kmac_stream_t *stream) {
+  if (stream == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // The block can only be released from the squeeze state.
+  if (stream->squeezing == kHardenedBoolFalse) {
+    HARDENED_TRY(kmac_stream_process(stream, /*digest_len=*/0));
+  }
+  HARDENED_TRY(kmac_stream_check(stream, kHardenedBoolTrue));
+  HARDENED_TRY(kmac_squeeze_done());
+
+  kmac_stream_session = 0;
+  stream->session = 0;
+  return OTCRYPTO_OK;
+}
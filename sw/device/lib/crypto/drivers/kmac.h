@@ -57,6 +57,55 @@ typedef struct kmac_blinded_key {
   hardened_bool_t hw_backed;
 } kmac_blinded_key_t;
 
+/**
+ * Keccak-based functions that can run as a streaming operation.
+ *
+ * Values are hardened.
+ */
+typedef enum kmac_stream_mode {
+  kKmacStreamModeSha3_224 = 0x2b5,
+  kKmacStreamModeSha3_256 = 0x5ce,
+  kKmacStreamModeSha3_384 = 0x9a3,
+  kKmacStreamModeSha3_512 = 0x671,
+  kKmacStreamModeShake128 = 0xc1e,
+  kKmacStreamModeShake256 = 0x3d9,
+  kKmacStreamModeCshake128 = 0xe47,
+  kKmacStreamModeCshake256 = 0x18b,
+  kKmacStreamModeKmac128 = 0x7f2,
+  kKmacStreamModeKmac256 = 0xa6c,
+} kmac_stream_mode_t;
+
+/**
+ * State of a streaming operation on the KMAC block.
+ *
+ * A streaming operation keeps the KMAC block in the absorb (and later
+ * squeeze) state between calls, so only one can run at a time. While one is
+ * running, all other KMAC driver operations fail with an error instead of
+ * waiting for the block to become idle.
+ */
+typedef struct kmac_stream {
+  /**
+   * Function being computed.
+   */
+  kmac_stream_mode_t mode;
+  /**
+   * Token identifying the operation that currently holds the KMAC block.
+   */
+  uint32_t session;
+  /**
+   * Keccak rate for the security strength of `mode`, in 32-bit words.
+   */
+  size_t keccak_rate_words;
+  /**
+   * Number of words already read from the current block of Keccak state.
+   */
+  size_t squeeze_offset;
+  /**
+   * Whether the message has been padded and the block is squeezing.
+   */
+  hardened_bool_t squeezing;
+} kmac_stream_t;
+
 /**
  * Check whether given key length is valid for KMAC.
 
@@ -293,6 +342,86 @@ status_t kmac_kmac_256(kmac_blinded_key_t *key, hardened_bool_t masked_digest,
                        const unsigned char *cust_str, size_t cust_str_len,
                        uint32_t *digest, size_t digest_len);
 
+/**
+ * Start a streaming SHA3, SHAKE, cSHAKE or KMAC operation.
+ *
+ * Configures the KMAC block for `mode` and leaves it in the absorb state.
+ * `key` is only used for KMAC modes and must be NULL otherwise; see
+ * `kmac_kmac_128` for the key requirements. `func_name` is only used for
+ * cSHAKE modes and `cust_str` only for cSHAKE and KMAC modes.
+ *
+ * Returns `OTCRYPTO_RECOV_ERR` without touching the hardware if another
+ * streaming operation already holds the KMAC block.
+ *
+ * @param mode Function to compute.
+ * @param key The KMAC key (KMAC modes only).
+ * @param func_name The function name (cSHAKE modes only).
+ * @param func_name_len The function name length in bytes.
+ * @param cust_str The customization string (cSHAKE and KMAC modes only).
+ * @param cust_str_len The customization string length in bytes.
+ * @param[out] stream State of the streaming operation.
+ * @return Error status.
+ */
+OT_WARN_UNUSED_RESULT
+status_t kmac_stream_start(kmac_stream_mode_t mode, kmac_blinded_key_t *key,
+                           const unsigned char *func_name,
+                           size_t func_name_len, const unsigned char *cust_str,
+                           size_t cust_str_len, kmac_stream_t *stream);
+
+/**
+ * Absorb more message data into a streaming operation.
+ *
+ * Fails with `OTCRYPTO_RECOV_ERR` if `stream` does not hold the KMAC block or
+ * the block is no longer absorbing; in the latter case the block is released.
+ *
+ * @param stream State of the streaming operation.
+ * @param message The message data.
+ * @param message_len The message data length in bytes.
+ * @return Error status.
+ */
+OT_WARN_UNUSED_RESULT
+status_t kmac_stream_absorb(kmac_stream_t *stream, const uint8_t *message,
+                            size_t message_len);
+
+/**
+ * Finish absorbing and move a streaming operation to the squeeze state.
+ *
+ * For KMAC modes, `digest_len` is the total output length that is encoded
+ * into the message as required by NIST SP 800-185; it is ignored otherwise.
+ *
+ * @param stream State of the streaming operation.
+ * @param digest_len Total output length in 32-bit words (KMAC modes only).
+ * @return Error status.
+ */
+OT_WARN_UNUSED_RESULT
+status_t kmac_stream_process(kmac_stream_t *stream, size_t digest_len);
+
+/**
+ * Read more output from a streaming operation in the squeeze state.
+ *
+ * Output continues where the previous call left off; the Keccak permutation
+ * is run again as needed.
+ *
+ * @param stream State of the streaming operation.
+ * @param[out] digest Output buffer for the result.
+ * @param digest_len Requested output length in 32-bit words.
+ * @return Error status.
+ */
+OT_WARN_UNUSED_RESULT
+status_t kmac_stream_squeeze(kmac_stream_t *stream, uint32_t *digest,
+                             size_t digest_len);
+
+/**
+ * End a streaming operation and release the KMAC block.
+ *
+ * May be called in either the absorb or the squeeze state.
+ *
+ * @param stream State of the streaming operation.
+ * @return Error status.
+ */
+OT_WARN_UNUSED_RESULT
+status_t kmac_stream_end(kmac_stream_t *stream);
+
 #ifdef __cplusplus
 }
 #endif
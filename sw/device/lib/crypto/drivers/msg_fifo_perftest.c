@@ -0,0 +1,125 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/drivers/hmac.h"
+#include "sw/device/lib/crypto/drivers/kmac.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/perf_test.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Measures the cost of feeding a message through the KMAC and HMAC message
+// FIFOs, so that throughput regressions in the drivers' write loops show up.
+//
+// There are no absolute cycle bounds. Each unaligned run is instead checked
+// against the aligned run of the same hash that precedes it. The write loops
+// only write the bytes before the first and after the last word boundary of
+// the message one at a time, so an unaligned message costs at most a few
+// extra stores. A run that costs more than `1/kMaxOverheadDivisor` more than
+// the aligned one has fallen back to byte-wise writes or per-word polling.
+
+enum {
+  kMsgLen = 1000,
+  kNumRuns = 10,
+  // Large enough for a SHA-256 or SHA3-256 digest.
+  kDigestWords = 8,
+  // Maximum overhead of an unaligned run, as a fraction of the aligned run.
+  kMaxOverheadDivisor = 16,
+};
+
+typedef struct perf_test {
+  // A human-readable name for this particular test, e.g. "kmac_sha3_256".
+  const char *label;
+
+  // Hash function under test. This function pointer must not be NULL.
+  status_t (*func)(const uint8_t *msg, size_t msg_len, uint32_t *digest);
+
+  // Offset of the message from the start of the (word-aligned) buffer. A
+  // nonzero offset exercises the unaligned head and tail of the write loop.
+  size_t msg_offset;
+} perf_test_t;
+
+static uint32_t msg_buf[(kMsgLen + sizeof(uint32_t)) / sizeof(uint32_t)];
+static uint32_t digest[kDigestWords];
+
+// Hash the message once; `ctx` is the `perf_test_t` to run.
+static void perf_test_body(const void *ctx) {
+  const perf_test_t *test = ctx;
+  const uint8_t *msg = (const uint8_t *)msg_buf + test->msg_offset;
+  CHECK_STATUS_OK(test->func(msg, kMsgLen, digest));
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+// Tests come in aligned/unaligned pairs for the same hash. Cycle counts can be
+// collected on a CW310 FPGA with:
+//
+//   $ ./bazelisk.sh test --copt -O2 --test_output=all \
+//       //sw/device/lib/crypto/drivers:msg_fifo_perftest_fpga_cw310
+static const perf_test_t kPerfTests[] = {
+    {
+        .label = "kmac_sha3_256_aligned",
+        .func = &kmac_sha3_256,
+        .msg_offset = 0,
+    },
+    {
+        .label = "kmac_sha3_256_unaligned",
+        .func = &kmac_sha3_256,
+        .msg_offset = 1,
+    },
+    {
+        .label = "hmac_hash_sha256_aligned",
+        .func = &hmac_hash_sha256,
+        .msg_offset = 0,
+    },
+    {
+        .label = "hmac_hash_sha256_unaligned",
+        .func = &hmac_hash_sha256,
+        .msg_offset = 1,
+    },
+};
+
+bool test_main(void) {
+  CHECK_STATUS_OK(entropy_complex_init());
+  CHECK_STATUS_OK(kmac_hwip_default_configure());
+  perf_test_fill_deterministic((uint8_t *)msg_buf, sizeof(msg_buf));
+
+  bool all_expectations_match = true;
+  uint64_t aligned_num_cycles = 0;
+  for (size_t i = 0; i < ARRAYSIZE(kPerfTests); ++i) {
+    const perf_test_t *test = &kPerfTests[i];
+    CHECK(test->func != NULL);
+    CHECK(test->msg_offset < sizeof(uint32_t));
+
+    const uint64_t num_cycles =
+        perf_test_measure(&perf_test_body, test, kNumRuns);
+    // `base_printf()` cannot print `uint64_t`.
+    CHECK(num_cycles < UINT32_MAX / 100);
+    LOG_INFO("%s: %d cycles", test->label, (uint32_t)num_cycles);
+
+    if (i % 2 == 0) {
+      CHECK(test->msg_offset == 0);
+      aligned_num_cycles = num_cycles;
+      continue;
+    }
+    CHECK(test->msg_offset != 0);
+    CHECK(aligned_num_cycles > 0);
+    const uint32_t percent_of_aligned =
+        (uint32_t)((100 * num_cycles) / aligned_num_cycles);
+    LOG_INFO("%s: %d%% of aligned", test->label, percent_of_aligned);
+    if (num_cycles >
+        aligned_num_cycles + aligned_num_cycles / kMaxOverheadDivisor) {
+      LOG_WARNING("%s: unaligned overhead above 1/%d", test->label,
+                  kMaxOverheadDivisor);
+      all_expectations_match = false;
+    }
+  }
+  return all_expectations_match;
+}
@@ -43,6 +43,12 @@ enum {
    *   https://opentitan.org/book/hw/ip/otbn/doc/theory_of_operation.html#software-execution-design-details
    */
   kOtbnErrBitsNoError = 0,
+  /**
+   * Flag set in the index of an IMEM write in the LOAD_CHECKSUM stream.
+   *
+   * Each write is folded into the checksum as `{imem, idx[14:0], wdata}`.
+   */
+  kOtbnLoadChecksumImemFlag = 1 << 15,
 };
 
 /**
@@ -66,6 +72,51 @@ typedef enum otbn_status {
   kOtbnStatusLocked = 0xFF,
 } otbn_status_t;
 
+/**
+ * Record of the application image last loaded into IMEM.
+ *
+ * `otbn_load_app()` fills this in after a full load so that a later load of
+ * the same image can try to skip the IMEM wipe and rewrite. The record only
+ * selects that path; it is never taken as evidence of what IMEM holds, which
+ * is re-checked against the image's checksum on every reload. The
+ * zero-initialized value means no image is resident.
+ */
+typedef struct otbn_resident_app {
+  /**
+   * Start of the resident image's IMEM section in Ibex's memory.
+   */
+  const uint32_t *imem_start;
+  /**
+   * End of the resident image's IMEM section in Ibex's memory.
+   */
+  const uint32_t *imem_end;
+  /**
+   * Checksum of the resident image (over IMEM and the DMEM data section).
+   */
+  uint32_t app_checksum;
+  /**
+   * Whether the record describes the contents of IMEM.
+   */
+  hardened_bool_t resident;
+} otbn_resident_app_t;
+
+static otbn_resident_app_t resident_app;
+
+/**
+ * Token of the current DMEM owner; see `otbn_dmem_claim()`.
+ */
+static uint32_t dmem_claim_token;
+
+/**
+ * Forgets the resident application, forcing a full reload next time.
+ */
+static void resident_app_clear(void) {
+  resident_app.resident = kHardenedBoolFalse;
+  resident_app.imem_start = NULL;
+  resident_app.imem_end = NULL;
+  resident_app.app_checksum = 0;
+}
+
 /**
  * Ensures that a memory access fits within the given memory size.
  *
@@ -116,62 +167,100 @@ static status_t otbn_assert_idle(void) {
   return OTCRYPTO_ASYNC_INCOMPLETE;
 }
 
-status_t otbn_dmem_write(size_t num_words, const uint32_t *src,
-                         otbn_addr_t dest) {
+status_t otbn_dmem_write_prepare(size_t num_words, const uint32_t *src,
+                                 otbn_addr_t dest,
+                                 otbn_dmem_write_plan_t *plan) {
   HARDENED_TRY(check_offset_len(dest, num_words, kOtbnDMemSizeBytes));
 
-  // Reset the LOAD_CHECKSUM register.
-  abs_mmio_write32(otbn_base() + OTBN_LOAD_CHECKSUM_REG_OFFSET, 0);
+  plan->src = src;
+  plan->num_words = num_words;
+  plan->dest = dest;
+
+  // Setup the random order construct. The commit replays a copy of it, so the
+  // words are written in the same order as they are added to the CRC here.
+  random_order_init(&plan->order, num_words);
+  random_order_t order = plan->order;
 
   // Initialize the CRC.
   uint32_t ctx;
   crc32_init(&ctx);
 
-  // Setup the random order construct.
-  random_order_t order;
-  random_order_init(&order, num_words);
-
   size_t count = 0;
-
   for (; launderw(count) < num_words; count = launderw(count) + 1) {
-    // The value obtained from `advance()` is laundered, to prevent
-    // implementation details from leaking across procedures.
     size_t idx = launderw(random_order_advance(&order));
-    size_t idx_word = idx * sizeof(uint32_t);
-
-    // Prevent the compiler from reordering the loop; this ensures a
-    // happens-before among indices consistent with `order`.
-    barrierw(idx);
-
-    // Perform the write.
-    abs_mmio_write32(otbn_base() + OTBN_DMEM_REG_OFFSET + dest + idx_word,
-                     src[idx]);
 
     // Update the CRC. According to the OTBN documentation, each CRC update
     // consists of 48-bit: {imem, idx, wdata}
     // imem: set to 0 for DMEM writes.
-    // idx: the index padded to 15b.
+    // idx: the word index in DMEM, padded to 15b.
     // wdata: the 32b word written into DMEM.
-    char crc_data[6];
-    memset(crc_data, 0, sizeof(crc_data));
-    uint32_t offset = ((dest + idx_word) >> 2) & 0x7FFF;
-    memcpy(crc_data, &src[idx], sizeof(uint32_t));
-    memcpy(crc_data + sizeof(uint32_t), &offset, 2);
-    crc32_add(&ctx, crc_data, sizeof(crc_data));
+    uint16_t dmem_idx = (uint16_t)((dest / sizeof(uint32_t) + idx) & 0x7FFF);
+    crc32_add48(&ctx, src[idx], dmem_idx);
   }
   RANDOM_ORDER_HARDENED_CHECK_DONE(order);
   HARDENED_CHECK_EQ(count, num_words);
 
-  // Get the computed (expected) checksum, fetch the checksum from the OTBN
-  // LOAD_CHECKSUM register, and compare both registers.
-  uint32_t checksum_expected = crc32_finish(&ctx);
+  plan->checksum = crc32_finish(&ctx);
+  return OTCRYPTO_OK;
+}
+
+status_t otbn_dmem_write_commit(const otbn_dmem_write_plan_t *plan) {
+  HARDENED_TRY(
+      check_offset_len(plan->dest, plan->num_words, kOtbnDMemSizeBytes));
+
+  // Reset the LOAD_CHECKSUM register.
+  abs_mmio_write32(otbn_base() + OTBN_LOAD_CHECKSUM_REG_OFFSET, 0);
+
+  random_order_t order = plan->order;
+  const uint32_t *src = plan->src;
+  const size_t num_words = plan->num_words;
+  const uint32_t dmem_addr = otbn_base() + OTBN_DMEM_REG_OFFSET + plan->dest;
+
+  // Write four words per iteration. The order still advances once per word,
+  // so the words are written in exactly the prepared order.
+  size_t count = 0;
+  for (; launderw(count) + 4 <= num_words; count = launderw(count) + 4) {
+    // The values obtained from `advance()` are laundered, to prevent
+    // implementation details from leaking across procedures. The barriers
+    // prevent the compiler from reordering the stores; this ensures a
+    // happens-before among indices consistent with `order`.
+    size_t idx = launderw(random_order_advance(&order));
+    barrierw(idx);
+    abs_mmio_write32(dmem_addr + idx * sizeof(uint32_t), src[idx]);
+    idx = launderw(random_order_advance(&order));
+    barrierw(idx);
+    abs_mmio_write32(dmem_addr + idx * sizeof(uint32_t), src[idx]);
+    idx = launderw(random_order_advance(&order));
+    barrierw(idx);
+    abs_mmio_write32(dmem_addr + idx * sizeof(uint32_t), src[idx]);
+    idx = launderw(random_order_advance(&order));
+    barrierw(idx);
+    abs_mmio_write32(dmem_addr + idx * sizeof(uint32_t), src[idx]);
+  }
+  for (; launderw(count) < num_words; count = launderw(count) + 1) {
+    size_t idx = launderw(random_order_advance(&order));
+    barrierw(idx);
+    abs_mmio_write32(dmem_addr + idx * sizeof(uint32_t), src[idx]);
+  }
+  RANDOM_ORDER_HARDENED_CHECK_DONE(order);
+  HARDENED_CHECK_EQ(count, num_words);
+
+  // Fetch the checksum from the OTBN LOAD_CHECKSUM register and compare it
+  // with the one computed from the source buffer when the write was prepared.
   uint32_t checksum =
       abs_mmio_read32(otbn_base() + OTBN_LOAD_CHECKSUM_REG_OFFSET);
-  HARDENED_CHECK_EQ(checksum, checksum_expected);
+  HARDENED_CHECK_EQ(checksum, plan->checksum);
 
   return OTCRYPTO_OK;
 }
 
+status_t otbn_dmem_write(size_t num_words, const uint32_t *src,
+                         otbn_addr_t dest) {
+  otbn_dmem_write_plan_t plan;
+  HARDENED_TRY(otbn_dmem_write_prepare(num_words, src, dest, &plan));
+  return otbn_dmem_write_commit(&plan);
+}
+
 status_t otbn_dmem_set(size_t num_words, const uint32_t src, otbn_addr_t dest) {
   HARDENED_TRY(check_offset_len(dest, num_words, kOtbnDMemSizeBytes));
 
@@ -253,12 +342,27 @@ uint32_t otbn_instruction_count_get(void) {
 
 status_t otbn_imem_sec_wipe(void) {
   HARDENED_TRY(otbn_assert_idle());
+  resident_app_clear();
+  dmem_claim_token++;
   abs_mmio_write32(otbn_base() + OTBN_CMD_REG_OFFSET, kOtbnCmdSecWipeImem);
   HARDENED_TRY(otbn_busy_wait_for_done());
   return OTCRYPTO_OK;
 }
 
+uint32_t otbn_dmem_claim(void) { return ++dmem_claim_token; }
+
+hardened_bool_t otbn_dmem_claim_check(uint32_t token) {
+  if (launder32(token) != dmem_claim_token) {
+    return kHardenedBoolFalse;
+  }
+  HARDENED_CHECK_EQ(token, dmem_claim_token);
+  return kHardenedBoolTrue;
+}
+
 status_t otbn_dmem_sec_wipe(void) {
+  // Invalidate the current claim even if the wipe fails; the owner must not
+  // rely on the DMEM contents afterwards either way.
+  dmem_claim_token++;
   HARDENED_TRY(otbn_assert_idle());
   abs_mmio_write32(otbn_base() + OTBN_CMD_REG_OFFSET, kOtbnCmdSecWipeDmem);
   HARDENED_TRY(otbn_busy_wait_for_done());
@@ -310,16 +414,122 @@ static status_t check_app_address_ranges(const otbn_app_t *app) {
   return OTCRYPTO_OK;
 }
 
+/**
+ * Writes the data section of an application to DMEM.
+ *
+ * Does not touch the LOAD_CHECKSUM register; the caller is responsible for
+ * seeding it beforehand and checking it afterwards.
+ *
+ * @param app The application whose data section to write.
+ * @return Result of the operation.
+ */
+static status_t load_app_data(const otbn_app_t *app) {
+  const size_t data_num_words =
+      (size_t)(app->dmem_data_end - app->dmem_data_start);
+  otbn_addr_t data_offset = app->dmem_data_start_addr;
+  HARDENED_TRY(
+      check_offset_len(data_offset, data_num_words, kOtbnDMemSizeBytes));
+  uint32_t data_start_addr = otbn_base() + OTBN_DMEM_REG_OFFSET + data_offset;
+  uint32_t i = 0;
+  for (; launder32(i) < data_num_words; i++) {
+    HARDENED_CHECK_LT(i, data_num_words);
+    abs_mmio_write32(data_start_addr + i * sizeof(uint32_t),
+                     app->dmem_data_start[i]);
+  }
+  HARDENED_CHECK_EQ(i, data_num_words);
+  return OTCRYPTO_OK;
+}
+
+/**
+ * Checks whether `app` is the application resident in IMEM.
+ *
+ * @param app The application to check.
+ * @return `kHardenedBoolTrue` if the image is resident.
+ */
+static hardened_bool_t app_is_resident(const otbn_app_t *app) {
+  if (launder32(resident_app.resident) != kHardenedBoolTrue ||
+      resident_app.imem_start != app->imem_start ||
+      resident_app.imem_end != app->imem_end ||
+      launder32(resident_app.app_checksum) != app->checksum) {
+    return kHardenedBoolFalse;
+  }
+  HARDENED_CHECK_EQ(resident_app.resident, kHardenedBoolTrue);
+  HARDENED_CHECK_EQ(resident_app.app_checksum, app->checksum);
+  return kHardenedBoolTrue;
+}
+
+/**
+ * Reloads only the data section of the resident application.
+ *
+ * Nothing about the resident record is trusted here. IMEM is read back over
+ * the bus and its LOAD_CHECKSUM contribution recomputed in software; the
+ * register is seeded with that value and the data section written, so the
+ * final value matches the application's build-time checksum only if IMEM
+ * still holds the image. As with a full load, the CRC catches corruption and
+ * faults but not an attacker in full control of the bus.
+ *
+ * On a mismatch the record is cleared and `*reloaded` is false, so the caller
+ * falls back to a full load.
+ *
+ * @param app The application believed to be resident.
+ * @param[out] reloaded Whether IMEM matched and the data section was loaded.
+ * @return Result of the operation.
+ */
+static status_t otbn_reload_app_data(const otbn_app_t *app,
+                                     hardened_bool_t *reloaded) {
+  *reloaded = kHardenedBoolFalse;
+  HARDENED_TRY(otbn_dmem_sec_wipe());
+
+  const size_t imem_num_words = (size_t)(app->imem_end - app->imem_start);
+  HARDENED_TRY(check_offset_len(0, imem_num_words, kOtbnIMemSizeBytes));
+  uint32_t imem_start_addr = otbn_base() + OTBN_IMEM_REG_OFFSET;
+  uint32_t ctx;
+  crc32_init(&ctx);
+  uint32_t i = 0;
+  for (; launder32(i) < imem_num_words; i++) {
+    HARDENED_CHECK_LT(i, imem_num_words);
+    uint32_t word = abs_mmio_read32(imem_start_addr + i * sizeof(uint32_t));
+    crc32_add48(&ctx, word, (uint16_t)(kOtbnLoadChecksumImemFlag | i));
+  }
+  HARDENED_CHECK_EQ(i, imem_num_words);
+
+  abs_mmio_write32(otbn_base() + OTBN_LOAD_CHECKSUM_REG_OFFSET,
+                   crc32_finish(&ctx));
+  HARDENED_TRY(load_app_data(app));
+
+  uint32_t checksum =
+      abs_mmio_read32(otbn_base() + OTBN_LOAD_CHECKSUM_REG_OFFSET);
+  if (launder32(checksum) != app->checksum) {
+    resident_app_clear();
+    return OTCRYPTO_OK;
+  }
+  HARDENED_CHECK_EQ(checksum, app->checksum);
+
+  *reloaded = kHardenedBoolTrue;
+  return OTCRYPTO_OK;
+}
+
 status_t otbn_load_app(const otbn_app_t app) {
   HARDENED_TRY(check_app_address_ranges(&app));
 
   // Ensure OTBN is idle.
   HARDENED_TRY(otbn_assert_idle());
 
+  // If the same image is still in IMEM, only the data section needs to be
+  // rewritten. Otherwise, or if IMEM fails the check, do a full load.
+  if (app_is_resident(&app) == kHardenedBoolTrue) {
+    hardened_bool_t reloaded;
+    HARDENED_TRY(otbn_reload_app_data(&app, &reloaded));
+    if (launder32(reloaded) == kHardenedBoolTrue) {
+      return OTCRYPTO_OK;
+    }
+  }
+
   const size_t imem_num_words = (size_t)(app.imem_end - app.imem_start);
   const size_t data_num_words =
       (size_t)(app.dmem_data_end - app.dmem_data_start);
 
+  // Wiping IMEM also forgets any previously resident application.
   HARDENED_TRY(otbn_imem_sec_wipe());
   HARDENED_TRY(otbn_dmem_sec_wipe());
 
@@ -344,17 +554,7 @@ status_t otbn_load_app(const otbn_app_t app) {
   HARDENED_CHECK_EQ(i, imem_num_words);
 
   // Write the data portion to DMEM.
-  otbn_addr_t data_offset = app.dmem_data_start_addr;
-  HARDENED_TRY(
-      check_offset_len(data_offset, data_num_words, kOtbnDMemSizeBytes));
-  uint32_t data_start_addr = otbn_base() + OTBN_DMEM_REG_OFFSET + data_offset;
-  i = 0;
-  for (; launder32(i) < data_num_words; i++) {
-    HARDENED_CHECK_LT(i, data_num_words);
-    abs_mmio_write32(data_start_addr + i * sizeof(uint32_t),
-                     app.dmem_data_start[i]);
-  }
-  HARDENED_CHECK_EQ(i, data_num_words);
+  HARDENED_TRY(load_app_data(&app));
 
   // Ensure that the checksum matches expectations.
   uint32_t checksum =
@@ -364,5 +564,10 @@ status_t otbn_load_app(const otbn_app_t app) {
   }
   HARDENED_CHECK_EQ(checksum, app.checksum);
 
+  resident_app.imem_start = app.imem_start;
+  resident_app.imem_end = app.imem_end;
+  resident_app.app_checksum = app.checksum;
+  resident_app.resident = kHardenedBoolTrue;
+
   return OTCRYPTO_OK;
 }
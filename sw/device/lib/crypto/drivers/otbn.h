@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "sw/device/lib/base/random_order.h"
 #include "sw/device/lib/crypto/impl/status.h"
 
 #ifdef __cplusplus
@@ -228,6 +229,69 @@ typedef struct otbn_app {
 status_t otbn_dmem_write(size_t num_words, const uint32_t *src,
                          otbn_addr_t dest);
 
+/**
+ * A DMEM write whose checksum has been computed ahead of time.
+ *
+ * Use `otbn_dmem_write_prepare()` to fill this in and
+ * `otbn_dmem_write_commit()` to perform the write.
+ */
+typedef struct otbn_dmem_write_plan {
+  /**
+   * Source buffer; must not change until the write is committed.
+   */
+  const uint32_t *src;
+  /**
+   * Length of the data in 32-bit words.
+   */
+  size_t num_words;
+  /**
+   * The DMEM location to copy to.
+   */
+  otbn_addr_t dest;
+  /**
+   * Randomized write order, replayed by the commit.
+   */
+  random_order_t order;
+  /**
+   * Expected value of the LOAD_CHECKSUM register after the write.
+   */
+  uint32_t checksum;
+} otbn_dmem_write_plan_t;
+
+/**
+ * Prepare a write to OTBN's data memory (DMEM).
+ *
+ * Picks the random write order and computes the expected load checksum, but
+ * does not access OTBN. It is therefore safe to call while OTBN is busy, so
+ * that the checksum computation for the next write can overlap with an OTBN
+ * run.
+ *
+ * Returns an error if the length and offset exceed the DMEM size.
+ *
+ * @param num_words Length of the data in 32-bit words.
+ * @param src The main memory location to copy from.
+ * @param dest The DMEM location to copy to.
+ * @param[out] plan The prepared write.
+ * @return Result of the operation.
+ */
+status_t otbn_dmem_write_prepare(size_t num_words, const uint32_t *src,
+                                 otbn_addr_t dest,
+                                 otbn_dmem_write_plan_t *plan);
+
+/**
+ * Perform a write prepared by `otbn_dmem_write_prepare()`.
+ *
+ * Writes the words in the prepared order and checks the LOAD_CHECKSUM
+ * register against the precomputed checksum, which also catches changes to
+ * the source buffer since the write was prepared.
+ *
+ * The caller must ensure OTBN is idle before calling this function.
+ *
+ * @param plan The prepared write.
+ * @return Result of the operation.
+ */
+status_t otbn_dmem_write_commit(const otbn_dmem_write_plan_t *plan);
+
 /**
  * Set a range of OTBN's data memory (DMEM) to a particular value.
  *
@@ -310,7 +374,8 @@ uint32_t otbn_instruction_count_get(void);
  * Wipe IMEM securely.
  *
  * This function returns an error if called when OTBN is not idle, and blocks
- * until the secure wipe is complete.
+ * until the secure wipe is complete. It also clears the record of the
+ * resident application, so the next `otbn_load_app()` does a full load.
  *
  * The caller is responsible for initializing the entropy complex before
  * calling this function, since it consumes randomness. If entropy is not
@@ -320,6 +385,29 @@ uint32_t otbn_instruction_count_get(void);
  */
 status_t otbn_imem_sec_wipe(void);
 
+/**
+ * Claim the current contents of DMEM.
+ *
+ * A caller that leaves data in DMEM between OTBN runs claims it afterwards and
+ * keeps the returned token. Every later claim and every IMEM or DMEM wipe,
+ * including the ones done by `otbn_load_app()`, invalidates the token.
+ *
+ * @return Token for `otbn_dmem_claim_check()`.
+ */
+uint32_t otbn_dmem_claim(void);
+
+/**
+ * Check whether a DMEM claim is still valid.
+ *
+ * True only if nobody has claimed or wiped OTBN memory since `token` was
+ * returned by `otbn_dmem_claim()`, so that the data and the application the
+ * claimer left in OTBN are still in place.
+ *
+ * @param token Token returned by `otbn_dmem_claim()`.
+ * @return Whether the claim is still valid.
+ */
+hardened_bool_t otbn_dmem_claim_check(uint32_t token);
+
 /**
  * Wipe DMEM securely.
  *
@@ -353,6 +441,15 @@ status_t otbn_set_ctrl_software_errs_fatal(bool enable);
  * Load the application image with both instruction and data segments into
  * OTBN.
  *
+ * The driver remembers which image was last loaded. If `app` is that image,
+ * IMEM is read back instead of being wiped and rewritten: its checksum is
+ * recomputed and used to seed the LOAD_CHECKSUM register before the data
+ * section is rewritten, so the final value must still match `app.checksum`.
+ * If it does not, the driver falls back to a full load. Loading a different
+ * image wipes both memories as usual. Code outside this
+ * driver that writes IMEM must call `otbn_imem_sec_wipe()` first so that the
+ * resident image is forgotten.
+ *
  * This function will return an error if called when OTBN is not idle.
  *
  * Because this function uses the OTBN secure wipe functionality before
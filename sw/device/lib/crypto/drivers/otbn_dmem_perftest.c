@@ -0,0 +1,149 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/drivers/otbn.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/perf_test.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Compares the cost of writing an operand to OTBN DMEM through a single
+// `otbn_dmem_write()` call, which computes the load checksum one word at a
+// time and unrolls its stores, with writing the same operand one word per
+// call. Both must leave the same data in DMEM.
+//
+// There are no absolute cycle bounds. Each single-call write must instead be
+// no slower than the per-word write of the same operand that precedes it.
+
+enum {
+  kNumRuns = 10,
+  // Large enough for an RSA-4096 operand.
+  kMaxNumWords = 4096 / 32,
+};
+
+typedef struct perf_test {
+  // A human-readable name for this particular test, e.g. "rsa4096_per_word".
+  const char *label;
+
+  // Writes `num_words` words from `src_buf` to `dest`. This function pointer
+  // must not be NULL.
+  status_t (*func)(size_t num_words, otbn_addr_t dest);
+
+  // Number of 32-bit words to write.
+  size_t num_words;
+
+  // Destination offset in DMEM. Must be word-aligned.
+  otbn_addr_t dest;
+} perf_test_t;
+
+static uint32_t src_buf[kMaxNumWords];
+static uint32_t readback_buf[kMaxNumWords];
+
+static status_t write_per_word(size_t num_words, otbn_addr_t dest) {
+  for (size_t i = 0; i < num_words; ++i) {
+    TRY(otbn_dmem_write(1, &src_buf[i], dest + i * sizeof(uint32_t)));
+  }
+  return OK_STATUS();
+}
+
+static status_t write_single_call(size_t num_words, otbn_addr_t dest) {
+  return otbn_dmem_write(num_words, src_buf, dest);
+}
+
+// Write the operand once; `ctx` is the `perf_test_t` to run.
+static void perf_test_body(const void *ctx) {
+  const perf_test_t *test = ctx;
+  CHECK_STATUS_OK(test->func(test->num_words, test->dest));
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+// Tests come in per-word/single-call pairs over the same operand. Cycle counts
+// can be collected on a CW310 FPGA with:
+//
+//   $ ./bazelisk.sh test --copt -O2 --test_output=all \
+//       //sw/device/lib/crypto/drivers:otbn_dmem_perftest_fpga_cw310
+static const perf_test_t kPerfTests[] = {
+    {
+        .label = "p256_coordinate_per_word",
+        .func = &write_per_word,
+        .num_words = 8,
+        .dest = 0,
+    },
+    {
+        .label = "p256_coordinate",
+        .func = &write_single_call,
+        .num_words = 8,
+        .dest = 0,
+    },
+    {
+        .label = "rsa4096_operand_per_word",
+        .func = &write_per_word,
+        .num_words = kMaxNumWords,
+        .dest = 0,
+    },
+    {
+        .label = "rsa4096_operand",
+        .func = &write_single_call,
+        .num_words = kMaxNumWords,
+        .dest = 0,
+    },
+    {
+        .label = "rsa4096_operand_offset_per_word",
+        .func = &write_per_word,
+        .num_words = kMaxNumWords,
+        .dest = 0x204,
+    },
+    {
+        .label = "rsa4096_operand_offset",
+        .func = &write_single_call,
+        .num_words = kMaxNumWords,
+        .dest = 0x204,
+    },
+};
+
+bool test_main(void) {
+  CHECK_STATUS_OK(entropy_complex_init());
+  perf_test_fill_deterministic((uint8_t *)src_buf, sizeof(src_buf));
+
+  bool all_expectations_match = true;
+  uint64_t per_word_num_cycles = 0;
+  for (size_t i = 0; i < ARRAYSIZE(kPerfTests); ++i) {
+    const perf_test_t *test = &kPerfTests[i];
+    CHECK(test->func != NULL);
+    CHECK(test->num_words <= kMaxNumWords);
+
+    const uint64_t num_cycles =
+        perf_test_measure(&perf_test_body, test, kNumRuns);
+    // `base_printf()` cannot print `uint64_t`.
+    CHECK(num_cycles < UINT32_MAX / 100);
+    LOG_INFO("%s: %d cycles", test->label, (uint32_t)num_cycles);
+
+    // Check the data, then wipe DMEM so that the next test cannot pass on
+    // data left behind by this one.
+    CHECK_STATUS_OK(otbn_dmem_read(test->num_words, test->dest, readback_buf));
+    CHECK_ARRAYS_EQ(readback_buf, src_buf, test->num_words);
+    CHECK_STATUS_OK(otbn_dmem_sec_wipe());
+
+    if (i % 2 == 0) {
+      per_word_num_cycles = num_cycles;
+      continue;
+    }
+    CHECK(per_word_num_cycles > 0);
+    const uint32_t percent_of_per_word =
+        (uint32_t)((100 * num_cycles) / per_word_num_cycles);
+    LOG_INFO("%s: %d%% of per-word", test->label, percent_of_per_word);
+    if (num_cycles > per_word_num_cycles) {
+      LOG_WARNING("%s: slower than the per-word write", test->label);
+      all_expectations_match = false;
+    }
+  }
+  return all_expectations_match;
+}
@@ -0,0 +1,156 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/crypto/drivers/otbn.h"
+
+#include "hw/top/dt/dt_otbn.h"
+#include "sw/device/lib/base/abs_mmio.h"
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/impl/status.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+#include "hw/top/otbn_regs.h"  // Generated.
+
+// Module ID for status codes.
+#define MODULE_ID MAKE_MODULE_ID('t', 's', 't')
+
+// Two applications to alternate between; any two distinct images will do.
+OTBN_DECLARE_APP_SYMBOLS(run_sha256);
+OTBN_DECLARE_APP_SYMBOLS(run_sha512);
+static const otbn_app_t kAppA = OTBN_APP_T_INIT(run_sha256);
+static const otbn_app_t kAppB = OTBN_APP_T_INIT(run_sha512);
+
+enum {
+  // Large enough for the data section of either application.
+  kMaxDataWords = OTBN_DMEM_SIZE_BYTES / sizeof(uint32_t),
+};
+
+static uint32_t src_buf[kMaxDataWords];
+static uint32_t readback_buf[kMaxDataWords];
+
+static uint32_t imem_addr(size_t index) {
+  return dt_otbn_primary_reg_block(kDtOtbn) + OTBN_IMEM_REG_OFFSET +
+         index * sizeof(uint32_t);
+}
+
+/**
+ * Checks that IMEM and the DMEM data section hold the given application.
+ */
+static status_t check_app_loaded(const otbn_app_t *app) {
+  const size_t imem_num_words = (size_t)(app->imem_end - app->imem_start);
+  for (size_t i = 0; i < imem_num_words; ++i) {
+    TRY_CHECK(abs_mmio_read32(imem_addr(i)) == app->imem_start[i],
+              "IMEM word %d differs", i);
+  }
+
+  const size_t data_num_words =
+      (size_t)(app->dmem_data_end - app->dmem_data_start);
+  TRY_CHECK(data_num_words <= kMaxDataWords);
+  TRY(otbn_dmem_read(data_num_words, app->dmem_data_start_addr,
+                     readback_buf));
+  TRY_CHECK_ARRAYS_EQ(readback_buf, app->dmem_data_start, data_num_words);
+  return OK_STATUS();
+}
+
+/**
+ * Loading the resident application again only reloads its data section.
+ */
+status_t resident_hit_test(void) {
+  TRY(otbn_load_app(kAppA));
+  TRY(check_app_loaded(&kAppA));
+
+  // Clobber the data section so that the reload is observable.
+  uint32_t zero = 0;
+  TRY(otbn_dmem_write(1, &zero, kAppA.dmem_data_start_addr));
+  TRY(otbn_load_app(kAppA));
+  return check_app_loaded(&kAppA);
+}
+
+/**
+ * Loading a different application replaces the resident one.
+ */
+status_t resident_miss_test(void) {
+  TRY(otbn_load_app(kAppA));
+  TRY(otbn_load_app(kAppB));
+  TRY(check_app_loaded(&kAppB));
+  TRY(otbn_load_app(kAppA));
+  return check_app_loaded(&kAppA);
+}
+
+/**
+ * A resident image whose IMEM was changed behind the driver's back fails the
+ * checksum and is fully reloaded.
+ */
+status_t imem_mismatch_test(void) {
+  TRY(otbn_load_app(kAppA));
+  abs_mmio_write32(imem_addr(0), kAppA.imem_start[0] ^ 1);
+  TRY_CHECK(abs_mmio_read32(imem_addr(0)) != kAppA.imem_start[0]);
+
+  TRY(otbn_load_app(kAppA));
+  return check_app_loaded(&kAppA);
+}
+
+/**
+ * DMEM writes arrive intact for lengths that do and do not fill the unrolled
+ * write loop, at aligned and unaligned destinations.
+ */
+status_t dmem_write_test(void) {
+  static const size_t kNumWords[] = {1, 3, 4, 5, 8, 4096 / 32};
+  static const otbn_addr_t kDests[] = {0, 0x204};
+
+  for (size_t i = 0; i < kMaxDataWords; ++i) {
+    src_buf[i] = 0x9e3779b9 * (i + 1);
+  }
+  for (size_t i = 0; i < ARRAYSIZE(kNumWords); ++i) {
+    for (size_t j = 0; j < ARRAYSIZE(kDests); ++j) {
+      TRY(otbn_dmem_sec_wipe());
+      TRY(otbn_dmem_write(kNumWords[i], src_buf, kDests[j]));
+      TRY(otbn_dmem_read(kNumWords[i], kDests[j], readback_buf));
+      TRY_CHECK_ARRAYS_EQ(readback_buf, src_buf, kNumWords[i]);
+    }
+  }
+  return otbn_dmem_sec_wipe();
+}
+
+/**
+ * A DMEM claim stays valid until the next claim, wipe or application load.
+ */
+status_t dmem_claim_test(void) {
+  TRY(otbn_load_app(kAppA));
+  uint32_t token = otbn_dmem_claim();
+  TRY_CHECK(otbn_dmem_claim_check(token) == kHardenedBoolTrue);
+
+  uint32_t next = otbn_dmem_claim();
+  TRY_CHECK(otbn_dmem_claim_check(token) == kHardenedBoolFalse);
+  TRY_CHECK(otbn_dmem_claim_check(next) == kHardenedBoolTrue);
+
+  TRY(otbn_dmem_sec_wipe());
+  TRY_CHECK(otbn_dmem_claim_check(next) == kHardenedBoolFalse);
+
+  // Reloading the resident application wipes DMEM as well.
+  token = otbn_dmem_claim();
+  TRY(otbn_load_app(kAppA));
+  TRY_CHECK(otbn_dmem_claim_check(token) == kHardenedBoolFalse);
+
+  token = otbn_dmem_claim();
+  TRY(otbn_imem_sec_wipe());
+  TRY_CHECK(otbn_dmem_claim_check(token) == kHardenedBoolFalse);
+  return OK_STATUS();
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  status_t test_result = OK_STATUS();
+  CHECK_STATUS_OK(entropy_complex_init());
+  EXECUTE_TEST(test_result, resident_hit_test);
+  EXECUTE_TEST(test_result, resident_miss_test);
+  EXECUTE_TEST(test_result, imem_mismatch_test);
+  EXECUTE_TEST(test_result, dmem_write_test);
+  EXECUTE_TEST(test_result, dmem_claim_test);
+  return status_ok(test_result);
+}
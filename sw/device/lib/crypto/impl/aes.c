@@ -4,6 +4,7 @@
 
 #include "sw/device/lib/crypto/include/aes.h"
 
+#include "sw/device/lib/base/crc32.h"
 #include "sw/device/lib/base/hardened.h"
 #include "sw/device/lib/base/hardened_memory.h"
 #include "sw/device/lib/base/math.h"
@@ -28,6 +29,65 @@ OT_ASSERT_ENUM_VALUE(kAesCipherModeCfb, (uint32_t)kOtcryptoAesModeCfb);
 OT_ASSERT_ENUM_VALUE(kAesCipherModeOfb, (uint32_t)kOtcryptoAesModeOfb);
 OT_ASSERT_ENUM_VALUE(kAesCipherModeCtr, (uint32_t)kOtcryptoAesModeCtr);
 
+/**
+ * AES context object for streaming operations.
+ */
+typedef struct aes_context {
+  /**
+   * Blinded key for the operation; must stay live as long as the context.
+   */
+  otcrypto_blinded_key_t *key;
+  /**
+   * Block cipher mode.
+   */
+  otcrypto_aes_mode_t mode;
+  /**
+   * Operation (encrypt or decrypt).
+   */
+  otcrypto_aes_operation_t operation;
+  /**
+   * Padding mode, applied in `otcrypto_aes_final()` for encryption.
+   */
+  otcrypto_aes_padding_t padding;
+  /**
+   * Current IV, updated after every block (ignored in ECB mode).
+   */
+  aes_block_t iv;
+  /**
+   * Partial input block; the first `partial_len` bytes are valid.
+   *
+   * The block may be empty, but will never be full.
+   */
+  aes_block_t partial_block;
+  /**
+   * Number of valid bytes in `partial_block`.
+   */
+  size_t partial_len;
+  /**
+   * Checksum over all other fields of the context.
+   */
+  uint32_t checksum;
+} __attribute__((aligned(sizeof(uint32_t)))) aes_context_t;
+
+// Check AES context size against the underlying implementation.
+static_assert(sizeof(otcrypto_aes_context_t) >= sizeof(aes_context_t),
+              "Size of AES context object for top-level API must be at least "
+              "as large as the context for the underlying implementation.");
+static_assert(sizeof(aes_context_t) % sizeof(uint32_t) == 0,
+              "Internal AES context object must be a multiple of the word "
+              "size for use with `hardened_memcpy`.");
+enum {
+  kAesContextNumWords = sizeof(aes_context_t) / sizeof(uint32_t),
+  /**
+   * Number of blocks recomputed at a time by the redundant streaming check.
+   */
+  kAesContextCheckNumBlocks = 4,
+  /**
+   * Number of blocks passed to the AES driver in one pipelined batch.
+   */
+  kAesBatchNumBlocks = 8,
+};
+
 /**
  * Extract an AES key from the blinded key struct.
  *
@@ -276,6 +336,100 @@ otcrypto_status_t otcrypto_aes_padded_plaintext_length(
   return OTCRYPTO_OK;
 }
 
+/**
+ * Runs the AES hardware over a sequence of blocks.
+ *
+ * Starts the hardware with the given key and IV, pipelines all
+ * `input_nblocks` blocks through it, verifies the control registers and ends
+ * the session. Blocks past the end of `input` are padded according to
+ * `padding`. For modes other than ECB, `aes_iv` is updated with the final IV
+ * so that a later call can continue the operation.
+ *
+ * Does not clear a sideloaded key; that is the caller's responsibility.
+ *
+ * @param aes_key AES key.
+ * @param aes_operation Required AES operation (encrypt or decrypt).
+ * @param[in,out] aes_iv IV for non-ECB modes; updated in place.
+ * @param input Input data to be ciphered.
+ * @param padding Padding scheme to be used for the data.
+ * @param input_nblocks Number of blocks to process, including padding.
+ * @param[out] output Output buffer, `input_nblocks` blocks long.
+ * @return The result of the cipher operation.
+ */
+static status_t aes_cipher_blocks(const aes_key_t aes_key,
+                                  otcrypto_aes_operation_t aes_operation,
+                                  aes_block_t *aes_iv,
+                                  otcrypto_const_byte_buf_t input,
+                                  otcrypto_aes_padding_t padding,
+                                  size_t input_nblocks, unsigned char *output) {
+  // Start the operation (encryption or decryption).
+  otcrypto_aes_operation_t aes_operation_started = launder32(0);
+  switch (aes_operation) {
+    case kOtcryptoAesOperationEncrypt:
+      HARDENED_TRY(aes_encrypt_begin(aes_key, aes_iv));
+      aes_operation_started =
+          launder32(aes_operation_started) | kOtcryptoAesOperationEncrypt;
+      break;
+    case kOtcryptoAesOperationDecrypt:
+      HARDENED_TRY(aes_decrypt_begin(aes_key, aes_iv));
+      aes_operation_started =
+          launder32(aes_operation_started) | kOtcryptoAesOperationDecrypt;
+      break;
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+  // Check if we landed in the correct case statement. Use ORs for this to
+  // avoid that multiple cases were executed.
+  HARDENED_CHECK_EQ(launder32(aes_operation_started), aes_operation);
+
+  // Perform the cipher operation in batches of up to `kAesBatchNumBlocks`
+  // blocks. Within a batch, the driver keeps up to 3 blocks in flight, which
+  // is beneficial from a hardening and performance point of view:
+  // - Software retrieves Block x-1 from the data output registers.
+  // - Hardware processes Block x.
+  // - Software provides  Block x+1 via the data input registers.
+  //
+  // See the AES driver for details.
+  aes_block_t blocks[kAesBatchNumBlocks];
+  size_t i = 0;
+  while (launder32(i) < input_nblocks) {
+    size_t batch_nblocks = input_nblocks - i;
+    if (batch_nblocks > kAesBatchNumBlocks) {
+      batch_nblocks = kAesBatchNumBlocks;
+    }
+    for (size_t j = 0; j < batch_nblocks; ++j) {
+      HARDENED_TRY(get_block(input, padding, i + j, &blocks[j]));
+    }
+    HARDENED_TRY(aes_update_blocks(blocks, blocks, batch_nblocks));
+    // Byte buffers passed as input may not be word-aligned, so we cannot
+    // use `hardened_memcpy`.
+    // This is acceptable because the data is non-sensitive.
+    memcpy(&output[i * kAesBlockNumBytes], blocks,
+           batch_nblocks * kAesBlockNumBytes);
+    i += batch_nblocks;
+  }
+  // Check that the loop ran for the correct number of iterations.
+  HARDENED_CHECK_EQ(i, input_nblocks);
+  HARDENED_TRY(hardened_memshred((uint32_t *)blocks,
+                                 kAesBatchNumBlocks * kAesBlockNumWords));
+
+  // Verify the CTRL and CTRL_AUX registers.
+
+  // Since this is a checking mechanism itself, we do not add extra redundancy
+  // to the if loop.
+  hardened_bool_t encrypt = kHardenedBoolTrue;
+  if (aes_operation == kOtcryptoAesOperationDecrypt)
+    encrypt = kHardenedBoolFalse;
+  HARDENED_TRY(aes_verify_ctrl_reg(aes_key, encrypt));
+  HARDENED_TRY(aes_verify_ctrl_aux_reg());
+
+  // Deinitialize the AES block and update the IV (in ECB mode, skip the IV).
+  if (aes_key.mode == kAesCipherModeEcb) {
+    return aes_end(NULL);
+  }
+  return aes_end(aes_iv);
+}
+
 /**
  * Performs the AES operation.
  *
@@ -351,108 +505,13 @@ static otcrypto_status_t otcrypto_aes_impl(
   aes_key_t aes_key;
   HARDENED_TRY(aes_key_construct(key, aes_mode, &aes_key));
 
-  // Start the operation (encryption or decryption).
-  otcrypto_aes_operation_t aes_operation_started = launder32(0);
-  switch (aes_operation) {
-    case kOtcryptoAesOperationEncrypt:
-      HARDENED_TRY(aes_encrypt_begin(aes_key, &aes_iv));
-      aes_operation_started =
-          launder32(aes_operation_started) | kOtcryptoAesOperationEncrypt;
-      break;
-    case kOtcryptoAesOperationDecrypt:
-      HARDENED_TRY(aes_decrypt_begin(aes_key, &aes_iv));
-      aes_operation_started =
-          launder32(aes_operation_started) | kOtcryptoAesOperationDecrypt;
-      break;
-    default:
-      return OTCRYPTO_BAD_ARGS;
-  }
-  // Check if we landed in the correct case statement. Use ORs for this to
-  // avoid that multiple cases were executed.
-  HARDENED_CHECK_EQ(launder32(aes_operation_started), aes_operation);
-
-  // Perform the cipher operation for all full blocks. The input and output are
-  // offset by `block_offset` number of blocks, where `block_offset` can be 1
-  // or 2. So if unrolled, these loops would look like:
-  //
-  // - block_offset == 1
-  //   aes_update(NULL, input[0]);
-  //   aes_update(output[0], input[1]);
-  //   aes_update(output[1], input[2]);
-  //   aes_update(output[2], NULL);
-  //
-  // - block_offset == 2
-  //   aes_update(NULL, input[0]);
-  //   aes_update(NULL, input[1]);
-  //   aes_update(output[0], input[2]); // The HW is processing input[1].
-  //   aes_update(output[1], input[3]); // The HW is processing input[2].
-  //   aes_update(output[2], NULL);
-  //   aes_update(output[3], NULL);
-  //
-  // Using a `block_offset` of 2 allows having 3 blocks in flight which is
-  // beneficial from a hardening and performance point of view:
-  // - Software retrieves Block x-1 from the data output registers.
-  // - Hardware processes Block x.
-  // - Software provides  Block x+1 via the data input registers.
-  //
-  // See the AES driver for details.
-  const size_t block_offset = input_nblocks >= 3 ? 2 : 1;
-  aes_block_t block_in;
-  aes_block_t block_out;
-  size_t i;
+  // Run the cipher over all blocks, including padding.
+  HARDENED_TRY(aes_cipher_blocks(aes_key, aes_operation, &aes_iv, cipher_input,
+                                 aes_padding, input_nblocks,
+                                 cipher_output.data));
 
-  // Provide the first `block_offset` number of input blocks and call the AES
-  // cipher.
-  for (i = 0; launder32(i) < block_offset; ++i) {
-    HARDENED_TRY(get_block(cipher_input, aes_padding, i, &block_in));
-    HARDENED_TRY(aes_update(/*dest=*/NULL, &block_in));
-  }
-  // Check that the loop ran for the correct number of iterations.
-  HARDENED_CHECK_EQ(i, block_offset);
-
-  // Call the AES cipher while providing new input and copying data to the
-  // output buffer.
-  for (i = block_offset; launder32(i) < input_nblocks; ++i) {
-    HARDENED_TRY(get_block(cipher_input, aes_padding, i, &block_in));
-    HARDENED_TRY(hardened_memshred(block_out.data, ARRAYSIZE(block_out.data)));
-    HARDENED_TRY(aes_update(&block_out, &block_in));
-    // Byte buffers passed as input may not be word-aligned, so we cannot
-    // use `hardened_memcpy`.
-    // This is acceptable because the data is non-sensitive.
-    memcpy(&cipher_output.data[(i - block_offset) * kAesBlockNumBytes],
-           block_out.data, kAesBlockNumBytes);
-  }
-  // Check that the loop ran for the correct number of iterations.
-  HARDENED_CHECK_EQ(i, input_nblocks);
-
-  // Retrieve the output from the final `block_offset` blocks (providing no
-  // input).
-  for (i = block_offset; i > 0; --i) {
-    HARDENED_TRY(aes_update(&block_out, /*src=*/NULL));
-    // Byte buffers passed as input may not be word-aligned, so we cannot
-    // use `hardened_memcpy`.
-    // This is acceptable because the data is non-sensitive.
-    memcpy(&cipher_output.data[(input_nblocks - i) * kAesBlockNumBytes],
-           block_out.data, kAesBlockNumBytes);
-  }
-  // Check that the loop ran for the correct number of iterations.
-  HARDENED_CHECK_EQ(launder32(i), 0);
-
-  // Verify the CTRL and CTRL_AUX registers.
-
-  // Since this is a checking mechanism itself, we do not add extra redundancy
-  // to the if loop.
-  hardened_bool_t encrypt = kHardenedBoolTrue;
-  if (aes_operation == kOtcryptoAesOperationDecrypt)
-    encrypt = kHardenedBoolFalse;
-  HARDENED_TRY(aes_verify_ctrl_reg(aes_key, encrypt));
-  HARDENED_TRY(aes_verify_ctrl_aux_reg());
-
-  // Deinitialize the AES block and update the IV (in ECB mode, skip the IV).
-  if (aes_mode == kAesCipherModeEcb) {
-    HARDENED_TRY(aes_end(NULL));
-  } else {
-    HARDENED_TRY(aes_end(&aes_iv));
+  // Update the IV (in ECB mode, skip the IV).
+  if (aes_mode != kOtcryptoAesModeEcb) {
     HARDENED_TRY(hardened_memcpy(iv.data, aes_iv.data, kAesBlockNumWords));
   }
 
@@ -536,3 +595,311 @@ otcrypto_status_t otcrypto_aes(otcrypto_blinded_key_t *key,
 
   return OTCRYPTO_OK;
 }
+
+/**
+ * Compute the checksum of a streaming AES context.
+ *
+ * Covers every field except the checksum itself. The partial block is
+ * plaintext for encryption and ciphertext for decryption, so no masked secret
+ * is fed into the checksum.
+ *
+ * @param ctx Internal context object.
+ * @returns Checksum value.
+ */
+static uint32_t aes_context_checksum(const aes_context_t *ctx) {
+  uint32_t checksum;
+  crc32_init(&checksum);
+  crc32_add32(&checksum, (uint32_t)(uintptr_t)ctx->key);
+  crc32_add32(&checksum, ctx->mode);
+  crc32_add32(&checksum, ctx->operation);
+  crc32_add32(&checksum, ctx->padding);
+  crc32_add(&checksum, (unsigned char *)ctx->iv.data, kAesBlockNumBytes);
+  crc32_add(&checksum, (unsigned char *)ctx->partial_block.data,
+            kAesBlockNumBytes);
+  crc32_add32(&checksum, ctx->partial_len);
+  return crc32_finish(&checksum);
+}
+
+/**
+ * Save a streaming AES context.
+ *
+ * Updates the checksum before copying the context out.
+ *
+ * @param internal_ctx Internal context object to save.
+ * @param[out] api_ctx Resulting API-facing context object.
+ * @return Result of the operation.
+ */
+static status_t aes_context_save(aes_context_t *internal_ctx,
+                                 otcrypto_aes_context_t *api_ctx) {
+  internal_ctx->checksum = aes_context_checksum(internal_ctx);
+  return hardened_memcpy(api_ctx->data, (uint32_t *)internal_ctx,
+                         kAesContextNumWords);
+}
+
+/**
+ * Restore a streaming AES context.
+ *
+ * Returns an error if the checksum of the restored context does not match.
+ *
+ * @param api_ctx API-facing context object to restore from.
+ * @param[out] internal_ctx Resulting internal context object.
+ * @return Result of the operation.
+ */
+static status_t aes_context_restore(otcrypto_aes_context_t *api_ctx,
+                                    aes_context_t *internal_ctx) {
+  HARDENED_TRY(hardened_memcpy((uint32_t *)internal_ctx, api_ctx->data,
+                               kAesContextNumWords));
+  if (launder32(internal_ctx->checksum) !=
+          aes_context_checksum(internal_ctx) ||
+      internal_ctx->partial_len >= kAesBlockNumBytes) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_CHECK_EQ(internal_ctx->checksum,
+                    aes_context_checksum(internal_ctx));
+  HARDENED_CHECK_LT(internal_ctx->partial_len, kAesBlockNumBytes);
+  return OTCRYPTO_OK;
+}
+
+/**
+ * Cipher full blocks of input for a streaming AES operation.
+ *
+ * Advances the IV in the context. For keys with a security level above low,
+ * recomputes the input from the output with the inverse operation and checks
+ * that it matches, as the one-shot `otcrypto_aes()` does; the recomputation
+ * is done a few blocks at a time so that stack usage does not depend on the
+ * input length.
+ *
+ * @param ctx Internal context object, updated in place.
+ * @param input Input data; must be exactly `nblocks` blocks long.
+ * @param nblocks Number of blocks to process.
+ * @param[out] output Output buffer, `nblocks` blocks long.
+ * @return Result of the operation.
+ */
+static status_t aes_context_process(aes_context_t *ctx,
+                                    otcrypto_const_byte_buf_t input,
+                                    size_t nblocks, unsigned char *output) {
+  if (nblocks == 0) {
+    return OTCRYPTO_OK;
+  }
+
+  // Remember the IV at the start for the redundant computation.
+  aes_block_t iv_start;
+  HARDENED_TRY(
+      hardened_memcpy(iv_start.data, ctx->iv.data, kAesBlockNumWords));
+
+  aes_key_t aes_key;
+  HARDENED_TRY(aes_key_construct(ctx->key, ctx->mode, &aes_key));
+  HARDENED_TRY(aes_cipher_blocks(aes_key, ctx->operation, &ctx->iv, input,
+                                 kOtcryptoAesPaddingNull, nblocks, output));
+  HARDENED_TRY(keymgr_sideload_clear_aes());
+
+  if (launder32(ctx->key->config.security_level) ==
+      kOtcryptoKeySecurityLevelLow) {
+    HARDENED_CHECK_EQ(ctx->key->config.security_level,
+                      kOtcryptoKeySecurityLevelLow);
+    // No additional FI protection.
+    return OTCRYPTO_OK;
+  }
+  HARDENED_CHECK_NE(ctx->key->config.security_level,
+                    kOtcryptoKeySecurityLevelLow);
+
+  otcrypto_aes_operation_t aes_operation_inverse = kOtcryptoAesOperationEncrypt;
+  if (ctx->operation == kOtcryptoAesOperationEncrypt) {
+    aes_operation_inverse = kOtcryptoAesOperationDecrypt;
+  }
+
+  // Recompute the input from the output, starting again from the initial IV.
+  HARDENED_TRY(aes_key_construct(ctx->key, ctx->mode, &aes_key));
+  aes_block_t recomputed[kAesContextCheckNumBlocks];
+  size_t i = 0;
+  while (launder32(i) < nblocks) {
+    size_t chunk_nblocks = nblocks - i;
+    if (chunk_nblocks > kAesContextCheckNumBlocks) {
+      chunk_nblocks = kAesContextCheckNumBlocks;
+    }
+    otcrypto_const_byte_buf_t output_chunk = {
+        .data = &output[i * kAesBlockNumBytes],
+        .len = chunk_nblocks * kAesBlockNumBytes,
+    };
+    HARDENED_TRY(aes_cipher_blocks(
+        aes_key, aes_operation_inverse, &iv_start, output_chunk,
+        kOtcryptoAesPaddingNull, chunk_nblocks, (unsigned char *)recomputed));
+    HARDENED_CHECK_EQ(
+        consttime_memeq_byte(&input.data[i * kAesBlockNumBytes], recomputed,
+                             chunk_nblocks * kAesBlockNumBytes),
+        kHardenedBoolTrue);
+    i += chunk_nblocks;
+  }
+  HARDENED_CHECK_EQ(i, nblocks);
+
+  return keymgr_sideload_clear_aes();
+}
+
+otcrypto_status_t otcrypto_aes_init(otcrypto_blinded_key_t *key,
+                                    otcrypto_const_word32_buf_t iv,
+                                    otcrypto_aes_mode_t aes_mode,
+                                    otcrypto_aes_operation_t aes_operation,
+                                    otcrypto_aes_padding_t aes_padding,
+                                    otcrypto_aes_context_t *ctx) {
+  if (key == NULL || ctx == NULL ||
+      (aes_mode != kOtcryptoAesModeEcb && iv.data == NULL)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Check the operation and padding mode up front so that errors do not only
+  // show up at the end of a long stream.
+  if (aes_operation != kOtcryptoAesOperationEncrypt &&
+      aes_operation != kOtcryptoAesOperationDecrypt) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  if (aes_padding != kOtcryptoAesPaddingPkcs7 &&
+      aes_padding != kOtcryptoAesPaddingIso9797M2 &&
+      aes_padding != kOtcryptoAesPaddingNull) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Check the security config of the device.
+  HARDENED_TRY(security_config_check(key->config.security_level));
+
+  // Ensure the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  // Check the key now; it is re-checked and re-masked on every update.
+  aes_key_t aes_key;
+  HARDENED_TRY(aes_key_construct(key, aes_mode, &aes_key));
+  HARDENED_TRY(keymgr_sideload_clear_aes());
+
+  aes_context_t internal_ctx;
+  internal_ctx.key = key;
+  internal_ctx.mode = aes_mode;
+  internal_ctx.operation = aes_operation;
+  internal_ctx.padding = aes_padding;
+  internal_ctx.partial_len = 0;
+  HARDENED_TRY(hardened_memshred(internal_ctx.partial_block.data,
+                                 kAesBlockNumWords));
+
+  // Copy the IV; ECB mode ignores it, so in this case it is zeroed.
+  if (aes_mode == kOtcryptoAesModeEcb) {
+    HARDENED_CHECK_EQ(launder32(aes_mode), kOtcryptoAesModeEcb);
+    memset(internal_ctx.iv.data, 0, sizeof(internal_ctx.iv.data));
+  } else {
+    HARDENED_CHECK_NE(launder32(aes_mode), kOtcryptoAesModeEcb);
+
+    // The IV must be exactly one block long.
+    if (iv.len != kAesBlockNumWords) {
+      return OTCRYPTO_BAD_ARGS;
+    }
+    HARDENED_CHECK_EQ(launder32(iv.len), kAesBlockNumWords);
+    HARDENED_TRY(
+        hardened_memcpy(internal_ctx.iv.data, iv.data, kAesBlockNumWords));
+  }
+
+  return aes_context_save(&internal_ctx, ctx);
+}
+
+otcrypto_status_t otcrypto_aes_update(otcrypto_aes_context_t *ctx,
+                                      otcrypto_const_byte_buf_t cipher_input,
+                                      otcrypto_byte_buf_t cipher_output,
+                                      size_t *output_bytes_written) {
+  if (ctx == NULL || output_bytes_written == NULL ||
+      (cipher_input.len != 0 && cipher_input.data == NULL)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  *output_bytes_written = 0;
+
+  // Ensure the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  aes_context_t internal_ctx;
+  HARDENED_TRY(aes_context_restore(ctx, &internal_ctx));
+
+  // Check that the output is long enough for all full blocks.
+  size_t nblocks =
+      (internal_ctx.partial_len + cipher_input.len) / kAesBlockNumBytes;
+  if (nblocks > 0 &&
+      (cipher_output.data == NULL ||
+       cipher_output.len < nblocks * kAesBlockNumBytes)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // If there is a partial block and enough input to fill it, complete it and
+  // process it first.
+  const unsigned char *input = cipher_input.data;
+  size_t input_len = cipher_input.len;
+  if (internal_ctx.partial_len != 0 && nblocks > 0) {
+    size_t fill_len = kAesBlockNumBytes - internal_ctx.partial_len;
+    memcpy((unsigned char *)internal_ctx.partial_block.data +
+               internal_ctx.partial_len,
+           input, fill_len);
+    otcrypto_const_byte_buf_t block = {
+        .data = (unsigned char *)internal_ctx.partial_block.data,
+        .len = kAesBlockNumBytes,
+    };
+    HARDENED_TRY(
+        aes_context_process(&internal_ctx, block, 1, cipher_output.data));
+    input += fill_len;
+    input_len -= fill_len;
+    internal_ctx.partial_len = 0;
+    *output_bytes_written += kAesBlockNumBytes;
+    nblocks--;
+  }
+
+  // Process the remaining full blocks straight from the caller's buffer.
+  otcrypto_const_byte_buf_t full_blocks = {
+      .data = input,
+      .len = nblocks * kAesBlockNumBytes,
+  };
+  HARDENED_TRY(aes_context_process(
+      &internal_ctx, full_blocks, nblocks,
+      &cipher_output.data[*output_bytes_written]));
+  *output_bytes_written += full_blocks.len;
+
+  // Keep any leftover input in the partial block.
+  size_t leftover_len = input_len - full_blocks.len;
+  memcpy((unsigned char *)internal_ctx.partial_block.data +
+             internal_ctx.partial_len,
+         &input[full_blocks.len], leftover_len);
+  internal_ctx.partial_len += leftover_len;
+
+  return aes_context_save(&internal_ctx, ctx);
+}
+
+otcrypto_status_t otcrypto_aes_final(otcrypto_aes_context_t *ctx,
+                                     otcrypto_byte_buf_t cipher_output,
+                                     size_t *output_bytes_written) {
+  if (ctx == NULL || output_bytes_written == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  *output_bytes_written = 0;
+
+  // Ensure the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  aes_context_t internal_ctx;
+  HARDENED_TRY(aes_context_restore(ctx, &internal_ctx));
+
+  if (internal_ctx.operation == kOtcryptoAesOperationEncrypt &&
+      internal_ctx.padding != kOtcryptoAesPaddingNull) {
+    // Pad and encrypt the last block.
+    if (cipher_output.data == NULL || cipher_output.len < kAesBlockNumBytes) {
+      return OTCRYPTO_BAD_ARGS;
+    }
+    HARDENED_TRY(aes_padding_apply(internal_ctx.padding,
+                                   internal_ctx.partial_len,
+                                   &internal_ctx.partial_block));
+    otcrypto_const_byte_buf_t block = {
+        .data = (unsigned char *)internal_ctx.partial_block.data,
+        .len = kAesBlockNumBytes,
+    };
+    HARDENED_TRY(
+        aes_context_process(&internal_ctx, block, 1, cipher_output.data));
+    *output_bytes_written = kAesBlockNumBytes;
+  } else if (internal_ctx.partial_len != 0) {
+    // Without padding, and always for decryption, the total input length
+    // must be a multiple of the block size.
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Clear the context so it cannot be reused.
+  return hardened_memshred(ctx->data, ARRAYSIZE(ctx->data));
+}
@@ -23,6 +23,18 @@ enum {
    * Log2 of the number of bytes in an AES block.
    */
   kAesBlockLog2NumBytes = 4,
+  /**
+   * Maximum number of blocks passed to the AES driver in one GCTR batch.
+   */
+  kGctrBatchNumBlocks = 8,
+  /**
+   * Minimum number of GHASH blocks for which the one-shot operations switch
+   * to the aggregated GHASH engine.
+   *
+   * Below this, the cost of precomputing the hash subkey powers outweighs the
+   * savings.
+   */
+  kGhashAggregateMinBlocks = 16,
 };
 static_assert(kAesBlockNumBytes == (1 << kAesBlockLog2NumBytes),
               "kAesBlockLog2NumBytes does not match kAesBlockNumBytes");
@@ -58,26 +70,39 @@ static inline void block_inc32(aes_block_t *block) {
 }
 
 /**
- * One-shot version of the AES encryption API for a single block.
+ * One-shot version of the AES encryption API for up to `kGctrBatchNumBlocks`
+ * blocks.
+ *
+ * In CTR mode, block `i` is encrypted with the counter `iv + i`, where the
+ * whole 128-bit IV is incremented; the caller must split batches if that
+ * differs from the GCM `inc32` counter. `iv` is not modified.
+ *
+ * @param key The AES key.
+ * @param iv Initial counter block.
+ * @param input Input blocks.
+ * @param[out] output Output blocks (must not overlap `input`).
+ * @param nblocks Number of blocks.
+ * @param security_level Security level configuration.
+ * @return OK or error.
  */
 OT_WARN_UNUSED_RESULT
-static status_t aes_encrypt_block(
+static status_t aes_encrypt_blocks(
     const aes_key_t key, const aes_block_t *iv, const aes_block_t *input,
-    aes_block_t *output, otcrypto_key_security_level_t security_level) {
+    aes_block_t *output, size_t nblocks,
+    otcrypto_key_security_level_t security_level) {
+  HARDENED_CHECK_LE(nblocks, kGctrBatchNumBlocks);
   if (launder32(security_level) == kOtcryptoKeySecurityLevelLow) {
     HARDENED_CHECK_EQ(security_level, kOtcryptoKeySecurityLevelLow);
     // No additional FI protection.
     HARDENED_TRY(aes_encrypt_begin(key, iv));
-    HARDENED_TRY(aes_update(/*dest=*/NULL, input));
-    HARDENED_TRY(aes_update(output, /*src=*/NULL));
+    HARDENED_TRY(aes_update_blocks(output, input, nblocks));
     return aes_end(NULL);
   } else {
     HARDENED_CHECK_NE(security_level, kOtcryptoKeySecurityLevelLow);
     // Additional FI hardening.
     // First AES operation. Encrypt the input.
     HARDENED_TRY(aes_encrypt_begin(key, iv));
-    HARDENED_TRY(aes_update(/*dest=*/NULL, input));
-    HARDENED_TRY(aes_update(output, /*src=*/NULL));
+    HARDENED_TRY(aes_update_blocks(output, input, nblocks));
 
     // Verify the CTRL and CTRL_AUX registers of the encryption.
     HARDENED_TRY(aes_verify_ctrl_reg(key, kHardenedBoolTrue));
@@ -85,15 +110,15 @@ static status_t aes_encrypt_block(
 
     // Second AES operation. Decrypt the output of the first AES operation and
     // check whether the same input is retrieved.
-    aes_block_t input_recalculated = (aes_block_t){.data = {0}};
+    aes_block_t input_recalculated[kGctrBatchNumBlocks];
+    memset(input_recalculated, 0, sizeof(input_recalculated));
     HARDENED_TRY(aes_decrypt_begin(key, iv));
-    HARDENED_TRY(aes_update(/*dest=*/NULL, output));
-    HARDENED_TRY(aes_update(&input_recalculated, /*src=*/NULL));
+    HARDENED_TRY(aes_update_blocks(input_recalculated, output, nblocks));
     HARDENED_TRY(aes_end(NULL));
 
     HARDENED_CHECK_EQ(
-        hardened_memeq((const uint32_t *)input_recalculated.data,
-                       (const uint32_t *)input->data, kAesBlockNumWords),
+        hardened_memeq((const uint32_t *)input_recalculated,
+                       (const uint32_t *)input, nblocks * kAesBlockNumWords),
         kHardenedBoolTrue);
 
     return OTCRYPTO_OK;
@@ -101,23 +126,41 @@ static status_t aes_encrypt_block(
 }
 
 /**
- * Run GCTR on exactly one block of input.
+ * Run GCTR on up to `kGctrBatchNumBlocks` blocks of input.
  *
- * Updates the IV in-place.
+ * Updates the IV in-place. The hardware increments the whole 128-bit counter
+ * while GCM only increments the last 32 bits, so the batch is split where
+ * the last 32 bits of the counter wrap around.
  *
  * @param key The AES key
  * @param iv Initialization vector, 128 bits
- * @param input Input block
+ * @param input Input blocks
+ * @param nblocks Number of blocks
  * @param security_level Security level configuration
- * @param[out] output Output block
+ * @param[out] output Output blocks (must not overlap `input`)
  */
 OT_WARN_UNUSED_RESULT
-static status_t gctr_process_block(const aes_key_t key, aes_block_t *iv,
-                                   aes_block_t *input,
-                                   otcrypto_key_security_level_t security_level,
-                                   aes_block_t *output) {
-  HARDENED_TRY(aes_encrypt_block(key, iv, input, output, security_level));
-  block_inc32(iv);
+static status_t gctr_process_blocks(
+    const aes_key_t key, aes_block_t *iv, const aes_block_t *input,
+    size_t nblocks, otcrypto_key_security_level_t security_level,
+    aes_block_t *output) {
+  while (nblocks > 0) {
+    // Number of blocks until the last 32 bits of the counter wrap (zero means
+    // 2^32, which is more than any batch).
+    uint32_t ctr = __builtin_bswap32(iv->data[kAesBlockNumWords - 1]);
+    size_t until_wrap = (uint32_t)(0 - ctr);
+    size_t n = nblocks;
+    if (until_wrap != 0 && until_wrap < n) {
+      n = until_wrap;
+    }
+
+    HARDENED_TRY(aes_encrypt_blocks(key, iv, input, output, n, security_level));
+    iv->data[kAesBlockNumWords - 1] = __builtin_bswap32(ctr + (uint32_t)n);
+
+    input += n;
+    output += n;
+    nblocks -= n;
+  }
   return OTCRYPTO_OK;
 }
 
@@ -174,25 +217,32 @@ static status_t aes_gcm_gctr(const aes_key_t key, aes_block_t *iv,
     input += kAesBlockNumBytes - partial_len;
     input_len -= kAesBlockNumBytes - partial_len;
 
-    // Process the block.
-    aes_block_t block_out;
-    HARDENED_TRY(
-        gctr_process_block(key, iv, partial, security_level, &block_out));
-    memcpy(output, block_out.data, kAesBlockNumBytes);
-    output += kAesBlockNumBytes;
-    *output_len = kAesBlockNumBytes;
-
-    // Process any remaining full blocks of input.
-    while (input_len >= kAesBlockNumBytes) {
-      memcpy(partial->data, input, kAesBlockNumBytes);
-      HARDENED_TRY(
-          gctr_process_block(key, iv, partial, security_level, &block_out));
-      memcpy(output, block_out.data, kAesBlockNumBytes);
-      output += kAesBlockNumBytes;
-      *output_len += kAesBlockNumBytes;
-      input += kAesBlockNumBytes;
-      input_len -= kAesBlockNumBytes;
-    }
+    // Process the block together with as many full blocks of new data as
+    // fit in the batch, then continue in full batches.
+    aes_block_t blocks_in[kGctrBatchNumBlocks];
+    aes_block_t blocks_out[kGctrBatchNumBlocks];
+    blocks_in[0] = *partial;
+    size_t nblocks = 1;
+    *output_len = 0;
+    do {
+      size_t nbytes = (kGctrBatchNumBlocks - nblocks) * kAesBlockNumBytes;
+      if (nbytes > input_len) {
+        nbytes = input_len - input_len % kAesBlockNumBytes;
+      }
+      // Byte buffers passed as input may not be word-aligned, so we cannot
+      // use `hardened_memcpy`.
+      memcpy(&blocks_in[nblocks], input, nbytes);
+      input += nbytes;
+      input_len -= nbytes;
+      nblocks += nbytes / kAesBlockNumBytes;
+
+      HARDENED_TRY(gctr_process_blocks(key, iv, blocks_in, nblocks,
+                                       security_level, blocks_out));
+      memcpy(output, blocks_out, nblocks * kAesBlockNumBytes);
+      output += nblocks * kAesBlockNumBytes;
+      *output_len += nblocks * kAesBlockNumBytes;
+      nblocks = 0;
+    } while (input_len >= kAesBlockNumBytes);
 
     // Copy any remaining input into the partial block.
     memcpy(partial->data, input, input_len);
@@ -222,8 +272,8 @@ static status_t aes_gcm_hash_subkey(
   aes_block_t zero;
   memset(zero.data, 0, kAesBlockNumBytes);
   aes_block_t hash_subkey;
-  HARDENED_TRY(
-      aes_encrypt_block(key, &zero, &zero, &hash_subkey, security_level));
+  HARDENED_TRY(aes_encrypt_blocks(key, &zero, &zero, &hash_subkey,
+                                  /*nblocks=*/1, security_level));
 
   // Create two shares of the hash subkey.
   aes_block_t hash_subkey_share0;
@@ -351,22 +401,98 @@ static status_t aes_gcm_get_tag(aes_gcm_context_t *ctx, size_t tag_len,
   return OTCRYPTO_OK;
 }
 
-status_t aes_gcm_encrypt(const aes_key_t key, const size_t iv_len,
-                         const uint32_t *iv, const size_t plaintext_len,
-                         const uint8_t *plaintext, const size_t aad_len,
-                         const uint8_t *aad, const size_t tag_len,
-                         uint32_t *tag, uint8_t *ciphertext) {
+static status_t aes_gcm_update_aad_impl(aes_gcm_context_t *ctx,
+                                        const ghash_subkey_powers_t *powers,
+                                        const size_t aad_len,
+                                        const uint8_t *aad);
+
+static status_t aes_gcm_update_encrypted_data_impl(
+    aes_gcm_context_t *ctx, const ghash_subkey_powers_t *powers,
+    size_t input_len, const uint8_t *input, size_t *output_len,
+    uint8_t *output);
+
+/**
+ * Select the GHASH engine for a one-shot AES-GCM operation.
+ *
+ * If the AAD and the input together are long enough, precomputes the hash
+ * subkey powers into `powers` and returns a pointer to them; otherwise returns
+ * NULL to select the baseline engine.
+ *
+ * @param ctx Initialized AES-GCM context.
+ * @param aad_len Length of the associated data in bytes.
+ * @param input_len Length of the input in bytes.
+ * @param[out] powers Buffer for the hash subkey powers.
+ * @return Hash subkey powers to use, or NULL.
+ */
+static const ghash_subkey_powers_t *aes_gcm_subkey_powers(
+    const aes_gcm_context_t *ctx, size_t aad_len, size_t input_len,
+    ghash_subkey_powers_t *powers) {
+  size_t num_blocks = aad_len / kGhashBlockNumBytes;
+  num_blocks += input_len / kGhashBlockNumBytes;
+  if (num_blocks < kGhashAggregateMinBlocks) {
+    return NULL;
+  }
+  ghash_init_subkey_powers(&ctx->ghash_ctx, powers);
+  return powers;
+}
+
+/**
+ * Wipe a hash subkey powers buffer.
+ *
+ * The powers are derived from the hash subkey, so they must not outlive the
+ * operation that computed them.
+ *
+ * @param powers Hash subkey powers to wipe.
+ * @return OK or error.
+ */
+static status_t aes_gcm_subkey_powers_wipe(ghash_subkey_powers_t *powers) {
+  static_assert(sizeof(ghash_subkey_powers_t) % sizeof(uint32_t) == 0,
+                "Hash subkey powers must be a whole number of words.");
+  return hardened_memshred((uint32_t *)powers,
+                           sizeof(*powers) / sizeof(uint32_t));
+}
+
+/**
+ * One-shot AES-GCM encryption using a caller-provided subkey powers buffer.
+ *
+ * Arguments are as for `aes_gcm_encrypt()`.
+ *
+ * @param[out] powers Buffer for the hash subkey powers.
+ * @return OK or error.
+ */
+static status_t aes_gcm_encrypt_impl(
+    const aes_key_t key, const size_t iv_len, const uint32_t *iv,
+    const size_t plaintext_len, const uint8_t *plaintext, const size_t aad_len,
+    const uint8_t *aad, const size_t tag_len, uint32_t *tag,
+    uint8_t *ciphertext, ghash_subkey_powers_t *powers) {
   aes_gcm_context_t ctx;
   HARDENED_TRY(aes_gcm_encrypt_init(key, iv_len, iv, &ctx));
-  HARDENED_TRY(aes_gcm_update_aad(&ctx, aad_len, aad));
+  const ghash_subkey_powers_t *powers_ptr =
+      aes_gcm_subkey_powers(&ctx, aad_len, plaintext_len, powers);
+  HARDENED_TRY(aes_gcm_update_aad_impl(&ctx, powers_ptr, aad_len, aad));
   size_t ciphertext_bytes_written;
-  HARDENED_TRY(aes_gcm_update_encrypted_data(
-      &ctx, plaintext_len, plaintext, &ciphertext_bytes_written, ciphertext));
+  HARDENED_TRY(aes_gcm_update_encrypted_data_impl(&ctx, powers_ptr,
+                                                  plaintext_len, plaintext,
+                                                  &ciphertext_bytes_written,
+                                                  ciphertext));
   ciphertext += ciphertext_bytes_written;
   return aes_gcm_encrypt_final(&ctx, tag_len, tag, &ciphertext_bytes_written,
                                ciphertext);
 }
 
+status_t aes_gcm_encrypt(const aes_key_t key, const size_t iv_len,
+                         const uint32_t *iv, const size_t plaintext_len,
+                         const uint8_t *plaintext, const size_t aad_len,
+                         const uint8_t *aad, const size_t tag_len,
+                         uint32_t *tag, uint8_t *ciphertext) {
+  ghash_subkey_powers_t powers;
+  status_t result =
+      aes_gcm_encrypt_impl(key, iv_len, iv, plaintext_len, plaintext, aad_len,
+                           aad, tag_len, tag, ciphertext, &powers);
+  HARDENED_TRY(aes_gcm_subkey_powers_wipe(&powers));
+  return result;
+}
+
 /**
  * Starts an AES-GCM operation.
  *
@@ -397,9 +523,9 @@ static status_t aes_gcm_init(const aes_key_t key, const size_t iv_len,
   aes_block_t zero;
   memset(zero.data, 0, kAesBlockNumBytes);
   aes_block_t enc_initial_counter_block;
-  HARDENED_TRY(aes_encrypt_block(key, &ctx->initial_counter_block, &zero,
-                                 &enc_initial_counter_block,
-                                 ctx->security_level));
+  HARDENED_TRY(aes_encrypt_blocks(key, &ctx->initial_counter_block, &zero,
+                                  &enc_initial_counter_block, /*nblocks=*/1,
+                                  ctx->security_level));
 
   // Split the initial counter block S into two shares S0 and S1.
   // S0: random data.
@@ -452,8 +578,18 @@ status_t aes_gcm_encrypt_init(const aes_key_t key, const size_t iv_len,
   return aes_gcm_init(key, iv_len, iv, ctx);
 }
 
-status_t aes_gcm_update_aad(aes_gcm_context_t *ctx, const size_t aad_len,
-                            const uint8_t *aad) {
+/**
+ * Add associated data to an AES-GCM operation.
+ *
+ * @param ctx AES-GCM context.
+ * @param powers Hash subkey powers for the aggregated GHASH engine, or NULL.
+ * @param aad_len Length of the associated data in bytes.
+ * @param aad Associated data.
+ */
+static status_t aes_gcm_update_aad_impl(aes_gcm_context_t *ctx,
+                                        const ghash_subkey_powers_t *powers,
+                                        const size_t aad_len,
+                                        const uint8_t *aad) {
   // If the length is 0, we have nothing to do.
   if (aad_len == 0) {
     return OTCRYPTO_OK;
@@ -475,16 +611,33 @@ status_t aes_gcm_update_aad(aes_gcm_context_t *ctx, const size_t aad_len,
 
   // Accumulate any full blocks of AAD into the tag's GHASH computation.
   size_t partial_ghash_block_len = ctx->aad_len % kGhashBlockNumBytes;
-  ghash_process_full_blocks(&ctx->ghash_ctx, partial_ghash_block_len,
-                            &ctx->partial_ghash_block, aad_len, aad);
+  ghash_process_full_blocks_aggregated(&ctx->ghash_ctx, powers,
+                                       partial_ghash_block_len,
+                                       &ctx->partial_ghash_block, aad_len, aad);
   ctx->aad_len += aad_len;
 
   return OTCRYPTO_OK;
 }
 
-status_t aes_gcm_update_encrypted_data(aes_gcm_context_t *ctx, size_t input_len,
-                                       const uint8_t *input, size_t *output_len,
-                                       uint8_t *output) {
+status_t aes_gcm_update_aad(aes_gcm_context_t *ctx, const size_t aad_len,
+                            const uint8_t *aad) {
+  return aes_gcm_update_aad_impl(ctx, /*powers=*/NULL, aad_len, aad);
+}
+
+/**
+ * Add encrypted or decrypted data to an AES-GCM operation.
+ *
+ * @param ctx AES-GCM context.
+ * @param powers Hash subkey powers for the aggregated GHASH engine, or NULL.
+ * @param input_len Length of the input in bytes.
+ * @param input Input data.
+ * @param[out] output_len Number of bytes written to `output`.
+ * @param[out] output Buffer for output data.
+ */
+static status_t aes_gcm_update_encrypted_data_impl(
+    aes_gcm_context_t *ctx, const ghash_subkey_powers_t *powers,
+    size_t input_len, const uint8_t *input, size_t *output_len,
+    uint8_t *output) {
   // If the length is 0, we have nothing to do.
   if (input_len == 0) {
     return OTCRYPTO_OK;
@@ -531,12 +684,15 @@ status_t aes_gcm_update_encrypted_data(aes_gcm_context_t *ctx, size_t input_len,
     if (*output_len % kGhashBlockNumBytes != 0) {
       return OTCRYPTO_RECOV_ERR;
     }
-    ghash_process_full_blocks(&ctx->ghash_ctx, /*partial_len=*/0,
-                              &ctx->partial_ghash_block, *output_len, output);
+    ghash_process_full_blocks_aggregated(&ctx->ghash_ctx, powers,
+                                         /*partial_len=*/0,
+                                         &ctx->partial_ghash_block,
+                                         *output_len, output);
   } else if (ctx->is_encrypt == kHardenedBoolFalse) {
     size_t partial_ghash_block_len = ctx->input_len % kGhashBlockNumBytes;
-    ghash_process_full_blocks(&ctx->ghash_ctx, partial_ghash_block_len,
-                              &ctx->partial_ghash_block, input_len, input);
+    ghash_process_full_blocks_aggregated(
+        &ctx->ghash_ctx, powers, partial_ghash_block_len,
+        &ctx->partial_ghash_block, input_len, input);
   } else {
     return OTCRYPTO_BAD_ARGS;
   }
@@ -545,6 +701,13 @@ status_t aes_gcm_update_encrypted_data(aes_gcm_context_t *ctx, size_t input_len,
   return OTCRYPTO_OK;
 }
 
+status_t aes_gcm_update_encrypted_data(aes_gcm_context_t *ctx, size_t input_len,
+                                       const uint8_t *input, size_t *output_len,
+                                       uint8_t *output) {
+  return aes_gcm_update_encrypted_data_impl(ctx, /*powers=*/NULL, input_len,
+                                            input, output_len, output);
+}
+
 /**
  * Finalize an AES-GCM operation: process remaining data and get the tag.
  *
@@ -592,9 +755,9 @@ status_t aes_gcm_final(aes_gcm_context_t *ctx, size_t tag_len, uint32_t *tag,
     memset(partial_aes_block_bytes + partial_aes_block_len, 0,
            kAesBlockNumBytes - partial_aes_block_len);
     aes_block_t block_out;
-    HARDENED_TRY(gctr_process_block(ctx->key, &ctx->gctr_iv,
-                                    &ctx->partial_aes_block,
-                                    ctx->security_level, &block_out));
+    HARDENED_TRY(gctr_process_blocks(ctx->key, &ctx->gctr_iv,
+                                     &ctx->partial_aes_block, /*nblocks=*/1,
+                                     ctx->security_level, &block_out));
     memcpy(output, block_out.data, partial_aes_block_len);
     *output_len = partial_aes_block_len;
   }
@@ -640,23 +803,49 @@ status_t aes_gcm_encrypt_final(aes_gcm_context_t *ctx, size_t tag_len,
   return aes_gcm_final(ctx, tag_len, tag, output_len, output);
 }
 
-status_t aes_gcm_decrypt(const aes_key_t key, const size_t iv_len,
-                         const uint32_t *iv, const size_t ciphertext_len,
-                         const uint8_t *ciphertext, const size_t aad_len,
-                         const uint8_t *aad, const size_t tag_len,
-                         const uint32_t *tag, uint8_t *plaintext,
-                         hardened_bool_t *success) {
+/**
+ * One-shot AES-GCM decryption using a caller-provided subkey powers buffer.
+ *
+ * Arguments are as for `aes_gcm_decrypt()`.
+ *
+ * @param[out] powers Buffer for the hash subkey powers.
+ * @return OK or error.
+ */
+static status_t aes_gcm_decrypt_impl(
+    const aes_key_t key, const size_t iv_len, const uint32_t *iv,
+    const size_t ciphertext_len, const uint8_t *ciphertext,
+    const size_t aad_len, const uint8_t *aad, const size_t tag_len,
+    const uint32_t *tag, uint8_t *plaintext, hardened_bool_t *success,
+    ghash_subkey_powers_t *powers) {
   aes_gcm_context_t ctx;
   HARDENED_TRY(aes_gcm_decrypt_init(key, iv_len, iv, &ctx));
-  HARDENED_TRY(aes_gcm_update_aad(&ctx, aad_len, aad));
+  const ghash_subkey_powers_t *powers_ptr =
+      aes_gcm_subkey_powers(&ctx, aad_len, ciphertext_len, powers);
+  HARDENED_TRY(aes_gcm_update_aad_impl(&ctx, powers_ptr, aad_len, aad));
   size_t plaintext_bytes_written;
-  HARDENED_TRY(aes_gcm_update_encrypted_data(
-      &ctx, ciphertext_len, ciphertext, &plaintext_bytes_written, plaintext));
+  HARDENED_TRY(aes_gcm_update_encrypted_data_impl(&ctx, powers_ptr,
+                                                  ciphertext_len, ciphertext,
+                                                  &plaintext_bytes_written,
+                                                  plaintext));
   plaintext += plaintext_bytes_written;
   return aes_gcm_decrypt_final(&ctx, tag_len, tag, &plaintext_bytes_written,
                                plaintext, success);
 }
 
+status_t aes_gcm_decrypt(const aes_key_t key, const size_t iv_len,
+                         const uint32_t *iv, const size_t ciphertext_len,
+                         const uint8_t *ciphertext, const size_t aad_len,
+                         const uint8_t *aad, const size_t tag_len,
+                         const uint32_t *tag, uint8_t *plaintext,
+                         hardened_bool_t *success) {
+  ghash_subkey_powers_t powers;
+  status_t result = aes_gcm_decrypt_impl(key, iv_len, iv, ciphertext_len,
+                                         ciphertext, aad_len, aad, tag_len,
+                                         tag, plaintext, success, &powers);
+  HARDENED_TRY(aes_gcm_subkey_powers_wipe(&powers));
+  return result;
+}
+
 status_t aes_gcm_decrypt_init(const aes_key_t key, const size_t iv_len,
                               const uint32_t *iv, aes_gcm_context_t *ctx) {
   ctx->is_encrypt = kHardenedBoolFalse;
@@ -129,6 +129,28 @@ static inline void galois_mulx(const ghash_block_t *p, ghash_block_t *out) {
   out->data[0] ^= (0xe1 & mask);
 }
 
+/**
+ * Multiply an element of the GCM Galois field by the polynomial `x^4`.
+ *
+ * This is the shift-and-reduce step between two 4-bit windows of a table-based
+ * multiplication.
+ *
+ * @param block Polynomial to be multiplied, modified in-place.
+ */
+static inline void galois_mulx4(ghash_block_t *block) {
+  // Save the most significant half-byte of `block` before shifting.
+  uint8_t overflow = block_byte_get(block, kGhashBlockNumBytes - 1) & 0x0f;
+  // Shift `block` to the right, discarding high bits.
+  block_shiftr(block, 4);
+  // Look up the product of `overflow` and the low terms of the modulus in
+  // the precomputed table.
+  uint16_t reduce_term = kGFReduceTable[overflow];
+  // Add (xor) this product to the low bits to complete modular reduction.
+  // This works because (low + x^128 * high) is equivalent to (low + (x^128
+  // - modulus) * high).
+  block->data[0] ^= reduce_term;
+}
+
 /**
  * Reverse the bits of a 4-bit number.
  *
@@ -221,7 +243,7 @@ void ghash_init(ghash_context_t *ctx) {
  * @return Multiplication of the state and the hash subkey.
  */
 static ghash_block_t galois_mul_state_key(ghash_block_t state,
-                                          ghash_block_t tbl[16]) {
+                                          const ghash_block_t tbl[16]) {
   // Initialize the multiplication result to 0.
   ghash_block_t result;
   memset(result.data, 0, kGhashBlockNumBytes);
@@ -237,18 +259,7 @@ static ghash_block_t galois_mul_state_key(ghash_block_t state,
   // `result` is 0.
   for (size_t i = 0; i < kNumWindows; ++i) {
     if (i != 0) {
-      // Save the most significant half-byte of `result` before shifting.
-      uint8_t overflow =
-          block_byte_get(&result, kGhashBlockNumBytes - 1) & 0x0f;
-      // Shift `result` to the right, discarding high bits.
-      block_shiftr(&result, 4);
-      // Look up the product of `overflow` and the low terms of the modulus in
-      // the precomputed table.
-      uint16_t reduce_term = kGFReduceTable[overflow];
-      // Add (xor) this product to the low bits to complete modular reduction.
-      // This works because (low + x^128 * high) is equivalent to (low + (x^128
-      // - modulus) * high).
-      result.data[0] ^= reduce_term;
+      galois_mulx4(&result);
     }
 
     // Add the product of the next window and H to `result`. We process the
@@ -269,6 +280,45 @@ static ghash_block_t galois_mul_state_key(ghash_block_t state,
   return result;
 }
 
+/**
+ * Compute a sum of products of blocks with (masked) hash subkey powers.
+ *
+ * Returns the sum over j of `blocks[j] * K_j`, where `tbls[j]` is the product
+ * table of K_j. Because multiplication distributes over addition, the sum can
+ * be accumulated in a single Horner pass: each window costs one shift and
+ * reduce of the accumulator plus one table lookup per block, instead of one
+ * full multiplication per block.
+ *
+ * @param blocks Blocks to multiply.
+ * @param tbls Product tables, one for each block.
+ * @return Sum of the products.
+ */
+static ghash_block_t galois_mul_aggregated(
+    const ghash_block_t blocks[kGhashAggregateNumBlocks],
+    const ghash_block_t *const tbls[kGhashAggregateNumBlocks]) {
+  ghash_block_t result;
+  memset(result.data, 0, kGhashBlockNumBytes);
+
+  // See `galois_mul_state_key` for the details of the window traversal.
+  for (size_t i = 0; i < kNumWindows; ++i) {
+    if (i != 0) {
+      galois_mulx4(&result);
+    }
+
+    size_t byte_index = (kNumWindows - 1 - i) >> 1;
+    for (size_t j = 0; j < kGhashAggregateNumBlocks; ++j) {
+      uint8_t tbl_index = block_byte_get(&blocks[j], byte_index);
+      if ((i & 1) == 1) {
+        tbl_index >>= 4;
+      } else {
+        tbl_index &= 0x0f;
+      }
+      block_xor(&result, &tbls[j][tbl_index], &result);
+    }
+  }
+  return result;
+}
+
 /**
  * Single-block update function for GHASH.
  *
@@ -346,14 +396,81 @@ static void ghash_process_block(ghash_context_t *ctx, ghash_block_t *block) {
   ctx->ghash_block_cnt++;
 }
 
+/**
+ * Aggregated update function for GHASH.
+ *
+ * Incorporates `kGhashAggregateNumBlocks` blocks T1..T4 at once by computing
+ *   X' = (X + T1) * H^4 + T2 * H^3 + T3 * H^2 + T4 * H
+ * separately for each share of the hash subkey powers. The correction terms
+ * keep the same invariant as `ghash_process_block`: the state shares always
+ * add up to X + S0.
+ *
+ * Must not be used for the first block of a GHASH operation, since that one
+ * needs the S1-based correction term.
+ *
+ * @param ctx GHASH context.
+ * @param powers Hash subkey powers for `ctx`.
+ * @param blocks Blocks to incorporate; overwritten.
+ */
+static void ghash_process_blocks_aggregated(
+    ghash_context_t *ctx, const ghash_subkey_powers_t *powers,
+    ghash_block_t blocks[kGhashAggregateNumBlocks]) {
+  HARDENED_CHECK_NE(ctx->ghash_block_cnt, 0);
+
+  // blocks[0] = (share0+T1)+share1
+  hardened_xor_in_place(blocks[0].data, ctx->state0.data, kGhashBlockNumWords);
+  hardened_xor_in_place(blocks[0].data, ctx->state1.data, kGhashBlockNumWords);
+
+  // Process share 0.
+  // share0 = blocks * (H^4, H^3, H^2, H)_0 + (S0*(H0^4+1))
+  const ghash_block_t *const tbls0[kGhashAggregateNumBlocks] = {
+      powers->tbl0[2], powers->tbl0[1], powers->tbl0[0], ctx->tbl0};
+  ghash_block_t s0_tmp = galois_mul_aggregated(blocks, tbls0);
+  hardened_memcpy(ctx->state0.data, s0_tmp.data, kGhashBlockNumWords);
+  hardened_xor_in_place(ctx->state0.data, powers->correction_term0.data,
+                        kGhashBlockNumWords);
+
+  // Process share 1.
+  // share1 = blocks * (H^4, H^3, H^2, H)_1 + (S0*H1^4)
+  const ghash_block_t *const tbls1[kGhashAggregateNumBlocks] = {
+      powers->tbl1[2], powers->tbl1[1], powers->tbl1[0], ctx->tbl1};
+  ghash_block_t s1_tmp = galois_mul_aggregated(blocks, tbls1);
+  hardened_memcpy(ctx->state1.data, s1_tmp.data, kGhashBlockNumWords);
+  hardened_xor_in_place(ctx->state1.data, powers->correction_term1.data,
+                        kGhashBlockNumWords);
+
+  // Check that the context's checksum is correct.
+  HARDENED_CHECK_EQ(ghash_context_integrity_checksum_check(ctx),
+                    kHardenedBoolTrue);
+
+  ctx->ghash_block_cnt += kGhashAggregateNumBlocks;
+}
+
 void ghash_process_full_blocks(ghash_context_t *ctx, size_t partial_len,
                                ghash_block_t *partial, size_t input_len,
                                const uint8_t *input) {
+  ghash_process_full_blocks_aggregated(ctx, NULL, partial_len, partial,
+                                       input_len, input);
+}
+
+void ghash_process_full_blocks_aggregated(ghash_context_t *ctx,
+                                          const ghash_subkey_powers_t *powers,
+                                          size_t partial_len,
+                                          ghash_block_t *partial,
+                                          size_t input_len,
+                                          const uint8_t *input) {
   if (input_len < kGhashBlockNumBytes - partial_len) {
     // Not enough data for a full block; copy into the partial block.
     unsigned char *partial_bytes = (unsigned char *)partial->data;
     memcpy(partial_bytes + partial_len, input, input_len);
   } else {
+    // The powers are only checked once per call; the per-step check on the
+    // context covers the share 0 table they were derived from.
+    if (powers != NULL) {
+      HARDENED_CHECK_EQ(ghash_subkey_powers_integrity_checksum_check(powers),
+                        kHardenedBoolTrue);
+    }
+
     // Construct a block from the partial data and the start of the new data.
     unsigned char *partial_bytes = (unsigned char *)partial->data;
     memcpy(partial_bytes + partial_len, input,
@@ -364,12 +481,22 @@ void ghash_process_full_blocks(ghash_context_t *ctx, size_t partial_len,
     // Process the block.
     ghash_process_block(ctx, partial);
 
-    // Process any remaining full blocks of input.
+    // Process any remaining full blocks of input, several at a time if the
+    // hash subkey powers are available.
     while (input_len >= kGhashBlockNumBytes) {
-      memcpy(partial->data, input, kGhashBlockNumBytes);
-      ghash_process_block(ctx, partial);
-      input += kGhashBlockNumBytes;
-      input_len -= kGhashBlockNumBytes;
+      if (powers != NULL &&
+          input_len >= kGhashAggregateNumBlocks * kGhashBlockNumBytes) {
+        ghash_block_t blocks[kGhashAggregateNumBlocks];
+        memcpy(blocks, input, sizeof(blocks));
+        ghash_process_blocks_aggregated(ctx, powers, blocks);
+        input += sizeof(blocks);
+        input_len -= sizeof(blocks);
+      } else {
+        memcpy(partial->data, input, kGhashBlockNumBytes);
+        ghash_process_block(ctx, partial);
+        input += kGhashBlockNumBytes;
+        input_len -= kGhashBlockNumBytes;
+      }
     }
 
     // Copy any remaining input into the partial block.
@@ -439,6 +566,75 @@ void ghash_handle_enc_initial_counter_block(
   ctx->checksum = ghash_context_integrity_checksum(ctx);
 }
 
+uint32_t ghash_subkey_powers_integrity_checksum(
+    const ghash_subkey_powers_t *powers) {
+  uint32_t ctx;
+  crc32_init(&ctx);
+  // As for the context, only cover share 0.
+  crc32_add(&ctx, (unsigned char *)powers->tbl0, sizeof(powers->tbl0));
+  crc32_add(&ctx, (unsigned char *)&powers->correction_term0,
+            sizeof(powers->correction_term0));
+  return crc32_finish(&ctx);
+}
+
+hardened_bool_t ghash_subkey_powers_integrity_checksum_check(
+    const ghash_subkey_powers_t *powers) {
+  if (powers->checksum ==
+      launder32(ghash_subkey_powers_integrity_checksum(powers))) {
+    return kHardenedBoolTrue;
+  }
+  return kHardenedBoolFalse;
+}
+
+void ghash_init_subkey_powers(const ghash_context_t *ctx,
+                              ghash_subkey_powers_t *powers) {
+  HARDENED_CHECK_EQ(ghash_context_integrity_checksum_check(ctx),
+                    kHardenedBoolTrue);
+
+  // Squaring is linear in GF(2^128), so (H0^2, H1^2) is a sharing of H^2 and
+  // (H0^4, H1^4) is a sharing of H^4. The shares of H are the second rows of
+  // the product tables.
+  ghash_block_t pow_share0 = galois_mul_state_key(ctx->tbl0[0x8], ctx->tbl0);
+  ghash_init_subkey(pow_share0.data, powers->tbl0[0]);
+  ghash_block_t pow_share1 = galois_mul_state_key(ctx->tbl1[0x8], ctx->tbl1);
+  ghash_init_subkey(pow_share1.data, powers->tbl1[0]);
+
+  // H^3 = H^2 * H needs a masked multiplication. Refresh the cross terms with
+  // a random block r so that neither share depends on both shares of H:
+  //   share0 = H0^2*H0 + r
+  //   share1 = H1^2*H1 + ((r + H0^2*H1) + H1^2*H0)
+  ghash_block_t mask;
+  hardened_memshred(mask.data, kGhashBlockNumWords);
+  ghash_block_t mul_tmp = galois_mul_state_key(pow_share0, ctx->tbl0);
+  hardened_xor_in_place(mul_tmp.data, mask.data, kGhashBlockNumWords);
+  ghash_init_subkey(mul_tmp.data, powers->tbl0[1]);
+  ghash_block_t cross = galois_mul_state_key(pow_share0, ctx->tbl1);
+  hardened_xor_in_place(cross.data, mask.data, kGhashBlockNumWords);
+  mul_tmp = galois_mul_state_key(pow_share1, ctx->tbl0);
+  hardened_xor_in_place(cross.data, mul_tmp.data, kGhashBlockNumWords);
+  mul_tmp = galois_mul_state_key(pow_share1, ctx->tbl1);
+  hardened_xor_in_place(cross.data, mul_tmp.data, kGhashBlockNumWords);
+  ghash_init_subkey(cross.data, powers->tbl1[1]);
+
+  // H^4 = (H^2)^2.
+  pow_share0 = galois_mul_state_key(pow_share0, powers->tbl0[0]);
+  ghash_init_subkey(pow_share0.data, powers->tbl0[2]);
+  pow_share1 = galois_mul_state_key(pow_share1, powers->tbl1[0]);
+  ghash_init_subkey(pow_share1.data, powers->tbl1[2]);
+
+  // correction_term0 = S0 * (H0^4 + 1).
+  mul_tmp =
+      galois_mul_state_key(ctx->enc_initial_counter_block0, powers->tbl0[2]);
+  block_xor(&mul_tmp, &ctx->enc_initial_counter_block0,
+            &powers->correction_term0);
+
+  // correction_term1 = S0 * H1^4.
+  powers->correction_term1 =
+      galois_mul_state_key(ctx->enc_initial_counter_block0, powers->tbl1[2]);
+
+  powers->checksum = ghash_subkey_powers_integrity_checksum(powers);
+}
+
 void ghash_final(ghash_context_t *ctx, uint32_t *result) {
   // Check that the context's checksum is correct.
   HARDENED_CHECK_EQ(ghash_context_integrity_checksum_check(ctx),
@@ -23,6 +23,10 @@ enum {
    * Size of a GHASH cipher block (128 bits) in words.
    */
   kGhashBlockNumWords = kGhashBlockNumBytes / sizeof(uint32_t),
+  /**
+   * Number of blocks the aggregated GHASH engine processes per step.
+   */
+  kGhashAggregateNumBlocks = 4,
 };
 
 /**
@@ -79,6 +83,39 @@ typedef struct ghash_context {
   uint32_t checksum;
 } ghash_context_t;
 
+/**
+ * Precomputed powers of the hash subkey for the aggregated GHASH engine.
+ *
+ * Holds the product tables for the shares of H^2, H^3 and H^4, plus the
+ * correction terms that keep the state masking intact when four blocks are
+ * folded into the state at once. This is kept separate from
+ * `ghash_context_t` because it is large (about 1.5 KiB); callers that hash
+ * enough data for the precomputation to pay off can allocate it on the stack
+ * for the duration of the operation.
+ */
+typedef struct ghash_subkey_powers {
+  /**
+   * Product tables for share 0 of H^2, H^3 and H^4 (in that order).
+   */
+  ghash_block_t tbl0[kGhashAggregateNumBlocks - 1][16];
+  /**
+   * Product tables for share 1 of H^2, H^3 and H^4 (in that order).
+   */
+  ghash_block_t tbl1[kGhashAggregateNumBlocks - 1][16];
+  /**
+   * Precomputed correction term (S0 * (H0^4 + 1)) for state share 0.
+   */
+  ghash_block_t correction_term0;
+  /**
+   * Precomputed correction term (S0 * H1^4) for state share 1.
+   */
+  ghash_block_t correction_term1;
+  /**
+   * Checksum of the structure.
+   */
+  uint32_t checksum;
+} ghash_subkey_powers_t;
+
 /**
  * Compute the checksum of a ghash context.
  *
@@ -149,6 +186,65 @@ void ghash_init(ghash_context_t *ctx);
 void ghash_process_full_blocks(ghash_context_t *ctx, size_t partial_len,
                                ghash_block_t *partial, size_t input_len,
                                const uint8_t *input);
+
+/**
+ * Compute the checksum of a hash subkey powers structure.
+ *
+ * @param powers Hash subkey powers.
+ * @returns Checksum value.
+ */
+uint32_t ghash_subkey_powers_integrity_checksum(
+    const ghash_subkey_powers_t *powers);
+
+/**
+ * Perform an integrity check on a hash subkey powers structure.
+ *
+ * @param powers Hash subkey powers.
+ * @returns Whether the integrity check passed.
+ */
+hardened_bool_t ghash_subkey_powers_integrity_checksum_check(
+    const ghash_subkey_powers_t *powers);
+
+/**
+ * Precompute the hash subkey powers for the aggregated GHASH engine.
+ *
+ * The context must already hold the product tables and the encrypted initial
+ * counter block, i.e. call this after `ghash_handle_enc_initial_counter_block`.
+ * The powers stay valid across `ghash_init` calls for the same key and
+ * initial counter block.
+ *
+ * The precomputation costs roughly a dozen block multiplications, so it only
+ * pays off for inputs of a few dozen blocks or more.
+ *
+ * @param ctx Context object.
+ * @param[out] powers The populated hash subkey powers.
+ */
+void ghash_init_subkey_powers(const ghash_context_t *ctx,
+                              ghash_subkey_powers_t *powers);
+
+/**
+ * Variant of `ghash_process_full_blocks` with a selectable engine.
+ *
+ * If `powers` is NULL, this is the same as `ghash_process_full_blocks`.
+ * Otherwise, full blocks are folded into the state `kGhashAggregateNumBlocks`
+ * at a time with the aggregated engine, which shares one shift-and-reduce
+ * pass per window across all blocks of a step. The result is identical for
+ * both engines.
+ *
+ * @param ctx Context object.
+ * @param powers Hash subkey powers from `ghash_init_subkey_powers`, or NULL.
+ * @param partial_len Length of the partial block.
+ * @param partial Partial GHASH block.
+ * @param input_len Length of the input data in bytes.
+ * @param input Input data.
+ */
+void ghash_process_full_blocks_aggregated(ghash_context_t *ctx,
+                                          const ghash_subkey_powers_t *powers,
+                                          size_t partial_len,
+                                          ghash_block_t *partial,
+                                          size_t input_len,
+                                          const uint8_t *input);
+
 /**
  * Update the state of a GHASH operation.
  *
@@ -0,0 +1,163 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/impl/aes_gcm/ghash.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/perf_test.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Compares the cycle cost of the baseline and aggregated GHASH engines, and
+// checks that both produce the same result.
+
+enum {
+  kNumRuns = 10,
+};
+
+typedef struct perf_test {
+  // A human-readable name for this particular test, e.g. "baseline_1024".
+  const char *label;
+
+  // Whether to use the aggregated engine. The cost of precomputing the hash
+  // subkey powers is included in the measurement.
+  bool aggregated;
+
+  // Number of bytes to hash.
+  size_t msg_len;
+
+  // The expected number of CPU cycles that `kNumRuns` runs will take.
+  uint32_t expected_max_num_cycles;
+
+  // For aggregated tests, the maximum cost relative to the preceding baseline
+  // test, in percent. Unlike the absolute bound, this does not depend on the
+  // clock or the compiler.
+  uint32_t max_percent_of_baseline;
+} perf_test_t;
+
+// Arbitrary hash subkey and encrypted initial counter block shares.
+static const uint32_t kHashSubkeyShare0[kGhashBlockNumWords] = {
+    0xd44be966, 0x3b2c8aef, 0x59fa4c88, 0x2e2b34ca};
+static const uint32_t kHashSubkeyShare1[kGhashBlockNumWords] = {
+    0x01234567, 0x89abcdef, 0xfedcba98, 0x76543210};
+static const uint32_t kEncInitialCounterBlock0[kGhashBlockNumWords] = {
+    0xa5a5a5a5, 0x5a5a5a5a, 0x0f0f0f0f, 0xf0f0f0f0};
+static const uint32_t kEncInitialCounterBlock1[kGhashBlockNumWords] = {
+    0x11111111, 0x22222222, 0x33333333, 0x44444444};
+
+static uint32_t msg_buf[1024 / sizeof(uint32_t)];
+static ghash_context_t ctx;
+static ghash_subkey_powers_t powers;
+static uint32_t result[kGhashBlockNumWords];
+
+// Hash `msg_len` bytes of the message into `result`; `arg` is the
+// `perf_test_t` to run.
+static void perf_test_body(const void *arg) {
+  const perf_test_t *test = arg;
+  ghash_init(&ctx);
+  const ghash_subkey_powers_t *engine = NULL;
+  if (test->aggregated) {
+    ghash_init_subkey_powers(&ctx, &powers);
+    engine = &powers;
+  }
+  ghash_block_t partial = {.data = {0}};
+  ghash_process_full_blocks_aggregated(&ctx, engine, /*partial_len=*/0,
+                                       &partial, test->msg_len,
+                                       (const uint8_t *)msg_buf);
+  ghash_final(&ctx, result);
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+// The values of `expected_max_num_cycles` are derived from a cost model of the
+// `-O2` code rather than measured: about 2400 cycles per table multiplication
+// (32 windows of one shift-and-reduce and one table lookup), plus about 900
+// cycles of hardened copies and context checksum per block. That gives about
+// 5700 cycles per baseline block and 11000 per aggregated group of four, plus
+// about 30000 to precompute the subkey powers. The bounds allow 50% on top of
+// the model. Replace them with measurements from a CW310 FPGA:
+//
+//   $ ./bazelisk.sh test --copt -O2 --test_output=all \
+//       //sw/device/lib/crypto/impl/aes_gcm:ghash_perftest_fpga_cw310
+//
+// Tests come in baseline/aggregated pairs over the same message; each
+// aggregated result and cycle count is checked against the preceding baseline.
+static const perf_test_t kPerfTests[] = {
+    {
+        .label = "baseline_256",
+        .aggregated = false,
+        .msg_len = 256,
+        .expected_max_num_cycles = 1400000,
+    },
+    {
+        .label = "aggregated_256",
+        .aggregated = true,
+        .msg_len = 256,
+        .expected_max_num_cycles = 1300000,
+        // At the threshold in aes_gcm.c, the precomputation roughly cancels
+        // out the savings.
+        .max_percent_of_baseline = 110,
+    },
+    {
+        .label = "baseline_1024",
+        .aggregated = false,
+        .msg_len = 1024,
+        .expected_max_num_cycles = 5500000,
+    },
+    {
+        .label = "aggregated_1024",
+        .aggregated = true,
+        .msg_len = 1024,
+        .expected_max_num_cycles = 3300000,
+        .max_percent_of_baseline = 75,
+    },
+};
+
+bool test_main(void) {
+  CHECK_STATUS_OK(entropy_complex_init());
+  perf_test_fill_deterministic((uint8_t *)msg_buf, sizeof(msg_buf));
+
+  ghash_init_subkey(kHashSubkeyShare0, ctx.tbl0);
+  ghash_init_subkey(kHashSubkeyShare1, ctx.tbl1);
+  ghash_handle_enc_initial_counter_block(kEncInitialCounterBlock0,
+                                         kEncInitialCounterBlock1, &ctx);
+
+  bool all_expectations_match = true;
+  uint32_t baseline_result[kGhashBlockNumWords];
+  uint64_t baseline_num_cycles = 0;
+  for (size_t i = 0; i < ARRAYSIZE(kPerfTests); ++i) {
+    const perf_test_t *test = &kPerfTests[i];
+    CHECK(test->msg_len <= sizeof(msg_buf));
+    CHECK(test->msg_len % kGhashBlockNumBytes == 0);
+
+    const uint64_t num_cycles =
+        perf_test_measure(&perf_test_body, test, kNumRuns);
+    if (!perf_test_check(test->label, num_cycles,
+                         test->expected_max_num_cycles)) {
+      all_expectations_match = false;
+    }
+
+    if (!test->aggregated) {
+      memcpy(baseline_result, result, sizeof(baseline_result));
+      baseline_num_cycles = num_cycles;
+      continue;
+    }
+    CHECK_ARRAYS_EQ(result, baseline_result, kGhashBlockNumWords);
+    const uint32_t percent_of_baseline =
+        (uint32_t)((100 * num_cycles) / baseline_num_cycles);
+    LOG_INFO("%s: %d%% of baseline", test->label, percent_of_baseline);
+    if (percent_of_baseline > test->max_percent_of_baseline) {
+      LOG_WARNING("%s: expected at most %d%% of baseline", test->label,
+                  test->max_percent_of_baseline);
+      all_expectations_match = false;
+    }
+  }
+  return all_expectations_match;
+}
@@ -5,6 +5,7 @@
 #include "sw/device/lib/crypto/impl/aes_gcm/ghash.h"
 
 #include <array>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -371,5 +372,134 @@ TEST(Ghash, McGrawViegaTestCase18) {
   EXPECT_THAT(result, testing::ElementsAreArray(exp_result));
 }
 
+/**
+ * Compute GHASH over `input` with the baseline or the aggregated engine.
+ *
+ * The hash subkey and the encrypted initial counter block are split into
+ * nonzero shares so that the correction terms are exercised. The input is fed
+ * in two pieces to cover a nonempty partial block at the start of the second
+ * call.
+ */
+std::array<uint32_t, 4> GhashWithEngine(const std::vector<uint8_t> &input,
+                                        size_t split, bool aggregated) {
+  std::array<uint32_t, 4> H = {
+      0x05f2beac,
+      0xebb8b479,
+      0xac9b88ce,
+      0xd7da3287,
+  };
+  std::array<uint32_t, 4> mask = {
+      0x01234567,
+      0x89abcdef,
+      0xfedcba98,
+      0x76543210,
+  };
+  std::array<uint32_t, 4> h_share0;
+  for (size_t i = 0; i < h_share0.size(); ++i) {
+    h_share0[i] = H[i] ^ mask[i];
+  }
+  std::array<uint32_t, 4> s0 = {0xa5a5a5a5, 0x5a5a5a5a, 0x0f0f0f0f,
+                                0xf0f0f0f0};
+  std::array<uint32_t, 4> s1 = {0x11111111, 0x22222222, 0x33333333,
+                                0x44444444};
+
+  ghash_context_t ctx;
+  ghash_init_subkey(h_share0.data(), ctx.tbl0);
+  ghash_init_subkey(mask.data(), ctx.tbl1);
+  ghash_handle_enc_initial_counter_block(s0.data(), s1.data(), &ctx);
+  ghash_subkey_powers_t powers;
+  ghash_init_subkey_powers(&ctx, &powers);
+  ghash_init(&ctx);
+
+  const ghash_subkey_powers_t *engine = aggregated ? &powers : nullptr;
+  ghash_block_t partial = {.data = {0}};
+  ghash_process_full_blocks_aggregated(&ctx, engine, 0, &partial, split,
+                                       input.data());
+  ghash_process_full_blocks_aggregated(
+      &ctx, engine, split % kGhashBlockNumBytes, &partial, input.size() - split,
+      input.data() + split);
+  size_t partial_len = input.size() % kGhashBlockNumBytes;
+  ghash_update(&ctx, partial_len, (unsigned char *)partial.data);
+
+  std::array<uint32_t, 4> result;
+  ghash_final(&ctx, result.data());
+  return result;
+}
+
+TEST(Ghash, AggregatedMatchesBaseline) {
+  // The checksum values are not under test here.
+  rom_test::MockCrc32 crc32_;
+  EXPECT_CALL(crc32_, Init(testing::NotNull())).Times(testing::AnyNumber());
+  EXPECT_CALL(crc32_, Add(testing::NotNull(), testing::_, testing::_))
+      .Times(testing::AnyNumber());
+  EXPECT_CALL(crc32_, Finish(testing::NotNull()))
+      .Times(testing::AnyNumber())
+      .WillRepeatedly(testing::Return(0));
+
+  // Lengths are chosen to hit zero, one and several aggregated steps as well
+  // as leftover single blocks and a trailing partial block.
+  for (size_t len : {16, 80, 100, 160, 333}) {
+    std::vector<uint8_t> input(len);
+    for (size_t i = 0; i < len; ++i) {
+      input[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    for (size_t split : {size_t{0}, size_t{5}, len / 2}) {
+      EXPECT_THAT(GhashWithEngine(input, split, /*aggregated=*/true),
+                  ElementsAreArray(
+                      GhashWithEngine(input, split, /*aggregated=*/false)))
+          << "len = " << len << ", split = " << split;
+    }
+  }
+}
+
+TEST(Ghash, AggregatedKnownAnswer) {
+  // GHASH of five blocks, each equal to 1 (big-endian 0x80 in the first
+  // byte), with all shares of H and S zero except H0 = H. The result is
+  // H^5 + H^4 + H^3 + H^2 + H, computed independently by repeated updates.
+  std::array<uint32_t, 4> H = {
+      0xd44be966,
+      0x3b2c8aef,
+      0x59fa4c88,
+      0x2e2b34ca,
+  };
+  rom_test::MockCrc32 crc32_;
+  EXPECT_CALL(crc32_, Init(testing::NotNull())).Times(testing::AnyNumber());
+  EXPECT_CALL(crc32_, Add(testing::NotNull(), testing::_, testing::_))
+      .Times(testing::AnyNumber());
+  EXPECT_CALL(crc32_, Finish(testing::NotNull()))
+      .Times(testing::AnyNumber())
+      .WillRepeatedly(testing::Return(0));
+
+  std::vector<uint8_t> input(5 * kGhashBlockNumBytes, 0);
+  for (size_t i = 0; i < 5; ++i) {
+    input[i * kGhashBlockNumBytes] = 0x80;
+  }
+
+  ghash_context_t ctx;
+  ghash_init_subkey(H.data(), ctx.tbl0);
+  ghash_init_subkey(Zero.data(), ctx.tbl1);
+  ghash_handle_enc_initial_counter_block(Zero.data(), Zero.data(), &ctx);
+  ghash_subkey_powers_t powers;
+  ghash_init_subkey_powers(&ctx, &powers);
+
+  ghash_init(&ctx);
+  for (size_t i = 0; i < 5; ++i) {
+    ghash_update(&ctx, kGhashBlockNumBytes,
+                 input.data() + i * kGhashBlockNumBytes);
+  }
+  std::array<uint32_t, 4> expected;
+  ghash_final(&ctx, expected.data());
+
+  ghash_init(&ctx);
+  ghash_block_t partial = {.data = {0}};
+  ghash_process_full_blocks_aggregated(&ctx, &powers, 0, &partial,
+                                       input.size(), input.data());
+  EXPECT_EQ(ctx.ghash_block_cnt, 5);
+  std::array<uint32_t, 4> result;
+  ghash_final(&ctx, result.data());
+
+  EXPECT_THAT(result, ElementsAreArray(expected));
+}
+
 }  // namespace
 }  // namespace ghash_unittest
@@ -29,6 +29,10 @@ OTBN_DECLARE_SYMBOL_ADDR(run_p256, d0_io);  // Private key scalar d (share 0).
 OTBN_DECLARE_SYMBOL_ADDR(run_p256, d1_io);  // Private key scalar d (share 1).
 OTBN_DECLARE_SYMBOL_ADDR(run_p256, x_r);    // ECDSA verification result.
 OTBN_DECLARE_SYMBOL_ADDR(run_p256, ok);     // Status code.
+OTBN_DECLARE_SYMBOL_ADDR(run_p256, batch_len);    // Batch size.
+OTBN_DECLARE_SYMBOL_ADDR(run_p256, batch_next);   // Next item in batch.
+OTBN_DECLARE_SYMBOL_ADDR(run_p256, batch_items);  // Batch inputs.
+OTBN_DECLARE_SYMBOL_ADDR(run_p256, batch_x_r);    // Batch results.
 
 static const otbn_addr_t kOtbnVarMode = OTBN_ADDR_T_INIT(run_p256, mode);
 static const otbn_addr_t kOtbnVarMsg = OTBN_ADDR_T_INIT(run_p256, msg);
@@ -40,6 +44,14 @@ static const otbn_addr_t kOtbnVarD0 = OTBN_ADDR_T_INIT(run_p256, d0_io);
 static const otbn_addr_t kOtbnVarD1 = OTBN_ADDR_T_INIT(run_p256, d1_io);
 static const otbn_addr_t kOtbnVarXr = OTBN_ADDR_T_INIT(run_p256, x_r);
 static const otbn_addr_t kOtbnVarOk = OTBN_ADDR_T_INIT(run_p256, ok);
+static const otbn_addr_t kOtbnVarBatchLen =
+    OTBN_ADDR_T_INIT(run_p256, batch_len);
+static const otbn_addr_t kOtbnVarBatchNext =
+    OTBN_ADDR_T_INIT(run_p256, batch_next);
+static const otbn_addr_t kOtbnVarBatchItems =
+    OTBN_ADDR_T_INIT(run_p256, batch_items);
+static const otbn_addr_t kOtbnVarBatchXr =
+    OTBN_ADDR_T_INIT(run_p256, batch_x_r);
 
 // Declare mode constants.
 OTBN_DECLARE_SYMBOL_ADDR(run_p256, MODE_KEYGEN);
@@ -49,6 +61,7 @@ OTBN_DECLARE_SYMBOL_ADDR(run_p256, MODE_ECDH);
 OTBN_DECLARE_SYMBOL_ADDR(run_p256, MODE_SIDELOAD_KEYGEN);
 OTBN_DECLARE_SYMBOL_ADDR(run_p256, MODE_SIDELOAD_SIGN);
 OTBN_DECLARE_SYMBOL_ADDR(run_p256, MODE_SIDELOAD_ECDH);
+OTBN_DECLARE_SYMBOL_ADDR(run_p256, MODE_VERIFY_BATCH);
 static const uint32_t kOtbnP256ModeKeygen =
     OTBN_ADDR_T_INIT(run_p256, MODE_KEYGEN);
 static const uint32_t kOtbnP256ModeSign = OTBN_ADDR_T_INIT(run_p256, MODE_SIGN);
@@ -61,6 +74,8 @@ static const uint32_t kOtbnP256ModeSideloadSign =
     OTBN_ADDR_T_INIT(run_p256, MODE_SIDELOAD_SIGN);
 static const uint32_t kOtbnP256ModeSideloadEcdh =
     OTBN_ADDR_T_INIT(run_p256, MODE_SIDELOAD_ECDH);
+static const uint32_t kOtbnP256ModeVerifyBatch =
+    OTBN_ADDR_T_INIT(run_p256, MODE_VERIFY_BATCH);
 
 enum {
   /*
@@ -88,6 +103,17 @@ enum {
   kModeEcdhSideloadInsCnt = 581658,
   kModeEcdsaSignInsCnt = 607087,
   kModeEcdsaSignSideloadInsCnt = 607147,
+  /*
+   * Layout of one item in the `batch_items` buffer: message digest, r, s,
+   * public key x and public key y, in the same order as the single-signature
+   * buffers.
+   */
+  kBatchItemMsgOffset = 0,
+  kBatchItemROffset = kBatchItemMsgOffset + kP256ScalarBytes,
+  kBatchItemSOffset = kBatchItemROffset + kP256ScalarBytes,
+  kBatchItemXOffset = kBatchItemSOffset + kP256ScalarBytes,
+  kBatchItemYOffset = kBatchItemXOffset + kP256CoordBytes,
+  kBatchItemBytes = kBatchItemYOffset + kP256CoordBytes,
 };
 
 static status_t p256_masked_scalar_write(p256_masked_scalar_t *src,
@@ -218,7 +244,8 @@ status_t p256_sideload_keygen_finalize(p256_point_t *public_key) {
  * @param digest Digest to set (big-endian).
  * @return OK or error.
  */
-static status_t set_message_digest(const uint32_t digest[kP256ScalarWords]) {
+static status_t set_message_digest(const uint32_t digest[kP256ScalarWords],
+                                   const otbn_addr_t dst) {
   // Set the message digest. We swap all the bytes so that OTBN can interpret
   // the digest as a little-endian integer, which is a more natural fit for the
   // architecture than the big-endian form requested by the specification (FIPS
@@ -230,7 +257,7 @@ static status_t set_message_digest(const uint32_t digest[kP256ScalarWords]) {
         __builtin_bswap32(digest[kP256ScalarWords - 1 - i]);
   }
   HARDENED_CHECK_EQ(i, kP256ScalarWords);
-  return otbn_dmem_write(kP256ScalarWords, digest_little_endian, kOtbnVarMsg);
+  return otbn_dmem_write(kP256ScalarWords, digest_little_endian, dst);
 }
 
 status_t p256_ecdsa_sign_start(const uint32_t digest[kP256ScalarWords],
@@ -243,7 +270,7 @@ status_t p256_ecdsa_sign_start(const uint32_t digest[kP256ScalarWords],
   HARDENED_TRY(otbn_dmem_write(kOtbnP256ModeWords, &mode, kOtbnVarMode));
 
   // Set the message digest.
-  HARDENED_TRY(set_message_digest(digest));
+  HARDENED_TRY(set_message_digest(digest, kOtbnVarMsg));
 
   // Set the private key shares.
   HARDENED_TRY(p256_masked_scalar_write(private_key, kOtbnVarD0, kOtbnVarD1));
@@ -262,7 +289,7 @@ status_t p256_ecdsa_sideload_sign_start(
   HARDENED_TRY(otbn_dmem_write(kOtbnP256ModeWords, &mode, kOtbnVarMode));
 
   // Set the message digest.
-  HARDENED_TRY(set_message_digest(digest));
+  HARDENED_TRY(set_message_digest(digest, kOtbnVarMsg));
 
   // Start the OTBN routine.
   return otbn_execute();
@@ -302,7 +329,7 @@ status_t p256_ecdsa_verify_start(const p256_ecdsa_signature_t *signature,
   HARDENED_TRY(otbn_dmem_write(kOtbnP256ModeWords, &mode, kOtbnVarMode));
 
   // Set the message digest.
-  HARDENED_TRY(set_message_digest(digest));
+  HARDENED_TRY(set_message_digest(digest, kOtbnVarMsg));
 
   // Set the signature R.
   HARDENED_TRY(otbn_dmem_write(kP256ScalarWords, signature->r, kOtbnVarR));
@@ -345,6 +372,109 @@ status_t p256_ecdsa_verify_finalize(const p256_ecdsa_signature_t *signature,
   return otbn_dmem_sec_wipe();
 }
 
+status_t p256_ecdsa_verify_batch_start(
+    const p256_ecdsa_verify_batch_item_t *items, size_t num_items) {
+  if (num_items == 0 || num_items > kP256VerifyBatchMaxItems) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Load the P-256 app and set up data pointers
+  HARDENED_TRY(otbn_load_app(kOtbnAppP256));
+
+  // Set mode so start() will jump into batch verification.
+  uint32_t mode = kOtbnP256ModeVerifyBatch;
+  HARDENED_TRY(otbn_dmem_write(kOtbnP256ModeWords, &mode, kOtbnVarMode));
+
+  // Set the batch size and start at the first item.
+  uint32_t batch_len = (uint32_t)num_items;
+  HARDENED_TRY(otbn_dmem_write(1, &batch_len, kOtbnVarBatchLen));
+  HARDENED_TRY(otbn_dmem_set(1, 0, kOtbnVarBatchNext));
+
+  // Set the message digest, signature and public key of each item.
+  size_t i = 0;
+  for (; launder32(i) < num_items; i++) {
+    const otbn_addr_t item = kOtbnVarBatchItems + i * kBatchItemBytes;
+    HARDENED_TRY(
+        set_message_digest(items[i].digest, item + kBatchItemMsgOffset));
+    HARDENED_TRY(otbn_dmem_write(kP256ScalarWords, items[i].signature->r,
+                                 item + kBatchItemROffset));
+    HARDENED_TRY(otbn_dmem_write(kP256ScalarWords, items[i].signature->s,
+                                 item + kBatchItemSOffset));
+    HARDENED_TRY(otbn_dmem_write(kP256CoordWords, items[i].public_key->x,
+                                 item + kBatchItemXOffset));
+    HARDENED_TRY(otbn_dmem_write(kP256CoordWords, items[i].public_key->y,
+                                 item + kBatchItemYOffset));
+  }
+  HARDENED_CHECK_EQ(i, num_items);
+
+  // Start the OTBN routine.
+  return otbn_execute();
+}
+
+status_t p256_ecdsa_verify_batch_finalize(
+    const p256_ecdsa_verify_batch_item_t *items, size_t num_items,
+    hardened_bool_t *results) {
+  // OTBN stops early at any item that fails the basic validity checks, with
+  // `batch_next` pointing at that item. Record the failure and restart OTBN
+  // after it until the whole batch has been processed. Each restart moves
+  // `batch_next` forward, so this takes at most `num_items` runs.
+  uint32_t failed[kP256VerifyBatchMaxItems] = {0};
+  uint32_t next = 0;
+  while (true) {
+    // Spin here waiting for OTBN to complete.
+    HARDENED_TRY_WIPE_DMEM(otbn_busy_wait_for_done());
+
+    uint32_t ok;
+    uint32_t stopped_at;
+    HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(1, kOtbnVarOk, &ok));
+    HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(1, kOtbnVarBatchNext, &stopped_at));
+    if (launder32(stopped_at) < next || stopped_at > num_items) {
+      HARDENED_TRY(otbn_dmem_sec_wipe());
+      return OTCRYPTO_FATAL_ERR;
+    }
+    if (stopped_at == num_items) {
+      // Every remaining item passed the basic checks.
+      if (launder32(ok) != kHardenedBoolTrue) {
+        HARDENED_TRY(otbn_dmem_sec_wipe());
+        return OTCRYPTO_FATAL_ERR;
+      }
+      HARDENED_CHECK_EQ(ok, kHardenedBoolTrue);
+      break;
+    }
+
+    // The item at `stopped_at` failed the basic checks.
+    if (launder32(ok) != kHardenedBoolFalse) {
+      HARDENED_TRY(otbn_dmem_sec_wipe());
+      return OTCRYPTO_FATAL_ERR;
+    }
+    failed[stopped_at] = kHardenedBoolTrue;
+    next = stopped_at + 1;
+    if (next == num_items) {
+      break;
+    }
+    HARDENED_TRY_WIPE_DMEM(otbn_dmem_write(1, &next, kOtbnVarBatchNext));
+    HARDENED_TRY_WIPE_DMEM(otbn_execute());
+  }
+
+  // Read x_r (recovered R) for each item out of OTBN dmem and compare it with
+  // the item's R.
+  size_t i = 0;
+  for (; launder32(i) < num_items; i++) {
+    if (failed[i] == kHardenedBoolTrue) {
+      results[i] = kHardenedBoolFalse;
+      continue;
+    }
+    uint32_t x_r[kP256ScalarWords];
+    HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(
+        kP256ScalarWords, kOtbnVarBatchXr + i * kP256ScalarBytes, x_r));
+    results[i] = hardened_memeq(x_r, items[i].signature->r, kP256ScalarWords);
+  }
+  HARDENED_CHECK_EQ(i, num_items);
+
+  // Wipe DMEM.
+  return otbn_dmem_sec_wipe();
+}
+
 status_t p256_ecdh_start(p256_masked_scalar_t *private_key,
                          const p256_point_t *public_key) {
   // Load the P-256 app. Fails if OTBN is non-idle.
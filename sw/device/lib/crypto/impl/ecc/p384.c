@@ -29,6 +29,10 @@ OTBN_DECLARE_SYMBOL_ADDR(run_p384, d0_io);  // Private key scalar d (share 0).
 OTBN_DECLARE_SYMBOL_ADDR(run_p384, d1_io);  // Private key scalar d (share 1).
 OTBN_DECLARE_SYMBOL_ADDR(run_p384, x_r);    // ECDSA verification result.
 OTBN_DECLARE_SYMBOL_ADDR(run_p384, ok);     // Status code.
+OTBN_DECLARE_SYMBOL_ADDR(run_p384, batch_len);    // Batch size.
+OTBN_DECLARE_SYMBOL_ADDR(run_p384, batch_next);   // Next item in batch.
+OTBN_DECLARE_SYMBOL_ADDR(run_p384, batch_items);  // Batch inputs.
+OTBN_DECLARE_SYMBOL_ADDR(run_p384, batch_x_r);    // Batch results.
 
 static const otbn_addr_t kOtbnVarMode = OTBN_ADDR_T_INIT(run_p384, mode);
 static const otbn_addr_t kOtbnVarMsg = OTBN_ADDR_T_INIT(run_p384, msg);
@@ -40,6 +44,14 @@ static const otbn_addr_t kOtbnVarD0 = OTBN_ADDR_T_INIT(run_p384, d0_io);
 static const otbn_addr_t kOtbnVarD1 = OTBN_ADDR_T_INIT(run_p384, d1_io);
 static const otbn_addr_t kOtbnVarXr = OTBN_ADDR_T_INIT(run_p384, x_r);
 static const otbn_addr_t kOtbnVarOk = OTBN_ADDR_T_INIT(run_p384, ok);
+static const otbn_addr_t kOtbnVarBatchLen =
+    OTBN_ADDR_T_INIT(run_p384, batch_len);
+static const otbn_addr_t kOtbnVarBatchNext =
+    OTBN_ADDR_T_INIT(run_p384, batch_next);
+static const otbn_addr_t kOtbnVarBatchItems =
+    OTBN_ADDR_T_INIT(run_p384, batch_items);
+static const otbn_addr_t kOtbnVarBatchXr =
+    OTBN_ADDR_T_INIT(run_p384, batch_x_r);
 
 // Declare mode constants.
 OTBN_DECLARE_SYMBOL_ADDR(run_p384, MODE_KEYGEN);
@@ -49,6 +61,7 @@ OTBN_DECLARE_SYMBOL_ADDR(run_p384, MODE_ECDH);
 OTBN_DECLARE_SYMBOL_ADDR(run_p384, MODE_SIDELOAD_KEYGEN);
 OTBN_DECLARE_SYMBOL_ADDR(run_p384, MODE_SIDELOAD_SIGN);
 OTBN_DECLARE_SYMBOL_ADDR(run_p384, MODE_SIDELOAD_ECDH);
+OTBN_DECLARE_SYMBOL_ADDR(run_p384, MODE_VERIFY_BATCH);
 static const uint32_t kP384ModeKeygen = OTBN_ADDR_T_INIT(run_p384, MODE_KEYGEN);
 static const uint32_t kP384ModeSign = OTBN_ADDR_T_INIT(run_p384, MODE_SIGN);
 static const uint32_t kP384ModeVerify = OTBN_ADDR_T_INIT(run_p384, MODE_VERIFY);
@@ -59,6 +72,8 @@ static const uint32_t kP384ModeSideloadSign =
     OTBN_ADDR_T_INIT(run_p384, MODE_SIDELOAD_SIGN);
 static const uint32_t kP384ModeSideloadEcdh =
     OTBN_ADDR_T_INIT(run_p384, MODE_SIDELOAD_ECDH);
+static const uint32_t kP384ModeVerifyBatch =
+    OTBN_ADDR_T_INIT(run_p384, MODE_VERIFY_BATCH);
 
 enum {
   /*
@@ -98,6 +113,19 @@ enum {
   kModeEcdhSideloadInsCnt = 1947177,
   kModeEcdsaSignInsCnt = 1574769,
   kModeEcdsaSignSideloadInsCnt = 1574917,
+  /*
+   * Layout of one item in the `batch_items` buffer: message digest, r, s,
+   * public key x and public key y, each padded to a multiple of the wide word
+   * size, in the same order as the single-signature buffers.
+   */
+  kBatchItemFieldBytes =
+      kP384ScalarBytes + kScalarPaddingWords * sizeof(uint32_t),
+  kBatchItemMsgOffset = 0,
+  kBatchItemROffset = kBatchItemMsgOffset + kBatchItemFieldBytes,
+  kBatchItemSOffset = kBatchItemROffset + kBatchItemFieldBytes,
+  kBatchItemXOffset = kBatchItemSOffset + kBatchItemFieldBytes,
+  kBatchItemYOffset = kBatchItemXOffset + kBatchItemFieldBytes,
+  kBatchItemBytes = kBatchItemYOffset + kBatchItemFieldBytes,
 };
 
 static status_t p384_masked_scalar_write(p384_masked_scalar_t *src,
@@ -154,14 +182,16 @@ static status_t p384_scalar_write(const uint32_t src[kP384ScalarWords],
  * Write a point into the x and y buffers, with padding as needed.
  *
  * @param p Point to write.
+ * @param x_addr DMEM address to write the x-coordinate.
+ * @param y_addr DMEM address to write the y-coordinate.
  */
-static status_t set_public_key(const p384_point_t *p) {
-  HARDENED_TRY(otbn_dmem_write(kP384CoordWords, p->x, kOtbnVarX));
-  HARDENED_TRY(otbn_dmem_write(kP384CoordWords, p->y, kOtbnVarY));
+static status_t set_public_key(const p384_point_t *p, const otbn_addr_t x_addr,
+                               const otbn_addr_t y_addr) {
+  HARDENED_TRY(otbn_dmem_write(kP384CoordWords, p->x, x_addr));
+  HARDENED_TRY(otbn_dmem_write(kP384CoordWords, p->y, y_addr));
 
-  HARDENED_TRY(
-      otbn_dmem_set(kCoordPaddingWords, 0, kOtbnVarX + kP384CoordBytes));
-  return otbn_dmem_set(kCoordPaddingWords, 0, kOtbnVarY + kP384CoordBytes);
+  HARDENED_TRY(otbn_dmem_set(kCoordPaddingWords, 0, x_addr + kP384CoordBytes));
+  return otbn_dmem_set(kCoordPaddingWords, 0, y_addr + kP384CoordBytes);
 }
 
 static status_t set_message_digest(const uint32_t digest[kP384ScalarWords],
@@ -340,7 +370,7 @@ status_t p384_ecdsa_verify_start(const p384_ecdsa_signature_t *signature,
   HARDENED_TRY(p384_scalar_write(signature->s, kOtbnVarS));
 
   // Set the public key.
-  HARDENED_TRY(set_public_key(public_key));
+  HARDENED_TRY(set_public_key(public_key, kOtbnVarX, kOtbnVarY));
 
   // Start the OTBN routine.
   return otbn_execute();
@@ -371,6 +401,107 @@ status_t p384_ecdsa_verify_finalize(const p384_ecdsa_signature_t *signature,
   return otbn_dmem_sec_wipe();
 }
 
+status_t p384_ecdsa_verify_batch_start(
+    const p384_ecdsa_verify_batch_item_t *items, size_t num_items) {
+  if (num_items == 0 || num_items > kP384VerifyBatchMaxItems) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Load the ECDSA/P-384 app
+  HARDENED_TRY(otbn_load_app(kOtbnAppP384));
+
+  // Set mode so start() will jump into ECDSA batch verify.
+  uint32_t mode = kP384ModeVerifyBatch;
+  HARDENED_TRY(otbn_dmem_write(kP384ModeWords, &mode, kOtbnVarMode));
+
+  // Set the batch size and start at the first item.
+  uint32_t batch_len = (uint32_t)num_items;
+  HARDENED_TRY(otbn_dmem_write(1, &batch_len, kOtbnVarBatchLen));
+  HARDENED_TRY(otbn_dmem_set(1, 0, kOtbnVarBatchNext));
+
+  // Set the message digest, signature and public key of each item.
+  size_t i = 0;
+  for (; launder32(i) < num_items; i++) {
+    const otbn_addr_t item = kOtbnVarBatchItems + i * kBatchItemBytes;
+    HARDENED_TRY(
+        set_message_digest(items[i].digest, item + kBatchItemMsgOffset));
+    HARDENED_TRY(
+        p384_scalar_write(items[i].signature->r, item + kBatchItemROffset));
+    HARDENED_TRY(
+        p384_scalar_write(items[i].signature->s, item + kBatchItemSOffset));
+    HARDENED_TRY(set_public_key(items[i].public_key, item + kBatchItemXOffset,
+                                item + kBatchItemYOffset));
+  }
+  HARDENED_CHECK_EQ(i, num_items);
+
+  // Start the OTBN routine.
+  return otbn_execute();
+}
+
+status_t p384_ecdsa_verify_batch_finalize(
+    const p384_ecdsa_verify_batch_item_t *items, size_t num_items,
+    hardened_bool_t *results) {
+  // OTBN stops early at any item that fails the basic validity checks, with
+  // `batch_next` pointing at that item. Record the failure and restart OTBN
+  // after it until the whole batch has been processed. Each restart moves
+  // `batch_next` forward, so this takes at most `num_items` runs.
+  uint32_t failed[kP384VerifyBatchMaxItems] = {0};
+  uint32_t next = 0;
+  while (true) {
+    // Spin here waiting for OTBN to complete.
+    HARDENED_TRY_WIPE_DMEM(otbn_busy_wait_for_done());
+
+    uint32_t ok;
+    uint32_t stopped_at;
+    HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(1, kOtbnVarOk, &ok));
+    HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(1, kOtbnVarBatchNext, &stopped_at));
+    if (launder32(stopped_at) < next || stopped_at > num_items) {
+      HARDENED_TRY(otbn_dmem_sec_wipe());
+      return OTCRYPTO_FATAL_ERR;
+    }
+    if (stopped_at == num_items) {
+      // Every remaining item passed the basic checks.
+      if (launder32(ok) != kHardenedBoolTrue) {
+        HARDENED_TRY(otbn_dmem_sec_wipe());
+        return OTCRYPTO_FATAL_ERR;
+      }
+      HARDENED_CHECK_EQ(ok, kHardenedBoolTrue);
+      break;
+    }
+
+    // The item at `stopped_at` failed the basic checks.
+    if (launder32(ok) != kHardenedBoolFalse) {
+      HARDENED_TRY(otbn_dmem_sec_wipe());
+      return OTCRYPTO_FATAL_ERR;
+    }
+    failed[stopped_at] = kHardenedBoolTrue;
+    next = stopped_at + 1;
+    if (next == num_items) {
+      break;
+    }
+    HARDENED_TRY_WIPE_DMEM(otbn_dmem_write(1, &next, kOtbnVarBatchNext));
+    HARDENED_TRY_WIPE_DMEM(otbn_execute());
+  }
+
+  // Read x_r (recovered R) for each item out of OTBN dmem and compare it with
+  // the item's R.
+  size_t i = 0;
+  for (; launder32(i) < num_items; i++) {
+    if (failed[i] == kHardenedBoolTrue) {
+      results[i] = kHardenedBoolFalse;
+      continue;
+    }
+    uint32_t x_r[kP384ScalarWords];
+    HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(
+        kP384ScalarWords, kOtbnVarBatchXr + i * kBatchItemFieldBytes, x_r));
+    results[i] = hardened_memeq(x_r, items[i].signature->r, kP384ScalarWords);
+  }
+  HARDENED_CHECK_EQ(i, num_items);
+
+  // Wipe DMEM.
+  return otbn_dmem_sec_wipe();
+}
+
 status_t p384_ecdh_start(p384_masked_scalar_t *private_key,
                          const p384_point_t *public_key) {
   // Load the ECDH/P-384 app. Fails if OTBN is non-idle.
@@ -384,7 +515,7 @@ status_t p384_ecdh_start(p384_masked_scalar_t *private_key,
   HARDENED_TRY(p384_masked_scalar_write(private_key, kOtbnVarD0, kOtbnVarD1));
 
   // Set the public key.
-  HARDENED_TRY(set_public_key(public_key));
+  HARDENED_TRY(set_public_key(public_key, kOtbnVarX, kOtbnVarY));
 
   // Start the OTBN routine.
   return otbn_execute();
@@ -434,7 +565,7 @@ status_t p384_sideload_ecdh_start(const p384_point_t *public_key) {
   HARDENED_TRY(otbn_dmem_write(kP384ModeWords, &mode, kOtbnVarMode));
 
   // Set the public key.
-  HARDENED_TRY(set_public_key(public_key));
+  HARDENED_TRY(set_public_key(public_key, kOtbnVarX, kOtbnVarY));
 
   // Start the OTBN routine.
   return otbn_execute();
@@ -73,6 +73,12 @@ enum {
    */
   kP384MaskedScalarTotalShareWords =
       kP384MaskedScalarNumShares * kP384MaskedScalarShareWords,
+  /**
+   * Maximum number of signatures in a batch verification.
+   *
+   * Must match the size of the batch buffers in `p384_mem.s`.
+   */
+  kP384VerifyBatchMaxItems = 3,
 };
 
 /**
@@ -134,6 +140,25 @@ typedef struct p384_ecdh_shared_key {
   uint32_t checksum;
 } p384_ecdh_shared_key_t;
 
+/**
+ * One signature in an ECDSA/P-384 batch verification.
+ */
+typedef struct p384_ecdsa_verify_batch_item {
+  /**
+   * Signature to be verified.
+   */
+  const p384_ecdsa_signature_t *signature;
+  /**
+   * Digest of the message to check the signature against
+   * (`kP384ScalarWords` words).
+   */
+  const uint32_t *digest;
+  /**
+   * Key to check the signature against.
+   */
+  const p384_point_t *public_key;
+} p384_ecdsa_verify_batch_item_t;
+
 /**
  * Compute the checksum of an p384 masked scalar.
  *
@@ -310,6 +335,44 @@ OT_WARN_UNUSED_RESULT
 status_t p384_ecdsa_verify_finalize(const p384_ecdsa_signature_t *signature,
                                     hardened_bool_t *result);
 
+/**
+ * Start an async ECDSA/P-384 batch signature verification operation on OTBN.
+ *
+ * Verifies up to `kP384VerifyBatchMaxItems` signatures with a single load of
+ * the OTBN app; see `p384_ecdsa_verify_start` for the per-item semantics.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param items Signatures to be verified.
+ * @param num_items Number of items (1 to `kP384VerifyBatchMaxItems`).
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t p384_ecdsa_verify_batch_start(
+    const p384_ecdsa_verify_batch_item_t *items, size_t num_items);
+
+/**
+ * Finish an async ECDSA/P-384 batch signature verification operation on OTBN.
+ *
+ * Blocks until OTBN has processed every item. An item that fails the basic
+ * validity checks on its signature or public key does not fail the whole
+ * batch; OTBN stops at that item and is restarted after it, and the item's
+ * result is `kHardenedBoolFalse`.
+ *
+ * For each item, writes `kHardenedBoolTrue` to the corresponding entry of
+ * `results` if the signature is valid and `kHardenedBoolFalse` otherwise. As
+ * for `p384_ecdsa_verify_finalize`, the caller must check `results`.
+ *
+ * @param items Signatures to be verified (same as for the start call).
+ * @param num_items Number of items (same as for the start call).
+ * @param[out] results Output buffer with one entry per item.
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t p384_ecdsa_verify_batch_finalize(
+    const p384_ecdsa_verify_batch_item_t *items, size_t num_items,
+    hardened_bool_t *results);
+
 /**
  * Start an async ECDH/P-384 shared key generation operation on OTBN.
  *
@@ -16,6 +16,11 @@
 // Module ID for status codes.
 #define MODULE_ID MAKE_MODULE_ID('p', '2', '5')
 
+// Check that the batch size from the top-level API matches the one from the
+// P-256 implementation.
+OT_ASSERT_ENUM_VALUE(kOtcryptoEcdsaP256VerifyBatchMaxItems,
+                     (uint32_t)kP256VerifyBatchMaxItems);
+
 otcrypto_status_t otcrypto_ecdsa_p256_keygen(
     otcrypto_blinded_key_t *private_key, otcrypto_unblinded_key_t *public_key) {
   HARDENED_TRY(otcrypto_ecdsa_p256_keygen_async_start(private_key));
@@ -42,6 +47,14 @@ otcrypto_status_t otcrypto_ecdsa_p256_verify(
                                                    verification_result);
 }
 
+otcrypto_status_t otcrypto_ecdsa_p256_verify_batch(
+    const otcrypto_ecdsa_p256_verify_item_t *items, size_t num_items,
+    hardened_bool_t *verification_results) {
+  HARDENED_TRY(otcrypto_ecdsa_p256_verify_batch_async_start(items, num_items));
+  return otcrypto_ecdsa_p256_verify_batch_async_finalize(items, num_items,
+                                                        verification_results);
+}
+
 otcrypto_status_t otcrypto_ecdsa_p256_sign_verify(
     const otcrypto_blinded_key_t *private_key,
     const otcrypto_unblinded_key_t *public_key,
@@ -388,18 +401,28 @@ otcrypto_status_t otcrypto_ecdsa_p256_sign_async_finalize(
   return keymgr_sideload_clear_otbn();
 }
 
-otcrypto_status_t otcrypto_ecdsa_p256_verify_async_start(
-    const otcrypto_unblinded_key_t *public_key,
-    const otcrypto_hash_digest_t message_digest,
-    otcrypto_const_word32_buf_t signature) {
+/**
+ * Checks the arguments of one ECDSA/P-256 signature verification.
+ *
+ * Performs every check that does not involve OTBN and, on success, fills in
+ * the internal signature, digest and public key pointers.
+ *
+ * @param public_key Pointer to the unblinded public key (Q) struct.
+ * @param message_digest Message digest to be verified (pre-hashed).
+ * @param signature Pointer to the signature to be verified.
+ * @param[out] item Internal representation of the arguments.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t verify_args_check(const otcrypto_unblinded_key_t *public_key,
+                                  const otcrypto_hash_digest_t message_digest,
+                                  otcrypto_const_word32_buf_t signature,
+                                  p256_ecdsa_verify_batch_item_t *item) {
   if (public_key == NULL || signature.data == NULL ||
       message_digest.data == NULL || public_key->key == NULL) {
     return OTCRYPTO_BAD_ARGS;
   }
 
-  // Ensure the entropy complex is initialized.
-  HARDENED_TRY(entropy_complex_check());
-
   // Check the integrity of the public key.
   if (integrity_unblinded_key_check(public_key) != kHardenedBoolTrue) {
     return OTCRYPTO_BAD_ARGS;
@@ -415,20 +438,35 @@ otcrypto_status_t otcrypto_ecdsa_p256_verify_async_start(
 
   // Check the public key size.
   HARDENED_TRY(p256_public_key_length_check(public_key));
-  p256_point_t *pk = (p256_point_t *)public_key->key;
+  item->public_key = (p256_point_t *)public_key->key;
 
   // Check the digest length.
   if (message_digest.len != kP256ScalarWords) {
     return OTCRYPTO_BAD_ARGS;
   }
   HARDENED_CHECK_EQ(launder32(message_digest.len), kP256ScalarWords);
+  item->digest = message_digest.data;
 
   // Check the signature lengths.
   HARDENED_TRY(p256_signature_length_check(signature.len));
-  p256_ecdsa_signature_t *sig = (p256_ecdsa_signature_t *)signature.data;
+  item->signature = (p256_ecdsa_signature_t *)signature.data;
+  return OTCRYPTO_OK;
+}
+
+otcrypto_status_t otcrypto_ecdsa_p256_verify_async_start(
+    const otcrypto_unblinded_key_t *public_key,
+    const otcrypto_hash_digest_t message_digest,
+    otcrypto_const_word32_buf_t signature) {
+  // Ensure the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  // Check the arguments.
+  p256_ecdsa_verify_batch_item_t item;
+  HARDENED_TRY(verify_args_check(public_key, message_digest, signature, &item));
 
   // Start the asynchronous signature-verification routine.
-  HARDENED_TRY(p256_ecdsa_verify_start(sig, message_digest.data, pk));
+  HARDENED_TRY(
+      p256_ecdsa_verify_start(item.signature, item.digest, item.public_key));
 
   // To detect forgeries of the pointer to the public key that we have passed
   // to the ECC implementation, check again its integrity. If the pointer would
@@ -454,6 +492,64 @@ otcrypto_status_t otcrypto_ecdsa_p256_verify_async_finalize(
   return p256_ecdsa_verify_finalize(sig_p256, verification_result);
 }
 
+otcrypto_status_t otcrypto_ecdsa_p256_verify_batch_async_start(
+    const otcrypto_ecdsa_p256_verify_item_t *items, size_t num_items) {
+  if (items == NULL || num_items == 0 ||
+      num_items > kOtcryptoEcdsaP256VerifyBatchMaxItems) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Ensure the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  // Check the arguments of every item before starting OTBN.
+  p256_ecdsa_verify_batch_item_t batch[kP256VerifyBatchMaxItems];
+  size_t i = 0;
+  for (; launder32(i) < num_items; i++) {
+    HARDENED_TRY(verify_args_check(items[i].public_key,
+                                   items[i].message_digest,
+                                   items[i].signature, &batch[i]));
+  }
+  HARDENED_CHECK_EQ(i, num_items);
+
+  // Start the asynchronous batch signature-verification routine.
+  HARDENED_TRY(p256_ecdsa_verify_batch_start(batch, num_items));
+
+  // Check the integrity of the public keys again, as for a single
+  // verification.
+  for (i = 0; launder32(i) < num_items; i++) {
+    HARDENED_CHECK_EQ(integrity_unblinded_key_check(items[i].public_key),
+                      kHardenedBoolTrue);
+  }
+  HARDENED_CHECK_EQ(i, num_items);
+  return OTCRYPTO_OK;
+}
+
+otcrypto_status_t otcrypto_ecdsa_p256_verify_batch_async_finalize(
+    const otcrypto_ecdsa_p256_verify_item_t *items, size_t num_items,
+    hardened_bool_t *verification_results) {
+  if (items == NULL || verification_results == NULL || num_items == 0 ||
+      num_items > kOtcryptoEcdsaP256VerifyBatchMaxItems) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Ensure the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  // Only the signatures are needed to interpret the results.
+  p256_ecdsa_verify_batch_item_t batch[kP256VerifyBatchMaxItems];
+  size_t i = 0;
+  for (; launder32(i) < num_items; i++) {
+    HARDENED_TRY(p256_signature_length_check(items[i].signature.len));
+    batch[i].signature = (p256_ecdsa_signature_t *)items[i].signature.data;
+    batch[i].digest = NULL;
+    batch[i].public_key = NULL;
+  }
+  HARDENED_CHECK_EQ(i, num_items);
+  return p256_ecdsa_verify_batch_finalize(batch, num_items,
+                                         verification_results);
+}
+
 otcrypto_status_t otcrypto_ecdh_p256_keygen_async_start(
     const otcrypto_blinded_key_t *private_key) {
   if (private_key == NULL || private_key->keyblob == NULL) {
@@ -15,37 +15,42 @@
 // Module ID for status codes.
 #define MODULE_ID MAKE_MODULE_ID('k', 'm', 'c')
 
-otcrypto_status_t otcrypto_kmac(otcrypto_blinded_key_t *key,
-                                otcrypto_const_byte_buf_t input_message,
-                                otcrypto_const_byte_buf_t customization_string,
-                                size_t required_output_len,
-                                otcrypto_word32_buf_t tag) {
-  // TODO (#16410) Revisit/complete error checks
-
-  // Check for null pointers.
-  if (key == NULL || key->keyblob == NULL || tag.data == NULL) {
-    return OTCRYPTO_BAD_ARGS;
-  }
-
+/**
+ * Internal context for a streaming KMAC operation.
+ */
+typedef struct kmac_context {
+  /**
+   * Whether the key was sideloaded from keymgr.
+   */
+  hardened_bool_t hw_backed;
+  /**
+   * State of the operation in the KMAC driver.
+   */
+  kmac_stream_t stream;
+} kmac_context_t;
+
+// Ensure that the KMAC context is large enough for the internal context.
+static_assert(sizeof(otcrypto_kmac_context_t) >= sizeof(kmac_context_t),
+              "`otcrypto_kmac_context_t` must be at least as large as "
+              "`kmac_context_t`.");
+
+/**
+ * Check a KMAC key and prepare it for the driver.
+ *
+ * For hardware-backed keys, this generates the sideload key in keymgr; the
+ * caller is responsible for clearing it afterwards. For software keys, this
+ * remasks the key and points the driver key at the shares in the keyblob.
+ *
+ * @param key Blinded key from the caller.
+ * @param[out] kmac_key Key in the representation used by the driver.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_key_prepare(otcrypto_blinded_key_t *key,
+                                 kmac_blinded_key_t *kmac_key) {
   // Check the security config of the device.
   HARDENED_TRY(security_config_check(key->config.security_level));
 
-  // Check for null input message with nonzero length.
-  if (input_message.data == NULL && input_message.len != 0) {
-    return OTCRYPTO_BAD_ARGS;
-  }
-
-  // Check for null customization string with nonzero length.
-  if (customization_string.data == NULL && customization_string.len != 0) {
-    return OTCRYPTO_BAD_ARGS;
-  }
-
-  // Ensure that tag buffer length and `required_output_len` match each other.
-  if (required_output_len != tag.len * sizeof(uint32_t) ||
-      required_output_len == 0) {
-    return OTCRYPTO_BAD_ARGS;
-  }
-
   // Ensure the entropy complex is initialized.
   HARDENED_TRY(entropy_complex_check());
 
@@ -60,12 +65,10 @@ otcrypto_status_t otcrypto_kmac(otcrypto_blinded_key_t *key,
   }
   HARDENED_CHECK_EQ(integrity_blinded_key_check(key), kHardenedBoolTrue);
 
-  kmac_blinded_key_t kmac_key = {
-      .share0 = NULL,
-      .share1 = NULL,
-      .hw_backed = key->config.hw_backed,
-      .len = key_len,
-  };
+  kmac_key->share0 = NULL;
+  kmac_key->share1 = NULL;
+  kmac_key->hw_backed = key->config.hw_backed;
+  kmac_key->len = key_len;
 
   if (key->config.hw_backed == kHardenedBoolTrue) {
     if (key_len != kKmacSideloadKeyLength / 8) {
@@ -86,11 +89,61 @@ otcrypto_status_t otcrypto_kmac(otcrypto_blinded_key_t *key,
     if (key->keyblob_length != 2 * key->config.key_length) {
       return OTCRYPTO_BAD_ARGS;
     }
-    HARDENED_TRY(keyblob_to_shares(key, &kmac_key.share0, &kmac_key.share1));
+    HARDENED_TRY(keyblob_to_shares(key, &kmac_key->share0, &kmac_key->share1));
   } else {
     return OTCRYPTO_BAD_ARGS;
   }
 
+  return OTCRYPTO_OK;
+}
+
+/**
+ * Clear the sideload key, if the key was hardware-backed.
+ *
+ * @param hw_backed Whether the key was sideloaded from keymgr.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t kmac_key_release(hardened_bool_t hw_backed) {
+  if (hw_backed == kHardenedBoolTrue) {
+    HARDENED_TRY(keymgr_sideload_clear_kmac());
+  } else if (hw_backed != kHardenedBoolFalse) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  return OTCRYPTO_OK;
+}
+
+otcrypto_status_t otcrypto_kmac(otcrypto_blinded_key_t *key,
+                                otcrypto_const_byte_buf_t input_message,
+                                otcrypto_const_byte_buf_t customization_string,
+                                size_t required_output_len,
+                                otcrypto_word32_buf_t tag) {
+  // TODO (#16410) Revisit/complete error checks
+
+  // Check for null pointers.
+  if (key == NULL || key->keyblob == NULL || tag.data == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Check for null input message with nonzero length.
+  if (input_message.data == NULL && input_message.len != 0) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Check for null customization string with nonzero length.
+  if (customization_string.data == NULL && customization_string.len != 0) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Ensure that tag buffer length and `required_output_len` match each other.
+  if (required_output_len != tag.len * sizeof(uint32_t) ||
+      required_output_len == 0) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  kmac_blinded_key_t kmac_key;
+  HARDENED_TRY(kmac_key_prepare(key, &kmac_key));
+
   otcrypto_key_mode_t key_mode_used = launder32(0);
   switch (launder32(key->config.key_mode)) {
     case kOtcryptoKeyModeKmac128:
@@ -114,11 +167,86 @@ otcrypto_status_t otcrypto_kmac(otcrypto_blinded_key_t *key,
   // avoid that multiple cases were executed.
   HARDENED_CHECK_EQ(launder32(key_mode_used), key->config.key_mode);
 
-  if (key->config.hw_backed == kHardenedBoolTrue) {
-    HARDENED_TRY(keymgr_sideload_clear_kmac());
-  } else if (key->config.hw_backed != kHardenedBoolFalse) {
+  return kmac_key_release(key->config.hw_backed);
+}
+
+otcrypto_status_t otcrypto_kmac_init(
+    otcrypto_blinded_key_t *key, otcrypto_const_byte_buf_t customization_string,
+    otcrypto_kmac_context_t *ctx) {
+  if (key == NULL || key->keyblob == NULL || ctx == NULL) {
     return OTCRYPTO_BAD_ARGS;
   }
 
-  return OTCRYPTO_OK;
+  // Check for null customization string with nonzero length.
+  if (customization_string.data == NULL && customization_string.len != 0) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  kmac_stream_mode_t stream_mode;
+  otcrypto_key_mode_t key_mode_used = launder32(0);
+  switch (launder32(key->config.key_mode)) {
+    case kOtcryptoKeyModeKmac128:
+      stream_mode = kKmacStreamModeKmac128;
+      key_mode_used = launder32(key_mode_used) | kOtcryptoKeyModeKmac128;
+      break;
+    case kOtcryptoKeyModeKmac256:
+      stream_mode = kKmacStreamModeKmac256;
+      key_mode_used = launder32(key_mode_used) | kOtcryptoKeyModeKmac256;
+      break;
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+  // Check if we landed in the correct case statement. Use ORs for this to
+  // avoid that multiple cases were executed.
+  HARDENED_CHECK_EQ(launder32(key_mode_used), key->config.key_mode);
+
+  kmac_blinded_key_t kmac_key;
+  HARDENED_TRY(kmac_key_prepare(key, &kmac_key));
+
+  kmac_context_t *kmac_ctx = (kmac_context_t *)ctx->data;
+  kmac_ctx->hw_backed = kmac_key.hw_backed;
+  status_t err = kmac_stream_start(
+      stream_mode, &kmac_key, /*func_name=*/NULL, 0, customization_string.data,
+      customization_string.len, &kmac_ctx->stream);
+  if (!status_ok(err)) {
+    // Do not leave the sideload key behind if the block could not be
+    // claimed.
+    HARDENED_TRY(kmac_key_release(kmac_key.hw_backed));
+  }
+  return err;
+}
+
+otcrypto_status_t otcrypto_kmac_update(
+    otcrypto_kmac_context_t *ctx, otcrypto_const_byte_buf_t input_message) {
+  if (ctx == NULL || (input_message.data == NULL && input_message.len != 0)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  kmac_context_t *kmac_ctx = (kmac_context_t *)ctx->data;
+  return kmac_stream_absorb(&kmac_ctx->stream, input_message.data,
+                            input_message.len);
+}
+
+otcrypto_status_t otcrypto_kmac_final(otcrypto_kmac_context_t *ctx,
+                                      size_t required_output_len,
+                                      otcrypto_word32_buf_t tag) {
+  if (ctx == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  kmac_context_t *kmac_ctx = (kmac_context_t *)ctx->data;
+
+  // Ensure that tag buffer length and `required_output_len` match each other.
+  if (tag.data == NULL || required_output_len != tag.len * sizeof(uint32_t) ||
+      required_output_len == 0) {
+    // Release the KMAC block anyway so that it does not stay held.
+    HARDENED_TRY(kmac_stream_end(&kmac_ctx->stream));
+    HARDENED_TRY(kmac_key_release(kmac_ctx->hw_backed));
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  HARDENED_TRY(kmac_stream_process(&kmac_ctx->stream, tag.len));
+  HARDENED_TRY(kmac_stream_squeeze(&kmac_ctx->stream, tag.data, tag.len));
+  HARDENED_TRY(kmac_stream_end(&kmac_ctx->stream));
+  return kmac_key_release(kmac_ctx->hw_backed);
 }
@@ -40,6 +40,15 @@ static_assert(kOtcryptoRsa3072PrivateKeyblobBytes ==
 static_assert(kOtcryptoRsa4096PrivateKeyblobBytes ==
                   sizeof(rsa_4096_private_key_t),
               "RSA-4096 keyblob size mismatch.");
+static_assert(kOtcryptoRsa2048CrtPrivateKeyblobBytes ==
+                  sizeof(rsa_2048_crt_private_key_t),
+              "RSA-2048 CRT keyblob size mismatch.");
+static_assert(kOtcryptoRsa3072CrtPrivateKeyblobBytes ==
+                  sizeof(rsa_3072_crt_private_key_t),
+              "RSA-3072 CRT keyblob size mismatch.");
+static_assert(kOtcryptoRsa4096CrtPrivateKeyblobBytes ==
+                  sizeof(rsa_4096_crt_private_key_t),
+              "RSA-4096 CRT keyblob size mismatch.");
 
 otcrypto_status_t otcrypto_rsa_keygen(otcrypto_rsa_size_t size,
                                       otcrypto_unblinded_key_t *public_key,
@@ -148,19 +157,20 @@ otcrypto_status_t otcrypto_rsa_public_key_construct(
 }
 
 /**
- * Basic structural validity checks for RSA private key buffers.
+ * Structural validity checks for RSA private key buffers in either form.
  *
- * Checks for bad length, invalid key modes, or an unsupported configuration.
- * Does not verify checksums or actual key data requirements because this
- * routine is used for keygen as well as other operations, when the key data is
- * not yet populated.
+ * Checks for bad length, invalid key modes, or an unsupported configuration,
+ * and determines from the keyblob length whether the key is in CRT form. Does
+ * not verify checksums or actual key data requirements.
  *
  * @param size RSA size parameter.
  * @param private_key Key to check.
+ * @param[out] is_crt Whether the keyblob holds a key in CRT form.
  * @return OK if the key is valid, OTCRYPTO_BAD_ARGS otherwise.
  */
-static status_t private_key_structural_check(
-    const otcrypto_rsa_size_t size, const otcrypto_blinded_key_t *private_key) {
+static status_t private_key_layout_check(
+    const otcrypto_rsa_size_t size, const otcrypto_blinded_key_t *private_key,
+    hardened_bool_t *is_crt) {
   // Check that the key mode is a valid RSA mode.
   HARDENED_TRY(rsa_mode_check(private_key->config.key_mode));
 
@@ -172,33 +182,70 @@ static status_t private_key_structural_check(
   // Check the lengths against the RSA size.
   size_t key_length = 0;
   size_t keyblob_length = 0;
+  size_t crt_keyblob_length = 0;
   switch (launder32(size)) {
     case kOtcryptoRsaSize2048:
       HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
       key_length = kOtcryptoRsa2048PrivateKeyBytes;
       keyblob_length = kOtcryptoRsa2048PrivateKeyblobBytes;
+      crt_keyblob_length = kOtcryptoRsa2048CrtPrivateKeyblobBytes;
       break;
     case kOtcryptoRsaSize3072:
       HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
       key_length = kOtcryptoRsa3072PrivateKeyBytes;
       keyblob_length = kOtcryptoRsa3072PrivateKeyblobBytes;
+      crt_keyblob_length = kOtcryptoRsa3072CrtPrivateKeyblobBytes;
       break;
     case kOtcryptoRsaSize4096:
       HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
       key_length = kOtcryptoRsa4096PrivateKeyBytes;
       keyblob_length = kOtcryptoRsa4096PrivateKeyblobBytes;
+      crt_keyblob_length = kOtcryptoRsa4096CrtPrivateKeyblobBytes;
       break;
     default:
       return OTCRYPTO_BAD_ARGS;
   }
   HARDENED_CHECK_NE(key_length, 0);
   HARDENED_CHECK_NE(keyblob_length, 0);
+  HARDENED_CHECK_NE(crt_keyblob_length, 0);
 
-  if (private_key->config.key_length != key_length ||
-      private_key->keyblob_length != keyblob_length) {
+  if (private_key->config.key_length != key_length) {
     return OTCRYPTO_BAD_ARGS;
   }
 
+  if (launder32(private_key->keyblob_length) == keyblob_length) {
+    HARDENED_CHECK_EQ(private_key->keyblob_length, keyblob_length);
+    *is_crt = kHardenedBoolFalse;
+    return OTCRYPTO_OK;
+  }
+  if (launder32(private_key->keyblob_length) == crt_keyblob_length) {
+    HARDENED_CHECK_EQ(private_key->keyblob_length, crt_keyblob_length);
+    *is_crt = kHardenedBoolTrue;
+    return OTCRYPTO_OK;
+  }
+  return OTCRYPTO_BAD_ARGS;
+}
+
+/**
+ * Basic structural validity checks for RSA private key buffers.
+ *
+ * Checks for bad length, invalid key modes, or an unsupported configuration.
+ * Does not verify checksums or actual key data requirements because this
+ * routine is used for keygen as well as other operations, when the key data is
+ * not yet populated. Rejects keys in CRT form.
+ *
+ * @param size RSA size parameter.
+ * @param private_key Key to check.
+ * @return OK if the key is valid, OTCRYPTO_BAD_ARGS otherwise.
+ */
+static status_t private_key_structural_check(
+    const otcrypto_rsa_size_t size, const otcrypto_blinded_key_t *private_key) {
+  hardened_bool_t is_crt = kHardenedBoolTrue;
+  HARDENED_TRY(private_key_layout_check(size, private_key, &is_crt));
+  if (launder32(is_crt) != kHardenedBoolFalse) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_CHECK_EQ(is_crt, kHardenedBoolFalse);
   return OTCRYPTO_OK;
 }
 
@@ -274,6 +321,122 @@ otcrypto_status_t otcrypto_rsa_private_key_from_exponents(
   return OTCRYPTO_OK;
 }
 
+otcrypto_status_t otcrypto_rsa_private_key_from_crt(
+    otcrypto_rsa_size_t size, otcrypto_const_word32_buf_t modulus,
+    otcrypto_const_word32_buf_t p, otcrypto_const_word32_buf_t q,
+    otcrypto_const_word32_buf_t d_p_share0,
+    otcrypto_const_word32_buf_t d_p_share1,
+    otcrypto_const_word32_buf_t d_q_share0,
+    otcrypto_const_word32_buf_t d_q_share1, otcrypto_const_word32_buf_t i_q,
+    otcrypto_blinded_key_t *private_key) {
+  if (modulus.data == NULL || p.data == NULL || q.data == NULL ||
+      d_p_share0.data == NULL || d_p_share1.data == NULL ||
+      d_q_share0.data == NULL || d_q_share1.data == NULL || i_q.data == NULL ||
+      private_key == NULL || private_key->keyblob == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  // Entropy complex must be initialized for `hardened_memcpy`.
+  HARDENED_TRY(entropy_complex_check());
+
+  // Check the mode and lengths for the private key, and ensure that the
+  // caller allocated a CRT keyblob.
+  hardened_bool_t is_crt = kHardenedBoolFalse;
+  HARDENED_TRY(private_key_layout_check(size, private_key, &is_crt));
+  if (launder32(is_crt) != kHardenedBoolTrue) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_CHECK_EQ(is_crt, kHardenedBoolTrue);
+
+  // All CRT components are half the length of the modulus.
+  size_t cofactor_len = modulus.len / 2;
+  if (cofactor_len == 0 || p.len != cofactor_len || q.len != cofactor_len ||
+      d_p_share0.len != cofactor_len || d_p_share1.len != cofactor_len ||
+      d_q_share0.len != cofactor_len || d_q_share1.len != cofactor_len ||
+      i_q.len != cofactor_len) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // The OTBN routine splits the base into two halves and reduces each modulo
+  // p and q, so both primes must fill their limbs.
+  if ((p.data[cofactor_len - 1] >> 31) == 0 ||
+      (q.data[cofactor_len - 1] >> 31) == 0) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Randomize the keyblob.
+  HARDENED_TRY(hardened_memshred(
+      private_key->keyblob,
+      ceil_div(private_key->keyblob_length, sizeof(uint32_t))));
+
+  switch (size) {
+    case kOtcryptoRsaSize2048: {
+      if (modulus.len != kRsa2048NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_2048_crt_private_key_t *sk =
+          (rsa_2048_crt_private_key_t *)private_key->keyblob;
+      HARDENED_TRY(hardened_memcpy(sk->n.data, modulus.data, modulus.len));
+      HARDENED_TRY(hardened_memcpy(sk->p.data, p.data, p.len));
+      HARDENED_TRY(hardened_memcpy(sk->q.data, q.data, q.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_p0.data, d_p_share0.data, d_p_share0.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_p1.data, d_p_share1.data, d_p_share1.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_q0.data, d_q_share0.data, d_q_share0.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_q1.data, d_q_share1.data, d_q_share1.len));
+      HARDENED_TRY(hardened_memcpy(sk->i_q.data, i_q.data, i_q.len));
+      break;
+    }
+    case kOtcryptoRsaSize3072: {
+      if (modulus.len != kRsa3072NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_3072_crt_private_key_t *sk =
+          (rsa_3072_crt_private_key_t *)private_key->keyblob;
+      HARDENED_TRY(hardened_memcpy(sk->n.data, modulus.data, modulus.len));
+      HARDENED_TRY(hardened_memcpy(sk->p.data, p.data, p.len));
+      HARDENED_TRY(hardened_memcpy(sk->q.data, q.data, q.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_p0.data, d_p_share0.data, d_p_share0.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_p1.data, d_p_share1.data, d_p_share1.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_q0.data, d_q_share0.data, d_q_share0.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_q1.data, d_q_share1.data, d_q_share1.len));
+      HARDENED_TRY(hardened_memcpy(sk->i_q.data, i_q.data, i_q.len));
+      break;
+    }
+    case kOtcryptoRsaSize4096: {
+      if (modulus.len != kRsa4096NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_4096_crt_private_key_t *sk =
+          (rsa_4096_crt_private_key_t *)private_key->keyblob;
+      HARDENED_TRY(hardened_memcpy(sk->n.data, modulus.data, modulus.len));
+      HARDENED_TRY(hardened_memcpy(sk->p.data, p.data, p.len));
+      HARDENED_TRY(hardened_memcpy(sk->q.data, q.data, q.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_p0.data, d_p_share0.data, d_p_share0.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_p1.data, d_p_share1.data, d_p_share1.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_q0.data, d_q_share0.data, d_q_share0.len));
+      HARDENED_TRY(
+          hardened_memcpy(sk->d_q1.data, d_q_share1.data, d_q_share1.len));
+      HARDENED_TRY(hardened_memcpy(sk->i_q.data, i_q.data, i_q.len));
+      break;
+    }
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+
+  private_key->checksum = integrity_blinded_checksum(private_key);
+  return OTCRYPTO_OK;
+}
+
 otcrypto_status_t otcrypto_rsa_keypair_from_cofactor(
     otcrypto_rsa_size_t size, otcrypto_const_word32_buf_t modulus,
     otcrypto_const_word32_buf_t cofactor_share0,
@@ -685,6 +848,60 @@ static status_t key_mode_padding_check(otcrypto_key_mode_t key_mode,
   return OTCRYPTO_FATAL_ERR;
 }
 
+/**
+ * Start a signature generation with a private key in CRT form.
+ *
+ * The caller must have checked the key layout, mode and checksum.
+ *
+ * @param size RSA size parameter.
+ * @param private_key Private key in CRT form.
+ * @param message_digest Message digest to sign.
+ * @param padding_mode Signature padding mode.
+ * @return Result of the operation (OK or error).
+ */
+static status_t rsa_sign_crt_start(otcrypto_rsa_size_t size,
+                                   const otcrypto_blinded_key_t *private_key,
+                                   const otcrypto_hash_digest_t message_digest,
+                                   otcrypto_rsa_padding_t padding_mode) {
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      HARDENED_CHECK_EQ(private_key->keyblob_length,
+                        sizeof(rsa_2048_crt_private_key_t));
+      rsa_2048_crt_private_key_t *sk =
+          (rsa_2048_crt_private_key_t *)private_key->keyblob;
+      return rsa_signature_generate_crt_2048_start(
+          sk, message_digest, (rsa_signature_padding_t)padding_mode);
+    }
+    case kOtcryptoRsaSize3072: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      HARDENED_CHECK_EQ(private_key->keyblob_length,
+                        sizeof(rsa_3072_crt_private_key_t));
+      rsa_3072_crt_private_key_t *sk =
+          (rsa_3072_crt_private_key_t *)private_key->keyblob;
+      return rsa_signature_generate_crt_3072_start(
+          sk, message_digest, (rsa_signature_padding_t)padding_mode);
+    }
+    case kOtcryptoRsaSize4096: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      HARDENED_CHECK_EQ(private_key->keyblob_length,
+                        sizeof(rsa_4096_crt_private_key_t));
+      rsa_4096_crt_private_key_t *sk =
+          (rsa_4096_crt_private_key_t *)private_key->keyblob;
+      return rsa_signature_generate_crt_4096_start(
+          sk, message_digest, (rsa_signature_padding_t)padding_mode);
+    }
+    default:
+      // Invalid key size. Since the size was inferred, should be unreachable.
+      HARDENED_TRAP();
+      return OTCRYPTO_FATAL_ERR;
+  }
+
+  // Should be unreachable.
+  HARDENED_TRAP();
+  return OTCRYPTO_FATAL_ERR;
+}
+
 otcrypto_status_t otcrypto_rsa_sign_async_start(
     const otcrypto_blinded_key_t *private_key,
     const otcrypto_hash_digest_t message_digest,
@@ -706,7 +923,8 @@ otcrypto_status_t otcrypto_rsa_sign_async_start(
   HARDENED_TRY(rsa_size_from_private_key(private_key, &size));
 
   // Check the caller-provided private key buffer.
-  HARDENED_TRY(private_key_structural_check(size, private_key));
+  hardened_bool_t is_crt = kHardenedBoolFalse;
+  HARDENED_TRY(private_key_layout_check(size, private_key, &is_crt));
 
   // Ensure the key mode matches the padding mode.
   HARDENED_TRY(
@@ -717,6 +935,12 @@ otcrypto_status_t otcrypto_rsa_sign_async_start(
     return OTCRYPTO_BAD_ARGS;
   }
 
+  if (launder32(is_crt) == kHardenedBoolTrue) {
+    HARDENED_CHECK_EQ(is_crt, kHardenedBoolTrue);
+    return rsa_sign_crt_start(size, private_key, message_digest, padding_mode);
+  }
+  HARDENED_CHECK_EQ(is_crt, kHardenedBoolFalse);
+
   // Start the appropriate signature generation routine.
   switch (launder32(size)) {
     case kOtcryptoRsaSize2048: {
@@ -994,6 +1218,88 @@ otcrypto_status_t otcrypto_rsa_encrypt_async_finalize(
   return OTCRYPTO_FATAL_ERR;
 }
 
+/**
+ * Start a decryption with a private key in CRT form.
+ *
+ * The caller must have checked the key layout, mode and checksum.
+ *
+ * @param size RSA size parameter.
+ * @param private_key Private key in CRT form.
+ * @param ciphertext Encrypted message.
+ * @return Result of the operation (OK or error).
+ */
+static status_t rsa_decrypt_crt_start(otcrypto_rsa_size_t size,
+                                      const otcrypto_blinded_key_t *private_key,
+                                      otcrypto_const_word32_buf_t ciphertext) {
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      HARDENED_CHECK_EQ(private_key->keyblob_length,
+                        sizeof(rsa_2048_crt_private_key_t));
+      if (ciphertext.len != kRsa2048NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_2048_crt_private_key_t *sk =
+          (rsa_2048_crt_private_key_t *)private_key->keyblob;
+      rsa_2048_int_t *ctext = (rsa_2048_int_t *)ciphertext.data;
+
+      // Check that ciphertext is < n.
+      if (bignum_lt(ctext->data, sk->n.data, kRsa2048NumWords) ==
+          kHardenedBoolFalse) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+
+      return rsa_decrypt_crt_2048_start(sk, ctext);
+    }
+    case kOtcryptoRsaSize3072: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      HARDENED_CHECK_EQ(private_key->keyblob_length,
+                        sizeof(rsa_3072_crt_private_key_t));
+      if (ciphertext.len != kRsa3072NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_3072_crt_private_key_t *sk =
+          (rsa_3072_crt_private_key_t *)private_key->keyblob;
+      rsa_3072_int_t *ctext = (rsa_3072_int_t *)ciphertext.data;
+
+      // Check that ciphertext is < n.
+      if (bignum_lt(ctext->data, sk->n.data, kRsa3072NumWords) ==
+          kHardenedBoolFalse) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+
+      return rsa_decrypt_crt_3072_start(sk, ctext);
+    }
+    case kOtcryptoRsaSize4096: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      HARDENED_CHECK_EQ(private_key->keyblob_length,
+                        sizeof(rsa_4096_crt_private_key_t));
+      if (ciphertext.len != kRsa4096NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_4096_crt_private_key_t *sk =
+          (rsa_4096_crt_private_key_t *)private_key->keyblob;
+      rsa_4096_int_t *ctext = (rsa_4096_int_t *)ciphertext.data;
+
+      // Check that ciphertext is < n.
+      if (bignum_lt(ctext->data, sk->n.data, kRsa4096NumWords) ==
+          kHardenedBoolFalse) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+
+      return rsa_decrypt_crt_4096_start(sk, ctext);
+    }
+    default:
+      // Invalid key size. Since the size was inferred, should be unreachable.
+      HARDENED_TRAP();
+      return OTCRYPTO_FATAL_ERR;
+  }
+
+  // Should be unreachable.
+  HARDENED_TRAP();
+  return OTCRYPTO_FATAL_ERR;
+}
+
 otcrypto_status_t otcrypto_rsa_decrypt_async_start(
     const otcrypto_blinded_key_t *private_key,
     otcrypto_const_word32_buf_t ciphertext) {
@@ -1014,7 +1320,8 @@ otcrypto_status_t otcrypto_rsa_decrypt_async_start(
   HARDENED_TRY(rsa_size_from_private_key(private_key, &size));
 
   // Check the caller-provided private key buffer.
-  HARDENED_TRY(private_key_structural_check(size, private_key));
+  hardened_bool_t is_crt = kHardenedBoolFalse;
+  HARDENED_TRY(private_key_layout_check(size, private_key, &is_crt));
 
   // Verify the checksum.
   if (integrity_blinded_key_check(private_key) != kHardenedBoolTrue) {
@@ -1029,6 +1336,12 @@ otcrypto_status_t otcrypto_rsa_decrypt_async_start(
   HARDENED_CHECK_EQ(private_key->config.key_mode,
                     kOtcryptoKeyModeRsaEncryptOaep);
 
+  if (launder32(is_crt) == kHardenedBoolTrue) {
+    HARDENED_CHECK_EQ(is_crt, kHardenedBoolTrue);
+    return rsa_decrypt_crt_start(size, private_key, ciphertext);
+  }
+  HARDENED_CHECK_EQ(is_crt, kHardenedBoolFalse);
+
   // Start the appropriate decryption routine.
   switch (launder32(size)) {
     case kOtcryptoRsaSize2048: {
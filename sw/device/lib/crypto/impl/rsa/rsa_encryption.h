@@ -66,6 +66,24 @@ OT_WARN_UNUSED_RESULT
 status_t rsa_decrypt_2048_start(const rsa_2048_private_key_t *private_key,
                                 const rsa_2048_int_t *ciphertext);
 
+/**
+ * Start decrypting a message with an RSA-2048 key in CRT form.
+ *
+ * Faster than `rsa_decrypt_2048_start()`. The key exponent must be F4=65537.
+ * Ciphertexts that are not less than the modulus are rejected by
+ * `rsa_decrypt_finalize()`.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param private_key RSA private key in CRT form.
+ * @param ciphertext Encrypted message.
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t rsa_decrypt_crt_2048_start(
+    const rsa_2048_crt_private_key_t *private_key,
+    const rsa_2048_int_t *ciphertext);
+
 /**
  * Waits for an RSA decryption to complete.
  *
@@ -153,6 +171,24 @@ OT_WARN_UNUSED_RESULT
 status_t rsa_decrypt_3072_start(const rsa_3072_private_key_t *private_key,
                                 const rsa_3072_int_t *ciphertext);
 
+/**
+ * Start decrypting a message with an RSA-3072 key in CRT form.
+ *
+ * Faster than `rsa_decrypt_3072_start()`. The key exponent must be F4=65537.
+ * Ciphertexts that are not less than the modulus are rejected by
+ * `rsa_decrypt_finalize()`.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param private_key RSA private key in CRT form.
+ * @param ciphertext Encrypted message.
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t rsa_decrypt_crt_3072_start(
+    const rsa_3072_crt_private_key_t *private_key,
+    const rsa_3072_int_t *ciphertext);
+
 /**
  * Starts encrypting a message with RSA-4096; returns immediately.
  *
@@ -202,6 +238,24 @@ OT_WARN_UNUSED_RESULT
 status_t rsa_decrypt_4096_start(const rsa_4096_private_key_t *private_key,
                                 const rsa_4096_int_t *ciphertext);
 
+/**
+ * Start decrypting a message with an RSA-4096 key in CRT form.
+ *
+ * Faster than `rsa_decrypt_4096_start()`. The key exponent must be F4=65537.
+ * Ciphertexts that are not less than the modulus are rejected by
+ * `rsa_decrypt_finalize()`.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param private_key RSA private key in CRT form.
+ * @param ciphertext Encrypted message.
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t rsa_decrypt_crt_4096_start(
+    const rsa_4096_crt_private_key_t *private_key,
+    const rsa_4096_int_t *ciphertext);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -28,6 +28,34 @@ static const otbn_addr_t kOtbnVarRsaD0 = OTBN_ADDR_T_INIT(run_rsa, rsa_d0);
 static const otbn_addr_t kOtbnVarRsaD1 = OTBN_ADDR_T_INIT(run_rsa, rsa_d1);
 static const otbn_addr_t kOtbnVarRsaInOut = OTBN_ADDR_T_INIT(run_rsa, inout);
 
+// Declare offsets for the inputs of the CRT modes.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_p);     // Prime p.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_q);     // Prime q.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_d_p0);  // CRT exponent d_p share 0.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_d_p1);  // CRT exponent d_p share 1.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_d_q0);  // CRT exponent d_q share 0.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_d_q1);  // CRT exponent d_q share 1.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_i_q);   // CRT coefficient i_q.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_c_lo);  // Lower half of the base.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_crt_c_hi);  // Upper half of the base.
+
+static const otbn_addr_t kOtbnVarRsaCrtP = OTBN_ADDR_T_INIT(run_rsa, rsa_crt_p);
+static const otbn_addr_t kOtbnVarRsaCrtQ = OTBN_ADDR_T_INIT(run_rsa, rsa_crt_q);
+static const otbn_addr_t kOtbnVarRsaCrtDp0 =
+    OTBN_ADDR_T_INIT(run_rsa, rsa_crt_d_p0);
+static const otbn_addr_t kOtbnVarRsaCrtDp1 =
+    OTBN_ADDR_T_INIT(run_rsa, rsa_crt_d_p1);
+static const otbn_addr_t kOtbnVarRsaCrtDq0 =
+    OTBN_ADDR_T_INIT(run_rsa, rsa_crt_d_q0);
+static const otbn_addr_t kOtbnVarRsaCrtDq1 =
+    OTBN_ADDR_T_INIT(run_rsa, rsa_crt_d_q1);
+static const otbn_addr_t kOtbnVarRsaCrtIq =
+    OTBN_ADDR_T_INIT(run_rsa, rsa_crt_i_q);
+static const otbn_addr_t kOtbnVarRsaCrtCLo =
+    OTBN_ADDR_T_INIT(run_rsa, rsa_crt_c_lo);
+static const otbn_addr_t kOtbnVarRsaCrtCHi =
+    OTBN_ADDR_T_INIT(run_rsa, rsa_crt_c_hi);
+
 // Declare mode constants.
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_2048_KEYGEN);
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_KEYGEN);
@@ -38,6 +66,9 @@ OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_MODEXP);
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_MODEXP_F4);
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_4096_MODEXP);
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_4096_MODEXP_F4);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_2048_MODEXP_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_MODEXP_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_4096_MODEXP_CRT);
 static const uint32_t kMode2048Keygen =
     OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_2048_KEYGEN);
 static const uint32_t kMode3072Keygen =
@@ -56,6 +87,12 @@ static const uint32_t kMode4096Modexp =
     OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_4096_MODEXP);
 static const uint32_t kMode4096ModexpF4 =
     OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_4096_MODEXP_F4);
+static const uint32_t kMode2048ModexpCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_2048_MODEXP_CRT);
+static const uint32_t kMode3072ModexpCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_3072_MODEXP_CRT);
+static const uint32_t kMode4096ModexpCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_4096_MODEXP_CRT);
 
 enum {
   /**
@@ -76,11 +113,14 @@ status_t rsa_modexp_wait(size_t *num_words) {
   HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(1, kOtbnVarRsaMode, &mode));
 
   *num_words = 0;
-  if (mode == kMode2048Modexp || mode == kMode2048ModexpF4) {
+  if (mode == kMode2048Modexp || mode == kMode2048ModexpF4 ||
+      mode == kMode2048ModexpCrt) {
     *num_words = kRsa2048NumWords;
-  } else if (mode == kMode3072Modexp || mode == kMode3072ModexpF4) {
+  } else if (mode == kMode3072Modexp || mode == kMode3072ModexpF4 ||
+             mode == kMode3072ModexpCrt) {
     *num_words = kRsa3072NumWords;
-  } else if (mode == kMode4096Modexp || mode == kMode4096ModexpF4) {
+  } else if (mode == kMode4096Modexp || mode == kMode4096ModexpF4 ||
+             mode == kMode4096ModexpCrt) {
     *num_words = kRsa4096NumWords;
   } else {
     // Wipe DMEM.
@@ -122,6 +162,56 @@ static status_t rsa_modexp_finalize(const size_t num_words, uint32_t *result) {
   return otbn_dmem_sec_wipe();
 }
 
+/**
+ * Starts a CRT modular exponentiation of variable size.
+ *
+ * All key parameters are half the size of the modulus. The base is full-size
+ * and is split across two half-size buffers in OTBN DMEM.
+ *
+ * @param mode Application mode.
+ * @param num_words Number of words of the modulus and the base.
+ * @param base Exponentiation base.
+ * @param p Prime p.
+ * @param q Prime q.
+ * @param d_p0 First share of the CRT exponent d_p.
+ * @param d_p1 Second share of the CRT exponent d_p.
+ * @param d_q0 First share of the CRT exponent d_q.
+ * @param d_q1 Second share of the CRT exponent d_q.
+ * @param i_q CRT coefficient q^-1 mod p.
+ * @return Status of the operation (OK or error).
+ */
+static status_t rsa_modexp_crt_start(uint32_t mode, size_t num_words,
+                                     const uint32_t *base, const uint32_t *p,
+                                     const uint32_t *q, const uint32_t *d_p0,
+                                     const uint32_t *d_p1, const uint32_t *d_q0,
+                                     const uint32_t *d_q1,
+                                     const uint32_t *i_q) {
+  size_t half_words = num_words / 2;
+
+  // Load the OTBN app. Fails if OTBN is not idle.
+  HARDENED_TRY(otbn_load_app(kOtbnAppRsa));
+
+  // Set mode.
+  HARDENED_TRY(otbn_dmem_write(1, &mode, kOtbnVarRsaMode));
+
+  // Set the base, in two halves.
+  HARDENED_TRY(otbn_dmem_write(half_words, base, kOtbnVarRsaCrtCLo));
+  HARDENED_TRY(
+      otbn_dmem_write(half_words, &base[half_words], kOtbnVarRsaCrtCHi));
+
+  // Set the primes, the CRT exponents and the CRT coefficient.
+  HARDENED_TRY(otbn_dmem_write(half_words, p, kOtbnVarRsaCrtP));
+  HARDENED_TRY(otbn_dmem_write(half_words, q, kOtbnVarRsaCrtQ));
+  HARDENED_TRY(otbn_dmem_write(half_words, d_p0, kOtbnVarRsaCrtDp0));
+  HARDENED_TRY(otbn_dmem_write(half_words, d_p1, kOtbnVarRsaCrtDp1));
+  HARDENED_TRY(otbn_dmem_write(half_words, d_q0, kOtbnVarRsaCrtDq0));
+  HARDENED_TRY(otbn_dmem_write(half_words, d_q1, kOtbnVarRsaCrtDq1));
+  HARDENED_TRY(otbn_dmem_write(half_words, i_q, kOtbnVarRsaCrtIq));
+
+  // Start OTBN.
+  return otbn_execute();
+}
+
 status_t rsa_modexp_consttime_2048_start(const rsa_2048_int_t *base,
                                          const rsa_2048_int_t *exp0,
                                          const rsa_2048_int_t *exp1,
@@ -160,6 +250,14 @@ status_t rsa_modexp_vartime_2048_start(const rsa_2048_int_t *base,
   return otbn_execute();
 }
 
+status_t rsa_modexp_crt_2048_start(const rsa_2048_int_t *base,
+                                   const rsa_2048_crt_private_key_t *key) {
+  return rsa_modexp_crt_start(kMode2048ModexpCrt, kRsa2048NumWords, base->data,
+                              key->p.data, key->q.data, key->d_p0.data,
+                              key->d_p1.data, key->d_q0.data, key->d_q1.data,
+                              key->i_q.data);
+}
+
 status_t rsa_modexp_2048_finalize(rsa_2048_int_t *result) {
   return rsa_modexp_finalize(kRsa2048NumWords, result->data);
 }
@@ -202,6 +300,14 @@ status_t rsa_modexp_vartime_3072_start(const rsa_3072_int_t *base,
   return otbn_execute();
 }
 
+status_t rsa_modexp_crt_3072_start(const rsa_3072_int_t *base,
+                                   const rsa_3072_crt_private_key_t *key) {
+  return rsa_modexp_crt_start(kMode3072ModexpCrt, kRsa3072NumWords, base->data,
+                              key->p.data, key->q.data, key->d_p0.data,
+                              key->d_p1.data, key->d_q0.data, key->d_q1.data,
+                              key->i_q.data);
+}
+
 status_t rsa_modexp_3072_finalize(rsa_3072_int_t *result) {
   return rsa_modexp_finalize(kRsa3072NumWords, result->data);
 }
@@ -244,6 +350,14 @@ status_t rsa_modexp_vartime_4096_start(const rsa_4096_int_t *base,
   return otbn_execute();
 }
 
+status_t rsa_modexp_crt_4096_start(const rsa_4096_int_t *base,
+                                   const rsa_4096_crt_private_key_t *key) {
+  return rsa_modexp_crt_start(kMode4096ModexpCrt, kRsa4096NumWords, base->data,
+                              key->p.data, key->q.data, key->d_p0.data,
+                              key->d_p1.data, key->d_q0.data, key->d_q1.data,
+                              key->i_q.data);
+}
+
 status_t rsa_modexp_4096_finalize(rsa_4096_int_t *result) {
   return rsa_modexp_finalize(kRsa4096NumWords, result->data);
 }
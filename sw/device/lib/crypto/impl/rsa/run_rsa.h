@@ -64,12 +64,31 @@ status_t rsa_modexp_consttime_2048_start(const rsa_2048_int_t *base,
 status_t rsa_modexp_vartime_2048_start(const rsa_2048_int_t *base,
                                        const rsa_2048_int_t *modulus);
 
+/**
+ * Start a constant-time RSA-2048 modular exponentiation using the CRT.
+ *
+ * Computes the same result as `rsa_modexp_consttime_2048_start()` with the
+ * private exponent d, but runs two half-size exponentiations modulo p and q,
+ * which is about four times faster. OTBN checks the result with the public
+ * exponent 65537 before returning it, so the key must use that exponent and
+ * the base must be less than the modulus.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param base Exponentiation base.
+ * @param key Private key in CRT form.
+ * @return Status of the operation (OK or error).
+ */
+status_t rsa_modexp_crt_2048_start(const rsa_2048_int_t *base,
+                                   const rsa_2048_crt_private_key_t *key);
+
 /**
  * Waits for an RSA-2048 modular exponentiation to complete.
  *
- * Can be used after either:
+ * Can be used after any of:
  * - `rsa_modexp_consttime_2048_start()`
  * - `rsa_modexp_vartime_2048_start()`
+ * - `rsa_modexp_crt_2048_start()`
  *
  * @param[out] result Exponentiation result = (base ^ exp) mod modulus.
  * @return Status of the operation (OK or error).
@@ -110,12 +129,31 @@ status_t rsa_modexp_consttime_3072_start(const rsa_3072_int_t *base,
 status_t rsa_modexp_vartime_3072_start(const rsa_3072_int_t *base,
                                        const rsa_3072_int_t *modulus);
 
+/**
+ * Start a constant-time RSA-3072 modular exponentiation using the CRT.
+ *
+ * Computes the same result as `rsa_modexp_consttime_3072_start()` with the
+ * private exponent d, but runs two half-size exponentiations modulo p and q,
+ * which is about four times faster. OTBN checks the result with the public
+ * exponent 65537 before returning it, so the key must use that exponent and
+ * the base must be less than the modulus.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param base Exponentiation base.
+ * @param key Private key in CRT form.
+ * @return Status of the operation (OK or error).
+ */
+status_t rsa_modexp_crt_3072_start(const rsa_3072_int_t *base,
+                                   const rsa_3072_crt_private_key_t *key);
+
 /**
  * Waits for an RSA-3072 modular exponentiation to complete.
  *
- * Can be used after either:
+ * Can be used after any of:
  * - `rsa_modexp_consttime_3072_start()`
  * - `rsa_modexp_vartime_3072_start()`
+ * - `rsa_modexp_crt_3072_start()`
  *
  * @param[out] result Exponentiation result = (base ^ exp) mod modulus.
  * @return Status of the operation (OK or error).
@@ -156,12 +194,31 @@ status_t rsa_modexp_consttime_4096_start(const rsa_4096_int_t *base,
 status_t rsa_modexp_vartime_4096_start(const rsa_4096_int_t *base,
                                        const rsa_4096_int_t *modulus);
 
+/**
+ * Start a constant-time RSA-4096 modular exponentiation using the CRT.
+ *
+ * Computes the same result as `rsa_modexp_consttime_4096_start()` with the
+ * private exponent d, but runs two half-size exponentiations modulo p and q,
+ * which is about four times faster. OTBN checks the result with the public
+ * exponent 65537 before returning it, so the key must use that exponent and
+ * the base must be less than the modulus.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param base Exponentiation base.
+ * @param key Private key in CRT form.
+ * @return Status of the operation (OK or error).
+ */
+status_t rsa_modexp_crt_4096_start(const rsa_4096_int_t *base,
+                                   const rsa_4096_crt_private_key_t *key);
+
 /**
  * Waits for an RSA-4096 modular exponentiation to complete.
  *
- * Can be used after either:
+ * Can be used after any of:
  * - `rsa_modexp_consttime_4096_start()`
  * - `rsa_modexp_vartime_4096_start()`
+ * - `rsa_modexp_crt_4096_start()`
  *
  * @param[out] result Exponentiation result = (base ^ exp) mod modulus.
  * @return Status of the operation (OK or error).
@@ -8,6 +8,7 @@
 #include "sw/device/lib/base/hardened_memory.h"
 #include "sw/device/lib/base/macros.h"
 #include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
 #include "sw/device/lib/crypto/drivers/otbn.h"
 #include "sw/device/lib/crypto/drivers/rv_core_ibex.h"
 #include "sw/device/lib/crypto/impl/status.h"
@@ -23,7 +24,22 @@ enum {
    * itself; see `run_sha256.s` for the detailed calculation.
    */
   kSha256MaxMessageChunksPerOtbnRun = 41,
+  /**
+   * Number of message blocks staged in Ibex memory for a single OTBN run.
+   *
+   * OTBN locks DMEM while it runs, so blocks for the next run are collected
+   * here, and their DMEM write is prepared, while OTBN compresses the current
+   * run. The overlap per block is the same for any run length; longer runs
+   * only amortize the fixed cost of a run (about 170 cycles in the OTBN
+   * simulator, against about 3400 cycles per block) over more blocks. With
+   * 8-block runs, OTBN takes 0.5% more cycles per block than with full
+   * 41-block runs.
+   */
+  kSha256StagedBlocksPerOtbnRun = 8,
 };
+static_assert(
+    kSha256StagedBlocksPerOtbnRun <= kSha256MaxMessageChunksPerOtbnRun,
+    "Staged blocks must fit in the OTBN message buffer.");
 
 /**
  * A type to hold message blocks.
@@ -37,9 +53,17 @@ typedef struct sha256_message_block {
  */
 typedef struct sha256_otbn_ctx {
   /**
-   * Number of message blocks currently loaded.
+   * Message blocks staged for the next OTBN run.
+   */
+  sha256_message_block_t staged[kSha256StagedBlocksPerOtbnRun];
+  /**
+   * Number of message blocks currently staged.
    */
   size_t num_blocks;
+  /**
+   * Whether OTBN may still be processing the previous run.
+   */
+  hardened_bool_t running;
 } sha256_otbn_ctx_t;
 
 // Initial state for SHA-256 (see FIPS 180-4, section 5.3.3). The SHA-256 OTBN
@@ -73,59 +97,117 @@ status_t sha256_init(sha256_state_t *state) {
   memset(state->partial_block, 0, kSha256MessageBlockBytes);
   // Set the message length so far to 0.
   state->total_len = 0ull;
+  // Updates wipe DMEM unless streaming is enabled.
+  state->streaming = kHardenedBoolFalse;
+  state->otbn_resident = kHardenedBoolFalse;
+  state->otbn_token = 0;
+
+  return OTCRYPTO_OK;
+}
 
+status_t sha256_streaming_enable(sha256_state_t *state) {
+  state->streaming = kHardenedBoolTrue;
   return OTCRYPTO_OK;
 }
 
 /**
- * Run OTBN to process the data currently in DMEM.
+ * Wait for the OTBN run in progress, if any.
+ *
+ * @param ctx OTBN message buffer context information (updated in place).
+ * @return Result of the operation.
+ */
+static status_t wait_for_run(sha256_otbn_ctx_t *ctx) {
+  if (ctx->running == kHardenedBoolTrue) {
+    HARDENED_TRY_WIPE_DMEM(otbn_busy_wait_for_done());
+    ctx->running = kHardenedBoolFalse;
+  }
+  return OTCRYPTO_OK;
+}
+
+/**
+ * Start an OTBN run on the staged message blocks.
+ *
+ * Does not wait for the new run to finish; see `wait_for_run`.
  *
  * @param ctx OTBN message buffer context information (updated in place).
  * @return Result of the operation.
  */
 static status_t process_message_buffer(sha256_otbn_ctx_t *ctx) {
-  // Write the number of blocks to DMEM.
-  HARDENED_TRY(
+  // Prepare the DMEM write for the staged blocks. This does not access OTBN,
+  // so it overlaps with the previous run if there is one.
+  otbn_dmem_write_plan_t plan;
+  status_t prepared = otbn_dmem_write_prepare(
+      ctx->num_blocks * kSha256MessageBlockWords, ctx->staged[0].data,
+      kOtbnVarSha256Msg, &plan);
+
+  // The previous run must be done before DMEM can be written, or wiped if the
+  // preparation failed.
+  HARDENED_TRY(wait_for_run(ctx));
+  HARDENED_TRY_WIPE_DMEM(prepared);
+
+  // Write the staged blocks and the number of blocks to DMEM.
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_write_commit(&plan));
+  HARDENED_TRY_WIPE_DMEM(
       otbn_dmem_write(1, &ctx->num_blocks, kOtbnVarSha256NumMsgChunks));
 
   // Run the OTBN program.
-  HARDENED_TRY(otbn_execute());
-  HARDENED_TRY_WIPE_DMEM(otbn_busy_wait_for_done());
+  HARDENED_TRY_WIPE_DMEM(otbn_execute());
+  ctx->running = kHardenedBoolTrue;
 
-  // Reset the message buffer counter.
+  // The staged blocks are in DMEM now; reset the message buffer counter.
   ctx->num_blocks = 0;
   return OTCRYPTO_OK;
 }
 
 /**
- * Add a single message block to the processing buffer.
+ * Get the staging buffer slot for the next message block.
  *
- * Runs OTBN if the maximum number of message blocks has been reached.
+ * There is always a free slot, since a full staging buffer is processed right
+ * away.
+ *
+ * @param ctx OTBN message buffer context information.
+ * @return Byte pointer to the next slot.
+ */
+static unsigned char *block_staged(sha256_otbn_ctx_t *ctx) {
+  return (unsigned char *)ctx->staged[ctx->num_blocks].data;
+}
+
+/**
+ * Add the message block in the next staging buffer slot to the processing
+ * buffer.
+ *
+ * Starts an OTBN run if the staging buffer is full.
  *
  * @param ctx OTBN message buffer context information (updated in place).
- * @param block Block to write.
  * @return Result of the operation.
  */
-static status_t process_block(sha256_otbn_ctx_t *ctx,
-                              const sha256_message_block_t *block) {
-  // Calculate the offset within the message buffer.
-  size_t offset = ctx->num_blocks * kSha256MessageBlockBytes;
-  otbn_addr_t dst = kOtbnVarSha256Msg + offset;
-
-  // Copy the message block into DMEM.
-  otbn_dmem_write(kSha256MessageBlockWords, block->data, dst);
+static status_t process_staged_block(sha256_otbn_ctx_t *ctx) {
   ctx->num_blocks += 1;
 
-  // If we've reached the maximum number of message chunks for a single run,
-  // then run the OTBN program to update the state in-place. Note that there
-  // is no need to read back and then re-write the state; it'll stay updated
-  // in DMEM for the next run.
-  if (ctx->num_blocks == kSha256MaxMessageChunksPerOtbnRun) {
+  // If the staging buffer is full, then run the OTBN program to update the
+  // state in-place. Note that there is no need to read back and then re-write
+  // the state; it'll stay updated in DMEM for the next run.
+  if (ctx->num_blocks == kSha256StagedBlocksPerOtbnRun) {
     HARDENED_TRY(process_message_buffer(ctx));
   }
   return OTCRYPTO_OK;
 }
 
+/**
+ * Add a single message block to the processing buffer.
+ *
+ * Starts an OTBN run if the staging buffer is full.
+ *
+ * @param ctx OTBN message buffer context information (updated in place).
+ * @param block Block to write.
+ * @return Result of the operation.
+ */
+static status_t process_block(sha256_otbn_ctx_t *ctx,
+                              const sha256_message_block_t *block) {
+  memcpy(block_staged(ctx), block->data, kSha256MessageBlockBytes);
+  return process_staged_block(ctx);
+}
+
 /**
  * Pad the block as described in FIPS 180-4, section 5.1.1.
  *
@@ -176,21 +258,42 @@ static status_t process_padding(sha256_otbn_ctx_t *ctx,
   return process_block(ctx, block);
 }
 
+/**
+ * Check whether OTBN still holds the app and this context's state.
+ *
+ * True only if the previous update of a streaming context left its state in
+ * DMEM and nobody has claimed or wiped OTBN memory since.
+ *
+ * @param state Context object.
+ * @return Whether the app and state are resident.
+ */
+static hardened_bool_t state_is_resident(const sha256_state_t *state) {
+  if (launder32(state->otbn_resident) != kHardenedBoolTrue ||
+      launder32(otbn_dmem_claim_check(state->otbn_token)) !=
+          kHardenedBoolTrue) {
+    return kHardenedBoolFalse;
+  }
+  HARDENED_CHECK_EQ(state->otbn_resident, kHardenedBoolTrue);
+  return kHardenedBoolTrue;
+}
+
 /**
  * Update the hash state to include new data, optionally adding padding.
  *
+ * Message data is copied into the staging buffer of `ctx` but not wiped from
+ * it; see `process_message`.
+ *
  * @param state Context object.
+ * @param ctx OTBN message buffer context information (updated in place).
  * @param msg Input message.
  * @param msg_len Input message length in bytes.
  * @param padding_needed Whether to pad the message.
  * @return Result of the operation.
  */
-static status_t process_message(sha256_state_t *state, const uint8_t *msg,
-                                size_t msg_len,
-                                hardened_bool_t padding_needed) {
-  // Load the SHA-256 app. Fails if OTBN is non-idle.
-  HARDENED_TRY(otbn_load_app(kOtbnAppSha256));
-
+static status_t process_message_staged(sha256_state_t *state,
+                                       sha256_otbn_ctx_t *ctx,
+                                       const uint8_t *msg, size_t msg_len,
+                                       hardened_bool_t padding_needed) {
   // Check the message length. SHA-256 messages must be less than 2^64 bits
   // long in total.
   uint64_t msg_bits = ((uint64_t)msg_len) << 3;
@@ -204,55 +307,72 @@ static status_t process_message(sha256_state_t *state, const uint8_t *msg,
   sha256_state_t new_state;
   new_state.total_len = state->total_len + msg_bits;
 
-  // Set the initial state if at least one block has been received before now.
-  if (state->total_len >= kSha256MessageBlockBytes) {
-    HARDENED_TRY(
-        otbn_dmem_write(kSha256StateWords, state->H, kOtbnVarSha256State));
+  // In streaming mode, the app and the current state may still be in OTBN
+  // from the previous update; claiming DMEM again makes sure that no copy of
+  // this context takes the same shortcut. Otherwise, load the SHA-256 app
+  // (fails if OTBN is non-idle) and set the initial state if at least one
+  // block has been received before now.
+  hardened_bool_t resident = state_is_resident(state);
+  state->otbn_resident = kHardenedBoolFalse;
+  if (launder32(resident) == kHardenedBoolTrue) {
+    otbn_dmem_claim();
+  } else {
+    HARDENED_TRY(otbn_load_app(kOtbnAppSha256));
+    if (state->total_len >= kSha256MessageBlockBytes) {
+      HARDENED_TRY(
+          otbn_dmem_write(kSha256StateWords, state->H, kOtbnVarSha256State));
+    }
   }
 
-  // Start computing the first block for the hash computation by simply copying
-  // the partial block. We won't use the partial block directly to avoid
-  // contaminating the context object if this operation fails later.
-  sha256_message_block_t block;
-  size_t partial_block_len = (state->total_len >> 3) % kSha256MessageBlockBytes;
-  memcpy(block.data, state->partial_block, partial_block_len);
-
-  // Initialize the context for the OTBN message buffer.
-  sha256_otbn_ctx_t ctx = {.num_blocks = 0};
-
   // Process the message one block at a time, including partial data if it is
-  // present (which is only possible on the first iteration).
+  // present (which is only possible on the first iteration). Full blocks are
+  // copied straight into the staging buffer. We won't use the partial block
+  // in the context object directly to avoid contaminating it if this
+  // operation fails later.
+  size_t partial_block_len = (state->total_len >> 3) % kSha256MessageBlockBytes;
   while (msg_len >= kSha256MessageBlockBytes - partial_block_len) {
     size_t available_len = kSha256MessageBlockBytes - partial_block_len;
-    memcpy((unsigned char *)block.data + partial_block_len, msg, available_len);
+    unsigned char *staged = block_staged(ctx);
+    memcpy(staged, state->partial_block, partial_block_len);
+    memcpy(staged + partial_block_len, msg, available_len);
     msg += available_len;
     msg_len -= available_len;
-    HARDENED_TRY(process_block(&ctx, &block));
+    HARDENED_TRY(process_staged_block(ctx));
     partial_block_len = 0;
   }
 
-  // Copy remaining mesage data into the working block (after partial data, if
-  // it is present). Because of the loop condition above, this must not be a
-  // full block.
+  // Copy the partial data, if it is still present, and the remaining message
+  // data into the working block. Because of the loop condition above, this
+  // must not be a full block.
+  sha256_message_block_t block;
+  memcpy(block.data, state->partial_block, partial_block_len);
   memcpy((unsigned char *)block.data + partial_block_len, msg, msg_len);
 
   // Add padding if necessary.
   if (padding_needed == kHardenedBoolTrue) {
-    HARDENED_TRY(process_padding(&ctx, new_state.total_len, &block));
+    HARDENED_TRY(process_padding(ctx, new_state.total_len, &block));
   }
 
-  // If there are any unprocessed blocks currently in DMEM, run the program one
-  // final time.
-  if (ctx.num_blocks > 0) {
-    HARDENED_TRY(process_message_buffer(&ctx));
+  // If there are any unprocessed blocks currently staged, run the program one
+  // final time, and wait for the last run to finish.
+  if (ctx->num_blocks > 0) {
+    HARDENED_TRY(process_message_buffer(ctx));
   }
+  HARDENED_TRY(wait_for_run(ctx));
 
   // Read the final state from OTBN dmem.
   HARDENED_TRY_WIPE_DMEM(
       otbn_dmem_read(kSha256StateWords, kOtbnVarSha256State, new_state.H));
 
-  // Clear OTBN's memory.
-  HARDENED_TRY(otbn_dmem_sec_wipe());
+  // Clear OTBN's memory, unless a streaming update leaves the state there for
+  // the next update.
+  hardened_bool_t keep_resident = kHardenedBoolFalse;
+  if (state->streaming == kHardenedBoolTrue &&
+      padding_needed != kHardenedBoolTrue) {
+    keep_resident = kHardenedBoolTrue;
+  } else {
+    HARDENED_TRY(otbn_dmem_sec_wipe());
+  }
 
   // At this point, no more errors are possible; it is safe to update the
   // context object.
@@ -260,11 +380,47 @@ static status_t process_message(sha256_state_t *state, const uint8_t *msg,
   HARDENED_TRY(hardened_memcpy(state->partial_block, block.data,
                                kSha256MessageBlockWords));
   state->total_len = new_state.total_len;
+  if (keep_resident == kHardenedBoolTrue) {
+    state->otbn_resident = kHardenedBoolTrue;
+    state->otbn_token = otbn_dmem_claim();
+  }
   return OTCRYPTO_OK;
 }
 
+/**
+ * Update the hash state to include new data, optionally adding padding.
+ *
+ * Wipes the message data from the staging buffer afterwards, whether or not
+ * the update succeeds. The entropy complex must be initialized before calling
+ * this function.
+ *
+ * @param state Context object.
+ * @param msg Input message.
+ * @param msg_len Input message length in bytes.
+ * @param padding_needed Whether to pad the message.
+ * @return Result of the operation.
+ */
+static status_t process_message(sha256_state_t *state, const uint8_t *msg,
+                                size_t msg_len,
+                                hardened_bool_t padding_needed) {
+  // Initialize the context for the OTBN message buffer.
+  sha256_otbn_ctx_t ctx;
+  ctx.num_blocks = 0;
+  ctx.running = kHardenedBoolFalse;
+
+  status_t result =
+      process_message_staged(state, &ctx, msg, msg_len, padding_needed);
+  HARDENED_TRY(hardened_memshred(ctx.staged[0].data,
+                                 kSha256StagedBlocksPerOtbnRun *
+                                     kSha256MessageBlockWords));
+  return result;
+}
+
 status_t sha256_update(sha256_state_t *state, const uint8_t *msg,
                        const size_t msg_len) {
+  // Entropy complex needs to be initialized for `hardened_memshred`.
+  HARDENED_TRY(entropy_complex_check());
+
   // Process new data with no padding.
   return process_message(state, msg, msg_len, kHardenedBoolFalse);
 }
@@ -282,6 +438,7 @@ static status_t state_shred(sha256_state_t *state) {
   HARDENED_TRY(
       hardened_memshred(state->partial_block, kSha256MessageBlockWords));
   state->total_len = 0;
+  state->otbn_resident = kHardenedBoolFalse;
 
   return OTCRYPTO_OK;
 }
@@ -77,6 +77,20 @@ typedef struct sha256_state {
    * Total message length so far, in bits.
    */
   uint64_t total_len;
+  /**
+   * Whether updates may leave the hash state in OTBN DMEM; see
+   * `sha256_streaming_enable()`.
+   */
+  hardened_bool_t streaming;
+  /**
+   * Whether the last update left this context's hash state in OTBN DMEM.
+   */
+  hardened_bool_t otbn_resident;
+  /**
+   * OTBN DMEM claim token from the last update (see `otbn_dmem_claim()`); only
+   * meaningful if `otbn_resident` is true.
+   */
+  uint32_t otbn_token;
 } sha256_state_t;
 
 /**
@@ -107,6 +121,23 @@ status_t sha256(const uint8_t *msg, const size_t msg_len, uint32_t *digest);
  */
 status_t sha256_init(sha256_state_t *state);
 
+/**
+ * Put a SHA-256 hash computation into streaming mode.
+ *
+ * Must be called after `sha256_init()` and before the first update. In
+ * streaming mode, `sha256_update()` leaves the app, hash state and message
+ * buffer in OTBN instead of wiping DMEM, so that the next update on the same
+ * context can skip reloading them. If another OTBN user, or a copy of this
+ * context, runs in between, the next update notices and reloads. DMEM is wiped
+ * by `sha256_final()`, or by the next OTBN user to load an app.
+ *
+ * Only use streaming mode if the message is not secret.
+ *
+ * @param state Hash context object; updated in-place.
+ * @return Result of the operation (OK or error).
+ */
+status_t sha256_streaming_enable(sha256_state_t *state);
+
 /**
  * Process new message data for a SHA-256 hash computation.
  *
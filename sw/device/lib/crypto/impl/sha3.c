@@ -13,6 +13,25 @@
 // Module ID for status codes.
 #define MODULE_ID MAKE_MODULE_ID('s', 'h', '3')
 
+/**
+ * Internal context for a streaming SHA3/SHAKE/cSHAKE operation.
+ */
+typedef struct sha3_context {
+  /**
+   * Hash mode of the operation.
+   */
+  otcrypto_hash_mode_t mode;
+  /**
+   * State of the operation in the KMAC driver.
+   */
+  kmac_stream_t stream;
+} sha3_context_t;
+
+// Ensure that the hash context is large enough for the internal context.
+static_assert(sizeof(otcrypto_sha3_context_t) >= sizeof(sha3_context_t),
+              "`otcrypto_sha3_context_t` must be at least as large as "
+              "`sha3_context_t`.");
+
 otcrypto_status_t otcrypto_sha3_224(otcrypto_const_byte_buf_t message,
                                     otcrypto_hash_digest_t *digest) {
   if (launder32(digest->len) != kKmacSha3224DigestWords) {
@@ -98,3 +117,187 @@ otcrypto_status_t otcrypto_cshake256(
                          function_name_string.len, customization_string.data,
                          customization_string.len, digest->data, digest->len);
 }
+
+otcrypto_status_t otcrypto_sha3_init(otcrypto_hash_mode_t hash_mode,
+                                     otcrypto_sha3_context_t *ctx) {
+  if (ctx == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  kmac_stream_mode_t stream_mode;
+  otcrypto_hash_mode_t hash_mode_used = launder32(0);
+  switch (launder32(hash_mode)) {
+    case kOtcryptoHashModeSha3_224:
+      stream_mode = kKmacStreamModeSha3_224;
+      hash_mode_used = launder32(hash_mode_used) | kOtcryptoHashModeSha3_224;
+      break;
+    case kOtcryptoHashModeSha3_256:
+      stream_mode = kKmacStreamModeSha3_256;
+      hash_mode_used = launder32(hash_mode_used) | kOtcryptoHashModeSha3_256;
+      break;
+    case kOtcryptoHashModeSha3_384:
+      stream_mode = kKmacStreamModeSha3_384;
+      hash_mode_used = launder32(hash_mode_used) | kOtcryptoHashModeSha3_384;
+      break;
+    case kOtcryptoHashModeSha3_512:
+      stream_mode = kKmacStreamModeSha3_512;
+      hash_mode_used = launder32(hash_mode_used) | kOtcryptoHashModeSha3_512;
+      break;
+    case kOtcryptoHashXofModeShake128:
+      stream_mode = kKmacStreamModeShake128;
+      hash_mode_used =
+          launder32(hash_mode_used) | kOtcryptoHashXofModeShake128;
+      break;
+    case kOtcryptoHashXofModeShake256:
+      stream_mode = kKmacStreamModeShake256;
+      hash_mode_used =
+          launder32(hash_mode_used) | kOtcryptoHashXofModeShake256;
+      break;
+    default:
+      // Unrecognized or unsupported hash mode.
+      return OTCRYPTO_BAD_ARGS;
+  }
+  // Check if we landed in the correct case statement. Use ORs for this to
+  // avoid that multiple cases were executed.
+  HARDENED_CHECK_EQ(launder32(hash_mode_used), hash_mode);
+
+  sha3_context_t *sha3_ctx = (sha3_context_t *)ctx->data;
+  sha3_ctx->mode = hash_mode;
+  return kmac_stream_start(stream_mode, /*key=*/NULL, /*func_name=*/NULL, 0,
+                           /*cust_str=*/NULL, 0, &sha3_ctx->stream);
+}
+
+otcrypto_status_t otcrypto_cshake_init(
+    otcrypto_hash_mode_t hash_mode,
+    otcrypto_const_byte_buf_t function_name_string,
+    otcrypto_const_byte_buf_t customization_string,
+    otcrypto_sha3_context_t *ctx) {
+  if (ctx == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  if (function_name_string.data == NULL && function_name_string.len != 0) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  if (customization_string.data == NULL && customization_string.len != 0) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  kmac_stream_mode_t stream_mode;
+  otcrypto_hash_mode_t hash_mode_used = launder32(0);
+  switch (launder32(hash_mode)) {
+    case kOtcryptoHashXofModeCshake128:
+      stream_mode = kKmacStreamModeCshake128;
+      hash_mode_used =
+          launder32(hash_mode_used) | kOtcryptoHashXofModeCshake128;
+      break;
+    case kOtcryptoHashXofModeCshake256:
+      stream_mode = kKmacStreamModeCshake256;
+      hash_mode_used =
+          launder32(hash_mode_used) | kOtcryptoHashXofModeCshake256;
+      break;
+    default:
+      // Unrecognized or unsupported hash mode.
+      return OTCRYPTO_BAD_ARGS;
+  }
+  // Check if we landed in the correct case statement. Use ORs for this to
+  // avoid that multiple cases were executed.
+  HARDENED_CHECK_EQ(launder32(hash_mode_used), hash_mode);
+
+  sha3_context_t *sha3_ctx = (sha3_context_t *)ctx->data;
+  sha3_ctx->mode = hash_mode;
+  return kmac_stream_start(
+      stream_mode, /*key=*/NULL, function_name_string.data,
+      function_name_string.len, customization_string.data,
+      customization_string.len, &sha3_ctx->stream);
+}
+
+otcrypto_status_t otcrypto_sha3_update(otcrypto_sha3_context_t *ctx,
+                                       otcrypto_const_byte_buf_t message) {
+  if (ctx == NULL || (message.data == NULL && message.len != 0)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  sha3_context_t *sha3_ctx = (sha3_context_t *)ctx->data;
+  return kmac_stream_absorb(&sha3_ctx->stream, message.data, message.len);
+}
+
+/**
+ * Get the fixed digest length for a SHA3 mode.
+ *
+ * @param mode Hash mode.
+ * @param[out] digest_len Digest length in words, or 0 for XOF modes.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t sha3_digest_len(otcrypto_hash_mode_t mode,
+                                size_t *digest_len) {
+  switch (launder32(mode)) {
+    case kOtcryptoHashModeSha3_224:
+      *digest_len = kKmacSha3224DigestWords;
+      return OTCRYPTO_OK;
+    case kOtcryptoHashModeSha3_256:
+      *digest_len = kKmacSha3256DigestWords;
+      return OTCRYPTO_OK;
+    case kOtcryptoHashModeSha3_384:
+      *digest_len = kKmacSha3384DigestWords;
+      return OTCRYPTO_OK;
+    case kOtcryptoHashModeSha3_512:
+      *digest_len = kKmacSha3512DigestWords;
+      return OTCRYPTO_OK;
+    case kOtcryptoHashXofModeShake128:
+    case kOtcryptoHashXofModeShake256:
+    case kOtcryptoHashXofModeCshake128:
+    case kOtcryptoHashXofModeCshake256:
+      *digest_len = 0;
+      return OTCRYPTO_OK;
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+}
+
+otcrypto_status_t otcrypto_shake_squeeze(otcrypto_sha3_context_t *ctx,
+                                         otcrypto_hash_digest_t *digest) {
+  if (ctx == NULL || digest == NULL ||
+      (digest->data == NULL && digest->len != 0)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  sha3_context_t *sha3_ctx = (sha3_context_t *)ctx->data;
+  size_t fixed_len;
+  HARDENED_TRY(sha3_digest_len(sha3_ctx->mode, &fixed_len));
+  if (fixed_len != 0) {
+    // SHA3 modes have a fixed-length digest; use `otcrypto_sha3_final`.
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  if (sha3_ctx->stream.squeezing != kHardenedBoolTrue) {
+    HARDENED_TRY(kmac_stream_process(&sha3_ctx->stream, /*digest_len=*/0));
+  }
+  digest->mode = sha3_ctx->mode;
+  return kmac_stream_squeeze(&sha3_ctx->stream, digest->data, digest->len);
+}
+
+otcrypto_status_t otcrypto_sha3_final(otcrypto_sha3_context_t *ctx,
+                                      otcrypto_hash_digest_t *digest) {
+  if (ctx == NULL || digest == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  sha3_context_t *sha3_ctx = (sha3_context_t *)ctx->data;
+  size_t fixed_len;
+  HARDENED_TRY(sha3_digest_len(sha3_ctx->mode, &fixed_len));
+  if ((fixed_len != 0 && launder32(digest->len) != fixed_len) ||
+      (digest->data == NULL && digest->len != 0)) {
+    // Release the KMAC block anyway so that it does not stay held.
+    HARDENED_TRY(kmac_stream_end(&sha3_ctx->stream));
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  if (sha3_ctx->stream.squeezing != kHardenedBoolTrue) {
+    HARDENED_TRY(kmac_stream_process(&sha3_ctx->stream, /*digest_len=*/0));
+  }
+  digest->mode = sha3_ctx->mode;
+  HARDENED_TRY(
+      kmac_stream_squeeze(&sha3_ctx->stream, digest->data, digest->len));
+  return kmac_stream_end(&sha3_ctx->stream);
+}
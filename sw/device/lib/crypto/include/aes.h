@@ -60,6 +60,15 @@ typedef enum otcrypto_aes_padding {
   kOtcryptoAesPaddingNull = 0x8ce,
 } otcrypto_aes_padding_t;
 
+/**
+ * Context for a streaming AES operation.
+ *
+ * Representation is internal to the AES implementation and subject to change.
+ */
+typedef struct otcrypto_aes_context {
+  uint32_t data[18];
+} otcrypto_aes_context_t;
+
 /**
  * Get the number of blocks needed for the plaintext length and padding mode.
  *
@@ -110,6 +119,85 @@ otcrypto_status_t otcrypto_aes(otcrypto_blinded_key_t *key,
                                otcrypto_aes_padding_t aes_padding,
                                otcrypto_byte_buf_t cipher_output);
 
+/**
+ * Initializes a streaming AES operation.
+ *
+ * The order of operations is:
+ *   - `otcrypto_aes_init()` called once
+ *   - `otcrypto_aes_update()` called zero or more times
+ *   - `otcrypto_aes_final()` called once
+ *
+ * Together, these produce the same output as a single call to
+ * `otcrypto_aes()` over the concatenation of all input, but only ever hold at
+ * most one partial block of input in the context. As with `otcrypto_aes()`,
+ * the padding mode is ignored during decryption and the total ciphertext
+ * length must be a multiple of the AES block size.
+ *
+ * The resulting context holds a pointer to the blinded key. It is important
+ * that the blinded key remains live as long as `ctx` is. The IV is safe to
+ * free.
+ *
+ * @param key Pointer to the blinded key struct with key shares.
+ * @param iv Initialization vector, used for CBC, CFB, OFB, CTR modes. May be
+ *           NULL if mode is ECB.
+ * @param aes_mode Required AES mode of operation.
+ * @param aes_operation Required AES operation (encrypt or decrypt).
+ * @param aes_padding Padding scheme to be used for the data.
+ * @param[out] ctx Context object for the operation.
+ * @return Result of the initialization operation.
+ */
+otcrypto_status_t otcrypto_aes_init(otcrypto_blinded_key_t *key,
+                                    otcrypto_const_word32_buf_t iv,
+                                    otcrypto_aes_mode_t aes_mode,
+                                    otcrypto_aes_operation_t aes_operation,
+                                    otcrypto_aes_padding_t aes_padding,
+                                    otcrypto_aes_context_t *ctx);
+
+/**
+ * Updates a streaming AES operation with more input.
+ *
+ * Call `otcrypto_aes_init()` first.
+ *
+ * The caller should allocate space for the output and set the `len` field
+ * accordingly. Only full blocks are ciphered; any trailing partial block is
+ * kept in the context until more input arrives. The output must be long
+ * enough to hold all full blocks of input received so far minus all output
+ * produced so far; rounding the input length up to the next block boundary is
+ * always enough. Returns an error if `output` is not long enough; if `output`
+ * is overly long, only the first `output_bytes_written` bytes will be used.
+ *
+ * @param ctx Context object for the operation, updated in place.
+ * @param cipher_input Input data to be ciphered.
+ * @param[out] cipher_output Output data after cipher operation.
+ * @param[out] output_bytes_written Number of bytes written to `cipher_output`.
+ * @return Result of the update operation.
+ */
+otcrypto_status_t otcrypto_aes_update(otcrypto_aes_context_t *ctx,
+                                      otcrypto_const_byte_buf_t cipher_input,
+                                      otcrypto_byte_buf_t cipher_output,
+                                      size_t *output_bytes_written);
+
+/**
+ * Finishes a streaming AES operation.
+ *
+ * For encryption, pads the remaining partial block (if the padding mode is
+ * not `kOtcryptoAesPaddingNull`) and ciphers it, so `output_bytes_written` is
+ * either 16 or 0. Returns an error if the padding mode is
+ * `kOtcryptoAesPaddingNull` and the total input was not a multiple of the
+ * block size. For decryption, no output is produced and an error is returned
+ * if the total ciphertext was not a multiple of the block size.
+ *
+ * The context is cleared on return and must not be used again.
+ *
+ * @param ctx Context object for the operation.
+ * @param[out] cipher_output Output data after cipher operation.
+ * @param[out] output_bytes_written Number of bytes written to `cipher_output`.
+ * @return Result of the final operation.
+ */
+otcrypto_status_t otcrypto_aes_final(otcrypto_aes_context_t *ctx,
+                                     otcrypto_byte_buf_t cipher_output,
+                                     size_t *output_bytes_written);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -18,6 +18,33 @@
 extern "C" {
 #endif  // __cplusplus
 
+enum {
+  /**
+   * Maximum number of signatures in one ECDSA/P-384 batch verification.
+   */
+  kOtcryptoEcdsaP384VerifyBatchMaxItems = 3,
+};
+
+/**
+ * One signature in an ECDSA/P-384 batch verification.
+ *
+ * See `otcrypto_ecdsa_p384_verify` for requirements on the fields.
+ */
+typedef struct otcrypto_ecdsa_p384_verify_item {
+  /**
+   * Pointer to the unblinded public key (Q) struct.
+   */
+  const otcrypto_unblinded_key_t *public_key;
+  /**
+   * Message digest to be verified (pre-hashed).
+   */
+  otcrypto_hash_digest_t message_digest;
+  /**
+   * Signature to be verified.
+   */
+  otcrypto_const_word32_buf_t signature;
+} otcrypto_ecdsa_p384_verify_item_t;
+
 /**
  * Generates a key pair for ECDSA with curve P-384.
  *
@@ -106,6 +133,33 @@ otcrypto_status_t otcrypto_ecdsa_p384_verify(
     otcrypto_const_word32_buf_t signature,
     hardened_bool_t *verification_result);
 
+/**
+ * Verifies a batch of ECDSA signatures with curve P-384.
+ *
+ * Equivalent to calling `otcrypto_ecdsa_p384_verify` on each item, but loads
+ * the OTBN program and checks the entropy complex once for the whole batch.
+ * The items may use different public keys.
+ *
+ * The caller must check each entry of `verification_results`, NOT only the
+ * returned status code, to know which signatures passed verification. Unlike
+ * `otcrypto_ecdsa_p384_verify`, a signature or public key that fails the basic
+ * validity checks (e.g. a point not on the curve, or r = 0) does not produce
+ * an error; it only produces a `kHardenedBoolFalse` result for that item, so
+ * that one bad item does not fail the rest of the batch. Malformed arguments
+ * (wrong lengths, key modes or key checksums) still fail the whole call.
+ *
+ * @param items Signatures to verify.
+ * @param num_items Number of items, 1 to
+ * `kOtcryptoEcdsaP384VerifyBatchMaxItems`.
+ * @param[out] verification_results Whether each signature passed
+ * verification (`num_items` entries).
+ * @return Result of the ECDSA batch verification operation.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_ecdsa_p384_verify_batch(
+    const otcrypto_ecdsa_p384_verify_item_t *items, size_t num_items,
+    hardened_bool_t *verification_results);
+
 /**
  * Generates a key pair for ECDH with curve P-384.
  *
@@ -231,6 +285,41 @@ otcrypto_status_t otcrypto_ecdsa_p384_verify_async_finalize(
     otcrypto_const_word32_buf_t signature,
     hardened_bool_t *verification_result);
 
+/**
+ * Starts asynchronous batch signature verification for ECDSA/P-384.
+ *
+ * See `otcrypto_ecdsa_p384_verify_batch` for requirements on input values.
+ *
+ * @param items Signatures to verify.
+ * @param num_items Number of items.
+ * @return Result of async ECDSA batch verify start function.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_ecdsa_p384_verify_batch_async_start(
+    const otcrypto_ecdsa_p384_verify_item_t *items, size_t num_items);
+
+/**
+ * Finalizes asynchronous batch signature verification for ECDSA/P-384.
+ *
+ * See `otcrypto_ecdsa_p384_verify_batch` for requirements on input values.
+ *
+ * May block until the operation is complete. The items must be the same as
+ * for the start call.
+ *
+ * The caller must check each entry of `verification_results`, NOT only the
+ * returned status code, to know which signatures passed verification.
+ *
+ * @param items Signatures to verify.
+ * @param num_items Number of items.
+ * @param[out] verification_results Whether each signature passed
+ * verification (`num_items` entries).
+ * @return Result of async ECDSA batch verify finalize operation.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_ecdsa_p384_verify_batch_async_finalize(
+    const otcrypto_ecdsa_p384_verify_item_t *items, size_t num_items,
+    hardened_bool_t *verification_results);
+
 /**
  * Starts asynchronous key generation for ECDH/P-384.
  *
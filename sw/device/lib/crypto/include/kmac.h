@@ -18,6 +18,24 @@
 extern "C" {
 #endif  // __cplusplus
 
+enum {
+  /**
+   * The size of the publicly exposed KMAC context in words.
+   * We assert that this value is large enough to host the internal context.
+   */
+  kOtcryptoKmacCtxStructWords = 12,
+};
+
+/**
+ * Opaque KMAC context.
+ *
+ * Representation is internal to the KMAC implementation; initialize with
+ * #otcrypto_kmac_init.
+ */
+typedef struct otcrypto_kmac_context {
+  uint32_t data[kOtcryptoKmacCtxStructWords];
+} otcrypto_kmac_context_t;
+
 /**
  * Performs the KMAC function on the input data.
  *
@@ -53,6 +71,55 @@ otcrypto_status_t otcrypto_kmac(otcrypto_blinded_key_t *key,
                                 size_t required_output_len,
                                 otcrypto_word32_buf_t tag);
 
+/**
+ * Start a streaming KMAC operation.
+ *
+ * Key and customization string requirements are the same as for
+ * `otcrypto_kmac`. The key is loaded into the KMAC block here, so the blinded
+ * key does not need to stay live afterwards.
+ *
+ * The streaming operation keeps the KMAC block busy until
+ * `otcrypto_kmac_final` is called; in the meantime, all other SHA-3, SHAKE,
+ * cSHAKE and KMAC operations (streaming or one-shot) fail with an error.
+ * This function fails with an error if another operation holds the block.
+ *
+ * @param key Pointer to the blinded key struct with key shares.
+ * @param customization_string Customization string.
+ * @param[out] ctx Initialized context object.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_kmac_init(
+    otcrypto_blinded_key_t *key, otcrypto_const_byte_buf_t customization_string,
+    otcrypto_kmac_context_t *ctx);
+
+/**
+ * Add more data to a streaming KMAC operation.
+ *
+ * @param ctx Initialized context object (updated in place).
+ * @param input_message Input message data.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_kmac_update(otcrypto_kmac_context_t *ctx,
+                                       otcrypto_const_byte_buf_t input_message);
+
+/**
+ * Finish a streaming KMAC operation and release the KMAC block.
+ *
+ * Output length requirements are the same as for `otcrypto_kmac`. The
+ * context data should not be used after this operation.
+ *
+ * @param ctx Initialized context object.
+ * @param required_output_len Required output length, in bytes.
+ * @param[out] tag Output authentication tag.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_kmac_final(otcrypto_kmac_context_t *ctx,
+                                      size_t required_output_len,
+                                      otcrypto_word32_buf_t tag);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -75,6 +75,17 @@ enum {
   kOtcryptoRsa2048PrivateKeyblobBytes = 768,
   kOtcryptoRsa3072PrivateKeyblobBytes = 1152,
   kOtcryptoRsa4096PrivateKeyblobBytes = 1536,
+  /**
+   * Number of bytes needed for RSA private keyblobs in CRT form.
+   *
+   * Keys constructed with `otcrypto_rsa_private_key_from_crt` use this
+   * `keyblob_length` instead of the one above; `config.key_length` is the same
+   * for both representations. The exact representation is an
+   * implementation-specific detail and subject to change.
+   */
+  kOtcryptoRsa2048CrtPrivateKeyblobBytes = 1152,
+  kOtcryptoRsa3072CrtPrivateKeyblobBytes = 1728,
+  kOtcryptoRsa4096CrtPrivateKeyblobBytes = 2304,
 };
 
 /**
@@ -136,6 +147,42 @@ otcrypto_status_t otcrypto_rsa_private_key_from_exponents(
     otcrypto_const_word32_buf_t d_share0, otcrypto_const_word32_buf_t d_share1,
     otcrypto_blinded_key_t *private_key);
 
+/**
+ * Constructs an RSA private key in CRT form.
+ *
+ * Signing and decryption with the resulting key use the Chinese Remainder
+ * Theorem and are considerably faster than with a key from
+ * `otcrypto_rsa_private_key_from_exponents`. The public exponent is
+ * implicitly fixed to e=2^16+1.
+ *
+ * The caller should allocate space for the private key and set the `keyblob`,
+ * `keyblob_length`, and `key_length` fields accordingly; `keyblob_length`
+ * must be the CRT keyblob length for `size` (for example,
+ * `kOtcryptoRsa3072CrtPrivateKeyblobBytes`). The primes must both be exactly
+ * half the length of the modulus, with the most significant bit set, and the
+ * remaining values must be half the length of the modulus as well.
+ *
+ * @param size RSA size parameter.
+ * @param modulus RSA modulus (n = p * q).
+ * @param p First prime factor of the modulus.
+ * @param q Second prime factor of the modulus.
+ * @param d_p_share0 First share of the CRT exponent d mod (p-1).
+ * @param d_p_share1 Second share of the CRT exponent d mod (p-1).
+ * @param d_q_share0 First share of the CRT exponent d mod (q-1).
+ * @param d_q_share1 Second share of the CRT exponent d mod (q-1).
+ * @param i_q CRT coefficient q^-1 mod p.
+ * @param[out] private_key Destination private key struct.
+ * @return Result of the RSA key construction.
+ */
+otcrypto_status_t otcrypto_rsa_private_key_from_crt(
+    otcrypto_rsa_size_t size, otcrypto_const_word32_buf_t modulus,
+    otcrypto_const_word32_buf_t p, otcrypto_const_word32_buf_t q,
+    otcrypto_const_word32_buf_t d_p_share0,
+    otcrypto_const_word32_buf_t d_p_share1,
+    otcrypto_const_word32_buf_t d_q_share0,
+    otcrypto_const_word32_buf_t d_q_share1, otcrypto_const_word32_buf_t i_q,
+    otcrypto_blinded_key_t *private_key);
+
 /**
  * Constructs an RSA keypair from the public key and one prime cofactor.
  *
@@ -166,6 +213,9 @@ otcrypto_status_t otcrypto_rsa_keypair_from_cofactor(
  * `signature`. If the user-set length and the output length does not
  * match, an error message will be returned.
  *
+ * The private key may be in either the standard or the CRT form; the form is
+ * selected by its `keyblob_length`.
+ *
  * @param private_key Pointer to blinded private key struct.
  * @param message_digest Message digest to be signed (pre-hashed).
  * @param padding_mode Padding scheme to be used for the data.
@@ -250,6 +300,9 @@ otcrypto_status_t otcrypto_rsa_encrypt(
  * Decryption recovers the original length of the plaintext buffer and will
  * return its value in `plaintext_bytelen`.
  *
+ * The private key may be in either the standard or the CRT form; the form is
+ * selected by its `keyblob_length`.
+ *
  * Note: RSA encryption is included for compatibility with legacy interfaces,
  * and is typically not recommended for modern applications because it is
  * slower and more fragile than other encryption methods. Consult an expert
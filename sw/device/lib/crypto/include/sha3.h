@@ -18,6 +18,24 @@
 extern "C" {
 #endif  // __cplusplus
 
+enum {
+  /**
+   * The size of the publicly exposed SHA-3 context in words.
+   * We assert that this value is large enough to host the internal context.
+   */
+  kOtcryptoSha3CtxStructWords = 12,
+};
+
+/**
+ * Opaque SHA-3/SHAKE/cSHAKE hash context.
+ *
+ * Representation is internal to the hash implementation; initialize
+ * with #otcrypto_sha3_init or #otcrypto_cshake_init.
+ */
+typedef struct otcrypto_sha3_context {
+  uint32_t data[kOtcryptoSha3CtxStructWords];
+} otcrypto_sha3_context_t;
+
 /**
  * One-shot SHA3-224 hash computation.
  *
@@ -158,6 +176,88 @@ otcrypto_status_t otcrypto_cshake256(
     otcrypto_const_byte_buf_t customization_string,
     otcrypto_hash_digest_t *digest);
 
+/**
+ * Start a streaming SHA3 or SHAKE operation.
+ *
+ * The streaming operation keeps the KMAC block busy until
+ * `otcrypto_sha3_final` is called; in the meantime, all other SHA-3, SHAKE,
+ * cSHAKE and KMAC operations (streaming or one-shot) fail with an error.
+ * This function fails with an error if another operation holds the block.
+ *
+ * @param hash_mode Desired mode (SHA3-224/256/384/512, SHAKE128/256).
+ * @param[out] ctx Initialized context object.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_sha3_init(otcrypto_hash_mode_t hash_mode,
+                                     otcrypto_sha3_context_t *ctx);
+
+/**
+ * Start a streaming cSHAKE operation.
+ *
+ * See `otcrypto_sha3_init` for how the KMAC block is held. The function name
+ * and customization string parameters are as for `otcrypto_cshake128`.
+ *
+ * @param hash_mode Desired mode (cSHAKE128 or cSHAKE256).
+ * @param function_name_string Function name parameter (may be empty).
+ * @param customization_string Customization parameter (may be empty).
+ * @param[out] ctx Initialized context object.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_cshake_init(
+    otcrypto_hash_mode_t hash_mode,
+    otcrypto_const_byte_buf_t function_name_string,
+    otcrypto_const_byte_buf_t customization_string,
+    otcrypto_sha3_context_t *ctx);
+
+/**
+ * Add more data to a streaming SHA3/SHAKE/cSHAKE operation.
+ *
+ * Must not be called after the first call to `otcrypto_shake_squeeze`.
+ *
+ * @param ctx Initialized context object (updated in place).
+ * @param message Input message data.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_sha3_update(otcrypto_sha3_context_t *ctx,
+                                       otcrypto_const_byte_buf_t message);
+
+/**
+ * Squeeze output from a streaming SHAKE or cSHAKE operation.
+ *
+ * May be called any number of times; each call returns the next `digest.len`
+ * words of output. The KMAC block remains held until `otcrypto_sha3_final`.
+ * Returns an error for SHA3 modes, which have a fixed-length digest.
+ *
+ * @param ctx Initialized context object (updated in place).
+ * @param[out] digest Next part of the output.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_shake_squeeze(otcrypto_sha3_context_t *ctx,
+                                         otcrypto_hash_digest_t *digest);
+
+/**
+ * Finish a streaming SHA3/SHAKE/cSHAKE operation and release the KMAC block.
+ *
+ * For SHA3 modes, the caller should allocate space for the `digest` buffer
+ * and set the `len` field; if the length does not match the mode, an error is
+ * returned. For SHAKE and cSHAKE, this returns the final `digest.len` words
+ * of output, following any output from `otcrypto_shake_squeeze`; `digest.len`
+ * may be 0. The `mode` field will be set by this function.
+ *
+ * The context data should not be used after this operation.
+ *
+ * @param ctx Initialized context object.
+ * @param[out] digest Resulting digest.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+otcrypto_status_t otcrypto_sha3_final(otcrypto_sha3_context_t *ctx,
+                                      otcrypto_hash_digest_t *digest);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -0,0 +1,61 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/testing/perf_test.h"
+
+#include "sw/device/lib/runtime/ibex.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+
+uint64_t perf_test_measure(perf_test_body_t body, const void *ctx,
+                           size_t num_runs) {
+  CHECK(body != NULL);
+
+  uint64_t total_clock_cycles = 0;
+  for (size_t i = 0; i < num_runs; ++i) {
+    uint64_t start_cycles = ibex_mcycle_read();
+    body(ctx);
+    uint64_t end_cycles = ibex_mcycle_read();
+
+    // The subtraction is correct even if the 64-bit counter wrapped, provided
+    // the run took fewer than 2**64 cycles; see memory_perftest.c.
+    const uint64_t num_cycles = end_cycles - start_cycles;
+    CHECK(total_clock_cycles < UINT64_MAX - num_cycles);
+    total_clock_cycles += num_cycles;
+  }
+
+  return total_clock_cycles;
+}
+
+void perf_test_fill_deterministic(uint8_t *buf, size_t len) {
+  uint32_t state = 42;
+  for (size_t i = 0; i < len; ++i) {
+    state = state * 17 + i;
+    buf[i] = (uint8_t)state;
+  }
+}
+
+bool perf_test_check(const char *label, uint64_t num_cycles,
+                     uint32_t expected_max_num_cycles) {
+  // Cast cycle counts to `uint32_t` before printing because `base_printf()`
+  // cannot print `uint64_t`.
+  CHECK(expected_max_num_cycles > 0);
+  CHECK(num_cycles < UINT32_MAX / 100);
+  const uint32_t num_cycles_u32 = (uint32_t)num_cycles;
+  LOG_INFO("%s: %d cycles", label, num_cycles_u32);
+
+  if (num_cycles_u32 <= expected_max_num_cycles) {
+    return true;
+  }
+
+  const uint32_t percent_change =
+      (100 * num_cycles_u32) / expected_max_num_cycles;
+  LOG_WARNING(
+      "%s:\n"
+      "  Expected:        %10d cycles\n"
+      "  Actual:          %10d cycles\n"
+      "  Actual/Expected: %10d%%\n",
+      label, expected_max_num_cycles, num_cycles_u32, percent_change);
+  return false;
+}
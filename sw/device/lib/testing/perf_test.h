@@ -0,0 +1,63 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_SW_DEVICE_LIB_TESTING_PERF_TEST_H_
+#define OPENTITAN_SW_DEVICE_LIB_TESTING_PERF_TEST_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * Body of a cycle-count performance test.
+ *
+ * Called once per measured run. Setup that should not be measured belongs
+ * outside the body.
+ *
+ * @param ctx Test-specific context passed to `perf_test_measure()`.
+ */
+typedef void (*perf_test_body_t)(const void *ctx);
+
+/**
+ * Run a performance test body repeatedly and sum the cycles it took.
+ *
+ * @param body Function to measure; must not be NULL.
+ * @param ctx Context passed to each call of `body`.
+ * @param num_runs Number of times to call `body`.
+ * @return Total number of cycles spent in `body` over all runs.
+ */
+uint64_t perf_test_measure(perf_test_body_t body, const void *ctx,
+                           size_t num_runs);
+
+/**
+ * Fill a buffer with arbitrary, but deterministically-selected bytes.
+ *
+ * @param[out] buf Buffer to fill.
+ * @param len Length of the buffer in bytes.
+ */
+void perf_test_fill_deterministic(uint8_t *buf, size_t len);
+
+/**
+ * Log the cycle count of a performance test and check it against its bound.
+ *
+ * A warning with the ratio between the measured and expected counts is logged
+ * when the bound is exceeded.
+ *
+ * @param label Human-readable name of the test.
+ * @param num_cycles Measured number of cycles.
+ * @param expected_max_num_cycles Upper bound on `num_cycles`.
+ * @return Whether `num_cycles` is within the bound.
+ */
+bool perf_test_check(const char *label, uint64_t num_cycles,
+                     uint32_t expected_max_num_cycles);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // OPENTITAN_SW_DEVICE_LIB_TESTING_PERF_TEST_H_
@@ -287,6 +287,32 @@ static rom_error_t boot_data_entry_invalidate(
   return error;
 }
 
+/**
+ * Checks whether the boot data entry at the given page and index is empty.
+ *
+ * The entry is read in full only if its sniffed identifier is erased, see
+ * `boot_data_sniff()`.
+ *
+ * @param page A boot data page.
+ * @param index Index of the entry to check in the given page.
+ * @param[out] is_empty Whether the entry is empty.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+static rom_error_t boot_data_entry_empty_check(
+    const flash_ctrl_info_page_t *page, size_t index,
+    hardened_bool_t *is_empty) {
+  *is_empty = kHardenedBoolFalse;
+  uint32_t masked_identifier;
+  HARDENED_RETURN_IF_ERROR(boot_data_sniff(page, index, &masked_identifier));
+  if (masked_identifier == kFlashCtrlErasedWord) {
+    boot_data_t buf;
+    HARDENED_RETURN_IF_ERROR(boot_data_entry_read(page, index, &buf));
+    *is_empty = boot_data_is_empty(&buf);
+  }
+  return kErrorOk;
+}
+
 /**
  * A struct that stores some information about the first empty and last valid
  * entries in the active flash info page.
@@ -318,7 +344,7 @@ typedef struct active_page_info {
  * Updates the given active page info struct and last valid boot data entry
  * using the given page.
  *
- * This function performs a forward search to find the first empty boot data
+ * This function performs a binary search to find the first empty boot data
  * entry followed by a backward search to find the last valid boot data entry.
  * If the page has an entry that is newer than the one passed in, this function
  * updates `page_info` and `boot_data`. Reads must be enabled for the given page
@@ -335,34 +361,41 @@ OT_WARN_UNUSED_RESULT
 static rom_error_t boot_data_page_info_update_impl(
     const flash_ctrl_info_page_t *page, active_page_info_t *page_info,
     boot_data_t *boot_data) {
-  uint32_t sniff_results[kBootDataEntriesPerPage];
-
   boot_data_t buf;
 
-  // Perform a forward search to find the first empty entry.
+  // Perform a binary search to find the first empty entry. Entries are only
+  // appended and pages are erased as a whole, so the empty entries of a page
+  // form a suffix and only O(log(kBootDataEntriesPerPage)) entries need to be
+  // read.
   hardened_bool_t has_empty_entry = kHardenedBoolFalse;
-  size_t i = 0, r = kBootDataEntriesPerPage - 1;
-  for (; launder32(i) < kBootDataEntriesPerPage &&
-         launder32(r) < kBootDataEntriesPerPage;
-       ++i, --r) {
-    // Read and cache the identifier to quickly determine if an entry can be
-    // empty or valid.
-    HARDENED_RETURN_IF_ERROR(boot_data_sniff(page, i, &sniff_results[i]));
-    // Check all words of this entry only if it can be empty.
-    if (sniff_results[i] == kFlashCtrlErasedWord) {
-      HARDENED_RETURN_IF_ERROR(boot_data_entry_read(page, i, &buf));
-      has_empty_entry = boot_data_is_empty(&buf);
-      if (launder32(has_empty_entry) == kHardenedBoolTrue) {
-        HARDENED_CHECK_EQ(has_empty_entry, kHardenedBoolTrue);
-        break;
-      }
+  size_t lo = 0, hi = kBootDataEntriesPerPage;
+  while (launder32(lo) < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    HARDENED_RETURN_IF_ERROR(
+        boot_data_entry_empty_check(page, mid, &has_empty_entry));
+    if (launder32(has_empty_entry) == kHardenedBoolTrue) {
+      HARDENED_CHECK_EQ(has_empty_entry, kHardenedBoolTrue);
+      hi = mid;
+    } else {
       HARDENED_CHECK_EQ(has_empty_entry, kHardenedBoolFalse);
+      lo = mid + 1;
     }
   }
-  // At the end of this loop, `i` is the index of the first empty entry if any
-  // and `kBootDataEntriesPerPage` otherwise.
-  HARDENED_CHECK_LE(i, kBootDataEntriesPerPage);
-  size_t first_empty_index = i;
+  HARDENED_CHECK_EQ(lo, hi);
+  // At the end of this loop, `lo` is the index of the first empty entry if any
+  // and `kBootDataEntriesPerPage` otherwise. Check the chosen entry again so
+  // that a glitch during the search cannot select a non-empty entry.
+  has_empty_entry = kHardenedBoolFalse;
+  if (launder32(lo) < kBootDataEntriesPerPage) {
+    HARDENED_CHECK_LT(lo, kBootDataEntriesPerPage);
+    HARDENED_RETURN_IF_ERROR(
+        boot_data_entry_empty_check(page, lo, &has_empty_entry));
+    HARDENED_CHECK_EQ(has_empty_entry, kHardenedBoolTrue);
+  } else {
+    HARDENED_CHECK_EQ(lo, kBootDataEntriesPerPage);
+  }
+  size_t first_empty_index = lo;
+  size_t i = lo, r = kBootDataEntriesPerPage - 1 - lo;
   HARDENED_CHECK_EQ(i + r, kBootDataEntriesPerPage - 1);
 
   // Perform a backward search to find the last valid entry.
@@ -371,7 +404,9 @@ static rom_error_t boot_data_page_info_update_impl(
                  launder32(r) < kBootDataEntriesPerPage;
        --i, ++r) {
     // Check the digest only if this entry can be valid.
-    if (sniff_results[i] == kBootDataIdentifier) {
+    uint32_t masked_identifier;
+    HARDENED_RETURN_IF_ERROR(boot_data_sniff(page, i, &masked_identifier));
+    if (masked_identifier == kBootDataIdentifier) {
       HARDENED_RETURN_IF_ERROR(boot_data_entry_read(page, i, &buf));
       rom_error_t is_valid = boot_data_check(&buf);
       if (launder32(is_valid) == kErrorOk) {
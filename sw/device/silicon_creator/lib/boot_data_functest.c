@@ -194,6 +194,28 @@ static rom_error_t check_boot_data(const boot_data_t *boot_data,
   return kErrorOk;
 }
 
+/**
+ * Reads the active boot data entry and logs the number of cycles it took.
+ *
+ * The locator performs a binary search over each page, so the cycle count
+ * should grow with the logarithm of the number of written entries.
+ *
+ * @param label Label of the measurement.
+ * @param[out] boot_data Active boot data entry.
+ * @return The result of the operation.
+ */
+static rom_error_t boot_data_read_timed(const char *label,
+                                        boot_data_t *boot_data) {
+  uint64_t start = ibex_mcycle_read();
+  RETURN_IF_ERROR(boot_data_read(kLcStateProd, boot_data));
+  uint64_t end = ibex_mcycle_read();
+
+  CHECK(end - start <= UINT32_MAX, "Cycle count must fit in uint32_t");
+  uint32_t cycles = (uint32_t)(end - start);
+  LOG_INFO("%s: boot_data_read() took %u cycles", label, cycles);
+  return kErrorOk;
+}
+
 rom_error_t check_test_data_test(void) {
   RETURN_IF_ERROR(check_boot_data(&kTestBootData, kTestBootData.counter));
   return kErrorOk;
@@ -240,16 +262,8 @@ rom_error_t read_single_page_1_test(void) {
   write_boot_data(kPages[1], 0, &kTestBootData);
 
   boot_data_t boot_data;
-  uint64_t start = ibex_mcycle_read();
-  RETURN_IF_ERROR(boot_data_read(kLcStateProd, &boot_data));
-  uint64_t end = ibex_mcycle_read();
+  RETURN_IF_ERROR(boot_data_read_timed("single_page_1", &boot_data));
   RETURN_IF_ERROR(compare_boot_data(&boot_data, &kTestBootData));
-  if (end - start > UINT32_MAX) {
-    LOG_FATAL("boot_data_read() took more than UINT32_MAX cycles");
-    return kErrorUnknown;
-  }
-  uint32_t cycles = (uint32_t)(end - start);
-  LOG_INFO("boot_data_read() took %u cycles", cycles);
   return kErrorOk;
 }
 
@@ -276,14 +290,22 @@ rom_error_t read_full_page_1_test(void) {
   write_boot_data(kPages[1], kBootDataEntriesPerPage - 1, &kTestBootData);
 
   boot_data_t boot_data;
-  uint64_t start = ibex_mcycle_read();
-  RETURN_IF_ERROR(boot_data_read(kLcStateProd, &boot_data));
-  uint64_t end = ibex_mcycle_read();
+  RETURN_IF_ERROR(boot_data_read_timed("full_page_1", &boot_data));
   RETURN_IF_ERROR(compare_boot_data(&boot_data, &kTestBootData));
+  return kErrorOk;
+}
 
-  CHECK(end - start <= UINT32_MAX, "Cycle count must fit in uint32_t");
-  uint32_t cycles = (uint32_t)(end - start);
-  LOG_INFO("boot_data_read() took %u cycles", cycles);
+rom_error_t read_half_page_0_test(void) {
+  enum {
+    kNumEntries = kBootDataEntriesPerPage / 2,
+  };
+  erase_boot_data_pages();
+  fill_with_invalidated_boot_data(kPages[0], kNumEntries - 1, &kTestBootData);
+  write_boot_data(kPages[0], kNumEntries - 1, &kTestBootData);
+
+  boot_data_t boot_data;
+  RETURN_IF_ERROR(boot_data_read_timed("half_page_0", &boot_data));
+  RETURN_IF_ERROR(compare_boot_data(&boot_data, &kTestBootData));
   return kErrorOk;
 }
 
@@ -368,6 +390,7 @@ bool test_main(void) {
   EXECUTE_TEST(result, read_single_page_1_test);
   EXECUTE_TEST(result, read_full_page_0_test);
   EXECUTE_TEST(result, read_full_page_1_test);
+  EXECUTE_TEST(result, read_half_page_0_test);
   EXECUTE_TEST(result, write_empty_test);
   EXECUTE_TEST(result, write_page_switch_test);
 
@@ -84,6 +84,9 @@ constexpr boot_data_t kDefaultEntry = {
     .primary_bl0_slot = kBootSlotA,
 };
 
+static_assert(kBootDataEntriesPerPage == 16,
+              "Expected flash reads assume 16 entries per page.");
+
 namespace boot_data_unittest {
 namespace {
 using ::testing::_;
@@ -264,36 +267,75 @@ class BootDataTest : public rom_test::RomTest {
     // #1. Non-erased and bootable provided boot_data.
     // #2. Non-erased and bootable but invalid digest.
     // #3. Entry with sniffed area erased but the rest not.
-    // #4. Fully erased entry.
+    // #4-#15. Fully erased entries.
     return [=](const flash_ctrl_info_page_t *page) {
-      // Expect to sniff each entry, fully reading if it could be erased.
-      ExpectSniff(page, 0, non_erased_entry_, kErrorOk);
-      ExpectSniff(page, 1, boot_data_raw, kErrorOk);
+      // Expect a binary search for the first empty entry, fully reading the
+      // probed entries that could be erased.
+      ExpectSniff(page, 8, erased_entry_, kErrorOk);
+      ExpectRead(page, 8, erased_entry_, kErrorOk);
+      ExpectSniff(page, 4, erased_entry_, kErrorOk);
+      ExpectRead(page, 4, erased_entry_, kErrorOk);
       ExpectSniff(page, 2, boot_data_raw, kErrorOk);
       ExpectSniff(page, 3, part_erased_entry_, kErrorOk);
       ExpectRead(page, 3, part_erased_entry_, kErrorOk);
+      // Check the chosen entry again.
       ExpectSniff(page, 4, erased_entry_, kErrorOk);
       ExpectRead(page, 4, erased_entry_, kErrorOk);
 
+      // Step back over the partially erased entry.
+      ExpectSniff(page, 3, part_erased_entry_, kErrorOk);
+
       // Check the last seen bootable entry's digest (mocked as invalid).
+      ExpectSniff(page, 2, boot_data_raw, kErrorOk);
       ExpectRead(page, 2, boot_data_raw, kErrorOk);
       ExpectDigestCompute(boot_data, false);
 
       // Step back to the previously seen bootable entry (provided `boot_data`).
+      ExpectSniff(page, 1, boot_data_raw, kErrorOk);
       ExpectRead(page, 1, boot_data_raw, kErrorOk);
       ExpectDigestCompute(boot_data, valid_digest);
+
+      // Step back over the non-bootable entry if `boot_data` is invalid.
+      if (!valid_digest) {
+        ExpectSniff(page, 0, non_erased_entry_, kErrorOk);
+      }
     };
   }
 
   /**
-   * Provides a lambda function mocking a page with only an erased entry.
+   * Provides a lambda function mocking a page with no empty entries whose last
+   * entry is the given bootable `boot_data`.
+   *
+   * @param boot_data Bootable boot data entry at the end of the page.
+   * @return Lambda function for use with `ExpectPageScan`.
+   */
+  auto FullPage(boot_data_t boot_data) {
+    std::array<uint32_t, kBootDataNumWords> boot_data_raw = {};
+    std::memcpy(boot_data_raw.data(), &boot_data, sizeof(boot_data_t));
+
+    return [=](const flash_ctrl_info_page_t *page) {
+      ExpectSniff(page, 8, non_erased_entry_, kErrorOk);
+      ExpectSniff(page, 12, non_erased_entry_, kErrorOk);
+      ExpectSniff(page, 14, non_erased_entry_, kErrorOk);
+      ExpectSniff(page, 15, boot_data_raw, kErrorOk);
+
+      ExpectSniff(page, 15, boot_data_raw, kErrorOk);
+      ExpectRead(page, 15, boot_data_raw, kErrorOk);
+      ExpectDigestCompute(boot_data, true);
+    };
+  }
+
+  /**
+   * Provides a lambda function mocking a fully erased page.
    *
    * @return Lambda function for use with `ExpectPageScan`.
    */
   auto ErasedPage() {
     return [this](auto page) {
-      ExpectSniff(page, 0, erased_entry_, kErrorOk);
-      ExpectRead(page, 0, erased_entry_, kErrorOk);
+      for (size_t index : {8, 4, 2, 1, 0, 0}) {
+        ExpectSniff(page, index, erased_entry_, kErrorOk);
+        ExpectRead(page, index, erased_entry_, kErrorOk);
+      }
     };
   }
 
@@ -362,6 +404,16 @@ TEST_F(BootDataReadTest, ReadOneEntryTest) {
   EXPECT_EQ(boot_data, kValidEntry0);
 }
 
+TEST_F(BootDataReadTest, ReadFullPageTest) {
+  // Expect the binary search to step over a page without empty entries.
+  ExpectPageScan(&kFlashCtrlInfoPageBootData0, FullPage(kValidEntry1));
+  ExpectPageScan(&kFlashCtrlInfoPageBootData1, ErasedPage());
+
+  boot_data_t boot_data = {{0}};
+  EXPECT_EQ(boot_data_read(kLcStateTest, &boot_data), kErrorOk);
+  EXPECT_EQ(boot_data, kValidEntry1);
+}
+
 TEST_F(BootDataReadTest, ReadOneValidTest) {
   // Expect both pages to be searched, but give only a valid entry for one.
   ExpectPageScan(&kFlashCtrlInfoPageBootData0, EntryPage(kValidEntry0));
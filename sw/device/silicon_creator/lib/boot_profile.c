@@ -0,0 +1,23 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/silicon_creator/lib/boot_profile.h"
+
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/silicon_creator/lib/drivers/ibex.h"
+#include "sw/device/silicon_creator/lib/drivers/retention_sram.h"
+
+#ifdef BOOT_PROFILE
+void boot_profile_init(void) {
+  boot_profile_t *profile = &retention_sram_get()->creator.boot_profile;
+  memset(profile, 0, sizeof(*profile));
+  profile->identifier = kBootProfileIdentifier;
+  boot_profile_mark(kBootProfileRomInit);
+}
+
+void boot_profile_mark(boot_profile_milestone_t milestone) {
+  retention_sram_get()->creator.boot_profile.cycles[milestone] =
+      ibex_mcycle32();
+}
+#endif
@@ -0,0 +1,123 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_SW_DEVICE_SILICON_CREATOR_LIB_BOOT_PROFILE_H_
+#define OPENTITAN_SW_DEVICE_SILICON_CREATOR_LIB_BOOT_PROFILE_H_
+
+#include <stdint.h>
+
+#include "sw/device/lib/base/macros.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Boot milestones.
+ *
+ * Each milestone is a fixed index into `boot_profile_t.cycles`. The host-side
+ * decoder (util/device_sw_utils/decode_boot_profile.py) relies on these
+ * values, so new milestones must be added at the end and existing ones must not
+ * be renumbered.
+ */
+typedef enum boot_profile_milestone {
+  /** ROM: `rom_init()` is done and the boot profile was cleared. */
+  kBootProfileRomInit = 0,
+  /** ROM: boot data has been read from flash. */
+  kBootProfileRomBootDataRead = 1,
+  /** ROM: `rom_verify()` entry. */
+  kBootProfileRomVerifyStart = 2,
+  /** ROM: keys are loaded and the image digest is computed. */
+  kBootProfileRomDigestDone = 3,
+  /** ROM: SPHINCS+ verification (overlapped with ECDSA on OTBN) is done. */
+  kBootProfileRomSpxDone = 4,
+  /** ROM: ECDSA verification result has been read back from OTBN. */
+  kBootProfileRomEcdsaDone = 5,
+  /** ROM: `rom_boot()` entry. */
+  kBootProfileRomBootStart = 6,
+  /** ROM: about to jump to the ROM_EXT. */
+  kBootProfileRomExtJump = 7,
+  /** ROM_EXT: `rom_ext_init()` is done. */
+  kBootProfileRomExtStart = 8,
+  /** ROM_EXT: ownership state has been initialized. */
+  kBootProfileRomExtOwnershipDone = 9,
+  /** ROM_EXT: `rom_ext_verify()` entry. */
+  kBootProfileRomExtVerifyStart = 10,
+  /** ROM_EXT: the owner firmware digest is computed. */
+  kBootProfileRomExtDigestDone = 11,
+  /** ROM_EXT: SPHINCS+ verification is done (hybrid keys only). */
+  kBootProfileRomExtSpxDone = 12,
+  /** ROM_EXT: ECDSA verification is done. */
+  kBootProfileRomExtEcdsaDone = 13,
+  /** ROM_EXT: the CDI_1 certificate is generated and flushed to flash. */
+  kBootProfileRomExtDiceDone = 14,
+  /** ROM_EXT: about to jump to the owner firmware. */
+  kBootProfileBl0Jump = 15,
+  /** Number of milestones. */
+  kBootProfileMilestoneCount = 16,
+} boot_profile_milestone_t;
+
+enum {
+  /**
+   * Boot profile identifier value (ASCII "BPRF").
+   */
+  kBootProfileIdentifier = 0x46525042,
+};
+
+/**
+ * Cycle-stamped boot milestones.
+ *
+ * This struct lives in the silicon creator area of the retention SRAM, right
+ * before the boot log, so that it can be read through the memory backdoor in
+ * simulation or by owner code after boot. Each entry holds the low 32 bits of
+ * `mcycle` when the milestone was last reached, or zero if it was not reached
+ * during this boot. Since `mcycle` is cleared during `rom_init()`, only the
+ * differences between entries are meaningful.
+ */
+typedef struct boot_profile {
+  /** Identifier (`BPRF`). */
+  uint32_t identifier;
+  /** `mcycle` stamps indexed by `boot_profile_milestone_t`. */
+  uint32_t cycles[kBootProfileMilestoneCount];
+} boot_profile_t;
+
+OT_ASSERT_MEMBER_OFFSET(boot_profile_t, identifier, 0);
+OT_ASSERT_MEMBER_OFFSET(boot_profile_t, cycles, 4);
+OT_ASSERT_SIZE(boot_profile_t, 68);
+
+/**
+ * Record boot milestones.
+ *
+ * Profiling is disabled by default and these functions inline to nothing in a
+ * normal build. Enable it with `--copt=-DBOOT_PROFILE`.
+ */
+#ifdef BOOT_PROFILE
+/**
+ * Clear the boot profile in the retention SRAM and record
+ * `kBootProfileRomInit`.
+ *
+ * Must be called after the retention SRAM is initialized.
+ */
+void boot_profile_init(void);
+
+/**
+ * Record the current cycle count for the given milestone.
+ *
+ * @param milestone The milestone that was reached.
+ */
+void boot_profile_mark(boot_profile_milestone_t milestone);
+#else
+#define boot_profile_init() \
+  do {                      \
+  } while (0)
+#define boot_profile_mark(milestone) \
+  do {                               \
+  } while (0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // OPENTITAN_SW_DEVICE_SILICON_CREATOR_LIB_BOOT_PROFILE_H_
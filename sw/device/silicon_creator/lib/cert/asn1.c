@@ -71,7 +71,64 @@ void asn1_push_bytes(asn1_state_t *state, const uint8_t *bytes, size_t size) {
   state->offset += size;
 }
 
+/**
+ * Return the number of length octets in the minimal encoding of `length`.
+ *
+ * Lengths above 0xffff are not supported and return the maximum of 3.
+ *
+ * @param length Length of the contents of a tag.
+ */
+static size_t asn1_len_size(size_t length) {
+  if (length <= 0x7f) {
+    return 1;
+  } else if (length <= 0xff) {
+    return 2;
+  }
+  return 3;
+}
+
+/**
+ * Move `len` bytes from `src` to `dest`. The two regions may overlap.
+ *
+ * Bytes are moved a word at a time, starting from the end of the regions when
+ * moving towards higher addresses and from the start otherwise, so that no
+ * source byte is overwritten before it is read.
+ *
+ * @param dest Destination of the bytes.
+ * @param src Source of the bytes.
+ * @param len Number of bytes to move.
+ */
+static void asn1_move(uint8_t *dest, const uint8_t *src, size_t len) {
+  uint32_t word;
+  if (dest > src) {
+    while (len >= sizeof(word)) {
+      len -= sizeof(word);
+      __builtin_memcpy(&word, src + len, sizeof(word));
+      __builtin_memcpy(dest + len, &word, sizeof(word));
+    }
+    while (len > 0) {
+      --len;
+      dest[len] = src[len];
+    }
+  } else {
+    size_t i = 0;
+    for (; i + sizeof(word) <= len; i += sizeof(word)) {
+      __builtin_memcpy(&word, src + i, sizeof(word));
+      __builtin_memcpy(dest + i, &word, sizeof(word));
+    }
+    for (; i < len; ++i) {
+      dest[i] = src[i];
+    }
+  }
+}
+
 void asn1_start_tag(asn1_state_t *state, asn1_tag_t *new_tag, uint8_t id) {
+  asn1_start_tag_with_size_hint(state, new_tag, id, 0);
+}
+
+void asn1_start_tag_with_size_hint(asn1_state_t *state, asn1_tag_t *new_tag,
+                                   uint8_t id, size_t size_hint) {
+  static const uint8_t kLenPlaceholder[3] = {0};
   new_tag->state = NULL;
   RETURN_IF_ASN1_ERROR(state);
 
@@ -79,56 +136,41 @@ void asn1_start_tag(asn1_state_t *state, asn1_tag_t *new_tag, uint8_t id) {
   asn1_push_byte(state, id);
   RETURN_IF_ASN1_ERROR(state);
   new_tag->len_offset = state->offset;
-  // We do not yet known how many bytes we need to encode the length. For now
-  // reserve one byte which is the minimum. This is then fixed in
-  // asn1_finish_tag by moving the data if necessary.
-
-  asn1_push_byte(state, 0);
+  // Reserve the length octets for the expected size. If the actual size needs
+  // a different number of bytes, asn1_finish_tag fixes it by moving the data.
+  size_t len_size = asn1_len_size(size_hint);
+  asn1_push_bytes(state, kLenPlaceholder, len_size);
   RETURN_IF_ASN1_ERROR(state);
-  new_tag->len_size = 1;
+  new_tag->len_size = len_size;
 }
 
 void asn1_finish_tag(asn1_tag_t *tag) {
   if (tag->state == NULL)
     return;
   RETURN_IF_ASN1_ERROR(tag->state);
-  // Sanity check: asn1_start_tag should have output one byte.
-  if (tag->len_size != 1) {
+  // Sanity check: asn1_start_tag should have output one to three bytes.
+  if (tag->len_size < 1 || tag->len_size > 3) {
     RAISE_ASN1_ERROR(tag->state, kErrorAsn1Internal);
   }
   // Compute actually used length.
   size_t length = tag->state->offset - tag->len_offset - tag->len_size;
-  // Compute the size of the minimal encoding.
-  size_t final_len_size;
-  if (length <= 0x7f) {
-    // We only need one byte to hold the length.
-    final_len_size = 1;
-  } else if (length <= 0xff) {
-    // We need two bytes to hold the length: we need to move the data before
-    // we can write the second byte.
-    final_len_size = 2;
-  } else if (length <= 0xffff) {
-    // We need three bytes to hold the length: we need to move the data before
-    // we can write the second and third bytes.
-    final_len_size = 3;
-  } else {
+  if (length > 0xffff) {
     // Length too large.
     RAISE_ASN1_ERROR(tag->state, kErrorAsn1Internal);
   }
-  // If the final length uses more bytes than we initially allocated, we
-  // need to shift all the tag data backwards.
+  // Compute the size of the minimal encoding.
+  size_t final_len_size = asn1_len_size(length);
+  // If the final length uses a different number of bytes than we initially
+  // allocated, we need to move all the tag data.
   if (tag->len_size != final_len_size) {
     // Make sure that the data actually fits into the buffer.
     size_t new_buffer_size =
-        tag->state->offset + final_len_size - tag->len_size;
+        tag->state->offset - tag->len_size + final_len_size;
     if (new_buffer_size > tag->state->size) {
       RAISE_ASN1_ERROR(tag->state, kErrorAsn1BufferExhausted);
     }
-    // Copy backwards.
-    for (size_t i = 0; i < length; i++) {
-      tag->state->buffer[tag->len_offset + final_len_size + length - 1 - i] =
-          tag->state->buffer[tag->len_offset + tag->len_size + length - 1 - i];
-    }
+    uint8_t *len_octets = tag->state->buffer + tag->len_offset;
+    asn1_move(len_octets + final_len_size, len_octets + tag->len_size, length);
   }
   // Write the length in the buffer.
   if (length <= 0x7f) {
@@ -145,7 +187,7 @@ void asn1_finish_tag(asn1_tag_t *tag) {
     RAISE_ASN1_ERROR(tag->state, kErrorAsn1Internal);
   }
   // Fix up state offset.
-  tag->state->offset += final_len_size - tag->len_size;
+  tag->state->offset = tag->state->offset - tag->len_size + final_len_size;
   // Hardening: clear out the tag structure to prevent accidental reuse.
   tag->state = NULL;
   tag->len_offset = 0;
@@ -154,7 +196,7 @@ void asn1_finish_tag(asn1_tag_t *tag) {
 
 void asn1_push_bool(asn1_state_t *state, uint8_t tag, bool value) {
   asn1_tag_t tag_st;
-  asn1_start_tag(state, &tag_st, tag);
+  asn1_start_tag_with_size_hint(state, &tag_st, tag, 1);
   asn1_push_byte(state, value ? 0xff : 0);
   asn1_finish_tag(&tag_st);
 }
@@ -186,8 +228,6 @@ void asn1_push_integer(asn1_state_t *state, uint8_t tag, bool is_signed,
   if (size == 0 || (bytes_be == NULL && size > 0)) {
     RAISE_ASN1_ERROR(state, kErrorAsn1PushIntegerInvalidArgument);
   }
-  asn1_tag_t tag_st;
-  asn1_start_tag(state, &tag_st, tag);
   // Compute smallest possible encoding: ASN1 forbids that the first 9 bits (ie
   // first octet) and MSB of the second octet are either all ones or all zeroes.
 
@@ -197,6 +237,7 @@ void asn1_push_integer(asn1_state_t *state, uint8_t tag, bool is_signed,
     size -= 1;
   }
 
+  bool pad = false;
   if (is_signed) {
     // Integers in ASN.1 are always signed and represented in two's complement.
     // So for unsigned numbers that has MSB set, add a 0x00 padding.
@@ -206,9 +247,12 @@ void asn1_push_integer(asn1_state_t *state, uint8_t tag, bool is_signed,
     }
   } else {
     // For unsigned numbers, add a 0x00 padding if the first octet has MSB set.
-    if ((bytes_be[0] >> 7) == 1) {
-      asn1_push_byte(state, 0);
-    }
+    pad = (bytes_be[0] >> 7) == 1;
+  }
+  asn1_tag_t tag_st;
+  asn1_start_tag_with_size_hint(state, &tag_st, tag, size + pad);
+  if (pad) {
+    asn1_push_byte(state, 0);
   }
   asn1_push_bytes(state, bytes_be, size);
   asn1_finish_tag(&tag_st);
@@ -235,7 +279,7 @@ void asn1_push_integer_pad(asn1_state_t *state, bool is_signed,
 
 void asn1_push_oid_raw(asn1_state_t *state, const uint8_t *bytes, size_t size) {
   asn1_tag_t tag;
-  asn1_start_tag(state, &tag, kAsn1TagNumberOid);
+  asn1_start_tag_with_size_hint(state, &tag, kAsn1TagNumberOid, size);
   asn1_push_bytes(state, bytes, size);
   asn1_finish_tag(&tag);
 }
@@ -259,7 +303,8 @@ static const char kLowercaseHexChars[16] = {'0', '1', '2', '3', '4', '5',
 void asn1_push_hexstring(asn1_state_t *state, uint8_t id, const uint8_t *bytes,
                          size_t size) {
   asn1_tag_t tag;
-  asn1_start_tag(state, &tag, id);
+  // Each byte is encoded as two hex characters.
+  asn1_start_tag_with_size_hint(state, &tag, id, 2 * size);
   while (size > 0) {
     asn1_push_byte(state, (uint8_t)kLowercaseHexChars[bytes[0] >> 4]);
     asn1_push_byte(state, (uint8_t)kLowercaseHexChars[bytes[0] & 0xf]);
@@ -151,6 +151,9 @@ typedef enum asn1_tag_number {
 /**
  * Start an ASN1 tag.
  *
+ * This is equivalent to `asn1_start_tag_with_size_hint()` with a size hint of
+ * zero, i.e. one byte is reserved for the length octets.
+ *
  * Note: This function tracks its error in the asn1 state, and the error will
  * be returned by `asn1_finish` in the end. This function will be no-op when
  * the state has an active error.
@@ -162,12 +165,34 @@ typedef enum asn1_tag_number {
  */
 void asn1_start_tag(asn1_state_t *state, asn1_tag_t *new_tag, uint8_t id);
 
+/**
+ * Start an ASN1 tag whose contents are expected to be `size_hint` bytes long.
+ *
+ * Reserves as many length octets as needed to encode `size_hint`. If the
+ * actual size of the contents needs the same number of length octets,
+ * `asn1_finish_tag` only writes the length and does not move any data. Callers
+ * that build nested tags should pass a hint for the outer tags so that the
+ * contents are not moved once per nesting level.
+ *
+ * Note: This function tracks its error in the asn1 state, and the error will
+ * be returned by `asn1_finish` in the end. This function will be no-op when
+ * the state has an active error.
+ *
+ * @param state Pointer to the state initialized by asn1_start.
+ * @param[out] new_tag Pointer to a user-allocated tag to be initialized.
+ * @param id Identifier byte of the tag (see ASN1_CLASS_*, ASN1_FORM_* and
+ * ASN1_TAG_*).
+ * @param size_hint Expected size of the contents of the tag in bytes.
+ */
+void asn1_start_tag_with_size_hint(asn1_state_t *state, asn1_tag_t *new_tag,
+                                   uint8_t id, size_t size_hint);
+
 /**
  * Finish an ASN1 tag.
  *
- * If size hint provided to asn1_start_tag does not match the actual size
- * of the data, this function will fix it up, potentially at the cost of moving
- * bytes within the buffer.
+ * If the size hint provided to `asn1_start_tag_with_size_hint` does not match
+ * the actual size of the data, this function will fix it up by moving the
+ * contents of the tag within the buffer once.
  *
  * Note: the `tag` will be cleared out after this call.
  *
@@ -481,5 +481,186 @@ TEST(Asn1, TagLengthEncoding) {
   EXPECT_EQ(buf, expected);
 }
 
+// Make sure that the tag encoding does not depend on the size hint, whether
+// the hint needs fewer, the same number of, or more length octets than the
+// actual size.
+TEST(Asn1, TagSizeHint) {
+  const size_t kSizes[] = {0, 0x7f, 0x80, 0xff, 0x100, 0x1234};
+  for (size_t size : kSizes) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = (uint8_t)(i * 7);
+    }
+
+    std::vector<uint8_t> expected(0x2000);
+    asn1_state_t state;
+    EXPECT_EQ(asn1_start(&state, &expected[0], expected.size()), kErrorOk);
+    asn1_tag_t tag;
+    asn1_start_tag(&state, &tag, kAsn1TagNumberOctetString);
+    asn1_push_bytes(&state, data.data(), data.size());
+    asn1_finish_tag(&tag);
+    size_t expected_size;
+    EXPECT_EQ(asn1_finish(&state, &expected_size), kErrorOk);
+    expected.resize(expected_size);
+
+    for (size_t hint : kSizes) {
+      std::vector<uint8_t> buf(0x2000);
+      EXPECT_EQ(asn1_start(&state, &buf[0], buf.size()), kErrorOk);
+      asn1_start_tag_with_size_hint(&state, &tag, kAsn1TagNumberOctetString,
+                                    hint);
+      asn1_push_bytes(&state, data.data(), data.size());
+      asn1_finish_tag(&tag);
+      size_t out_size;
+      EXPECT_EQ(asn1_finish(&state, &out_size), kErrorOk);
+      buf.resize(out_size);
+      EXPECT_EQ(buf, expected) << "size " << size << ", hint " << hint;
+    }
+  }
+}
+
+// Make sure that nested tags with size hints are encoded correctly.
+TEST(Asn1, NestedTagSizeHint) {
+  asn1_state_t state;
+  std::vector<uint8_t> buf(0x400);
+  EXPECT_EQ(asn1_start(&state, &buf[0], buf.size()), kErrorOk);
+  asn1_tag_t outer;
+  asn1_start_tag_with_size_hint(&state, &outer, kAsn1TagNumberSequence, 0x104);
+  asn1_tag_t inner;
+  asn1_start_tag(&state, &inner, kAsn1TagNumberOctetString);
+  std::vector<uint8_t> tmp(0x100, 0xa5);
+  asn1_push_bytes(&state, &tmp[0], tmp.size());
+  asn1_finish_tag(&inner);
+  asn1_finish_tag(&outer);
+  size_t out_size;
+  EXPECT_EQ(asn1_finish(&state, &out_size), kErrorOk);
+
+  std::vector<uint8_t> expected = {
+      0x30, 0x82, 0x01, 0x04,  // Sequence, length.
+      0x04, 0x82, 0x01, 0x00,  // Octet string, length.
+  };
+  expected.insert(expected.end(), tmp.begin(), tmp.end());
+  buf.resize(out_size);
+  EXPECT_EQ(buf, expected);
+}
+
+// Make sure that the contents are moved correctly in both directions when the
+// hint is wrong, including lengths that are not a multiple of the word size.
+TEST(Asn1, TagSizeHintMove) {
+  struct {
+    size_t size;
+    size_t hint;
+    std::vector<uint8_t> len_octets;
+  } kCases[] = {
+      // Hint too small: the contents move towards higher addresses.
+      {0x80, 0, {0x81, 0x80}},
+      {0x81, 0, {0x81, 0x81}},
+      {0x82, 0, {0x81, 0x82}},
+      {0x83, 0, {0x81, 0x83}},
+      {0x100, 0x80, {0x82, 0x01, 0x00}},
+      {0x101, 0, {0x82, 0x01, 0x01}},
+      {0x102, 0, {0x82, 0x01, 0x02}},
+      {0x103, 0, {0x82, 0x01, 0x03}},
+      // Hint too large: the contents move towards lower addresses.
+      {1, 0x80, {0x01}},
+      {2, 0x100, {0x02}},
+      {3, 0x100, {0x03}},
+      {5, 0x100, {0x05}},
+      {0x80, 0x100, {0x81, 0x80}},
+      {0x87, 0x100, {0x81, 0x87}},
+  };
+  for (const auto &c : kCases) {
+    std::vector<uint8_t> data(c.size);
+    for (size_t i = 0; i < c.size; ++i) {
+      data[i] = (uint8_t)(i + 1);
+    }
+    std::vector<uint8_t> expected = {kAsn1TagNumberOctetString};
+    expected.insert(expected.end(), c.len_octets.begin(), c.len_octets.end());
+    expected.insert(expected.end(), data.begin(), data.end());
+
+    asn1_state_t state;
+    std::vector<uint8_t> buf(0x200);
+    EXPECT_EQ(asn1_start(&state, &buf[0], buf.size()), kErrorOk);
+    asn1_tag_t tag;
+    asn1_start_tag_with_size_hint(&state, &tag, kAsn1TagNumberOctetString,
+                                  c.hint);
+    asn1_push_bytes(&state, data.data(), data.size());
+    asn1_finish_tag(&tag);
+    size_t out_size;
+    EXPECT_EQ(asn1_finish(&state, &out_size), kErrorOk);
+    buf.resize(out_size);
+    EXPECT_EQ(buf, expected) << "size " << c.size << ", hint " << c.hint;
+  }
+}
+
+// Make sure that a hint that is too small fails cleanly when the buffer has
+// no room for the extra length octets.
+TEST(Asn1, TagSizeHintBufferExhausted) {
+  const uint8_t kPattern = 0xa5;
+  // Tag, one reserved length octet and 0x80 bytes of contents.
+  const size_t kBufferSize = 1 + 1 + 0x80;
+  std::vector<uint8_t> buf(kBufferSize + 1, kPattern);
+  std::vector<uint8_t> data(0x80, 0x5a);
+
+  asn1_state_t state;
+  EXPECT_EQ(asn1_start(&state, &buf[0], kBufferSize), kErrorOk);
+  asn1_tag_t tag;
+  asn1_start_tag_with_size_hint(&state, &tag, kAsn1TagNumberOctetString, 0);
+  asn1_push_bytes(&state, data.data(), data.size());
+  EXPECT_EQ(state.error, kErrorOk);
+  asn1_finish_tag(&tag);
+  EXPECT_EQ(state.error, kErrorAsn1BufferExhausted);
+  // The contents were not moved past the end of the buffer.
+  EXPECT_EQ(buf[kBufferSize], kPattern);
+
+  // With the right hint, the same contents fit in one more byte.
+  EXPECT_EQ(asn1_start(&state, &buf[0], kBufferSize + 1), kErrorOk);
+  asn1_start_tag_with_size_hint(&state, &tag, kAsn1TagNumberOctetString,
+                                data.size());
+  asn1_push_bytes(&state, data.data(), data.size());
+  asn1_finish_tag(&tag);
+  size_t out_size;
+  EXPECT_EQ(asn1_finish(&state, &out_size), kErrorOk);
+  EXPECT_EQ(out_size, kBufferSize + 1);
+}
+
+// Make sure that the helpers, which pass an exact size hint, encode contents
+// that need a long-form length correctly.
+TEST(Asn1, PushLongContents) {
+  asn1_state_t state;
+  std::vector<uint8_t> buf(0x400);
+  EXPECT_EQ(asn1_start(&state, &buf[0], buf.size()), kErrorOk);
+
+  // 0x40 bytes are encoded as 0x80 hex characters.
+  std::vector<uint8_t> hex_in(0x40, 0xab);
+  asn1_push_hexstring(&state, kAsn1TagNumberPrintableString, hex_in.data(),
+                      hex_in.size());
+  std::vector<uint8_t> oid(0x80, 0x2a);
+  asn1_push_oid_raw(&state, oid.data(), oid.size());
+  // An unsigned integer with the MSB set needs a padding byte.
+  std::vector<uint8_t> integer(0x7f, 0x80);
+  asn1_push_integer(&state, kAsn1TagNumberInteger, false, integer.data(),
+                    integer.size());
+  // Leading zeroes are removed before the hint is computed.
+  std::vector<uint8_t> zeroes(0x100, 0);
+  zeroes.back() = 0x01;
+  asn1_push_integer(&state, kAsn1TagNumberInteger, false, zeroes.data(),
+                    zeroes.size());
+  size_t out_size;
+  EXPECT_EQ(asn1_finish(&state, &out_size), kErrorOk);
+
+  std::vector<uint8_t> expected = {kAsn1TagNumberPrintableString, 0x81, 0x80};
+  for (size_t i = 0; i < hex_in.size(); ++i) {
+    expected.push_back('a');
+    expected.push_back('b');
+  }
+  expected.insert(expected.end(), {kAsn1TagNumberOid, 0x81, 0x80});
+  expected.insert(expected.end(), oid.begin(), oid.end());
+  expected.insert(expected.end(), {kAsn1TagNumberInteger, 0x81, 0x80, 0x00});
+  expected.insert(expected.end(), integer.begin(), integer.end());
+  expected.insert(expected.end(), {kAsn1TagNumberInteger, 0x01, 0x01});
+  buf.resize(out_size);
+  EXPECT_EQ(buf, expected);
+}
+
 }  // namespace
 }  // namespace asn1_unittest
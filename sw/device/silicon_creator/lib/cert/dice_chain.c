@@ -315,9 +315,9 @@ rom_error_t dice_chain_attestation_creator(
       /*sealing_binding=*/&seal_binding_value,
       /*attest_binding=*/rom_ext_measurement,
       rom_ext_manifest->max_key_version));
-  HARDENED_RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen(
-      kDiceKeyCdi0, &static_dice_cdi_0.cdi_0_pubkey_id,
-      &static_dice_cdi_0.cdi_0_pubkey));
+
+  // Start the CDI_0 keygen on OTBN and buffer the cert page while it runs.
+  HARDENED_RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen_start(kDiceKeyCdi0));
 
   // Switch page for the device generated CDI_0.
   RETURN_IF_ERROR(dice_chain_load_flash(&kFlashCtrlInfoPageDiceCerts));
@@ -325,6 +325,9 @@ rom_error_t dice_chain_attestation_creator(
   // Seek to skip previous objects.
   RETURN_IF_ERROR(dice_chain_skip_cert_obj("UDS", /*name_size=*/4));
 
+  HARDENED_RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen_finish(
+      &static_dice_cdi_0.cdi_0_pubkey_id, &static_dice_cdi_0.cdi_0_pubkey));
+
   // Check if the current CDI_0 cert is valid.
   RETURN_IF_ERROR(dice_chain_load_cert_obj("CDI_0", /*name_size=*/6));
   if (dice_chain.cert_valid == kHardenedBoolFalse) {
@@ -405,10 +408,6 @@ rom_error_t dice_chain_attestation_owner(
     const manifest_t *owner_manifest, keymgr_binding_value_t *bl0_measurement,
     hmac_digest_t *owner_measurement, keymgr_binding_value_t *sealing_binding,
     owner_app_domain_t key_domain) {
-  // Handles the certificates from the immutable rom_ext first.
-  RETURN_IF_ERROR(dice_chain_attestation_check_uds());
-  RETURN_IF_ERROR(dice_chain_attestation_check_cdi_0());
-
   // Generate CDI_1 attestation keys and (potentially) update certificate.
   SEC_MMIO_WRITE_INCREMENT(kScKeymgrSecMmioSwBindingSet +
                            kScKeymgrSecMmioOwnerIntMaxVerSet);
@@ -431,8 +430,16 @@ rom_error_t dice_chain_attestation_owner(
       /*sealing_binding=*/sealing_binding,
       /*attest_binding=*/(keymgr_binding_value_t *)&attest_measurement,
       owner_manifest->max_key_version));
-  HARDENED_RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen(
-      kDiceKeyCdi1, &dice_chain.subject_pubkey_id, &dice_chain.subject_pubkey));
+  HARDENED_RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen_start(kDiceKeyCdi1));
+
+  // Handle the certificates from the immutable rom_ext while OTBN computes the
+  // CDI_1 public key. This only needs flash and Ibex, and must be done before
+  // `dice_chain.subject_pubkey` is overwritten below.
+  RETURN_IF_ERROR(dice_chain_attestation_check_uds());
+  RETURN_IF_ERROR(dice_chain_attestation_check_cdi_0());
+
+  HARDENED_RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen_finish(
+      &dice_chain.subject_pubkey_id, &dice_chain.subject_pubkey));
 
   // Check if the current CDI_1 cert is valid.
   RETURN_IF_ERROR(dice_chain_load_cert_obj("CDI_1", /*name_size=*/6));
@@ -123,17 +123,29 @@ static void transaction_start(transaction_params_t params) {
 /**
  * Copies `word_count` words from the read FIFO to the given buffer.
  *
- * Large reads may create back pressure.
+ * Large reads may create back pressure. The loop is unrolled so that the CPU
+ * drains the FIFO at close to bus speed while the controller keeps fetching.
  *
  * @param word_count Number of words to read from the FIFO.
  * @param[out] data Output buffer.
  */
 static void fifo_read(size_t word_count, void *data) {
+  const uint32_t fifo = flash_ctrl_core_base() + FLASH_CTRL_RD_FIFO_REG_OFFSET;
   size_t i = 0, r = word_count - 1;
+  for (; launder32(i) + 4 <= word_count && launder32(r) < word_count;
+       i += 4, r -= 4) {
+    uint32_t w0 = abs_mmio_read32(fifo);
+    uint32_t w1 = abs_mmio_read32(fifo);
+    uint32_t w2 = abs_mmio_read32(fifo);
+    uint32_t w3 = abs_mmio_read32(fifo);
+    write_32(w0, data);
+    write_32(w1, (char *)data + 1 * sizeof(uint32_t));
+    write_32(w2, (char *)data + 2 * sizeof(uint32_t));
+    write_32(w3, (char *)data + 3 * sizeof(uint32_t));
+    data = (char *)data + 4 * sizeof(uint32_t);
+  }
   for (; launder32(i) < word_count && launder32(r) < word_count; ++i, --r) {
-    write_32(
-        abs_mmio_read32(flash_ctrl_core_base() + FLASH_CTRL_RD_FIFO_REG_OFFSET),
-        data);
+    write_32(abs_mmio_read32(fifo), data);
     data = (char *)data + sizeof(uint32_t);
   }
   HARDENED_CHECK_EQ(i, word_count);
@@ -143,16 +155,30 @@ static void fifo_read(size_t word_count, void *data) {
 /**
  * Copies `word_count` words from the given buffer to the program FIFO.
  *
- * Large writes may create back pressure.
+ * Large writes may create back pressure. The loop is unrolled like the one in
+ * `fifo_read()`.
  *
  * @param word_count Number of words to write to the FIFO.
  * @param data Input buffer.
  */
 static void fifo_write(size_t word_count, const void *data) {
+  const uint32_t fifo =
+      flash_ctrl_core_base() + FLASH_CTRL_PROG_FIFO_REG_OFFSET;
   size_t i = 0, r = word_count - 1;
+  for (; launder32(i) + 4 <= word_count && launder32(r) < word_count;
+       i += 4, r -= 4) {
+    uint32_t w0 = read_32(data);
+    uint32_t w1 = read_32((const char *)data + 1 * sizeof(uint32_t));
+    uint32_t w2 = read_32((const char *)data + 2 * sizeof(uint32_t));
+    uint32_t w3 = read_32((const char *)data + 3 * sizeof(uint32_t));
+    abs_mmio_write32(fifo, w0);
+    abs_mmio_write32(fifo, w1);
+    abs_mmio_write32(fifo, w2);
+    abs_mmio_write32(fifo, w3);
+    data = (const char *)data + 4 * sizeof(uint32_t);
+  }
   for (; launder32(i) < word_count && launder32(r) < word_count; ++i, --r) {
-    abs_mmio_write32(flash_ctrl_core_base() + FLASH_CTRL_PROG_FIFO_REG_OFFSET,
-                     read_32(data));
+    abs_mmio_write32(fifo, read_32(data));
     data = (const char *)data + sizeof(uint32_t);
   }
   HARDENED_CHECK_EQ(i, word_count);
@@ -228,6 +254,52 @@ static rom_error_t write(uint32_t addr, flash_ctrl_partition_t partition,
   return kErrorOk;
 }
 
+/**
+ * Reads data from the given partition.
+ *
+ * Reads longer than a single transaction, which is limited by the `NUM` field
+ * of the `CONTROL` register, are split into back-to-back transactions. Within
+ * a transaction, the controller keeps fetching the following words into the
+ * read FIFO while the CPU drains it, so long reads should be issued with a
+ * single call rather than many small ones.
+ *
+ * @param addr Full byte address to read from.
+ * @param partition The partition to read from.
+ * @param word_count Number of bus words to read.
+ * @param[out] data Buffer to store the read data.
+ * @param error Error code to return in case of a flash controller error.
+ * @return Result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+static rom_error_t read(uint32_t addr, flash_ctrl_partition_t partition,
+                        uint32_t word_count, void *data, rom_error_t error) {
+  enum {
+    kMaxTransactionWordCount = FLASH_CTRL_CONTROL_NUM_MASK + 1,
+  };
+  while (true) {
+    uint32_t transaction_word_count = word_count < kMaxTransactionWordCount
+                                          ? word_count
+                                          : kMaxTransactionWordCount;
+    transaction_start((transaction_params_t){
+        .addr = addr,
+        .op_type = FLASH_CTRL_CONTROL_OP_VALUE_READ,
+        .partition = partition,
+        .word_count = transaction_word_count,
+        // Does not apply to read transactions.
+        .erase_type = kFlashCtrlEraseTypePage,
+    });
+    fifo_read(transaction_word_count, data);
+    word_count -= transaction_word_count;
+    if (word_count == 0) {
+      return wait_for_done(error);
+    }
+    RETURN_IF_ERROR(wait_for_done(error));
+
+    addr += transaction_word_count * sizeof(uint32_t);
+    data = (char *)data + transaction_word_count * sizeof(uint32_t);
+  }
+}
+
 /**
  * Disables all access to a page until next reset.
  *
@@ -345,31 +417,31 @@ void flash_ctrl_error_code_get(flash_ctrl_error_code_t *error_code) {
 
 rom_error_t flash_ctrl_data_read(uint32_t addr, uint32_t word_count,
                                  void *data) {
-  transaction_start((transaction_params_t){
-      .addr = addr,
-      .op_type = FLASH_CTRL_CONTROL_OP_VALUE_READ,
-      .partition = kFlashCtrlPartitionData,
-      .word_count = word_count,
-      // Does not apply to read transactions.
-      .erase_type = kFlashCtrlEraseTypePage,
-  });
-  fifo_read(word_count, data);
-  return wait_for_done(kErrorFlashCtrlDataRead);
+  return read(addr, kFlashCtrlPartitionData, word_count, data,
+              kErrorFlashCtrlDataRead);
 }
 
 rom_error_t flash_ctrl_info_read(const flash_ctrl_info_page_t *info_page,
                                  uint32_t offset, uint32_t word_count,
                                  void *data) {
-  transaction_start((transaction_params_t){
-      .addr = info_page->base_addr + offset,
-      .op_type = FLASH_CTRL_CONTROL_OP_VALUE_READ,
-      .partition = kFlashCtrlPartitionInfo0,
-      .word_count = word_count,
-      // Does not apply to read transactions.
-      .erase_type = kFlashCtrlEraseTypePage,
-  });
-  fifo_read(word_count, data);
-  return wait_for_done(kErrorFlashCtrlInfoRead);
+  return read(info_page->base_addr + offset, kFlashCtrlPartitionInfo0,
+              word_count, data, kErrorFlashCtrlInfoRead);
+}
+
+rom_error_t flash_ctrl_info_pages_read(const flash_ctrl_info_page_t *info_page,
+                                       uint32_t page_count, void *data) {
+  enum {
+    kPageWordCount = FLASH_CTRL_PARAM_BYTES_PER_PAGE / sizeof(uint32_t),
+  };
+  const uint32_t page_index =
+      (info_page->base_addr % FLASH_CTRL_PARAM_BYTES_PER_BANK) /
+      FLASH_CTRL_PARAM_BYTES_PER_PAGE;
+  if (page_count == 0 ||
+      page_count > FLASH_CTRL_PARAM_NUM_INFOS0 - page_index) {
+    return kErrorFlashCtrlInfoRead;
+  }
+  return read(info_page->base_addr, kFlashCtrlPartitionInfo0,
+              page_count * kPageWordCount, data, kErrorFlashCtrlInfoRead);
 }
 
 rom_error_t flash_ctrl_info_read_zeros_on_read_error(
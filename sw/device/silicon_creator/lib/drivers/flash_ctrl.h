@@ -325,6 +325,25 @@ rom_error_t flash_ctrl_info_read(const flash_ctrl_info_page_t *info_page,
                                  uint32_t offset, uint32_t word_count,
                                  void *data);
 
+/**
+ * Reads consecutive information pages.
+ *
+ * Reads `page_count` whole pages starting at `info_page` in the same bank,
+ * e.g. `kFlashCtrlInfoPageOwnerSlot0` and `kFlashCtrlInfoPageOwnerSlot1`.
+ * Reads must be enabled for all of these pages. This is faster than reading
+ * the pages one by one since the controller fetches ahead across the page
+ * boundaries while the CPU drains the read FIFO.
+ *
+ * @param info_page First information page to read.
+ * @param page_count Number of pages to read.
+ * @param[out] data Buffer of `page_count` pages to store the read data. Must
+ * be word aligned.
+ * @return Result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t flash_ctrl_info_pages_read(const flash_ctrl_info_page_t *info_page,
+                                       uint32_t page_count, void *data);
+
 /**
  * Reads data from an information page, returning all zeros if a read error code
  * is encountered.
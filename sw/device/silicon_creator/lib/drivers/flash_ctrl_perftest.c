@@ -0,0 +1,163 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/perf_test.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+#include "sw/device/silicon_creator/lib/base/sec_mmio.h"
+#include "sw/device/silicon_creator/lib/drivers/flash_ctrl.h"
+
+#include "hw/top/flash_ctrl_regs.h"
+
+// Compares the cost of reading several flash pages one transaction per page
+// with reading them through a single call, and checks that both return the
+// same data.
+//
+// There are no absolute cycle bounds: they depend on the flash timing of the
+// platform. Each single-call read must instead be no slower than the per-page
+// read of the same pages that precedes it.
+
+enum {
+  kNumRuns = 10,
+  kPageWords = FLASH_CTRL_PARAM_BYTES_PER_PAGE / sizeof(uint32_t),
+  kDataPageCount = 4,
+  kInfoPageCount = 2,
+};
+
+typedef struct perf_test {
+  // A human-readable name for this particular test, e.g. "data_per_page".
+  const char *label;
+
+  // Reads `word_count` words into `buf`. This function pointer must not be
+  // NULL.
+  rom_error_t (*func)(uint32_t *buf);
+
+  // Destination of the read.
+  uint32_t *buf;
+
+  // Number of words that `func` reads.
+  size_t word_count;
+} perf_test_t;
+
+static uint32_t buf_per_page[kDataPageCount * kPageWords];
+static uint32_t buf_chained[kDataPageCount * kPageWords];
+
+static rom_error_t data_per_page(uint32_t *buf) {
+  for (size_t i = 0; i < kDataPageCount; ++i) {
+    RETURN_IF_ERROR(flash_ctrl_data_read(i * FLASH_CTRL_PARAM_BYTES_PER_PAGE,
+                                         kPageWords, buf + i * kPageWords));
+  }
+  return kErrorOk;
+}
+
+static rom_error_t data_chained(uint32_t *buf) {
+  return flash_ctrl_data_read(0, kDataPageCount * kPageWords, buf);
+}
+
+// The boot data pages are adjacent, which `flash_ctrl_info_pages_read()`
+// requires.
+static rom_error_t info_per_page(uint32_t *buf) {
+  RETURN_IF_ERROR(
+      flash_ctrl_info_read(&kFlashCtrlInfoPageBootData0, 0, kPageWords, buf));
+  return flash_ctrl_info_read(&kFlashCtrlInfoPageBootData1, 0, kPageWords,
+                              buf + kPageWords);
+}
+
+static rom_error_t info_pages(uint32_t *buf) {
+  return flash_ctrl_info_pages_read(&kFlashCtrlInfoPageBootData0,
+                                    kInfoPageCount, buf);
+}
+
+// Read the pages once; `ctx` is the `perf_test_t` to run.
+static void perf_test_body(const void *ctx) {
+  const perf_test_t *test = ctx;
+  CHECK(test->func(test->buf) == kErrorOk);
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+// Tests come in per-page/single-call pairs over the same pages. Cycle counts
+// can be collected on a CW310 FPGA with:
+//
+//   $ ./bazelisk.sh test --test_output=all \
+//       //sw/device/silicon_creator/lib/drivers:flash_ctrl_perftest_fpga_cw310
+static const perf_test_t kPerfTests[] = {
+    {
+        .label = "data_per_page",
+        .func = &data_per_page,
+        .buf = buf_per_page,
+        .word_count = kDataPageCount * kPageWords,
+    },
+    {
+        .label = "data_chained",
+        .func = &data_chained,
+        .buf = buf_chained,
+        .word_count = kDataPageCount * kPageWords,
+    },
+    {
+        .label = "info_per_page",
+        .func = &info_per_page,
+        .buf = buf_per_page,
+        .word_count = kInfoPageCount * kPageWords,
+    },
+    {
+        .label = "info_pages",
+        .func = &info_pages,
+        .buf = buf_chained,
+        .word_count = kInfoPageCount * kPageWords,
+    },
+};
+
+bool test_main(void) {
+  // Initialize the sec_mmio table so that we can run this test with both rom
+  // and test_rom.
+  sec_mmio_init();
+  flash_ctrl_init();
+  flash_ctrl_data_default_perms_set((flash_ctrl_perms_t){
+      .read = kMultiBitBool4True,
+      .write = kMultiBitBool4False,
+      .erase = kMultiBitBool4False,
+  });
+  const flash_ctrl_perms_t kInfoPerms = {
+      .read = kMultiBitBool4True,
+      .write = kMultiBitBool4False,
+      .erase = kMultiBitBool4False,
+  };
+  flash_ctrl_info_perms_set(&kFlashCtrlInfoPageBootData0, kInfoPerms);
+  flash_ctrl_info_perms_set(&kFlashCtrlInfoPageBootData1, kInfoPerms);
+
+  bool all_expectations_match = true;
+  uint64_t per_page_num_cycles = 0;
+  for (size_t i = 0; i < ARRAYSIZE(kPerfTests); ++i) {
+    const perf_test_t *test = &kPerfTests[i];
+    CHECK(test->func != NULL);
+
+    const uint64_t num_cycles =
+        perf_test_measure(&perf_test_body, test, kNumRuns);
+    // `base_printf()` cannot print `uint64_t`.
+    CHECK(num_cycles < UINT32_MAX / 100);
+    LOG_INFO("%s: %d cycles", test->label, (uint32_t)num_cycles);
+
+    if (i % 2 == 0) {
+      per_page_num_cycles = num_cycles;
+      continue;
+    }
+    CHECK_ARRAYS_EQ(buf_chained, buf_per_page, test->word_count);
+    CHECK(per_page_num_cycles > 0);
+    const uint32_t percent_of_per_page =
+        (uint32_t)((100 * num_cycles) / per_page_num_cycles);
+    LOG_INFO("%s: %d%% of per-page", test->label, percent_of_per_page);
+    if (num_cycles > per_page_num_cycles) {
+      LOG_WARNING("%s: slower than the per-page read", test->label);
+      all_expectations_match = false;
+    }
+  }
+  return all_expectations_match;
+}
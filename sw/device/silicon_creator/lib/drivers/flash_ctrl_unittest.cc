@@ -338,6 +338,60 @@ TEST_F(TransferTest, ReadInfoOk) {
   EXPECT_EQ(words_out, words_);
 }
 
+TEST_F(TransferTest, ReadDataAcrossTransactions) {
+  // Reads longer than `CONTROL.NUM` allows are split into transactions.
+  constexpr uint32_t kMaxWords = FLASH_CTRL_CONTROL_NUM_MASK + 1;
+  std::vector<uint32_t> words(kMaxWords + 3);
+  for (size_t i = 0; i < words.size(); ++i) {
+    words[i] = 0x5a5a0000 + i;
+  }
+  ExpectTransferStart(0, 0, 0, FLASH_CTRL_CONTROL_OP_VALUE_READ, 0x1000,
+                      kMaxWords);
+  ExpectReadData({words.begin(), words.begin() + kMaxWords});
+  ExpectWaitForDone(true, false);
+  ExpectTransferStart(0, 0, 0, FLASH_CTRL_CONTROL_OP_VALUE_READ,
+                      0x1000 + kMaxWords * sizeof(uint32_t), 3);
+  ExpectReadData({words.begin() + kMaxWords, words.end()});
+  ExpectWaitForDone(true, false);
+
+  std::vector<uint32_t> words_out(words.size());
+  EXPECT_EQ(flash_ctrl_data_read(0x1000, words.size(), &words_out.front()),
+            kErrorOk);
+  EXPECT_EQ(words_out, words);
+}
+
+TEST_F(TransferTest, ReadInfoPagesOk) {
+  constexpr uint32_t kPageWords =
+      FLASH_CTRL_PARAM_BYTES_PER_PAGE / sizeof(uint32_t);
+  std::vector<uint32_t> words(2 * kPageWords);
+  for (size_t i = 0; i < words.size(); ++i) {
+    words[i] = 0xa5a50000 + i;
+  }
+  // Both owner pages are read in a single transaction.
+  const uint32_t addr =
+      1 * FLASH_CTRL_PARAM_BYTES_PER_BANK + 2 * FLASH_CTRL_PARAM_BYTES_PER_PAGE;
+  ExpectTransferStart(1, 0, 0, FLASH_CTRL_CONTROL_OP_VALUE_READ, addr,
+                      words.size());
+  ExpectReadData(words);
+  ExpectWaitForDone(true, false);
+
+  std::vector<uint32_t> words_out(words.size());
+  EXPECT_EQ(flash_ctrl_info_pages_read(&kFlashCtrlInfoPageOwnerSlot0, 2,
+                                       &words_out.front()),
+            kErrorOk);
+  EXPECT_EQ(words_out, words);
+}
+
+TEST_F(TransferTest, ReadInfoPagesOutOfBank) {
+  std::vector<uint32_t> words_out(1);
+  EXPECT_EQ(flash_ctrl_info_pages_read(&kFlashCtrlInfoPageOwnerSlot0, 0,
+                                       &words_out.front()),
+            kErrorFlashCtrlInfoRead);
+  EXPECT_EQ(flash_ctrl_info_pages_read(&kFlashCtrlInfoPageDiceCerts, 2,
+                                       &words_out.front()),
+            kErrorFlashCtrlInfoRead);
+}
+
 TEST_F(TransferTest, ProgDataOk) {
   ExpectTransferStart(0, 0, 0, FLASH_CTRL_CONTROL_OP_VALUE_PROG, 0x01234567,
                       words_.size());
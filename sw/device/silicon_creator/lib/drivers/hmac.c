@@ -19,14 +19,13 @@ static inline uint32_t hmac_base(void) {
   return dt_hmac_primary_reg_block(kHmacDt);
 }
 
-void hmac_sha256_configure(bool big_endian_digest) {
-  // Clear the config, stopping the SHA engine.
-  abs_mmio_write32(hmac_base() + HMAC_CFG_REG_OFFSET, 0u);
-
-  // Disable and clear interrupts. INTR_STATE register is rw1c.
-  abs_mmio_write32(hmac_base() + HMAC_INTR_ENABLE_REG_OFFSET, 0u);
-  abs_mmio_write32(hmac_base() + HMAC_INTR_STATE_REG_OFFSET, UINT32_MAX);
-
+/**
+ * Computes the configuration register value for SHA256 mode.
+ *
+ * @param big_endian_digest Whether the digest is read out big-endian.
+ * @return Configuration with the SHA engine enabled.
+ */
+static uint32_t sha256_cfg(bool big_endian_digest) {
   uint32_t reg = 0;
   reg = bitfield_bit32_write(reg, HMAC_CFG_DIGEST_SWAP_BIT, big_endian_digest);
   reg = bitfield_bit32_write(reg, HMAC_CFG_ENDIAN_SWAP_BIT, false);
@@ -37,7 +36,19 @@ void hmac_sha256_configure(bool big_endian_digest) {
                                HMAC_CFG_DIGEST_SIZE_VALUE_SHA2_256);
   reg = bitfield_field32_write(reg, HMAC_CFG_KEY_LENGTH_FIELD,
                                HMAC_CFG_KEY_LENGTH_VALUE_KEY_256);
-  abs_mmio_write32(hmac_base() + HMAC_CFG_REG_OFFSET, reg);
+  return reg;
+}
+
+void hmac_sha256_configure(bool big_endian_digest) {
+  // Clear the config, stopping the SHA engine.
+  abs_mmio_write32(hmac_base() + HMAC_CFG_REG_OFFSET, 0u);
+
+  // Disable and clear interrupts. INTR_STATE register is rw1c.
+  abs_mmio_write32(hmac_base() + HMAC_INTR_ENABLE_REG_OFFSET, 0u);
+  abs_mmio_write32(hmac_base() + HMAC_INTR_STATE_REG_OFFSET, UINT32_MAX);
+
+  abs_mmio_write32(hmac_base() + HMAC_CFG_REG_OFFSET,
+                   sha256_cfg(big_endian_digest));
 }
 
 inline void hmac_sha256_start(void) {
@@ -89,12 +100,17 @@ static void wait_for_done(void) {
   abs_mmio_write32(hmac_base() + HMAC_INTR_STATE_REG_OFFSET, reg);
 }
 
-void hmac_sha256_final_truncated(uint32_t *digest, size_t len) {
-  wait_for_done();
-
+/**
+ * Read the first `len` words of the digest.
+ *
+ * @param[out] digest Buffer to copy digest to.
+ * @param len Requested word-length.
+ * @param big_endian_digest Whether the block is configured for big-endian
+ *                          output.
+ */
+static void digest_read(uint32_t *digest, size_t len, bool big_endian_digest) {
   uint32_t result, incr;
-  uint32_t reg = abs_mmio_read32(hmac_base() + HMAC_CFG_REG_OFFSET);
-  if (bitfield_bit32_read(reg, HMAC_CFG_DIGEST_SWAP_BIT)) {
+  if (big_endian_digest) {
     // Big-endian output.
     result = HMAC_DIGEST_0_REG_OFFSET;
     incr = sizeof(uint32_t);
@@ -115,6 +131,18 @@ void hmac_sha256_final_truncated(uint32_t *digest, size_t len) {
   }
 }
 
+void hmac_sha256_final_truncated(uint32_t *digest, size_t len) {
+  wait_for_done();
+  uint32_t reg = abs_mmio_read32(hmac_base() + HMAC_CFG_REG_OFFSET);
+  digest_read(digest, len, bitfield_bit32_read(reg, HMAC_CFG_DIGEST_SWAP_BIT));
+}
+
+void hmac_sha256_final_truncated_configured(uint32_t *digest, size_t len,
+                                            bool big_endian_digest) {
+  wait_for_done();
+  digest_read(digest, len, big_endian_digest);
+}
+
 void hmac_sha256(const void *data, size_t len, hmac_digest_t *digest) {
   hmac_sha256_init();
   hmac_sha256_update(data, len);
@@ -152,10 +180,15 @@ void hmac_sha256_save(hmac_context_t *ctx) {
   abs_mmio_write32(hmac_base() + HMAC_CFG_REG_OFFSET, cfg);
 }
 
-void hmac_sha256_restore(const hmac_context_t *ctx) {
+/**
+ * Restore an operation's working state given the current configuration.
+ *
+ * @param ctx Saved operation state.
+ * @param cfg Current value of the configuration register.
+ */
+static void restore_with_cfg(const hmac_context_t *ctx, uint32_t cfg) {
   // Clear the `sha_en` bit to ensure the message length registers are
   // writeable. Leave the rest of the configuration unchanged.
-  uint32_t cfg = abs_mmio_read32(hmac_base() + HMAC_CFG_REG_OFFSET);
   cfg = bitfield_bit32_write(cfg, HMAC_CFG_SHA_EN_BIT, false);
   abs_mmio_write32(hmac_base() + HMAC_CFG_REG_OFFSET, cfg);
 
@@ -183,5 +216,14 @@ void hmac_sha256_restore(const hmac_context_t *ctx) {
   abs_mmio_write32(hmac_base() + HMAC_CMD_REG_OFFSET, cmd);
 }
 
+void hmac_sha256_restore(const hmac_context_t *ctx) {
+  restore_with_cfg(ctx, abs_mmio_read32(hmac_base() + HMAC_CFG_REG_OFFSET));
+}
+
+void hmac_sha256_restore_configured(const hmac_context_t *ctx,
+                                    bool big_endian_digest) {
+  restore_with_cfg(ctx, sha256_cfg(big_endian_digest));
+}
+
 extern void hmac_sha256_init(void);
 extern void hmac_sha256_final(hmac_digest_t *digest);
@@ -161,6 +161,38 @@ void hmac_sha256_save(hmac_context_t *ctx);
  */
 void hmac_sha256_restore(const hmac_context_t *ctx);
 
+/**
+ * Restore an operation's working state with a known configuration.
+ *
+ * Equivalent to `hmac_sha256_restore()`, but derives the configuration from
+ * `big_endian_digest` instead of reading it back from the block. This saves a
+ * register read per call in hash-chain loops that restore the same state many
+ * times without reconfiguring the block in between.
+ *
+ * @param ctx Saved operation state.
+ * @param big_endian_digest Must match the value most recently passed to
+ *                          `hmac_sha256_configure()`.
+ */
+void hmac_sha256_restore_configured(const hmac_context_t *ctx,
+                                    bool big_endian_digest);
+
+/**
+ * Finalizes SHA256 operation with a known configuration.
+ *
+ * Equivalent to `hmac_sha256_final_truncated()`, but takes the digest
+ * endianness from `big_endian_digest` instead of reading it back from the
+ * block.
+ *
+ * Note: the caller must call `hmac_sha256_process()` before calling this.
+ *
+ * @param[out] digest Buffer to copy digest to.
+ * @param len Requested word-length.
+ * @param big_endian_digest Must match the value most recently passed to
+ *                          `hmac_sha256_configure()`.
+ */
+void hmac_sha256_final_truncated_configured(uint32_t *digest, size_t len,
+                                            bool big_endian_digest);
+
 #ifdef __cplusplus
 }
 #endif
@@ -132,6 +132,59 @@ TEST_F(Sha256FinalTest, GetDigest) {
   EXPECT_THAT(got_digest.digest, ElementsAreArray(kExpectedDigest));
 }
 
+class Sha256RestoreTest : public HmacTest {};
+
+TEST_F(Sha256RestoreTest, RestoreConfiguredSkipsCfgRead) {
+  hmac_context_t ctx = {
+      0,
+      512,
+      {0x00000000, 0x11111111, 0x22222222, 0x33333333, 0x44444444, 0x55555555,
+       0x66666666, 0x77777777},
+  };
+  uint32_t key_len_256 = HMAC_CFG_KEY_LENGTH_VALUE_KEY_256;
+  uint32_t digest_256 = HMAC_CFG_DIGEST_SIZE_VALUE_SHA2_256;
+
+  EXPECT_ABS_WRITE32(base_ + HMAC_CFG_REG_OFFSET,
+                     {
+                         {HMAC_CFG_DIGEST_SWAP_BIT, true},
+                         {HMAC_CFG_SHA_EN_BIT, false},
+                         {HMAC_CFG_DIGEST_SIZE_OFFSET, digest_256},
+                         {HMAC_CFG_KEY_LENGTH_OFFSET, key_len_256},
+                     });
+  for (uint32_t i = 0; i < kHmacDigestNumWords; ++i) {
+    EXPECT_ABS_WRITE32(
+        base_ + HMAC_DIGEST_0_REG_OFFSET + i * sizeof(uint32_t),
+        ctx.digest[i]);
+  }
+  EXPECT_ABS_WRITE32(base_ + HMAC_MSG_LENGTH_LOWER_REG_OFFSET, 512);
+  EXPECT_ABS_WRITE32(base_ + HMAC_MSG_LENGTH_UPPER_REG_OFFSET, 0);
+  EXPECT_ABS_WRITE32(base_ + HMAC_CFG_REG_OFFSET,
+                     {
+                         {HMAC_CFG_DIGEST_SWAP_BIT, true},
+                         {HMAC_CFG_SHA_EN_BIT, true},
+                         {HMAC_CFG_DIGEST_SIZE_OFFSET, digest_256},
+                         {HMAC_CFG_KEY_LENGTH_OFFSET, key_len_256},
+                     });
+  EXPECT_ABS_WRITE32(base_ + HMAC_CMD_REG_OFFSET,
+                     {{HMAC_CMD_HASH_CONTINUE_BIT, true}});
+
+  hmac_sha256_restore_configured(&ctx, /*big_endian_digest=*/true);
+}
+
+TEST_F(Sha256RestoreTest, FinalConfiguredSkipsCfgRead) {
+  EXPECT_ABS_READ32(base_ + HMAC_INTR_STATE_REG_OFFSET,
+                    {{HMAC_INTR_STATE_HMAC_DONE_BIT, true}});
+  EXPECT_ABS_WRITE32(base_ + HMAC_INTR_STATE_REG_OFFSET,
+                     {{HMAC_INTR_STATE_HMAC_DONE_BIT, true}});
+  EXPECT_ABS_READ32(base_ + HMAC_DIGEST_0_REG_OFFSET, 0x01234567);
+  EXPECT_ABS_READ32(base_ + HMAC_DIGEST_1_REG_OFFSET, 0x89abcdef);
+
+  uint32_t digest[2];
+  hmac_sha256_final_truncated_configured(digest, ARRAYSIZE(digest),
+                                         /*big_endian_digest=*/true);
+  EXPECT_THAT(digest, ElementsAreArray({0x01234567u, 0x89abcdefu}));
+}
+
 class Sha256Test : public HmacTest {};
 
 TEST_F(Sha256Test, Sha256) {
@@ -29,6 +29,11 @@ rom_error_t flash_ctrl_info_read(const flash_ctrl_info_page_t *info_page,
                                             data);
 }
 
+rom_error_t flash_ctrl_info_pages_read(const flash_ctrl_info_page_t *info_page,
+                                       uint32_t page_count, void *data) {
+  return MockFlashCtrl::Instance().InfoPagesRead(info_page, page_count, data);
+}
+
 rom_error_t flash_ctrl_data_write(uint32_t addr, uint32_t word_count,
                                   const void *data) {
   return MockFlashCtrl::Instance().DataWrite(addr, word_count, data);
@@ -23,6 +23,8 @@ class MockFlashCtrl : public global_mock::GlobalMock<MockFlashCtrl> {
   MOCK_METHOD(rom_error_t, DataRead, (uint32_t, uint32_t, void *));
   MOCK_METHOD(rom_error_t, InfoRead,
               (const flash_ctrl_info_page_t *, uint32_t, uint32_t, void *));
+  MOCK_METHOD(rom_error_t, InfoPagesRead,
+              (const flash_ctrl_info_page_t *, uint32_t, void *));
   MOCK_METHOD(rom_error_t, DataWrite, (uint32_t, uint32_t, const void *));
   MOCK_METHOD(rom_error_t, InfoWrite,
               (const flash_ctrl_info_page_t *, uint32_t, uint32_t,
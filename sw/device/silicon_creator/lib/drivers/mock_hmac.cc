@@ -43,5 +43,16 @@ void hmac_sha256_save(hmac_context_t *ctx) {
 void hmac_sha256_restore(const hmac_context_t *ctx) {
   MockHmac::Instance().sha256_restore(ctx);
 }
+
+void hmac_sha256_restore_configured(const hmac_context_t *ctx,
+                                    bool big_endian_digest) {
+  MockHmac::Instance().sha256_restore_configured(ctx, big_endian_digest);
+}
+
+void hmac_sha256_final_truncated_configured(uint32_t *digest, size_t len,
+                                            bool big_endian_digest) {
+  MockHmac::Instance().sha256_final_truncated_configured(digest, len,
+                                                         big_endian_digest);
+}
 }  // extern "C"
 }  // namespace rom_test
@@ -28,6 +28,9 @@ class MockHmac : public global_mock::GlobalMock<MockHmac> {
   MOCK_METHOD(void, sha256, (const void *, size_t, hmac_digest_t *));
   MOCK_METHOD(void, sha256_save, (hmac_context_t *));
   MOCK_METHOD(void, sha256_restore, (const hmac_context_t *));
+  MOCK_METHOD(void, sha256_restore_configured, (const hmac_context_t *, bool));
+  MOCK_METHOD(void, sha256_final_truncated_configured,
+              (uint32_t *, size_t, bool));
 };
 
 }  // namespace internal
@@ -9,6 +9,12 @@ extern "C" {
 
 void spi_device_init(void) { MockSpiDevice::Instance().Init(); }
 
+void spi_device_read_enable(void) { MockSpiDevice::Instance().ReadEnable(); }
+
+void spi_device_read_buffer_write(const void *data, size_t len) {
+  MockSpiDevice::Instance().ReadBufferWrite(data, len);
+}
+
 rom_error_t spi_device_cmd_get(spi_device_cmd_t *cmd) {
   return MockSpiDevice::Instance().CmdGet(cmd);
 }
@@ -17,6 +23,10 @@ void spi_device_flash_status_clear(void) {
   MockSpiDevice::Instance().FlashStatusClear();
 }
 
+void spi_device_flash_status_set(uint32_t status) {
+  MockSpiDevice::Instance().FlashStatusSet(status);
+}
+
 uint32_t spi_device_flash_status_get(void) {
   return MockSpiDevice::Instance().FlashStatusGet();
 }
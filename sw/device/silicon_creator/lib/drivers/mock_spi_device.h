@@ -17,8 +17,11 @@ namespace internal {
 class MockSpiDevice : public global_mock::GlobalMock<MockSpiDevice> {
  public:
   MOCK_METHOD(void, Init, ());
+  MOCK_METHOD(void, ReadEnable, ());
+  MOCK_METHOD(void, ReadBufferWrite, (const void *, size_t));
   MOCK_METHOD(rom_error_t, CmdGet, (spi_device_cmd_t *));
   MOCK_METHOD(void, FlashStatusClear, ());
+  MOCK_METHOD(void, FlashStatusSet, (uint32_t));
   MOCK_METHOD(uint32_t, FlashStatusGet, ());
 };
 
@@ -125,28 +125,45 @@ rom_error_t sc_otbn_dmem_read(size_t num_words, sc_otbn_addr_t src,
   return kErrorOk;
 }
 
+enum {
+  /**
+   * Value of the INTR_STATE register with only the `done` interrupt set.
+   */
+  kScOtbnIntrStateDone = (1 << OTBN_INTR_COMMON_DONE_BIT),
+};
+
 /**
- * Helper function for running an OTBN command.
+ * Helper function for starting an OTBN command.
  *
- * This function blocks until OTBN is idle.
+ * Clears the `done` interrupt and issues the command without waiting for it
+ * to complete; see `sc_otbn_cmd_wait()`.
  *
  * @param cmd OTBN command.
+ */
+static void sc_otbn_cmd_start(sc_otbn_cmd_t cmd) {
+  abs_mmio_write32(otbn_base() + OTBN_INTR_STATE_REG_OFFSET,
+                   kScOtbnIntrStateDone);
+  abs_mmio_write32(otbn_base() + OTBN_CMD_REG_OFFSET, cmd);
+}
+
+/**
+ * Helper function for waiting for a command started by `sc_otbn_cmd_start()`.
+ *
+ * This function blocks until OTBN is idle.
+ *
  * @param error Error to return if operation fails.
  * @return Result of the operation.
  */
 OT_WARN_UNUSED_RESULT
-static rom_error_t sc_otbn_cmd_run(sc_otbn_cmd_t cmd, rom_error_t error) {
+static rom_error_t sc_otbn_cmd_wait(rom_error_t error) {
   enum {
-    kIntrStateDone = (1 << OTBN_INTR_COMMON_DONE_BIT),
+    kIntrStateDone = kScOtbnIntrStateDone,
     // Use a bit index that doesn't overlap with error bits.
     kResDoneBit = 31,
   };
   static_assert((UINT32_C(1) << kResDoneBit) > kOtbnErrBitsLast,
                 "kResDoneBit must not overlap with OTBN error bits");
 
-  abs_mmio_write32(otbn_base() + OTBN_INTR_STATE_REG_OFFSET, kIntrStateDone);
-  abs_mmio_write32(otbn_base() + OTBN_CMD_REG_OFFSET, cmd);
-
   rom_error_t res = kErrorOk ^ (UINT32_C(1) << kResDoneBit);
   uint32_t reg = 0;
   do {
@@ -177,7 +194,22 @@ static rom_error_t sc_otbn_cmd_run(sc_otbn_cmd_t cmd, rom_error_t error) {
   return error;
 }
 
-rom_error_t sc_otbn_execute(void) {
+/**
+ * Helper function for running an OTBN command.
+ *
+ * This function blocks until OTBN is idle.
+ *
+ * @param cmd OTBN command.
+ * @param error Error to return if operation fails.
+ * @return Result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+static rom_error_t sc_otbn_cmd_run(sc_otbn_cmd_t cmd, rom_error_t error) {
+  sc_otbn_cmd_start(cmd);
+  return sc_otbn_cmd_wait(error);
+}
+
+rom_error_t sc_otbn_execute_start(void) {
   // If OTBN is busy, wait for it to be done.
   HARDENED_RETURN_IF_ERROR(sc_otbn_busy_wait_for_done());
 
@@ -187,7 +219,17 @@ rom_error_t sc_otbn_execute(void) {
   sec_mmio_write32(otbn_base() + OTBN_CTRL_REG_OFFSET,
                    1 << OTBN_CTRL_SOFTWARE_ERRS_FATAL_BIT);
 
-  return sc_otbn_cmd_run(kScOtbnCmdExecute, kErrorOtbnExecutionFailed);
+  sc_otbn_cmd_start(kScOtbnCmdExecute);
+  return kErrorOk;
+}
+
+rom_error_t sc_otbn_execute_finish(void) {
+  return sc_otbn_cmd_wait(kErrorOtbnExecutionFailed);
+}
+
+rom_error_t sc_otbn_execute(void) {
+  HARDENED_RETURN_IF_ERROR(sc_otbn_execute_start());
+  return sc_otbn_execute_finish();
 }
 
 uint32_t sc_otbn_instruction_count_get(void) {
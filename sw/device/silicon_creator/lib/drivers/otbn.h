@@ -256,6 +256,26 @@ rom_error_t sc_otbn_dmem_read(size_t num_words, const sc_otbn_addr_t src,
 OT_WARN_UNUSED_RESULT
 rom_error_t sc_otbn_execute(void);
 
+/**
+ * Start the execution of the application loaded into OTBN without waiting
+ * for it to finish.
+ *
+ * This function blocks until OTBN is idle before starting. The caller must
+ * not access OTBN memories until `sc_otbn_execute_finish()` returns.
+ *
+ * @return Result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t sc_otbn_execute_start(void);
+
+/**
+ * Wait for an execution started by `sc_otbn_execute_start()` to finish.
+ *
+ * @return Result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t sc_otbn_execute_finish(void);
+
 /**
  * Blocks until OTBN is idle.
  *
@@ -129,6 +129,69 @@ TEST_F(ExecuteTest, ExecuteBlockUntilIdle) {
   EXPECT_EQ(sc_otbn_execute(), kErrorOk);
 }
 
+TEST_F(ExecuteTest, ExecuteStartFinish) {
+  // Read twice for hardening.
+  EXPECT_ABS_READ32(base_ + OTBN_STATUS_REG_OFFSET, kScOtbnStatusIdle);
+  EXPECT_ABS_READ32(base_ + OTBN_STATUS_REG_OFFSET, kScOtbnStatusIdle);
+
+  EXPECT_SEC_WRITE32(base_ + OTBN_CTRL_REG_OFFSET, 0x1);
+
+  EXPECT_ABS_WRITE32(base_ + OTBN_INTR_STATE_REG_OFFSET,
+                     {
+                         {OTBN_INTR_COMMON_DONE_BIT, 1},
+                     });
+  EXPECT_ABS_WRITE32(base_ + OTBN_CMD_REG_OFFSET, kScOtbnCmdExecute);
+
+  // Starting must not wait for the `done` interrupt.
+  EXPECT_EQ(sc_otbn_execute_start(), kErrorOk);
+
+  EXPECT_ABS_READ32(base_ + OTBN_INTR_STATE_REG_OFFSET, 0);
+  EXPECT_ABS_READ32(base_ + OTBN_INTR_STATE_REG_OFFSET,
+                    {
+                        {OTBN_INTR_COMMON_DONE_BIT, 1},
+                    });
+  EXPECT_ABS_WRITE32(base_ + OTBN_INTR_STATE_REG_OFFSET,
+                     {
+                         {OTBN_INTR_COMMON_DONE_BIT, 1},
+                     });
+  EXPECT_ABS_READ32(base_ + OTBN_ERR_BITS_REG_OFFSET, err_bits_ok_);
+  EXPECT_ABS_READ32(base_ + OTBN_STATUS_REG_OFFSET, kScOtbnStatusIdle);
+  EXPECT_ABS_READ32(base_ + OTBN_STATUS_REG_OFFSET, kScOtbnStatusIdle);
+
+  EXPECT_EQ(sc_otbn_execute_finish(), kErrorOk);
+}
+
+TEST_F(ExecuteTest, ExecuteStartFinishError) {
+  // Read twice for hardening.
+  EXPECT_ABS_READ32(base_ + OTBN_STATUS_REG_OFFSET, kScOtbnStatusIdle);
+  EXPECT_ABS_READ32(base_ + OTBN_STATUS_REG_OFFSET, kScOtbnStatusIdle);
+
+  EXPECT_SEC_WRITE32(base_ + OTBN_CTRL_REG_OFFSET, 0x1);
+
+  EXPECT_ABS_WRITE32(base_ + OTBN_INTR_STATE_REG_OFFSET,
+                     {
+                         {OTBN_INTR_COMMON_DONE_BIT, 1},
+                     });
+  EXPECT_ABS_WRITE32(base_ + OTBN_CMD_REG_OFFSET, kScOtbnCmdExecute);
+
+  // Errors during execution are only reported when finishing.
+  EXPECT_EQ(sc_otbn_execute_start(), kErrorOk);
+
+  EXPECT_ABS_READ32(base_ + OTBN_INTR_STATE_REG_OFFSET,
+                    {
+                        {OTBN_INTR_COMMON_DONE_BIT, 1},
+                    });
+  EXPECT_ABS_WRITE32(base_ + OTBN_INTR_STATE_REG_OFFSET,
+                     {
+                         {OTBN_INTR_COMMON_DONE_BIT, 1},
+                     });
+  EXPECT_ABS_READ32(base_ + OTBN_ERR_BITS_REG_OFFSET,
+                    1 << OTBN_ERR_BITS_FATAL_SOFTWARE_BIT);
+  EXPECT_ABS_READ32(base_ + OTBN_STATUS_REG_OFFSET, kScOtbnStatusLocked);
+
+  EXPECT_EQ(sc_otbn_execute_finish(), kErrorOtbnExecutionFailed);
+}
+
 class IsBusyTest : public OtbnTest {};
 
 TEST_F(IsBusyTest, Success) {
@@ -7,6 +7,7 @@
 #include "hw/top/dt/dt_spi_device.h"
 #include "sw/device/lib/base/abs_mmio.h"
 #include "sw/device/lib/base/bitfield.h"
+#include "sw/device/lib/base/hardened.h"
 #include "sw/device/lib/base/memory.h"
 #include "sw/device/silicon_creator/lib/drivers/lifecycle.h"
 #include "sw/device/silicon_creator/lib/error.h"
@@ -34,6 +35,11 @@ enum {
    */
   kSfdpAreaEndOff = SPI_DEVICE_EGRESS_BUFFER_REG_OFFSET +
                     kSpiDeviceSfdpAreaOffset + kSpiDeviceSfdpAreaNumBytes,
+  /**
+   * Start address of the read buffer in spi_device buffer.
+   */
+  kReadBufferStartOff =
+      SPI_DEVICE_EGRESS_BUFFER_REG_OFFSET + kSpiDeviceReadBufferOffset,
   /**
    * Flash data partition size in bits.
    */
@@ -623,6 +629,35 @@ void spi_device_init(void) {
                    reg);
 }
 
+void spi_device_read_enable(void) {
+  // Configure the READ command (CMD_INFO_5). The first read slot is served by
+  // hardware from the read buffer.
+  cmd_info_set((cmd_info_t){
+      .reg_offset = SPI_DEVICE_CMD_INFO_5_REG_OFFSET,
+      .op_code = kSpiDeviceOpcodeRead,
+      .address = true,
+      .dummy_cycles = 0,
+      .handled_in_sw = false,
+  });
+}
+
+void spi_device_read_buffer_write(const void *data, size_t len) {
+  HARDENED_CHECK_LE(len, kSpiDeviceReadBufferNumBytes);
+  uint32_t dest = spi_device_reg_base() + kReadBufferStartOff;
+  const char *src = (const char *)data;
+  for (; len >= sizeof(uint32_t); len -= sizeof(uint32_t)) {
+    abs_mmio_write32(dest, read_32(src));
+    dest += sizeof(uint32_t);
+    src += sizeof(uint32_t);
+  }
+  if (len > 0) {
+    // The buffer only accepts word writes; pad the last word with `0xff`s.
+    uint32_t word = UINT32_MAX;
+    memcpy(&word, src, len);
+    abs_mmio_write32(dest, word);
+  }
+}
+
 rom_error_t spi_device_cmd_get(spi_device_cmd_t *cmd) {
   uint32_t reg = 0;
   bool cmd_pending = false;
@@ -675,6 +710,11 @@ void spi_device_flash_status_clear(void) {
                    0);
 }
 
+void spi_device_flash_status_set(uint32_t status) {
+  abs_mmio_write32(spi_device_reg_base() + SPI_DEVICE_FLASH_STATUS_REG_OFFSET,
+                   status);
+}
+
 uint32_t spi_device_flash_status_get(void) {
   return abs_mmio_read32(spi_device_reg_base() +
                          SPI_DEVICE_FLASH_STATUS_REG_OFFSET);
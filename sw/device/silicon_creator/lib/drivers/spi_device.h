@@ -82,6 +82,17 @@ enum {
    */
   kSpiDevicePayloadAreaNumWords =
       kSpiDevicePayloadAreaNumBytes / sizeof(uint32_t),
+  /**
+   * Offset of the read buffer in spi_device egress buffer.
+   */
+  kSpiDeviceReadBufferOffset = 0x0,
+  /**
+   * Size of the read buffer in spi_device egress buffer in bytes.
+   *
+   * READ commands are served from this buffer, indexed by the lower bits of
+   * the address.
+   */
+  kSpiDeviceReadBufferNumBytes = 2048,
   /**
    * Index of the WEL bit in flash status register.
    */
@@ -124,6 +135,15 @@ typedef enum spi_device_opcode {
    * spi_device sends `kSpiDeviceSfdpTable` from its buffer.
    */
   kSpiDeviceOpcodeReadSfdp = 0x5a,
+  /**
+   * READ command.
+   *
+   * This command is handled by the spi_device once enabled with
+   * `spi_device_read_enable()`. Upon receiving this opcode and 3 bytes of
+   * address, spi_device sends the contents of its read buffer starting at the
+   * address modulo `kSpiDeviceReadBufferNumBytes`.
+   */
+  kSpiDeviceOpcodeRead = 0x03,
   /**
    * CHIP_ERASE command.
    *
@@ -304,6 +324,25 @@ extern const spi_device_sfdp_table_t kSpiDeviceSfdpTable;
  */
 void spi_device_init(void);
 
+/**
+ * Enables the READ command.
+ *
+ * Bootstrap does not support reads, but other users of the flash-mode
+ * interface can use the read buffer to send data to the host. Call after
+ * `spi_device_init()`.
+ */
+void spi_device_read_enable(void);
+
+/**
+ * Writes data to the read buffer.
+ *
+ * The host can read the data back with a READ command starting at address 0.
+ *
+ * @param data Data to write.
+ * @param len Size of `data` in bytes, at most `kSpiDeviceReadBufferNumBytes`.
+ */
+void spi_device_read_buffer_write(const void *data, size_t len);
+
 /**
  * A SPI flash command.
  */
@@ -353,6 +392,17 @@ rom_error_t spi_device_cmd_get(spi_device_cmd_t *cmd);
  */
 void spi_device_flash_status_clear(void);
 
+/**
+ * Sets the SPI flash status register.
+ *
+ * Like `spi_device_flash_status_clear()`, this clears the WIP and WEL bits
+ * unless they are set in `status`. The remaining bits are visible to the host
+ * through the READ_STATUS command.
+ *
+ * @param status New value of the status register.
+ */
+void spi_device_flash_status_set(uint32_t status);
+
 /**
  * Gets the SPI flash status register.
  */
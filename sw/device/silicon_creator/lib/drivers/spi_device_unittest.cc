@@ -171,6 +171,35 @@ TEST_F(SpiDeviceTest, FlashStatusClear) {
   spi_device_flash_status_clear();
 }
 
+TEST_F(SpiDeviceTest, FlashStatusSet) {
+  EXPECT_ABS_WRITE32(base_ + SPI_DEVICE_FLASH_STATUS_REG_OFFSET, 0x04);
+
+  spi_device_flash_status_set(0x04);
+}
+
+TEST_F(SpiDeviceTest, ReadEnable) {
+  EXPECT_ABS_WRITE32(base_ + SPI_DEVICE_CMD_INFO_5_REG_OFFSET,
+                     {
+                         {SPI_DEVICE_CMD_INFO_5_OPCODE_5_OFFSET,
+                          kSpiDeviceOpcodeRead},
+                         {SPI_DEVICE_CMD_INFO_5_ADDR_MODE_5_OFFSET,
+                          SPI_DEVICE_CMD_INFO_0_ADDR_MODE_0_VALUE_ADDR3B},
+                         {SPI_DEVICE_CMD_INFO_5_VALID_5_BIT, 1},
+                     });
+
+  spi_device_read_enable();
+}
+
+TEST_F(SpiDeviceTest, ReadBufferWrite) {
+  constexpr std::array<uint8_t, 6> kData = {0x00, 0x01, 0x02,
+                                            0x03, 0x04, 0x05};
+  EXPECT_ABS_WRITE32(base_ + SPI_DEVICE_EGRESS_BUFFER_REG_OFFSET, 0x03020100);
+  EXPECT_ABS_WRITE32(base_ + SPI_DEVICE_EGRESS_BUFFER_REG_OFFSET + 4,
+                     0xffff0504);
+
+  spi_device_read_buffer_write(kData.data(), kData.size());
+}
+
 TEST_F(SpiDeviceTest, FlashStatusGet) {
   EXPECT_ABS_READ32(base_ + SPI_DEVICE_FLASH_STATUS_REG_OFFSET, 0xa5);
 
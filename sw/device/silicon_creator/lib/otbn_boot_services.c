@@ -108,10 +108,21 @@ static rom_error_t load_attestation_keygen_seed(uint32_t additional_seed_idx,
 
 rom_error_t otbn_boot_app_load(void) { return sc_otbn_load_app(kOtbnAppBoot); }
 
-rom_error_t otbn_boot_attestation_keygen(
+/**
+ * Whether a keygen routine was started by `attestation_keygen_start()` and has
+ * not been finished yet.
+ */
+static hardened_bool_t keygen_pending = kHardenedBoolFalse;
+
+/**
+ * Sideloads an attestation key into OTBN and starts the keygen routine.
+ *
+ * The caller must not use OTBN until `attestation_keygen_finish()` returns.
+ */
+OT_WARN_UNUSED_RESULT
+static rom_error_t attestation_keygen_start(
     uint32_t additional_seed_idx, sc_keymgr_key_type_t key_type,
-    sc_keymgr_diversification_t diversification,
-    ecdsa_p256_public_key_t *public_key) {
+    sc_keymgr_diversification_t diversification) {
   // Trigger key manager to sideload the attestation key into OTBN.
   HARDENED_RETURN_IF_ERROR(
       sc_keymgr_generate_key_otbn(key_type, diversification));
@@ -137,9 +148,32 @@ rom_error_t otbn_boot_attestation_keygen(
       ARRAYSIZE(zero_buf), zero_buf,
       kOtbnVarBootAttestationAdditionalSeed + kAttestationSeedBytes));
 
-  // Run the OTBN program (blocks until OTBN is done).
-  HARDENED_RETURN_IF_ERROR(sc_otbn_execute());
+  // Start the OTBN routine.
+  HARDENED_RETURN_IF_ERROR(sc_otbn_execute_start());
   SEC_MMIO_WRITE_INCREMENT(kScOtbnSecMmioExecute);
+  keygen_pending = kHardenedBoolTrue;
+  return kErrorOk;
+}
+
+/**
+ * Waits for the keygen routine started by `attestation_keygen_start()` and
+ * reads back the public key.
+ *
+ * Fails with `kErrorOtbnInvalidArgument` if no keygen routine is pending.
+ */
+OT_WARN_UNUSED_RESULT
+static rom_error_t attestation_keygen_finish(
+    ecdsa_p256_public_key_t *public_key) {
+  // OTBN only raises `done` for a routine that was started, so waiting without
+  // one would never return.
+  if (launder32(keygen_pending) != kHardenedBoolTrue) {
+    return kErrorOtbnInvalidArgument;
+  }
+  HARDENED_CHECK_EQ(keygen_pending, kHardenedBoolTrue);
+  keygen_pending = kHardenedBoolFalse;
+
+  // Wait for the OTBN routine to finish.
+  HARDENED_RETURN_IF_ERROR(sc_otbn_execute_finish());
 
   // TODO(#20023): Check the instruction count register (see `mod_exp_otbn`).
 
@@ -152,6 +186,15 @@ rom_error_t otbn_boot_attestation_keygen(
   return kErrorOk;
 }
 
+rom_error_t otbn_boot_attestation_keygen(
+    uint32_t additional_seed_idx, sc_keymgr_key_type_t key_type,
+    sc_keymgr_diversification_t diversification,
+    ecdsa_p256_public_key_t *public_key) {
+  HARDENED_RETURN_IF_ERROR(attestation_keygen_start(
+      additional_seed_idx, key_type, diversification));
+  return attestation_keygen_finish(public_key);
+}
+
 /**
  * Helper function to convert an ECC P256 public key from little to big endian
  * in place.
@@ -161,14 +204,18 @@ static void pubkey_le_to_be_convert(ecdsa_p256_public_key_t *pubkey) {
   util_reverse_bytes(pubkey->y, kEcdsaP256PublicKeyCoordBytes);
 }
 
-rom_error_t otbn_boot_cert_ecc_p256_keygen(sc_keymgr_ecc_key_t key,
-                                           hmac_digest_t *pubkey_id,
-                                           ecdsa_p256_public_key_t *pubkey) {
+rom_error_t otbn_boot_cert_ecc_p256_keygen_start(sc_keymgr_ecc_key_t key) {
   HARDENED_RETURN_IF_ERROR(sc_keymgr_state_check(key.required_keymgr_state));
 
-  // Generate / sideload key material into OTBN, and generate the ECC keypair.
-  HARDENED_RETURN_IF_ERROR(otbn_boot_attestation_keygen(
-      key.keygen_seed_idx, key.type, *key.keymgr_diversifier, pubkey));
+  // Generate / sideload key material into OTBN, and start generating the ECC
+  // keypair.
+  return attestation_keygen_start(key.keygen_seed_idx, key.type,
+                                  *key.keymgr_diversifier);
+}
+
+rom_error_t otbn_boot_cert_ecc_p256_keygen_finish(
+    hmac_digest_t *pubkey_id, ecdsa_p256_public_key_t *pubkey) {
+  HARDENED_RETURN_IF_ERROR(attestation_keygen_finish(pubkey));
 
   // Keys are represented in certificates in big endian format, but the key is
   // output from OTBN in little endian format, so we convert the key to
@@ -186,6 +233,13 @@ rom_error_t otbn_boot_cert_ecc_p256_keygen(sc_keymgr_ecc_key_t key,
   return kErrorOk;
 }
 
+rom_error_t otbn_boot_cert_ecc_p256_keygen(sc_keymgr_ecc_key_t key,
+                                           hmac_digest_t *pubkey_id,
+                                           ecdsa_p256_public_key_t *pubkey) {
+  HARDENED_RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen_start(key));
+  return otbn_boot_cert_ecc_p256_keygen_finish(pubkey_id, pubkey);
+}
+
 rom_error_t otbn_boot_attestation_key_save(
     uint32_t additional_seed_idx, sc_keymgr_key_type_t key_type,
     sc_keymgr_diversification_t diversification) {
@@ -270,10 +324,9 @@ rom_error_t otbn_boot_attestation_endorse(const hmac_digest_t *digest,
   return kErrorOk;
 }
 
-rom_error_t otbn_boot_sigverify(const ecdsa_p256_public_key_t *key,
-                                const ecdsa_p256_signature_t *sig,
-                                const hmac_digest_t *digest,
-                                uint32_t *recovered_r) {
+rom_error_t otbn_boot_sigverify_start(const ecdsa_p256_public_key_t *key,
+                                      const ecdsa_p256_signature_t *sig,
+                                      const hmac_digest_t *digest) {
   // Write the mode.
   uint32_t mode = kOtbnBootModeSigverify;
   HARDENED_RETURN_IF_ERROR(
@@ -296,8 +349,14 @@ rom_error_t otbn_boot_sigverify(const ecdsa_p256_public_key_t *key,
                                               sig->s, kOtbnVarBootS));
 
   // Start the OTBN routine.
-  HARDENED_RETURN_IF_ERROR(sc_otbn_execute());
+  HARDENED_RETURN_IF_ERROR(sc_otbn_execute_start());
   SEC_MMIO_WRITE_INCREMENT(kScOtbnSecMmioExecute);
+  return kErrorOk;
+}
+
+rom_error_t otbn_boot_sigverify_finish(uint32_t *recovered_r) {
+  // Wait for the OTBN routine to finish.
+  HARDENED_RETURN_IF_ERROR(sc_otbn_execute_finish());
 
   // Check if the signature passed basic checks.
   uint32_t ok;
@@ -316,3 +375,11 @@ rom_error_t otbn_boot_sigverify(const ecdsa_p256_public_key_t *key,
   return sc_otbn_dmem_read(kEcdsaP256SignatureComponentWords, kOtbnVarBootXr,
                            recovered_r);
 }
+
+rom_error_t otbn_boot_sigverify(const ecdsa_p256_public_key_t *key,
+                                const ecdsa_p256_signature_t *sig,
+                                const hmac_digest_t *digest,
+                                uint32_t *recovered_r) {
+  HARDENED_RETURN_IF_ERROR(otbn_boot_sigverify_start(key, sig, digest));
+  return otbn_boot_sigverify_finish(recovered_r);
+}
@@ -118,6 +118,38 @@ rom_error_t otbn_boot_cert_ecc_p256_keygen(sc_keymgr_ecc_key_t key,
                                            hmac_digest_t *pubkey_id,
                                            ecdsa_p256_public_key_t *pubkey);
 
+/**
+ * Starts generating an ECC P256 certificate keypair on OTBN.
+ *
+ * Same as `otbn_boot_cert_ecc_p256_keygen`, but returns as soon as OTBN is
+ * running so that the caller can do other work on Ibex in the meantime. The
+ * caller must not use OTBN until `otbn_boot_cert_ecc_p256_keygen_finish`
+ * returns. The key manager is idle when this function returns.
+ *
+ * Preconditions: keymgr has been initialized and cranked to the desired stage.
+ *
+ * @param key The description of the desired key to generate.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t otbn_boot_cert_ecc_p256_keygen_start(sc_keymgr_ecc_key_t key);
+
+/**
+ * Finishes an ECC P256 keypair generation started with
+ * `otbn_boot_cert_ecc_p256_keygen_start`.
+ *
+ * Blocks until OTBN is done and returns the public key and key ID as
+ * `otbn_boot_cert_ecc_p256_keygen` does. Fails without waiting on OTBN if no
+ * keygen was started, or if the last one was already finished.
+ *
+ * @param[out] pubkey_id The public key ID (for embedding into certificates).
+ * @param[out] pubkey The public key.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t otbn_boot_cert_ecc_p256_keygen_finish(
+    hmac_digest_t *pubkey_id, ecdsa_p256_public_key_t *pubkey);
+
 /**
  * Saves an attestation private key to OTBN's scratchpad.
  *
@@ -200,6 +232,39 @@ rom_error_t otbn_boot_sigverify(const ecdsa_p256_public_key_t *key,
                                 const hmac_digest_t *digest,
                                 uint32_t *recovered_r);
 
+/**
+ * Starts an ECDSA-P256 signature verification on OTBN.
+ *
+ * Same as `otbn_boot_sigverify`, but returns as soon as OTBN is running so
+ * that the caller can do other work on Ibex in the meantime. The caller must
+ * not use OTBN until `otbn_boot_sigverify_finish` returns.
+ *
+ * Expects the OTBN boot-services program to already be loaded; see
+ * `otbn_boot_app_load`.
+ *
+ * @param key An ECDSA-P256 public key.
+ * @param sig An ECDSA-P256 signature.
+ * @param digest Message digest to check against.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t otbn_boot_sigverify_start(const ecdsa_p256_public_key_t *key,
+                                      const ecdsa_p256_signature_t *sig,
+                                      const hmac_digest_t *digest);
+
+/**
+ * Finishes an ECDSA-P256 signature verification started with
+ * `otbn_boot_sigverify_start`.
+ *
+ * Blocks until OTBN is done and returns the recovered `r` value as
+ * `otbn_boot_sigverify` does.
+ *
+ * @param[out] recovered_r Buffer for the recovered `r` value.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t otbn_boot_sigverify_finish(uint32_t *recovered_r);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -123,6 +123,48 @@ rom_error_t attestation_keygen_test(void) {
   return kErrorOk;
 }
 
+rom_error_t cert_keygen_start_finish_test(void) {
+  const sc_keymgr_ecc_key_t kKey = {
+      .type = kScKeymgrKeyTypeAttestation,
+      .keygen_seed_idx = kFlashInfoFieldUdsKeySeedIdx,
+      .keymgr_diversifier = &kDiversification,
+      .required_keymgr_state = kScKeymgrStateCreatorRootKey,
+  };
+  hmac_digest_t pubkey_id;
+  ecdsa_p256_public_key_t pk;
+
+  // Finishing without a started keygen fails instead of waiting for OTBN.
+  CHECK(otbn_boot_cert_ecc_p256_keygen_finish(&pubkey_id, &pk) ==
+        kErrorOtbnInvalidArgument);
+
+  // A keygen that fails to start cannot be finished either.
+  sc_keymgr_ecc_key_t wrong_state_key = kKey;
+  wrong_state_key.required_keymgr_state = kScKeymgrStateOwnerKey;
+  CHECK(otbn_boot_cert_ecc_p256_keygen_start(wrong_state_key) ==
+        kErrorKeymgrInternal);
+  CHECK(otbn_boot_cert_ecc_p256_keygen_finish(&pubkey_id, &pk) ==
+        kErrorOtbnInvalidArgument);
+
+  // Work done on Ibex between start and finish does not change the result.
+  hmac_digest_t expected_id;
+  ecdsa_p256_public_key_t expected_pk;
+  RETURN_IF_ERROR(
+      otbn_boot_cert_ecc_p256_keygen(kKey, &expected_id, &expected_pk));
+  RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen_start(kKey));
+  hmac_digest_t digest;
+  hmac_sha256(kTestMessage, kTestMessageLen, &digest);
+  RETURN_IF_ERROR(otbn_boot_cert_ecc_p256_keygen_finish(&pubkey_id, &pk));
+  CHECK_ARRAYS_EQ((unsigned char *)&pk, (unsigned char *)&expected_pk,
+                  sizeof(pk));
+  CHECK_ARRAYS_EQ((unsigned char *)&pubkey_id, (unsigned char *)&expected_id,
+                  sizeof(pubkey_id));
+
+  // A keygen can only be finished once.
+  CHECK(otbn_boot_cert_ecc_p256_keygen_finish(&pubkey_id, &pk) ==
+        kErrorOtbnInvalidArgument);
+  return kErrorOk;
+}
+
 rom_error_t attestation_advance_and_endorse_test(void) {
   // Generate and save the a keypair.
   ecdsa_p256_public_key_t pk;
@@ -251,6 +293,8 @@ bool test_main(void) {
 
   EXECUTE_TEST(result, sigverify_test);
   EXECUTE_TEST(result, attestation_keygen_test);
+  // Needs the keymgr in the CreatorRootKey state.
+  EXECUTE_TEST(result, cert_keygen_start_finish_test);
   EXECUTE_TEST(result, attestation_advance_and_endorse_test);
   EXECUTE_TEST(result, attestation_keygen_test);
   EXECUTE_TEST(result, attestation_advance_and_endorse_test);
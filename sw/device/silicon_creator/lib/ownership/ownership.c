@@ -176,6 +176,29 @@ static rom_error_t unlocked_init(boot_data_t *bootdata, owner_config_t *config,
   return kErrorOk;
 }
 
+/**
+ * Reads the owner pages one at a time, marking a page invalid if it cannot be
+ * read.
+ */
+static void ownership_pages_read_each(void) {
+  if (flash_ctrl_info_read(&kFlashCtrlInfoPageOwnerSlot0, 0,
+                           sizeof(owner_page[0]) / sizeof(uint32_t),
+                           &owner_page[0]) == kErrorOk) {
+    owner_page_valid[0] = owner_page_validity_check(0);
+  } else {
+    owner_page_valid[0] = kOwnerPageStatusInvalid;
+    memset(&owner_page[0], 0xff, sizeof(owner_page[0]));
+  }
+  if (flash_ctrl_info_read(&kFlashCtrlInfoPageOwnerSlot1, 0,
+                           sizeof(owner_page[1]) / sizeof(uint32_t),
+                           &owner_page[1]) == kErrorOk) {
+    owner_page_valid[1] = owner_page_validity_check(1);
+  } else {
+    owner_page_valid[1] = kOwnerPageStatusInvalid;
+    memset(&owner_page[1], 0xff, sizeof(owner_page[1]));
+  }
+}
+
 rom_error_t ownership_init(boot_data_t *bootdata, owner_config_t *config,
                            owner_application_keyring_t *keyring) {
   flash_ctrl_perms_t perm = {
@@ -196,23 +219,17 @@ rom_error_t ownership_init(boot_data_t *bootdata, owner_config_t *config,
   // turn on read/write/earse permissions until we need them.
   flash_ctrl_info_cfg_set(&kFlashCtrlInfoPageOwnerSecret, cfg);
 
-  // We don't want to abort ownership setup if we fail to
-  // read the INFO pages, so we discard the error result.
-  if (flash_ctrl_info_read(&kFlashCtrlInfoPageOwnerSlot0, 0,
-                           sizeof(owner_page[0]) / sizeof(uint32_t),
-                           &owner_page[0]) == kErrorOk) {
+  // Read both owner pages with a single flash transaction.  If that fails,
+  // read them one at a time so that an error in one page does not invalidate
+  // the other.  We don't want to abort ownership setup if we fail to read the
+  // INFO pages, so we discard the error result.
+  if (flash_ctrl_info_pages_read(&kFlashCtrlInfoPageOwnerSlot0,
+                                 ARRAYSIZE(owner_page),
+                                 owner_page) == kErrorOk) {
     owner_page_valid[0] = owner_page_validity_check(0);
-  } else {
-    owner_page_valid[0] = kOwnerPageStatusInvalid;
-    memset(&owner_page[0], 0xff, sizeof(owner_page[0]));
-  }
-  if (flash_ctrl_info_read(&kFlashCtrlInfoPageOwnerSlot1, 0,
-                           sizeof(owner_page[1]) / sizeof(uint32_t),
-                           &owner_page[1]) == kErrorOk) {
     owner_page_valid[1] = owner_page_validity_check(1);
   } else {
-    owner_page_valid[1] = kOwnerPageStatusInvalid;
-    memset(&owner_page[1], 0xff, sizeof(owner_page[1]));
+    ownership_pages_read_each();
   }
 
   // Depending on ownership state:
@@ -39,6 +39,40 @@ rom_error_t sigverify_ecdsa_p256_verify(const ecdsa_p256_signature_t *signature,
                                         const hmac_digest_t *act_digest,
                                         uint32_t *flash_exec);
 
+/**
+ * Starts verifying an ECDSA-P256 signature.
+ *
+ * The verification runs on OTBN, so the caller can do other work, such as
+ * SPHINCS+ verification, before calling
+ * `sigverify_ecdsa_p256_verify_finish()`. The caller must always finish a
+ * verification that was started successfully, and must not use OTBN until
+ * then.
+ *
+ * @param signature The signature to verify, little endian.
+ * @param key The public key to use for verification, little endian.
+ * @param act_digest The actual digest of the signed message.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t sigverify_ecdsa_p256_verify_start(
+    const ecdsa_p256_signature_t *signature, const ecdsa_p256_public_key_t *key,
+    const hmac_digest_t *act_digest);
+
+/**
+ * Finishes verifying an ECDSA-P256 signature.
+ *
+ * Waits for the verification started by `sigverify_ecdsa_p256_verify_start()`
+ * and checks its result as `sigverify_ecdsa_p256_verify()` does.
+ *
+ * @param signature The signature being verified, little endian.
+ * @param[out] flash_exec The partial value to write to the flash_ctrl EXEC
+ * register.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t sigverify_ecdsa_p256_verify_finish(
+    const ecdsa_p256_signature_t *signature, uint32_t *flash_exec);
+
 /**
  * Transforms `kSigverifyEcdsaSuccess` into `kErrorOk`.
  *
@@ -13,9 +13,12 @@
 
 void thash(const uint32_t *in, size_t inblocks, const spx_ctx_t *ctx,
            const spx_addr_t *addr, uint32_t *out) {
-  hmac_sha256_restore(&ctx->state_seeded);
+  // The block is still configured as `spx_hash_initialize()` left it.
+  hmac_sha256_restore_configured(&ctx->state_seeded,
+                                 /*big_endian_digest=*/true);
   hmac_sha256_update((unsigned char *)addr->addr, kSpxSha256AddrBytes);
   hmac_sha256_update_words(in, inblocks * kSpxNWords);
   hmac_sha256_process();
-  hmac_sha256_final_truncated(out, kSpxNWords);
+  hmac_sha256_final_truncated_configured(out, kSpxNWords,
+                                         /*big_endian_digest=*/true);
 }
@@ -45,13 +45,17 @@ static void gen_chain(const uint32_t *in, uint8_t start, const spx_ctx_t *ctx,
   spx_addr_hash_set(addr, start);
   for (uint8_t i = start; i + 1 < kSpxWotsW; i++) {
     // This loop body is essentially just `thash`, inlined for performance.
-    hmac_sha256_restore(&ctx->state_seeded);
+    // `spx_hash_initialize()` configured the block for big-endian digests, so
+    // skip reading the configuration back twice per hash.
+    hmac_sha256_restore_configured(&ctx->state_seeded,
+                                   /*big_endian_digest=*/true);
     hmac_sha256_update((unsigned char *)addr->addr, kSpxSha256AddrBytes);
     hmac_sha256_update_words(out, kSpxNWords);
     hmac_sha256_process();
     // Update the address while HMAC is processing for performance reasons.
     spx_addr_hash_set(addr, i + 1);
-    hmac_sha256_final_truncated(out, kSpxNWords);
+    hmac_sha256_final_truncated_configured(out, kSpxNWords,
+                                           /*big_endian_digest=*/true);
   }
 }
 
@@ -456,6 +456,60 @@ TEST_F(BootstrapTest, DataWriteErrorMisalignedAddr) {
   EXPECT_EQ(bootstrap(), kErrorUnknown);
 }
 
+TEST_F(BootstrapTest, DataWriteErrorMisalignedAddrLongPayload) {
+  // Erase
+  ExpectBootstrapRequestCheck(true);
+  EXPECT_CALL(spi_device_, Init());
+  ExpectSpiCmd(ChipEraseCmd());
+  ExpectSpiFlashStatusGet(true);
+  ExpectFlashCtrlChipErase(kErrorOk, kErrorOk);
+  // Verify
+  ExpectFlashCtrlEraseVerify(kErrorOk, kErrorOk);
+  EXPECT_CALL(spi_device_, FlashStatusClear());
+  // Program
+  auto cmd = PageProgramCmd(0xfff0, 256);
+  ExpectSpiCmd(cmd);
+  ExpectSpiFlashStatusGet(true);
+  ExpectFlashCtrlWriteEnable();
+  EXPECT_CALL(flash_ctrl_, DataWrite(0xfff0, 4, NotNull()))
+      .WillOnce(Return(kErrorUnknown));
+  // The second write still runs before the first error is reported.
+  EXPECT_CALL(flash_ctrl_, DataWrite(0xff00, 60, NotNull()))
+      .WillOnce(Return(kErrorOk));
+  ExpectFlashCtrlAllDisable();
+
+  EXPECT_EQ(bootstrap(), kErrorUnknown);
+}
+
+TEST_F(BootstrapTest, PageProgramCompletesBeforeWipClear) {
+  // Erase
+  ExpectBootstrapRequestCheck(true);
+  EXPECT_CALL(spi_device_, Init());
+  ExpectSpiCmd(ChipEraseCmd());
+  ExpectSpiFlashStatusGet(true);
+  ExpectFlashCtrlChipErase(kErrorOk, kErrorOk);
+  // Verify
+  ExpectFlashCtrlEraseVerify(kErrorOk, kErrorOk);
+  EXPECT_CALL(spi_device_, FlashStatusClear());
+
+  // Each page must be fully programmed and write access revoked before WIP is
+  // cleared, since the host may reset the chip as soon as it sees WIP clear.
+  for (uint32_t addr = 0; addr < 512; addr += 256) {
+    ExpectSpiCmd(PageProgramCmd(addr, 256));
+    ExpectSpiFlashStatusGet(true);
+    ExpectFlashCtrlWriteEnable();
+    EXPECT_CALL(flash_ctrl_, DataWrite(addr, 64, NotNull()))
+        .WillOnce(Return(kErrorOk));
+    ExpectFlashCtrlAllDisable();
+    EXPECT_CALL(spi_device_, FlashStatusClear());
+  }
+  // Reset
+  ExpectSpiCmd(ResetCmd());
+  EXPECT_CALL(rstmgr_, Reset());
+
+  EXPECT_EQ(bootstrap(), kErrorUnknown);
+}
+
 TEST_F(BootstrapTest, BadProgramAddress) {
   // Erase
   ExpectBootstrapRequestCheck(true);
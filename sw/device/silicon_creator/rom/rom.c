@@ -20,6 +20,7 @@
 #include "sw/device/silicon_creator/lib/base/static_critical_version.h"
 #include "sw/device/silicon_creator/lib/boot_data.h"
 #include "sw/device/silicon_creator/lib/boot_log.h"
+#include "sw/device/silicon_creator/lib/boot_profile.h"
 #include "sw/device/silicon_creator/lib/cfi.h"
 #include "sw/device/silicon_creator/lib/chip_info.h"
 #include "sw/device/silicon_creator/lib/drivers/alert.h"
@@ -250,6 +251,9 @@ static rom_error_t rom_init(void) {
   boot_log->retention_ram_initialized =
       reset_reasons & reset_mask ? kHardenedBoolTrue : kHardenedBoolFalse;
 
+  // In a normal build, this function inlines to nothing.
+  boot_profile_init();
+
   // Always store the retention RAM version so the ROM_EXT can depend on its
   // accuracy even after scrambling.
   retention_sram_get()->version = kRetentionSramVersion4;
@@ -310,6 +314,7 @@ static rom_error_t rom_init(void) {
 OT_WARN_UNUSED_RESULT
 static rom_error_t rom_verify(const manifest_t *manifest,
                               uint32_t *flash_exec) {
+  boot_profile_mark(kBootProfileRomVerifyStart);
   // Check security version and manifest constraints.
   //
   // The poisoning work (`anti_rollback`) invalidates signatures if the
@@ -392,27 +397,29 @@ static rom_error_t rom_verify(const manifest_t *manifest,
   /**
    * Verify the ECDSA/SPX+ signatures of ROM_EXT.
    *
-   * We swap the order of signature verifications randomly.
+   * ECDSA runs on OTBN while SPX+ runs on Ibex and HMAC, so the ECDSA
+   * verification is started first and finished after SPX+. Both always run
+   * to completion and both must succeed; we check their results in a random
+   * order.
    */
   *flash_exec = 0;
+  boot_profile_mark(kBootProfileRomDigestDone);
+  HARDENED_RETURN_IF_ERROR(sigverify_ecdsa_p256_verify_start(
+      &manifest->ecdsa_signature, ecdsa_key, &act_digest));
+  rom_error_t spx_error = sigverify_spx_verify(
+      spx_signature, spx_key, spx_config, lc_state, &usage_constraints_from_hw,
+      sizeof(usage_constraints_from_hw), anti_rollback, anti_rollback_len,
+      digest_region.start, digest_region.length, &act_digest, flash_exec);
+  boot_profile_mark(kBootProfileRomSpxDone);
+  rom_error_t ecdsa_error =
+      sigverify_ecdsa_p256_verify_finish(&manifest->ecdsa_signature, flash_exec);
+  boot_profile_mark(kBootProfileRomEcdsaDone);
   if (rnd_uint32() < 0x80000000) {
-    HARDENED_RETURN_IF_ERROR(sigverify_ecdsa_p256_verify(
-        &manifest->ecdsa_signature, ecdsa_key, &act_digest, flash_exec));
-
-    return sigverify_spx_verify(
-        spx_signature, spx_key, spx_config, lc_state,
-        &usage_constraints_from_hw, sizeof(usage_constraints_from_hw),
-        anti_rollback, anti_rollback_len, digest_region.start,
-        digest_region.length, &act_digest, flash_exec);
+    HARDENED_RETURN_IF_ERROR(ecdsa_error);
+    return spx_error;
   } else {
-    HARDENED_RETURN_IF_ERROR(sigverify_spx_verify(
-        spx_signature, spx_key, spx_config, lc_state,
-        &usage_constraints_from_hw, sizeof(usage_constraints_from_hw),
-        anti_rollback, anti_rollback_len, digest_region.start,
-        digest_region.length, &act_digest, flash_exec));
-
-    return sigverify_ecdsa_p256_verify(&manifest->ecdsa_signature, ecdsa_key,
-                                       &act_digest, flash_exec);
+    HARDENED_RETURN_IF_ERROR(spx_error);
+    return ecdsa_error;
   }
 }
 
@@ -545,6 +552,7 @@ static rom_error_t rom_measure_otp_partitions(
 OT_WARN_UNUSED_RESULT
 static rom_error_t rom_boot(const manifest_t *manifest, uint32_t flash_exec) {
   CFI_FUNC_COUNTER_INCREMENT(rom_counters, kCfiRomBoot, 1);
+  boot_profile_mark(kBootProfileRomBootStart);
   HARDENED_RETURN_IF_ERROR(sc_keymgr_state_check(kScKeymgrStateReset));
 
   boot_log_t *boot_log = &retention_sram_get()->creator.boot_log;
@@ -665,8 +673,9 @@ static rom_error_t rom_boot(const manifest_t *manifest, uint32_t flash_exec) {
   }
   CFI_FUNC_COUNTER_INCREMENT(rom_counters, kCfiRomBoot, 5);
 
-  // In a normal build, this function inlines to nothing.
+  // In a normal build, these functions inline to nothing.
   stack_utilization_print();
+  boot_profile_mark(kBootProfileRomExtJump);
 
   // (Potentially) Execute the immutable ROM_EXT section.
   uint32_t rom_ext_immutable_section_enabled =
@@ -731,6 +740,7 @@ static rom_error_t rom_try_boot(void) {
 
   // Read boot data from flash
   HARDENED_RETURN_IF_ERROR(boot_data_read(lc_state, &boot_data));
+  boot_profile_mark(kBootProfileRomBootDataRead);
 
   boot_policy_manifests_t manifests = boot_policy_manifests_get();
   uint32_t flash_exec = 0;
@@ -5,6 +5,8 @@
 #include "sw/device/silicon_creator/rom_ext/rescue.h"
 
 #include "sw/device/lib/arch/device.h"
+#include "sw/device/lib/base/bitfield.h"
+#include "sw/device/lib/base/crc32.h"
 #include "sw/device/lib/base/memory.h"
 #include "sw/device/silicon_creator/lib/boot_data.h"
 #include "sw/device/silicon_creator/lib/dbg_print.h"
@@ -12,6 +14,7 @@
 #include "sw/device/silicon_creator/lib/drivers/lifecycle.h"
 #include "sw/device/silicon_creator/lib/drivers/retention_sram.h"
 #include "sw/device/silicon_creator/lib/drivers/rstmgr.h"
+#include "sw/device/silicon_creator/lib/drivers/spi_device.h"
 #include "sw/device/silicon_creator/lib/drivers/uart.h"
 #include "sw/device/silicon_creator/lib/ownership/datatypes.h"
 #include "sw/device/silicon_creator/lib/ownership/owner_block.h"
@@ -29,6 +32,25 @@ const uint32_t kFlashBankSize =
     kFlashPageSize * FLASH_CTRL_PARAM_REG_PAGES_PER_BANK;
 static rescue_state_t rescue_state;
 
+static rom_error_t rescue_send(rescue_state_t *state, const void *data,
+                               size_t len) {
+  if (state->type == kRescueTypeSpi) {
+    // The host reads the data back from the read buffer once WIP clears.
+    spi_device_read_buffer_write(data, len);
+    return kErrorOk;
+  }
+  return xmodem_send(iohandle, data, len);
+}
+
+static void rescue_cancel(rescue_state_t *state) {
+  if (state->type == kRescueTypeSpi) {
+    spi_device_flash_status_set(
+        bitfield_bit32_write(0, kRescueSpiStatusErrorBit, true));
+    return;
+  }
+  xmodem_cancel(iohandle);
+}
+
 rom_error_t flash_firmware_block(rescue_state_t *state) {
   uint32_t bank_offset =
       state->mode == kRescueModeFirmwareSlotB ? kFlashBankSize : 0;
@@ -53,7 +75,7 @@ rom_error_t flash_firmware_block(rescue_state_t *state) {
         sizeof(state->data) / sizeof(uint32_t), state->data));
     state->flash_offset += sizeof(state->data);
   } else {
-    xmodem_cancel(iohandle);
+    rescue_cancel(state);
     return kErrorRescueImageTooBig;
   }
   return kErrorOk;
@@ -221,17 +243,17 @@ static rom_error_t handle_send_modes(rescue_state_t *state,
   const retention_sram_t *rr = retention_sram_get();
   switch (state->mode) {
     case kRescueModeBootLog:
-      HARDENED_RETURN_IF_ERROR(xmodem_send(iohandle, &rr->creator.boot_log,
+      HARDENED_RETURN_IF_ERROR(rescue_send(state, &rr->creator.boot_log,
                                            sizeof(rr->creator.boot_log)));
       break;
     case kRescueModeBootSvcRsp:
-      HARDENED_RETURN_IF_ERROR(xmodem_send(iohandle, &rr->creator.boot_svc_msg,
+      HARDENED_RETURN_IF_ERROR(rescue_send(state, &rr->creator.boot_svc_msg,
                                            sizeof(rr->creator.boot_svc_msg)));
       break;
     case kRescueModeOpenTitanID: {
       lifecycle_device_id_t id;
       lifecycle_device_id_get(&id);
-      HARDENED_RETURN_IF_ERROR(xmodem_send(iohandle, &id, sizeof(id)));
+      HARDENED_RETURN_IF_ERROR(rescue_send(state, &id, sizeof(id)));
       break;
     }
     case kRescueModeOwnerPage0:
@@ -241,7 +263,7 @@ static rom_error_t handle_send_modes(rescue_state_t *state,
                                                : &kFlashCtrlInfoPageOwnerSlot1,
           0, sizeof(state->data) / sizeof(uint32_t), state->data));
       HARDENED_RETURN_IF_ERROR(
-          xmodem_send(iohandle, state->data, sizeof(state->data)));
+          rescue_send(state, state->data, sizeof(state->data)));
       break;
 
     case kRescueModeBootSvcReq:
@@ -267,7 +289,7 @@ static rom_error_t handle_recv_modes(rescue_state_t *state,
   hardened_bool_t allow =
       owner_rescue_command_allowed(state->config, state->mode);
   if (allow != kHardenedBoolTrue) {
-    xmodem_cancel(iohandle);
+    rescue_cancel(state);
     return kErrorRescueBadMode;
   }
 
@@ -285,7 +307,7 @@ static rom_error_t handle_recv_modes(rescue_state_t *state,
         const boot_svc_msg_t *msg = (const boot_svc_msg_t *)state->data;
         allow = owner_rescue_command_allowed(state->config, msg->header.type);
         if (allow != kHardenedBoolTrue) {
-          xmodem_cancel(iohandle);
+          rescue_cancel(state);
           return kErrorRescueBadMode;
         }
         memcpy(&rr->creator.boot_svc_msg, state->data,
@@ -379,9 +401,124 @@ static rom_error_t protocol(rescue_state_t *state, boot_data_t *bootdata) {
   }
 }
 
+/**
+ * Handles an SPI rescue control frame.
+ *
+ * @param state Rescue state.
+ * @param bootdata Boot data.
+ * @param cmd PAGE_PROGRAM command carrying the control frame.
+ * @param[out] ok Whether the frame was accepted.
+ * @return kErrorOk unless rescue should stop.
+ */
+static rom_error_t spi_control(rescue_state_t *state, boot_data_t *bootdata,
+                               const spi_device_cmd_t *cmd, bool *ok) {
+  rescue_spi_ctrl_t ctrl;
+  *ok = false;
+  if (cmd->payload_byte_count < sizeof(ctrl)) {
+    return kErrorOk;
+  }
+  memcpy(&ctrl, cmd->payload, sizeof(ctrl));
+  switch (ctrl.op) {
+    case kRescueSpiOpMode:
+      if (ctrl.arg == kRescueModeBaud) {
+        // There is no baud rate to change on SPI.
+        return kErrorOk;
+      }
+      validate_mode(ctrl.arg, state, bootdata);
+      *ok = true;
+      // Fill the read buffer before WIP clears.
+      return handle_send_modes(state, bootdata);
+    case kRescueSpiOpBlock:
+      if (state->offset != 0) {
+        // The previous block was short and has not been handled yet. Only the
+        // last block before `DONE` may be short, and the host has already
+        // overwritten its data, so restart the upload.
+        state->frame = 1;
+        state->offset = 0;
+        state->flash_offset = 0;
+        return kErrorOk;
+      }
+      if (ctrl.arg == 0 || ctrl.arg > sizeof(state->data) ||
+          crc32(state->data, ctrl.arg) != ctrl.crc32) {
+        // Let the host retransmit the block.
+        return kErrorOk;
+      }
+      state->offset = ctrl.arg;
+      HARDENED_RETURN_IF_ERROR(handle_recv_modes(state, bootdata));
+      state->frame += 1;
+      *ok = true;
+      return kErrorOk;
+    case kRescueSpiOpDone:
+      if (state->offset % sizeof(state->data) != 0) {
+        // Extend the residue out to a full block and then handle it.
+        memset(state->data + state->offset, 0xff,
+               sizeof(state->data) - state->offset);
+        state->offset = sizeof(state->data);
+        HARDENED_RETURN_IF_ERROR(handle_recv_modes(state, bootdata));
+      }
+      if (state->reboot) {
+        return kErrorRescueReboot;
+      }
+      state->frame = 1;
+      state->offset = 0;
+      state->flash_offset = 0;
+      *ok = true;
+      return kErrorOk;
+    default:
+      return kErrorOk;
+  }
+}
+
+/**
+ * SPI rescue protocol.
+ *
+ * The host drives the same modes as the XMODEM protocol using standard SPI
+ * flash commands, which avoids the UART bottleneck for firmware uploads:
+ * - PAGE_PROGRAM below `kRescueSpiCtrlAddr` fills the data buffer.
+ * - PAGE_PROGRAM to `kRescueSpiCtrlAddr` sends a `rescue_spi_ctrl_t`.
+ * - READ returns the data of send modes from the read buffer.
+ * - RESET reboots the chip.
+ *
+ * WIP stays set until a command is handled; the error bit reports failures.
+ */
+static rom_error_t protocol_spi(rescue_state_t *state, boot_data_t *bootdata) {
+  state->reboot = true;
+  validate_mode(kRescueModeFirmware, state, bootdata);
+
+  spi_device_init();
+  spi_device_read_enable();
+  spi_device_cmd_t cmd;
+  while (true) {
+    HARDENED_RETURN_IF_ERROR(spi_device_cmd_get(&cmd));
+    bool ok = true;
+    switch (cmd.opcode) {
+      case kSpiDeviceOpcodePageProgram:
+        if (cmd.address == kRescueSpiCtrlAddr) {
+          HARDENED_RETURN_IF_ERROR(spi_control(state, bootdata, &cmd, &ok));
+        } else if (cmd.address < sizeof(state->data) &&
+                   cmd.payload_byte_count <=
+                       sizeof(state->data) - cmd.address) {
+          memcpy(state->data + cmd.address, cmd.payload,
+                 cmd.payload_byte_count);
+        } else {
+          ok = false;
+        }
+        break;
+      case kSpiDeviceOpcodeReset:
+        return kErrorRescueReboot;
+      default:
+        // Erase commands have no meaning in rescue; just complete them.
+        break;
+    }
+    spi_device_flash_status_set(
+        bitfield_bit32_write(0, kRescueSpiStatusErrorBit, !ok));
+  }
+}
+
 rom_error_t rescue_protocol(boot_data_t *bootdata,
                             const owner_rescue_config_t *config) {
   rescue_state.config = config;
+  rescue_state.type = kRescueTypeXmodem;
   if ((hardened_bool_t)config == kHardenedBoolFalse) {
     HARDENED_CHECK_EQ((hardened_bool_t)config, kHardenedBoolFalse);
     // If there is no rescue config, then the rescue region starts immediately
@@ -392,8 +529,13 @@ rom_error_t rescue_protocol(boot_data_t *bootdata,
     rescue_state.flash_start = (uint32_t)config->start * kFlashPageSize;
     rescue_state.flash_limit =
         (uint32_t)(config->start + config->size) * kFlashPageSize;
+    if (config->rescue_type == kRescueTypeSpi) {
+      rescue_state.type = kRescueTypeSpi;
+    }
   }
-  rom_error_t result = protocol(&rescue_state, bootdata);
+  rom_error_t result = rescue_state.type == kRescueTypeSpi
+                           ? protocol_spi(&rescue_state, bootdata)
+                           : protocol(&rescue_state, bootdata);
   if (result == kErrorRescueReboot) {
     rstmgr_reset();
   }
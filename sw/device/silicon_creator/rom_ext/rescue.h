@@ -12,6 +12,10 @@
 #include "sw/device/silicon_creator/lib/error.h"
 #include "sw/device/silicon_creator/lib/ownership/datatypes.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
 enum {
   // Rescue is signalled by asserting serial break to the UART for at least
   // 4 byte periods.  At 115200 bps, one byte period is about 87us; four is
@@ -19,6 +23,54 @@ enum {
   kRescueDetectTime = 350,
 };
 
+typedef enum {
+  /** `XMDM`: XMODEM-CRC over the console UART. */
+  kRescueTypeXmodem = 0x4d444d58,
+  /** `SPID`: SPI flash commands via the spi_device. */
+  kRescueTypeSpi = 0x44495053,
+} rescue_type_t;
+
+enum {
+  /**
+   * SPI rescue: PAGE_PROGRAM address of control frames (`rescue_spi_ctrl_t`).
+   *
+   * PAGE_PROGRAM commands to addresses below `sizeof(rescue_state_t.data)`
+   * write their payload into the rescue data buffer.
+   */
+  kRescueSpiCtrlAddr = 0x800000,
+  /**
+   * SPI rescue: status register bit set when the last command failed.
+   *
+   * The host polls READ_STATUS until WIP clears and then checks this bit.
+   */
+  kRescueSpiStatusErrorBit = 2,
+};
+
+typedef enum {
+  /** `MODE`: change to the mode in `arg`. */
+  kRescueSpiOpMode = 0x4d4f4445,
+  /**
+   * `BLCK`: process `arg` bytes of the data buffer, checked by `crc32`.
+   *
+   * Only the last block before `DONE` may be shorter than the data buffer.
+   */
+  kRescueSpiOpBlock = 0x424c434b,
+  /** `DONE`: end of the upload. */
+  kRescueSpiOpDone = 0x444f4e45,
+} rescue_spi_op_t;
+
+/**
+ * SPI rescue control frame.
+ */
+typedef struct rescue_spi_ctrl {
+  /** Operation, see `rescue_spi_op_t`. */
+  uint32_t op;
+  /** Operand. */
+  uint32_t arg;
+  /** CRC32 of the first `arg` bytes of the data buffer for `BLCK`. */
+  uint32_t crc32;
+} rescue_spi_ctrl_t;
+
 typedef enum {
   /** `BAUD` */
   kRescueModeBaud = 0x42415544,
@@ -64,10 +116,12 @@ typedef enum {
 } rescue_baud_t;
 
 typedef struct RescueState {
+  // Rescue transport.
+  rescue_type_t type;
   rescue_mode_t mode;
   // Whether to reboot automatically after an xmodem upload.
   bool reboot;
-  // Current xmodem frame.
+  // Current xmodem frame (or block count for SPI rescue).
   uint32_t frame;
   // Current data offset.
   uint32_t offset;
@@ -85,4 +139,8 @@ typedef struct RescueState {
 rom_error_t rescue_protocol(boot_data_t *bootdata,
                             const owner_rescue_config_t *rescue);
 
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
 #endif  // OPENTITAN_SW_DEVICE_SILICON_CREATOR_ROM_EXT_RESCUE_H_
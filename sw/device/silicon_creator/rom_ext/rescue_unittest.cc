@@ -0,0 +1,299 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/silicon_creator/rom_ext/rescue.h"
+
+#include <array>
+#include <cstring>
+
+#include "gtest/gtest.h"
+#include "sw/device/lib/base/mock_abs_mmio.h"
+#include "sw/device/lib/base/mock_crc32.h"
+#include "sw/device/silicon_creator/lib/drivers/mock_flash_ctrl.h"
+#include "sw/device/silicon_creator/lib/drivers/mock_rstmgr.h"
+#include "sw/device/silicon_creator/lib/drivers/mock_spi_device.h"
+#include "sw/device/silicon_creator/lib/drivers/retention_sram.h"
+#include "sw/device/silicon_creator/lib/error.h"
+#include "sw/device/silicon_creator/testing/rom_test.h"
+
+#include "hw/top/flash_ctrl_regs.h"
+#include "hw/top/uart_regs.h"
+
+namespace rescue_unittest {
+namespace {
+
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::NotNull;
+using ::testing::Return;
+using ::testing::SetArgPointee;
+
+enum {
+  kPageSize = FLASH_CTRL_PARAM_BYTES_PER_PAGE,
+  kBlockSize = sizeof(rescue_state_t{}.data),
+  kBlockWords = kBlockSize / sizeof(uint32_t),
+  // Rescue region configured by the test fixture.
+  kRegionStartPage = 32,
+  kRegionNumPages = 2,
+  kRegionStart = kRegionStartPage * kPageSize,
+};
+
+MATCHER_P(IsPaddedAfter, len, "") {
+  const uint8_t *data = static_cast<const uint8_t *>(arg);
+  for (size_t i = len; i < kBlockSize; ++i) {
+    if (data[i] != 0xff) {
+      return false;
+    }
+  }
+  return true;
+}
+
+spi_device_cmd_t DataCmd(uint32_t address, size_t byte_count) {
+  spi_device_cmd_t cmd{
+      .opcode = kSpiDeviceOpcodePageProgram,
+      .address = address,
+      .payload_byte_count = byte_count,
+  };
+  std::memset(cmd.payload, 0xa5, byte_count);
+  return cmd;
+}
+
+spi_device_cmd_t CtrlCmd(rescue_spi_op_t op, uint32_t arg,
+                         uint32_t crc32 = 0) {
+  spi_device_cmd_t cmd{
+      .opcode = kSpiDeviceOpcodePageProgram,
+      .address = kRescueSpiCtrlAddr,
+      .payload_byte_count = sizeof(rescue_spi_ctrl_t),
+  };
+  rescue_spi_ctrl_t ctrl{.op = op, .arg = arg, .crc32 = crc32};
+  std::memcpy(cmd.payload, &ctrl, sizeof(ctrl));
+  return cmd;
+}
+
+spi_device_cmd_t ResetCmd() {
+  return spi_device_cmd_t{
+      .opcode = kSpiDeviceOpcodeReset,
+      .address = kSpiDeviceNoAddress,
+      .payload_byte_count = 0,
+  };
+}
+
+class RescueSpiTest : public rom_test::RomTest {
+ protected:
+  void SetUp() override {
+    config_->header.tag = kTlvTagRescueConfig;
+    config_->header.length = sizeof(config_buf_);
+    config_->rescue_type = kRescueTypeSpi;
+    config_->start = kRegionStartPage;
+    config_->size = kRegionNumPages;
+    config_->command_allow[0] = kRescueModeFirmware;
+    config_->command_allow[1] = kRescueModeBootLog;
+
+    // `dbg_printf()` waits for the UART to go idle.
+    ON_CALL(mmio_, Read32(_))
+        .WillByDefault(Return(1 << UART_STATUS_TXIDLE_BIT));
+
+    EXPECT_CALL(spi_device_, Init());
+    EXPECT_CALL(spi_device_, ReadEnable());
+  }
+
+  void ExpectCmd(const spi_device_cmd_t &cmd) {
+    EXPECT_CALL(spi_device_, CmdGet(NotNull()))
+        .WillOnce(DoAll(SetArgPointee<0>(cmd), Return(kErrorOk)));
+  }
+
+  void ExpectStatus(bool error) {
+    EXPECT_CALL(spi_device_,
+                FlashStatusSet(error ? 1u << kRescueSpiStatusErrorBit : 0));
+  }
+
+  void ExpectCrc(size_t len, uint32_t crc) {
+    EXPECT_CALL(crc32_, Crc32(NotNull(), len)).WillOnce(Return(crc));
+  }
+
+  void ExpectRegionErase() {
+    EXPECT_CALL(flash_ctrl_, DataDefaultPermsSet(_));
+    for (uint32_t page = 0; page < kRegionNumPages; ++page) {
+      EXPECT_CALL(flash_ctrl_, DataErase(kRegionStart + page * kPageSize,
+                                         kFlashCtrlEraseTypePage))
+          .WillOnce(Return(kErrorOk));
+    }
+  }
+
+  void ExpectReset() {
+    ExpectCmd(ResetCmd());
+    EXPECT_CALL(rstmgr_, Reset());
+  }
+
+  rom_error_t Run() { return rescue_protocol(&bootdata_, config_); }
+
+  std::array<uint32_t, 6> config_buf_{};
+  owner_rescue_config_t *config_ =
+      reinterpret_cast<owner_rescue_config_t *>(config_buf_.data());
+  boot_data_t bootdata_{};
+  rom_test::NiceMockAbsMmio mmio_;
+  rom_test::MockCrc32 crc32_;
+  rom_test::MockFlashCtrl flash_ctrl_;
+  rom_test::MockRstmgr rstmgr_;
+  rom_test::MockSpiDevice spi_device_;
+};
+
+TEST_F(RescueSpiTest, FirmwareBlocksInOrder) {
+  // Fill the data buffer one page program at a time.
+  for (uint32_t addr = 0; addr < kBlockSize;
+       addr += kSpiDevicePayloadAreaNumBytes) {
+    ExpectCmd(DataCmd(addr, kSpiDevicePayloadAreaNumBytes));
+    ExpectStatus(false);
+  }
+  // The first block erases the rescue region before it is written.
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, kBlockSize, 0x1234));
+  ExpectCrc(kBlockSize, 0x1234);
+  ExpectRegionErase();
+  EXPECT_CALL(flash_ctrl_, DataWrite(kRegionStart, kBlockWords, NotNull()))
+      .WillOnce(Return(kErrorOk));
+  ExpectStatus(false);
+  // The second block lands right after the first one.
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, kBlockSize, 0x5678));
+  ExpectCrc(kBlockSize, 0x5678);
+  EXPECT_CALL(flash_ctrl_,
+              DataWrite(kRegionStart + kBlockSize, kBlockWords, NotNull()))
+      .WillOnce(Return(kErrorOk));
+  ExpectStatus(false);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, DataOutOfRange) {
+  ExpectCmd(DataCmd(kBlockSize - 128, 256));
+  ExpectStatus(true);
+  ExpectCmd(DataCmd(kBlockSize, 16));
+  ExpectStatus(true);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, BadBlockLength) {
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, 0));
+  ExpectStatus(true);
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, kBlockSize + 1));
+  ExpectStatus(true);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, BadCrcRetransmit) {
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, kBlockSize, 0x1234));
+  ExpectCrc(kBlockSize, 0x4321);
+  ExpectStatus(true);
+  // The retransmitted block is written to the start of the region.
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, kBlockSize, 0x1234));
+  ExpectCrc(kBlockSize, 0x1234);
+  ExpectRegionErase();
+  EXPECT_CALL(flash_ctrl_, DataWrite(kRegionStart, kBlockWords, NotNull()))
+      .WillOnce(Return(kErrorOk));
+  ExpectStatus(false);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, ShortBlockPaddedOnDone) {
+  // Stay in rescue after the upload so that DONE reports its status.
+  ExpectCmd(CtrlCmd(kRescueSpiOpMode, kRescueModeWait));
+  ExpectStatus(false);
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, 100, 0x1234));
+  ExpectCrc(100, 0x1234);
+  ExpectStatus(false);
+  ExpectCmd(CtrlCmd(kRescueSpiOpDone, 0));
+  ExpectRegionErase();
+  EXPECT_CALL(flash_ctrl_,
+              DataWrite(kRegionStart, kBlockWords, IsPaddedAfter(100)))
+      .WillOnce(Return(kErrorOk));
+  ExpectStatus(false);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, BlockAfterShortBlockRestarts) {
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, 100, 0x1234));
+  ExpectCrc(100, 0x1234);
+  ExpectStatus(false);
+  // Only the last block before DONE may be short.
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, kBlockSize, 0x5678));
+  ExpectStatus(true);
+  // The upload starts over at the beginning of the region.
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, kBlockSize, 0x5678));
+  ExpectCrc(kBlockSize, 0x5678);
+  ExpectRegionErase();
+  EXPECT_CALL(flash_ctrl_, DataWrite(kRegionStart, kBlockWords, NotNull()))
+      .WillOnce(Return(kErrorOk));
+  ExpectStatus(false);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, DoneReboots) {
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, 100, 0x1234));
+  ExpectCrc(100, 0x1234);
+  ExpectStatus(false);
+  // The residue is written before rebooting, without a status update.
+  ExpectCmd(CtrlCmd(kRescueSpiOpDone, 0));
+  ExpectRegionErase();
+  EXPECT_CALL(flash_ctrl_,
+              DataWrite(kRegionStart, kBlockWords, IsPaddedAfter(100)))
+      .WillOnce(Return(kErrorOk));
+  EXPECT_CALL(rstmgr_, Reset());
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, FlashWriteErrorStopsRescue) {
+  ExpectCmd(CtrlCmd(kRescueSpiOpBlock, kBlockSize, 0x1234));
+  ExpectCrc(kBlockSize, 0x1234);
+  ExpectRegionErase();
+  EXPECT_CALL(flash_ctrl_, DataWrite(kRegionStart, kBlockWords, NotNull()))
+      .WillOnce(Return(kErrorFlashCtrlDataWrite));
+
+  EXPECT_EQ(Run(), kErrorFlashCtrlDataWrite);
+}
+
+TEST_F(RescueSpiTest, SendModeFillsReadBuffer) {
+  // The read buffer is filled before WIP clears.
+  ExpectCmd(CtrlCmd(kRescueSpiOpMode, kRescueModeBootLog));
+  EXPECT_CALL(spi_device_,
+              ReadBufferWrite(NotNull(),
+                              sizeof(retention_sram_t{}.creator.boot_log)));
+  ExpectStatus(false);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, ModeNotAllowed) {
+  // Baud rate changes have no meaning on SPI.
+  ExpectCmd(CtrlCmd(kRescueSpiOpMode, kRescueModeBaud));
+  ExpectStatus(true);
+  // Not in the allowlist: the mode does not change, so no data is sent.
+  ExpectCmd(CtrlCmd(kRescueSpiOpMode, kRescueModeOwnerPage0));
+  ExpectStatus(false);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+TEST_F(RescueSpiTest, UnknownControlOp) {
+  ExpectCmd(CtrlCmd(static_cast<rescue_spi_op_t>(0), 0));
+  ExpectStatus(true);
+  ExpectReset();
+
+  EXPECT_EQ(Run(), kErrorRescueReboot);
+}
+
+}  // namespace
+}  // namespace rescue_unittest
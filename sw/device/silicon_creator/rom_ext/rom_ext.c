@@ -15,6 +15,7 @@
 #include "sw/device/silicon_creator/lib/base/sec_mmio.h"
 #include "sw/device/silicon_creator/lib/boot_data.h"
 #include "sw/device/silicon_creator/lib/boot_log.h"
+#include "sw/device/silicon_creator/lib/boot_profile.h"
 #include "sw/device/silicon_creator/lib/boot_svc/boot_svc_empty.h"
 #include "sw/device/silicon_creator/lib/boot_svc/boot_svc_header.h"
 #include "sw/device/silicon_creator/lib/boot_svc/boot_svc_msg.h"
@@ -77,6 +78,30 @@ owner_application_keyring_t keyring;
 // Verifying key index
 size_t verify_key;
 
+/**
+ * Owner firmware digest of a BL0 slot.
+ *
+ * `rom_ext_verify()` may run more than once for the same slot during a boot,
+ * e.g. a MinBl0SecVer boot services request verifies both slots before the
+ * boot slot is verified again. The digest over the usage constraints and the
+ * image is computed once per slot and reused by later verifications.
+ *
+ * An entry is only reused for the same slot, the same usage constraints and a
+ * manifest whose length and ECDSA signature are unchanged. This does not cover
+ * the rest of the image: the cache assumes that the BL0 slots are not written
+ * while it is valid. The only code in ROM_EXT that writes the BL0 slots is the
+ * rescue protocol, which must call `rom_ext_bl0_digest_invalidate()` first.
+ */
+typedef struct bl0_digest {
+  hardened_bool_t valid;
+  uint32_t length;
+  ecdsa_p256_signature_t ecdsa_signature;
+  manifest_usage_constraints_t usage_constraints;
+  hmac_digest_t digest;
+} bl0_digest_t;
+
+static bl0_digest_t bl0_digests[2];
+
 OT_WARN_UNUSED_RESULT
 static rom_error_t rom_ext_irq_error(void) {
   uint32_t mcause;
@@ -279,9 +304,70 @@ static rom_error_t rom_ext_spx_verify(
   return result;
 }
 
+/**
+ * Invalidate the cached BL0 slot digests.
+ *
+ * Must be called before anything that may write to the BL0 slots.
+ */
+static void rom_ext_bl0_digest_invalidate(void) {
+  for (size_t i = 0; i < ARRAYSIZE(bl0_digests); ++i) {
+    bl0_digests[i].valid = kHardenedBoolFalse;
+  }
+}
+
+/**
+ * Compute the digest of an owner firmware image or reuse a cached one.
+ *
+ * @param manifest Manifest of the image.
+ * @param usage_constraints Usage constraints read from the hardware.
+ * @param[out] digest Digest of the usage constraints and the image.
+ */
+static void rom_ext_bl0_digest_get(
+    const manifest_t *manifest,
+    const manifest_usage_constraints_t *usage_constraints,
+    hmac_digest_t *digest) {
+  bl0_digest_t *entry = NULL;
+  if (manifest == rom_ext_boot_policy_manifest_a_get()) {
+    entry = &bl0_digests[0];
+  } else if (manifest == rom_ext_boot_policy_manifest_b_get()) {
+    entry = &bl0_digests[1];
+  }
+  if (entry != NULL && entry->valid == kHardenedBoolTrue &&
+      entry->length == manifest->length &&
+      memcmp(&entry->ecdsa_signature, &manifest->ecdsa_signature,
+             sizeof(entry->ecdsa_signature)) == 0 &&
+      memcmp(&entry->usage_constraints, usage_constraints,
+             sizeof(entry->usage_constraints)) == 0) {
+    memcpy(digest, &entry->digest, sizeof(*digest));
+    return;
+  }
+
+  hmac_sha256_init();
+  // Hash usage constraints.
+  hmac_sha256_update(usage_constraints, sizeof(*usage_constraints));
+  // Hash the remaining part of the image.
+  manifest_digest_region_t digest_region = manifest_digest_region_get(manifest);
+  hmac_sha256_update(digest_region.start, digest_region.length);
+  // TODO(#19596): add owner configuration block to measurement.
+  hmac_sha256_process();
+  hmac_sha256_final(digest);
+
+  if (entry == NULL) {
+    return;
+  }
+  entry->length = manifest->length;
+  memcpy(&entry->ecdsa_signature, &manifest->ecdsa_signature,
+         sizeof(entry->ecdsa_signature));
+  memcpy(&entry->usage_constraints, usage_constraints,
+         sizeof(entry->usage_constraints));
+  memcpy(&entry->digest, digest, sizeof(entry->digest));
+  entry->valid = kHardenedBoolTrue;
+}
+
 OT_WARN_UNUSED_RESULT
 static rom_error_t rom_ext_verify(const manifest_t *manifest,
                                   const boot_data_t *boot_data) {
+  boot_profile_mark(kBootProfileRomExtVerifyStart);
   RETURN_IF_ERROR(rom_ext_boot_policy_manifest_check(manifest, boot_data));
 
   uint32_t key_id =
@@ -313,45 +399,45 @@ static rom_error_t rom_ext_verify(const manifest_t *manifest,
   memset(boot_measurements.bl0.data, (int)rnd_uint32(),
          sizeof(boot_measurements.bl0.data));
 
-  hmac_sha256_init();
-  // Hash usage constraints.
   manifest_usage_constraints_t usage_constraints_from_hw;
   sigverify_usage_constraints_get(manifest->usage_constraints.selector_bits |
                                       keyring.key[verify_key]->usage_constraint,
                                   &usage_constraints_from_hw);
-  hmac_sha256_update(&usage_constraints_from_hw,
-                     sizeof(usage_constraints_from_hw));
-  // Hash the remaining part of the image.
-  manifest_digest_region_t digest_region = manifest_digest_region_get(manifest);
-  hmac_sha256_update(digest_region.start, digest_region.length);
-  // TODO(#19596): add owner configuration block to measurement.
-  // Verify signature
-  hmac_sha256_process();
   hmac_digest_t act_digest;
-  hmac_sha256_final(&act_digest);
+  rom_ext_bl0_digest_get(manifest, &usage_constraints_from_hw, &act_digest);
 
   static_assert(sizeof(boot_measurements.bl0) == sizeof(act_digest),
                 "Unexpected BL0 digest size.");
   memcpy(&boot_measurements.bl0, &act_digest, sizeof(boot_measurements.bl0));
+  boot_profile_mark(kBootProfileRomExtDigestDone);
 
   uint32_t flash_exec = 0;
   if (key_alg == kOwnershipKeyAlgEcdsaP256) {
-    return sigverify_ecdsa_p256_verify(&manifest->ecdsa_signature,
-                                       &keyring.key[verify_key]->data.ecdsa,
-                                       &act_digest, &flash_exec);
+    rom_error_t ecdsa_error = sigverify_ecdsa_p256_verify(
+        &manifest->ecdsa_signature, &keyring.key[verify_key]->data.ecdsa,
+        &act_digest, &flash_exec);
+    boot_profile_mark(kBootProfileRomExtEcdsaDone);
+    return ecdsa_error;
   } else if ((key_alg & kOwnershipKeyAlgCategoryMask) ==
              kOwnershipKeyAlgCategoryHybrid) {
-    // Hybrid signatures check both ECDSA and SPX+ signatures.
-    // TODO: as a future optimization, start the ECDSA verify operation on
-    // OTBN and compute the SPX+ verify in parallel on Ibex.
-    HARDENED_RETURN_IF_ERROR(sigverify_ecdsa_p256_verify(
+    // Hybrid signatures check both ECDSA and SPX+ signatures. The ECDSA
+    // verification runs on OTBN while the SPX+ verification runs on Ibex, and
+    // both must succeed.
+    manifest_digest_region_t digest_region =
+        manifest_digest_region_get(manifest);
+    HARDENED_RETURN_IF_ERROR(sigverify_ecdsa_p256_verify_start(
         &manifest->ecdsa_signature, &keyring.key[verify_key]->data.hybrid.ecdsa,
-        &act_digest, &flash_exec));
-    return rom_ext_spx_verify(
+        &act_digest));
+    rom_error_t spx_error = rom_ext_spx_verify(
         &ext_spx_signature->signature,
         &keyring.key[verify_key]->data.hybrid.spx, key_alg,
         &usage_constraints_from_hw, sizeof(usage_constraints_from_hw), NULL, 0,
         digest_region.start, digest_region.length, &act_digest);
+    boot_profile_mark(kBootProfileRomExtSpxDone);
+    HARDENED_RETURN_IF_ERROR(sigverify_ecdsa_p256_verify_finish(
+        &manifest->ecdsa_signature, &flash_exec));
+    boot_profile_mark(kBootProfileRomExtEcdsaDone);
+    return spx_error;
   } else {
     // TODO: consider whether an SPX+-only verify is sufficent.
     return kErrorOwnershipInvalidAlgorithm;
@@ -411,6 +497,7 @@ static rom_error_t rom_ext_boot(boot_data_t *boot_data, boot_log_t *boot_log,
 
   // Write the DICE certs to flash if they have been updated.
   HARDENED_RETURN_IF_ERROR(dice_chain_flush_flash());
+  boot_profile_mark(kBootProfileRomExtDiceDone);
 
   // Remove write and erase access to the certificate pages before handing over
   // execution to the owner firmware (owner firmware can still read).
@@ -501,6 +588,8 @@ static rom_error_t rom_ext_boot(boot_data_t *boot_data, boot_log_t *boot_log,
                                    TOP_EARLGREY_OTP_CTRL_CORE_BASE_ADDR);
   // Jump to OWNER entry point.
   dbg_printf("entry: 0x%x\r\n", (unsigned int)entry_point);
+  // In a normal build, this function inlines to nothing.
+  boot_profile_mark(kBootProfileBl0Jump);
   ((owner_stage_entry_point *)entry_point)();
 
   return kErrorRomExtBootFailed;
@@ -698,6 +787,7 @@ static rom_error_t rom_ext_try_next_stage(boot_data_t *boot_data,
 
 static rom_error_t rom_ext_start(boot_data_t *boot_data, boot_log_t *boot_log) {
   HARDENED_RETURN_IF_ERROR(rom_ext_init(boot_data));
+  boot_profile_mark(kBootProfileRomExtStart);
   const manifest_t *self = rom_ext_manifest();
   dbg_printf("ROM_EXT:%u.%u\r\n", self->version_major, self->version_minor);
 
@@ -735,6 +825,7 @@ static rom_error_t rom_ext_start(boot_data_t *boot_data, boot_log_t *boot_log) {
   // Initialize the chip ownership state.
   rom_error_t error;
   error = ownership_init(boot_data, &owner_config, &keyring);
+  boot_profile_mark(kBootProfileRomExtOwnershipDone);
   if (error == kErrorWriteBootdataThenReboot) {
     return error;
   }
@@ -773,6 +864,8 @@ static rom_error_t rom_ext_start(boot_data_t *boot_data, boot_log_t *boot_log) {
     dbg_printf("rescue: remember to clear break\r\n");
     uart_enable_receiver();
     ownership_pages_lockdown(boot_data, /*rescue=*/kHardenedBoolTrue);
+    // Rescue may rewrite the BL0 slots.
+    rom_ext_bl0_digest_invalidate();
     // TODO: update rescue protocol to accept boot data and rescue
     // config from the owner_config.
     error = rescue_protocol(boot_data, owner_config.rescue);
@@ -27,6 +27,8 @@ static const aes_test_t *test = NULL;
 enum {
   kAesBlockBytes = 128 / 8,
   kAesBlockWords = kAesBlockBytes / sizeof(uint32_t),
+  // Input chunk size for the init/update/final tests.
+  kStreamChunkBytes = 7,
 };
 
 static otcrypto_key_config_t make_key_config(const aes_test_t *test) {
@@ -220,6 +222,87 @@ static status_t run_decrypt(const aes_test_t *test, bool streaming) {
   return OK_STATUS();
 }
 
+/**
+ * Run AES with the init/update/final API for the given test vector.
+ *
+ * Feeds the input in chunks of `kStreamChunkBytes`, which is deliberately not
+ * a multiple of the block size, so that the partial-block handling in the
+ * context is exercised.
+ *
+ * @param test Test vector to run.
+ * @param operation Operation to perform (encrypt or decrypt).
+ */
+static status_t run_stream(const aes_test_t *test,
+                           otcrypto_aes_operation_t operation) {
+  // Determine the key configuration.
+  otcrypto_key_config_t config = make_key_config(test);
+
+  // Construct blinded key from the key and testing mask.
+  uint32_t keyblob[keyblob_num_words(config)];
+  TRY(keyblob_from_key_and_mask(test->key, kKeyMask, config, keyblob));
+  otcrypto_blinded_key_t key = {
+      .config = config,
+      .keyblob_length = sizeof(keyblob),
+      .keyblob = keyblob,
+  };
+  key.checksum = integrity_blinded_checksum(&key);
+
+  otcrypto_const_word32_buf_t iv = {
+      .data = test->iv,
+      .len = kAesBlockWords,
+  };
+
+  // Calculate the size of the padded plaintext.
+  size_t padded_len_bytes;
+  TRY(otcrypto_aes_padded_plaintext_length(test->plaintext_len, test->padding,
+                                           &padded_len_bytes));
+
+  // Select the input and expected output.
+  const unsigned char *input = (const unsigned char *)test->plaintext;
+  size_t input_len = test->plaintext_len;
+  const unsigned char *expected = (const unsigned char *)test->exp_ciphertext;
+  size_t expected_len = padded_len_bytes;
+  if (operation == kOtcryptoAesOperationDecrypt) {
+    input = (const unsigned char *)test->exp_ciphertext;
+    input_len = padded_len_bytes;
+    expected = (const unsigned char *)test->plaintext;
+    expected_len = test->plaintext_len;
+  }
+
+  otcrypto_aes_context_t ctx;
+  TRY(otcrypto_aes_init(&key, iv, test->mode, operation, test->padding, &ctx));
+
+  uint32_t output_data[padded_len_bytes / sizeof(uint32_t)];
+  unsigned char *output = (unsigned char *)output_data;
+  size_t output_len = 0;
+  while (input_len > 0) {
+    size_t chunk_len =
+        input_len < kStreamChunkBytes ? input_len : kStreamChunkBytes;
+    otcrypto_const_byte_buf_t input_buf = {.data = input, .len = chunk_len};
+    otcrypto_byte_buf_t output_buf = {
+        .data = &output[output_len],
+        .len = sizeof(output_data) - output_len,
+    };
+    size_t written;
+    TRY(otcrypto_aes_update(&ctx, input_buf, output_buf, &written));
+    output_len += written;
+    input += chunk_len;
+    input_len -= chunk_len;
+  }
+
+  otcrypto_byte_buf_t output_buf = {
+      .data = &output[output_len],
+      .len = sizeof(output_data) - output_len,
+  };
+  size_t written;
+  TRY(otcrypto_aes_final(&ctx, output_buf, &written));
+  output_len += written;
+
+  TRY_CHECK(output_len == padded_len_bytes);
+  TRY_CHECK_ARRAYS_EQ(output, expected, expected_len);
+  return OK_STATUS();
+}
+
 /**
  * Test one-shot AES encryption.
  */
@@ -248,6 +331,20 @@ static status_t decrypt_streaming_test(void) {
   return run_decrypt(test, /*streaming=*/true);
 }
 
+/**
+ * Test AES encryption with the init/update/final API.
+ */
+static status_t encrypt_init_update_final_test(void) {
+  return run_stream(test, kOtcryptoAesOperationEncrypt);
+}
+
+/**
+ * Test AES decryption with the init/update/final API.
+ */
+static status_t decrypt_init_update_final_test(void) {
+  return run_stream(test, kOtcryptoAesOperationDecrypt);
+}
+
 OTTF_DEFINE_TEST_CONFIG();
 
 bool test_main(void) {
@@ -263,6 +360,8 @@ bool test_main(void) {
     EXECUTE_TEST(result, decrypt_test);
     EXECUTE_TEST(result, encrypt_streaming_test);
     EXECUTE_TEST(result, decrypt_streaming_test);
+    EXECUTE_TEST(result, encrypt_init_update_final_test);
+    EXECUTE_TEST(result, decrypt_init_update_final_test);
     LOG_INFO("Finished AES test %d.", i + 1);
   }
 
@@ -82,6 +82,52 @@ status_t sign_then_verify_test(hardened_bool_t *verification_result) {
       (otcrypto_const_word32_buf_t){.data = sig, .len = ARRAYSIZE(sig)},
       verification_result));
 
+  // Verify a batch of a corrupted copy of the signature, the same signature
+  // under a public key that is not on the curve and the signature itself. The
+  // second item fails the basic validity checks on OTBN, which stops the
+  // program and makes the driver restart it with the last item; only the last
+  // item should pass.
+  LOG_INFO("Verifying batch...");
+  uint32_t bad_sig[kP384SignatureWords];
+  for (size_t i = 0; i < ARRAYSIZE(bad_sig); i++) {
+    bad_sig[i] = sig[i];
+  }
+  bad_sig[0] ^= 1;
+  uint32_t bad_pk[kP384PublicKeyWords];
+  for (size_t i = 0; i < ARRAYSIZE(bad_pk); i++) {
+    bad_pk[i] = pk[i];
+  }
+  bad_pk[ARRAYSIZE(bad_pk) - 1] ^= 1;
+  otcrypto_unblinded_key_t bad_public_key = {
+      .key_mode = kOtcryptoKeyModeEcdsaP384,
+      .key_length = sizeof(bad_pk),
+      .key = bad_pk,
+  };
+  bad_public_key.checksum = integrity_unblinded_checksum(&bad_public_key);
+  const otcrypto_ecdsa_p384_verify_item_t items[] = {
+      {
+          .public_key = &public_key,
+          .message_digest = msg_digest,
+          .signature = {.data = bad_sig, .len = ARRAYSIZE(bad_sig)},
+      },
+      {
+          .public_key = &bad_public_key,
+          .message_digest = msg_digest,
+          .signature = {.data = sig, .len = ARRAYSIZE(sig)},
+      },
+      {
+          .public_key = &public_key,
+          .message_digest = msg_digest,
+          .signature = {.data = sig, .len = ARRAYSIZE(sig)},
+      },
+  };
+  hardened_bool_t batch_results[ARRAYSIZE(items)];
+  CHECK_STATUS_OK(otcrypto_ecdsa_p384_verify_batch(items, ARRAYSIZE(items),
+                                                  batch_results));
+  CHECK(batch_results[0] == kHardenedBoolFalse);
+  CHECK(batch_results[1] == kHardenedBoolFalse);
+  CHECK(batch_results[2] == kHardenedBoolTrue);
+
   return OTCRYPTO_OK;
 }
 
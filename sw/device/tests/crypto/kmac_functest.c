@@ -2,6 +2,7 @@
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
 
+#include "sw/device/lib/base/memory.h"
 #include "sw/device/lib/crypto/drivers/entropy.h"
 #include "sw/device/lib/crypto/drivers/kmac.h"
 #include "sw/device/lib/crypto/impl/integrity.h"
@@ -20,6 +21,19 @@
 
 #define MODULE_ID MAKE_MODULE_ID('t', 's', 't')
 
+enum {
+  /**
+   * Number of message bytes passed to each streaming update call.
+   *
+   * Chosen so that updates do not line up with words or Keccak blocks.
+   */
+  kStreamChunkBytes = 13,
+  /**
+   * Number of digest words read by each streaming squeeze call.
+   */
+  kStreamSqueezeWords = 3,
+};
+
 // Global pointer to the current test vector.
 static kmac_test_vector_t *current_test_vector = NULL;
 
@@ -184,6 +198,123 @@ static status_t run_kmac(otcrypto_word32_buf_t tag) {
       current_test_vector->cust_str, current_test_vector->digest.len, tag);
 }
 
+/**
+ * Absorb the message of `current_test_vector` in small chunks.
+ *
+ * @param ctx Streaming SHA3 context, or NULL for KMAC.
+ * @param kmac_ctx Streaming KMAC context, or NULL for SHA3.
+ * @return OK or error.
+ */
+static status_t stream_absorb(otcrypto_sha3_context_t *ctx,
+                              otcrypto_kmac_context_t *kmac_ctx) {
+  otcrypto_const_byte_buf_t msg = current_test_vector->input_msg;
+  size_t offset = 0;
+  do {
+    size_t chunk_len = msg.len - offset;
+    if (chunk_len > kStreamChunkBytes) {
+      chunk_len = kStreamChunkBytes;
+    }
+    otcrypto_const_byte_buf_t chunk = {
+        .data = msg.data + offset,
+        .len = chunk_len,
+    };
+    if (ctx != NULL) {
+      TRY(otcrypto_sha3_update(ctx, chunk));
+    } else {
+      TRY(otcrypto_kmac_update(kmac_ctx, chunk));
+    }
+    offset += chunk_len;
+  } while (offset < msg.len);
+  return OK_STATUS();
+}
+
+/**
+ * Compute the digest of `current_test_vector` with the streaming API.
+ *
+ * The message is passed in chunks of `kStreamChunkBytes`, and the output of
+ * SHAKE and cSHAKE is squeezed in chunks of `kStreamSqueezeWords`.
+ *
+ * @param[out] digest Computed digest.
+ * @return OK or error.
+ */
+static status_t run_stream(otcrypto_hash_digest_t *digest) {
+  otcrypto_hash_mode_t mode;
+  otcrypto_sha3_context_t ctx;
+  switch (current_test_vector->test_operation) {
+    case kKmacTestOperationSha3:
+      TRY(get_sha3_mode(current_test_vector->security_strength, &mode));
+      TRY(otcrypto_sha3_init(mode, &ctx));
+      TRY(stream_absorb(&ctx, NULL));
+      return otcrypto_sha3_final(&ctx, digest);
+    case kKmacTestOperationShake:
+      TRY(get_shake_mode(current_test_vector->security_strength, &mode));
+      TRY(otcrypto_sha3_init(mode, &ctx));
+      break;
+    case kKmacTestOperationCshake:
+      TRY(get_cshake_mode(current_test_vector->security_strength, &mode));
+      TRY(otcrypto_cshake_init(mode, current_test_vector->func_name,
+                               current_test_vector->cust_str, &ctx));
+      break;
+    case kKmacTestOperationKmac: {
+      otcrypto_kmac_context_t kmac_ctx;
+      current_test_vector->key.checksum =
+          integrity_blinded_checksum(&current_test_vector->key);
+      TRY(otcrypto_kmac_init(&current_test_vector->key,
+                             current_test_vector->cust_str, &kmac_ctx));
+      TRY(stream_absorb(NULL, &kmac_ctx));
+      otcrypto_word32_buf_t tag = {
+          .data = digest->data,
+          .len = digest->len,
+      };
+      return otcrypto_kmac_final(&kmac_ctx, current_test_vector->digest.len,
+                                 tag);
+    }
+    default:
+      return INVALID_ARGUMENT();
+  }
+
+  // Squeeze the XOF output in several pieces.
+  TRY(stream_absorb(&ctx, NULL));
+  size_t offset = 0;
+  while (digest->len - offset > kStreamSqueezeWords) {
+    otcrypto_hash_digest_t chunk = {
+        .data = digest->data + offset,
+        .len = kStreamSqueezeWords,
+    };
+    TRY(otcrypto_shake_squeeze(&ctx, &chunk));
+    offset += kStreamSqueezeWords;
+  }
+  otcrypto_hash_digest_t last = {
+      .data = digest->data + offset,
+      .len = digest->len - offset,
+  };
+  return otcrypto_sha3_final(&ctx, &last);
+}
+
+/**
+ * Check that one-shot operations fail while a stream holds the KMAC block.
+ */
+static status_t stream_busy_test(void) {
+  otcrypto_sha3_context_t ctx;
+  TRY(otcrypto_sha3_init(kOtcryptoHashModeSha3_256, &ctx));
+
+  uint32_t digest_data[kKmacSha3256DigestWords];
+  otcrypto_hash_digest_t digest = {
+      .data = digest_data,
+      .len = ARRAYSIZE(digest_data),
+  };
+  otcrypto_const_byte_buf_t msg = {.data = NULL, .len = 0};
+  TRY_CHECK(status_err(otcrypto_sha3_256(msg, &digest)) == kFailedPrecondition);
+  otcrypto_sha3_context_t other_ctx;
+  TRY_CHECK(status_err(otcrypto_sha3_init(kOtcryptoHashModeSha3_256,
+                                          &other_ctx)) == kFailedPrecondition);
+
+  // Finishing the stream releases the block again.
+  TRY(otcrypto_sha3_final(&ctx, &digest));
+  TRY(otcrypto_sha3_256(msg, &digest));
+  return OK_STATUS();
+}
+
 /**
  * Run the test pointed to by `current_test_vector`.
  */
@@ -226,6 +357,13 @@ static status_t run_test_vector(void) {
     }
   }
 
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest.data,
+                      current_test_vector->digest.data,
+                      current_test_vector->digest.len);
+
+  // Repeat the computation with the streaming API.
+  memset(digest_data, 0, sizeof(digest_data));
+  TRY(run_stream(&digest));
   TRY_CHECK_ARRAYS_EQ((unsigned char *)digest.data,
                       current_test_vector->digest.data,
                       current_test_vector->digest.len);
@@ -248,5 +386,6 @@ bool test_main(void) {
              current_test_vector->vector_identifier);
     EXECUTE_TEST(test_result, run_test_vector);
   }
+  EXECUTE_TEST(test_result, stream_busy_test);
   return status_ok(test_result);
 }
@@ -0,0 +1,219 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/impl/sha2/sha256.h"
+#include "sw/device/lib/crypto/impl/sha2/sha512.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Tests the streaming mode of the OTBN-based SHA-256 and SHA-512 library,
+// which keeps the app and hash state in OTBN across update calls.
+
+enum {
+  /**
+   * Test message length in bytes.
+   *
+   * Long enough for several OTBN runs with both hash functions.
+   */
+  kMessageLen = 1500,
+};
+
+/**
+ * Update sizes for the streaming tests, in bytes.
+ *
+ * Uneven on purpose, so that updates start and end in the middle of blocks
+ * and span several OTBN runs. Sums to `kMessageLen`.
+ */
+static const size_t kUpdateSizes[] = {1, 63, 64, 65, 0, 600, 129, 578};
+
+static uint8_t message[kMessageLen];
+
+/**
+ * Expected digests for `message`; see `message_init`.
+ *
+ * Generated with:
+ *   m = bytes(((i * 31 + 7) & 0xff) for i in range(1500))
+ *   hashlib.sha256(m).digest()
+ *   hashlib.sha512(m).digest()
+ */
+static const uint8_t kSha256ExpDigest[kSha256DigestBytes] = {
+    0x3f, 0xfd, 0x37, 0xae, 0x1b, 0xcd, 0xf2, 0x18, 0x09, 0x22, 0x96,
+    0xbf, 0xf8, 0x27, 0xe1, 0x09, 0xfa, 0x2d, 0xf9, 0x5c, 0x4c, 0x82,
+    0x25, 0x81, 0x1f, 0x7c, 0x54, 0xea, 0xe4, 0x4b, 0x91, 0x96,
+};
+static const uint8_t kSha512ExpDigest[kSha512DigestBytes] = {
+    0x72, 0x08, 0x97, 0x55, 0xb5, 0x10, 0xbe, 0x6c, 0x57, 0x01, 0xdd,
+    0xd5, 0x17, 0x23, 0x4a, 0x7b, 0xdb, 0x7e, 0x4e, 0xc0, 0xfe, 0x53,
+    0xa6, 0x0a, 0x41, 0x19, 0xac, 0xe8, 0xb8, 0xd5, 0x49, 0x09, 0xfb,
+    0x32, 0xa6, 0xfd, 0x90, 0x62, 0x83, 0x20, 0xde, 0x76, 0xae, 0x62,
+    0xcb, 0x04, 0x91, 0xf1, 0x95, 0xb8, 0xbb, 0x9a, 0x97, 0x8a, 0x98,
+    0x71, 0x6b, 0x0e, 0xc6, 0xa3, 0x1b, 0x91, 0xa1, 0x5c,
+};
+
+static void message_init(void) {
+  for (size_t i = 0; i < kMessageLen; i++) {
+    message[i] = (uint8_t)(i * 31 + 7);
+  }
+}
+
+/**
+ * Check the one-shot digests, which never keep anything in OTBN.
+ */
+static status_t oneshot_test(void) {
+  uint32_t digest256[kSha256DigestWords];
+  TRY(sha256(message, kMessageLen, digest256));
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest256, kSha256ExpDigest,
+                      kSha256DigestBytes);
+
+  uint32_t digest512[kSha512DigestWords];
+  TRY(sha512(message, kMessageLen, digest512));
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest512, kSha512ExpDigest,
+                      kSha512DigestBytes);
+  return OK_STATUS();
+}
+
+/**
+ * Hash the message in uneven pieces; each update stays resident in OTBN.
+ */
+static status_t streaming_test(void) {
+  sha256_state_t state256;
+  TRY(sha256_init(&state256));
+  TRY(sha256_streaming_enable(&state256));
+  sha512_state_t state512;
+  TRY(sha512_init(&state512));
+  TRY(sha512_streaming_enable(&state512));
+
+  // Run all updates of one context before the other's, so that each context
+  // keeps OTBN to itself while it is updated.
+  const uint8_t *next = message;
+  for (size_t i = 0; i < ARRAYSIZE(kUpdateSizes); i++) {
+    TRY(sha256_update(&state256, next, kUpdateSizes[i]));
+    TRY_CHECK(state256.otbn_resident == kHardenedBoolTrue);
+    next += kUpdateSizes[i];
+  }
+  TRY_CHECK(next == message + kMessageLen);
+  next = message;
+  for (size_t i = 0; i < ARRAYSIZE(kUpdateSizes); i++) {
+    TRY(sha512_update(&state512, next, kUpdateSizes[i]));
+    TRY_CHECK(state512.otbn_resident == kHardenedBoolTrue);
+    next += kUpdateSizes[i];
+  }
+
+  uint32_t digest256[kSha256DigestWords];
+  TRY(sha256_final(&state256, digest256));
+  TRY_CHECK(state256.otbn_resident == kHardenedBoolFalse);
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest256, kSha256ExpDigest,
+                      kSha256DigestBytes);
+
+  uint32_t digest512[kSha512DigestWords];
+  TRY(sha512_final(&state512, digest512));
+  TRY_CHECK(state512.otbn_resident == kHardenedBoolFalse);
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest512, kSha512ExpDigest,
+                      kSha512DigestBytes);
+  return OK_STATUS();
+}
+
+/**
+ * Alternate updates between streaming contexts and one-shot hashes.
+ *
+ * Every other OTBN user replaces the app and state in OTBN, so each update
+ * has to notice and reload them.
+ */
+static status_t interleaved_test(void) {
+  sha256_state_t state256;
+  TRY(sha256_init(&state256));
+  TRY(sha256_streaming_enable(&state256));
+  sha512_state_t state512;
+  TRY(sha512_init(&state512));
+  TRY(sha512_streaming_enable(&state512));
+
+  const uint8_t *next = message;
+  for (size_t i = 0; i < ARRAYSIZE(kUpdateSizes); i++) {
+    TRY(sha256_update(&state256, next, kUpdateSizes[i]));
+    TRY(sha512_update(&state512, next, kUpdateSizes[i]));
+    TRY_CHECK(state256.otbn_resident == kHardenedBoolTrue);
+    TRY_CHECK(state512.otbn_resident == kHardenedBoolTrue);
+
+    // Another user of the same app in between.
+    uint32_t other[kSha256DigestWords];
+    TRY(sha256(next, kUpdateSizes[i], other));
+    next += kUpdateSizes[i];
+  }
+
+  uint32_t digest256[kSha256DigestWords];
+  TRY(sha256_final(&state256, digest256));
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest256, kSha256ExpDigest,
+                      kSha256DigestBytes);
+
+  uint32_t digest512[kSha512DigestWords];
+  TRY(sha512_final(&state512, digest512));
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest512, kSha512ExpDigest,
+                      kSha512DigestBytes);
+  return OK_STATUS();
+}
+
+/**
+ * Continue a copy of a resident context next to the original.
+ *
+ * Only one of the two can use the state left in OTBN; the other one has to
+ * reload its own state.
+ */
+static status_t copy_test(void) {
+  sha256_state_t state;
+  TRY(sha256_init(&state));
+  TRY(sha256_streaming_enable(&state));
+
+  size_t head_len = kUpdateSizes[0] + kUpdateSizes[1] + kUpdateSizes[2];
+  TRY(sha256_update(&state, message, head_len));
+  sha256_state_t copy = state;
+
+  // Alternate between the two contexts for the rest of the message.
+  const uint8_t *next = message + head_len;
+  for (size_t i = 3; i < ARRAYSIZE(kUpdateSizes); i++) {
+    TRY(sha256_update(&copy, next, kUpdateSizes[i]));
+    TRY(sha256_update(&state, next, kUpdateSizes[i]));
+    next += kUpdateSizes[i];
+  }
+
+  uint32_t digest[kSha256DigestWords];
+  TRY(sha256_final(&state, digest));
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest, kSha256ExpDigest,
+                      kSha256DigestBytes);
+  TRY(sha256_final(&copy, digest));
+  TRY_CHECK_ARRAYS_EQ((unsigned char *)digest, kSha256ExpDigest,
+                      kSha256DigestBytes);
+  return OK_STATUS();
+}
+
+/**
+ * Check that updates without streaming mode leave nothing in OTBN.
+ */
+static status_t non_streaming_test(void) {
+  sha512_state_t state;
+  TRY(sha384_init(&state));
+  TRY(sha384_update(&state, message, kMessageLen));
+  TRY_CHECK(state.otbn_resident == kHardenedBoolFalse);
+
+  uint32_t digest[kSha384DigestWords];
+  TRY(sha384_final(&state, digest));
+  return OK_STATUS();
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  status_t test_result = OK_STATUS();
+  // The entropy complex is needed to wipe OTBN and the hash state.
+  CHECK_STATUS_OK(entropy_complex_init());
+  message_init();
+  EXECUTE_TEST(test_result, oneshot_test);
+  EXECUTE_TEST(test_result, streaming_test);
+  EXECUTE_TEST(test_result, interleaved_test);
+  EXECUTE_TEST(test_result, copy_test);
+  EXECUTE_TEST(test_result, non_streaming_test);
+  return status_ok(test_result);
+}
@@ -170,6 +170,7 @@ volatile otcrypto_interface_t otcrypto = {
     // RSA key construction.
     .rsa_public_key_construct = &otcrypto_rsa_public_key_construct,
     .rsa_private_key_from_exponents = &otcrypto_rsa_private_key_from_exponents,
+    .rsa_private_key_from_crt = &otcrypto_rsa_private_key_from_crt,
 
     // RSA key generation (blocking).
     .rsa_keygen = &otcrypto_rsa_keygen,
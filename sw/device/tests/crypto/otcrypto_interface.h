@@ -215,6 +215,12 @@ typedef struct otcrypto_interface_t {
       otcrypto_rsa_size_t, otcrypto_const_word32_buf_t,
       otcrypto_const_word32_buf_t, otcrypto_const_word32_buf_t,
       otcrypto_blinded_key_t *);
+  otcrypto_status_t (*rsa_private_key_from_crt)(
+      otcrypto_rsa_size_t, otcrypto_const_word32_buf_t,
+      otcrypto_const_word32_buf_t, otcrypto_const_word32_buf_t,
+      otcrypto_const_word32_buf_t, otcrypto_const_word32_buf_t,
+      otcrypto_const_word32_buf_t, otcrypto_const_word32_buf_t,
+      otcrypto_const_word32_buf_t, otcrypto_blinded_key_t *);
   otcrypto_status_t (*rsa_keypair_from_cofactor)(otcrypto_rsa_size_t,
                                                  otcrypto_const_word32_buf_t,
                                                  otcrypto_const_word32_buf_t,
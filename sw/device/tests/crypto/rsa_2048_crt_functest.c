@@ -0,0 +1,391 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/impl/rsa/rsa_datatypes.h"
+#include "sw/device/lib/crypto/impl/rsa/rsa_signature.h"
+#include "sw/device/lib/crypto/impl/rsa/run_rsa.h"
+#include "sw/device/lib/crypto/include/rsa.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/profile.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Module for status messages.
+#define MODULE_ID MAKE_MODULE_ID('t', 's', 't')
+
+// Note: The key and the test vectors were generated out-of-band with Python.
+// The CRT exponents d_p and d_q belong to e = 65537 and were split into two
+// random XOR shares each.
+//
+// n =
+// 0xb9f54d9080a36ca8024dbae7d23e4716c5da56d9eab616bf00120ec6da6f1587a9e306a4c31cb224524a1398deae51e8ef310591c6c0381d2649e1e2b8b4f2ec93ed2121d8bd9e802a2e49c7106dce69a2240eefe2e20629e3b80dc1f1d81878c02a03e1fe4157aa73e444c3c47616171b75be0e5ac6a4f83498f13ff4d610b9e400194da05a86617815fa22e546efff05636edc0b02b49f9c502929a92b2f1898a23cf32010ec9a193c9369e294e546bfbfea1bcdc68d70f3db1791b00ebf3e7ab1f2d524637ef4301e0a68eb85c2aee313b24e130aaee9312287ae6ae098e3ed5b2dae90ed6954c95f27829a542da7f4f8bedb7c3c9872a6288fdbb4c3d89b
+// d =
+// 0xbc5db74c341bbd5012921a4d36193613168e46824769f53d54b68f97bb95e1013cb7335ecf589d3aea66a8a33fc7b17447968f1280461f5e0e0fb29f14eadcee51bcf0c476b3a9e5b9a159c429b4f7867f96109e97fc65e525a50c8a8dc1c3150105f4b285f907592a3bb8190faaa185c9d316306aa04a6501ef4ae482ffb4265e7349bafa7f0ff6ad456bae883b54e0c6c70ded97d2e0ecad5f0cbfc575348128f8e813bc62664aaaca0d8eb76dad6b1e5ddaf7abef45091da9654c7e32df514834f5b6add8657944298677f1d95d1678a772e923308a95b245fbd87364b6505c631230c4671caa939dac93a962a7644f07aef0ce58968317890874f092161
+
+// Test RSA-2048 private key in CRT form (all values in little-endian form).
+static const uint32_t kTestP[kRsa2048NumWords / 2] = {
+    0xf4bade21, 0x6cf8a819, 0x8f02d4bf, 0xa401bbe5, 0xa5898b86, 0xf0b101df,
+    0x1d7b639a, 0x3074f6a3, 0x7b4313d2, 0x63fce667, 0x2ba8d3ee, 0x548d7235,
+    0x75df6082, 0x85c3bb4d, 0x6c89c7f6, 0xe5c64950, 0x1440bd8f, 0xb484c2d9,
+    0x5194159e, 0xc905e6f2, 0xb4ecc73c, 0xfffc72e2, 0x50a91f42, 0x9f9273f2,
+    0xf25c6f93, 0x024af111, 0x689562fc, 0x00645b47, 0xe149ad13, 0x96e413b9,
+    0xdc15a97a, 0xd25ca2c5,
+};
+static const uint32_t kTestQ[kRsa2048NumWords / 2] = {
+    0xb427c73b, 0xfd96607c, 0xbb9d056e, 0xaec3b8ce, 0x4533105f, 0x14384c8d,
+    0xbe450535, 0xafb362c1, 0xcee4f31a, 0x58573371, 0xb90214a8, 0xe38313dc,
+    0xed402685, 0x45095c52, 0xa28af442, 0x43b48db0, 0xd9411afb, 0xabbc134b,
+    0x25163962, 0x9cdcdfbb, 0x0678f746, 0xb7a5ba32, 0x6d97e180, 0xff4f61b1,
+    0x0bc17349, 0x31aa38c5, 0x233fb839, 0x7fe5c478, 0x5b777b64, 0xab43fb0d,
+    0x9424256b, 0xe24d4de3,
+};
+static const uint32_t kTestDP0[kRsa2048NumWords / 2] = {
+    0x5e956e1b, 0xf12398d4, 0x35ec4e00, 0xcca6588e, 0x8fda6447, 0xb6791abd,
+    0x29a79296, 0xa32c979a, 0x78016016, 0xf231d6ff, 0x93202963, 0x2400afe6,
+    0x690f12e9, 0x6c81af7f, 0xcb8454b8, 0xa403d918, 0x587230f2, 0xd0bc76c4,
+    0x3d1d184a, 0x80f4a4c2, 0xe9adbce7, 0xcfcb6a4f, 0x90026c78, 0xffec06a2,
+    0xe4ea7dbf, 0x8bed2382, 0x4b573145, 0x4f17d8b7, 0x41a9f394, 0xe4539fc2,
+    0xa936681d, 0x8b292786,
+};
+static const uint32_t kTestDP1[kRsa2048NumWords / 2] = {
+    0x712d3e9a, 0x7fdb065a, 0xa51f1862, 0x88189e18, 0x27c55247, 0x7f7220af,
+    0x1319f81d, 0x917816a5, 0xfe5e97ca, 0x1833292e, 0x4b3470c5, 0x6bbd7028,
+    0x8e2682e2, 0xcc57d9fb, 0xcc703168, 0x94314f14, 0x7f2b4b56, 0xb1c494dd,
+    0x031a4988, 0x82c34835, 0x32dcf766, 0x0121427d, 0x07be4226, 0xa38f80db,
+    0x9ba9bb3a, 0xbc20795e, 0x56c51a5d, 0x61704c9e, 0xf6f971ee, 0xf6c1331a,
+    0x76177bda, 0x38ea1a43,
+};
+static const uint32_t kTestDQ0[kRsa2048NumWords / 2] = {
+    0x4eb74561, 0xc8465380, 0x99e2dc3f, 0xfd6989e4, 0x8d52230c, 0xff11946d,
+    0x07ac6aec, 0x5546e6f2, 0xef03f4ed, 0x642eea15, 0xd3dff84d, 0x2f7aa519,
+    0xbb847c50, 0x616a1c1c, 0xa53f67df, 0xf7150fc5, 0xb494e63c, 0x31fa462f,
+    0xe3480329, 0xb582a9ec, 0x09d28a51, 0x58477b08, 0xc857cea9, 0x23e469fb,
+    0x7a1b5f87, 0x4ef22ed7, 0x7b06cf7c, 0xf706f5f8, 0x51e01a05, 0xd8d9f3bd,
+    0xc4c9e724, 0x83d024fc,
+};
+static const uint32_t kTestDQ1[kRsa2048NumWords / 2] = {
+    0x79a82fd6, 0xe2d21d0f, 0x252d3922, 0xeedf38e6, 0x03d4fb98, 0xf3c28ef4,
+    0x530e26de, 0x3ea314f3, 0x133d6f56, 0x4988fe25, 0xb692c18c, 0x82591f0f,
+    0x1f33a03f, 0x936a7cab, 0x92e3dfa0, 0xaabb4868, 0x1ba235ae, 0x8fe3d52a,
+    0x475da380, 0x8bce3945, 0xbb8a9221, 0x58dde31f, 0xd8f772c9, 0x6ab44c4d,
+    0x164b55c6, 0x35f27551, 0x2e3ce659, 0xeee4a0cc, 0x606d26aa, 0x2cfda473,
+    0x47a4d76c, 0x3d8b32a8,
+};
+static const uint32_t kTestIQ[kRsa2048NumWords / 2] = {
+    0x783d75af, 0x1a07caa8, 0x7b3814c7, 0x23785434, 0x87b23c56, 0x28da5274,
+    0x84b04741, 0xeacdc3fd, 0x031d0940, 0xce132def, 0xa33166b7, 0x47859c4f,
+    0x8be419a4, 0x4a46a467, 0x777810bc, 0xd3574d68, 0xcb90ee8e, 0xde8ab6da,
+    0x55c8a96b, 0x146a567a, 0x77b1ef4a, 0xf5dbf06a, 0xcf5e5b0e, 0x5083d72c,
+    0xc3c93eee, 0xbeac1890, 0x953fef6d, 0x39783aaa, 0xadab5399, 0xfb67f4fc,
+    0xf5c00ba6, 0xc353d8b4,
+};
+static const uint32_t kTestModulus[kRsa2048NumWords] = {
+    0xb4c3d89b, 0xa6288fdb, 0x7c3c9872, 0xf4f8bedb, 0x9a542da7, 0xc95f2782,
+    0x90ed6954, 0xed5b2dae, 0x6ae098e3, 0x312287ae, 0x130aaee9, 0xe313b24e,
+    0xeb85c2ae, 0x301e0a68, 0x24637ef4, 0x7ab1f2d5, 0xb00ebf3e, 0xf3db1791,
+    0xcdc68d70, 0xbfbfea1b, 0xe294e546, 0x193c9369, 0x2010ec9a, 0x98a23cf3,
+    0xa92b2f18, 0x9c502929, 0x0b02b49f, 0x05636edc, 0xe546efff, 0x7815fa22,
+    0xa05a8661, 0xe400194d, 0xf4d610b9, 0x3498f13f, 0x5ac6a4f8, 0x1b75be0e,
+    0xc4761617, 0x73e444c3, 0xfe4157aa, 0xc02a03e1, 0xf1d81878, 0xe3b80dc1,
+    0xe2e20629, 0xa2240eef, 0x106dce69, 0x2a2e49c7, 0xd8bd9e80, 0x93ed2121,
+    0xb8b4f2ec, 0x2649e1e2, 0xc6c0381d, 0xef310591, 0xdeae51e8, 0x524a1398,
+    0xc31cb224, 0xa9e306a4, 0xda6f1587, 0x00120ec6, 0xeab616bf, 0xc5da56d9,
+    0xd23e4716, 0x024dbae7, 0x80a36ca8, 0xb9f54d90,
+};
+
+// Exponentiation base, less than n.
+static const uint32_t kTestBase[kRsa2048NumWords] = {
+    0x6b54d1de, 0xf7ac0d73, 0xf1ec9a44, 0xad37eaf2, 0x90fcbd5b, 0x7db0b2fa,
+    0x6d9b94b5, 0xcc8c28ca, 0x4aaa89b6, 0xec9f9bc7, 0xfa22af95, 0x2c107fff,
+    0xd429c602, 0x5988fc23, 0x183f4f71, 0x5d4babb2, 0xaa7bc75e, 0x87fd8d89,
+    0x400ff4e3, 0x2db05f29, 0x5a7f8630, 0x33bb3224, 0x3b137587, 0x8d89a2b2,
+    0x11bcfb94, 0x3be45eac, 0x987e44ea, 0x457d2500, 0xf4c13af4, 0xf81f1ac9,
+    0x675ea513, 0x89d28c4d, 0x2a954590, 0x6f6730e9, 0x73b3810f, 0xa9e104a8,
+    0x31b36f14, 0xc2f2e21f, 0xa916c589, 0xe290537b, 0x6532c6a7, 0xc7ece4ce,
+    0x67acdca4, 0xe52005e2, 0x33f1d69b, 0x6a14fa68, 0x34210531, 0xf40158f9,
+    0xfddda0ae, 0x1fc0c9b0, 0xf39df482, 0x31181234, 0x2e80322f, 0x05e473bf,
+    0x01a3c948, 0x9bd8b134, 0xaa2e0e02, 0x736dd97c, 0x0cfdac5d, 0x2581ea80,
+    0x84e51149, 0xa8caa1f0, 0xc4c7fadc, 0x0f361cf3,
+};
+
+// Expected result, base^d mod n.
+static const uint32_t kTestResult[kRsa2048NumWords] = {
+    0x7effba19, 0x94e9e034, 0x644957e5, 0x6b06fb19, 0x84c75ac2, 0xe71876cc,
+    0x6bb9b930, 0x3e16f09a, 0xc3e27caa, 0x355b13d1, 0xabd20822, 0x93b5065f,
+    0x466f230f, 0xe4265315, 0x0a25a1ce, 0x99f6aebb, 0x94aaffe4, 0xc8de49a0,
+    0xf213e12e, 0xd5762005, 0xe1f3cc79, 0xddee1d73, 0x85b250f5, 0x7e12b503,
+    0x33212518, 0xd54caa70, 0xac8cde82, 0x73f9df9e, 0x2e4262fc, 0x2773af45,
+    0x393d3a7e, 0x6c5bd9dc, 0xef08601a, 0x6b73dea9, 0xf4356ea0, 0xf5762c03,
+    0x5c1625fc, 0xcdce40df, 0x7bbb1031, 0x171b1c86, 0x6e88ef7d, 0x4d1bd4f5,
+    0x9ba1ee33, 0x3b299767, 0x58c05dd6, 0xf51beca4, 0x97d32a52, 0x120b7bcb,
+    0x8dfac7b9, 0x23dd6bf9, 0xdca25057, 0x1b30272c, 0x6a108058, 0xf1a5fa3b,
+    0xa69e5882, 0x328cb56f, 0x5cf7bd14, 0x18aa81d7, 0x5838fc7d, 0x4d55765b,
+    0xe6041b6a, 0x1dafdbd9, 0x0a69c549, 0x1c15927f,
+};
+
+// Arbitrary SHA-256 digest for the signature test.
+static uint32_t kTestDigest[] = {
+    0x4f8b42c2, 0x2dd3729b, 0x519ba6f6, 0x8d2da34c,
+    0xc0ffee00, 0x1b0fb3a8, 0x0d6b5d61, 0x7e9a8b2f,
+};
+
+// Message and label for the OAEP round trip through the public API.
+static const uint8_t kTestMessage[] = "Test message.";
+static const uint8_t kTestLabel[] = "Test label.";
+static const otcrypto_hash_mode_t kTestHashMode = kOtcryptoHashModeSha256;
+
+// The test private key in the form that the CRT functions expect.
+static rsa_2048_crt_private_key_t test_key;
+
+// Keyblob for the test private key constructed through the public API.
+static uint32_t
+    api_keyblob[kOtcryptoRsa2048CrtPrivateKeyblobBytes / sizeof(uint32_t)];
+
+static void test_key_init(void) {
+  memcpy(test_key.p.data, kTestP, sizeof(kTestP));
+  memcpy(test_key.q.data, kTestQ, sizeof(kTestQ));
+  memcpy(test_key.d_p0.data, kTestDP0, sizeof(kTestDP0));
+  memcpy(test_key.d_p1.data, kTestDP1, sizeof(kTestDP1));
+  memcpy(test_key.d_q0.data, kTestDQ0, sizeof(kTestDQ0));
+  memcpy(test_key.d_q1.data, kTestDQ1, sizeof(kTestDQ1));
+  memcpy(test_key.i_q.data, kTestIQ, sizeof(kTestIQ));
+  memcpy(test_key.n.data, kTestModulus, sizeof(kTestModulus));
+}
+
+static status_t modexp_crt_test(void) {
+  rsa_2048_int_t base;
+  memcpy(base.data, kTestBase, sizeof(kTestBase));
+
+  rsa_2048_int_t result;
+  uint64_t t_start = profile_start();
+  TRY(rsa_modexp_crt_2048_start(&base, &test_key));
+  TRY(rsa_modexp_2048_finalize(&result));
+  profile_end_and_print(t_start, "RSA-2048 CRT modexp");
+
+  TRY_CHECK_ARRAYS_EQ(result.data, kTestResult, ARRAYSIZE(kTestResult));
+  return OK_STATUS();
+}
+
+static status_t sign_crt_test(void) {
+  otcrypto_hash_digest_t digest = {
+      .mode = kOtcryptoHashModeSha256,
+      .data = kTestDigest,
+      .len = ARRAYSIZE(kTestDigest),
+  };
+
+  rsa_2048_int_t signature;
+  uint64_t t_start = profile_start();
+  TRY(rsa_signature_generate_crt_2048_start(&test_key, digest,
+                                           kRsaSignaturePaddingPkcs1v15));
+  TRY(rsa_signature_generate_2048_finalize(&signature));
+  profile_end_and_print(t_start, "RSA-2048 CRT signature generation");
+
+  // Check the signature with the public key.
+  rsa_2048_public_key_t public_key = {.n = test_key.n};
+  hardened_bool_t verification_result;
+  TRY(rsa_signature_verify_2048_start(&public_key, &signature));
+  TRY(rsa_signature_verify_finalize(digest, kRsaSignaturePaddingPkcs1v15,
+                                    &verification_result));
+  TRY_CHECK(verification_result == kHardenedBoolTrue);
+  return OK_STATUS();
+}
+
+static otcrypto_const_word32_buf_t word32_buf(const uint32_t *data,
+                                              size_t len) {
+  return (otcrypto_const_word32_buf_t){.data = data, .len = len};
+}
+
+static otcrypto_key_config_t api_key_config(otcrypto_key_mode_t key_mode) {
+  return (otcrypto_key_config_t){
+      .version = kOtcryptoLibVersion1,
+      .key_mode = key_mode,
+      .key_length = kOtcryptoRsa2048PrivateKeyBytes,
+      .hw_backed = kHardenedBoolFalse,
+      .security_level = kOtcryptoKeySecurityLevelLow,
+  };
+}
+
+/**
+ * Constructs the test private key in CRT form through the public API.
+ *
+ * @param q Second prime factor of the modulus.
+ * @param[out] private_key Destination private key with a CRT keyblob.
+ * @return Result of `otcrypto_rsa_private_key_from_crt`.
+ */
+static otcrypto_status_t api_private_key_construct(
+    const uint32_t *q, otcrypto_blinded_key_t *private_key) {
+  return otcrypto_rsa_private_key_from_crt(
+      kOtcryptoRsaSize2048, word32_buf(kTestModulus, ARRAYSIZE(kTestModulus)),
+      word32_buf(kTestP, ARRAYSIZE(kTestP)), word32_buf(q, ARRAYSIZE(kTestQ)),
+      word32_buf(kTestDP0, ARRAYSIZE(kTestDP0)),
+      word32_buf(kTestDP1, ARRAYSIZE(kTestDP1)),
+      word32_buf(kTestDQ0, ARRAYSIZE(kTestDQ0)),
+      word32_buf(kTestDQ1, ARRAYSIZE(kTestDQ1)),
+      word32_buf(kTestIQ, ARRAYSIZE(kTestIQ)), private_key);
+}
+
+/**
+ * Constructs the test public key through the public API.
+ *
+ * @param key_mode Mode for the public key.
+ * @param key_data Buffer for the public key data.
+ * @param[out] public_key Destination public key.
+ * @return Result of `otcrypto_rsa_public_key_construct`.
+ */
+static otcrypto_status_t api_public_key_construct(
+    otcrypto_key_mode_t key_mode, uint32_t *key_data,
+    otcrypto_unblinded_key_t *public_key) {
+  *public_key = (otcrypto_unblinded_key_t){
+      .key_mode = key_mode,
+      .key_length = kOtcryptoRsa2048PublicKeyBytes,
+      .key = key_data,
+  };
+  return otcrypto_rsa_public_key_construct(
+      kOtcryptoRsaSize2048, word32_buf(kTestModulus, ARRAYSIZE(kTestModulus)),
+      public_key);
+}
+
+static status_t api_sign_test(void) {
+  otcrypto_blinded_key_t private_key = {
+      .config = api_key_config(kOtcryptoKeyModeRsaSignPkcs),
+      .keyblob = api_keyblob,
+      .keyblob_length = kOtcryptoRsa2048CrtPrivateKeyblobBytes,
+  };
+  TRY(api_private_key_construct(kTestQ, &private_key));
+
+  otcrypto_hash_digest_t digest = {
+      .mode = kOtcryptoHashModeSha256,
+      .data = kTestDigest,
+      .len = ARRAYSIZE(kTestDigest),
+  };
+  uint32_t signature[kRsa2048NumWords];
+  otcrypto_word32_buf_t signature_buf = {
+      .data = signature,
+      .len = ARRAYSIZE(signature),
+  };
+  uint64_t t_start = profile_start();
+  TRY(otcrypto_rsa_sign(&private_key, digest, kOtcryptoRsaPaddingPkcs,
+                        signature_buf));
+  profile_end_and_print(t_start, "RSA-2048 CRT otcrypto_rsa_sign");
+
+  // Check the signature with the public key.
+  uint32_t public_key_data[kRsa2048NumWords];
+  otcrypto_unblinded_key_t public_key;
+  TRY(api_public_key_construct(kOtcryptoKeyModeRsaSignPkcs, public_key_data,
+                               &public_key));
+  hardened_bool_t verification_result;
+  TRY(otcrypto_rsa_verify(&public_key, digest, kOtcryptoRsaPaddingPkcs,
+                          word32_buf(signature, ARRAYSIZE(signature)),
+                          &verification_result));
+  TRY_CHECK(verification_result == kHardenedBoolTrue);
+  return OK_STATUS();
+}
+
+static status_t api_decrypt_test(void) {
+  // Encrypt the message with the public key.
+  uint32_t public_key_data[kRsa2048NumWords];
+  otcrypto_unblinded_key_t public_key;
+  TRY(api_public_key_construct(kOtcryptoKeyModeRsaEncryptOaep, public_key_data,
+                               &public_key));
+  otcrypto_const_byte_buf_t label = {
+      .data = kTestLabel,
+      .len = sizeof(kTestLabel),
+  };
+  uint32_t ciphertext[kRsa2048NumWords];
+  otcrypto_word32_buf_t ciphertext_buf = {
+      .data = ciphertext,
+      .len = ARRAYSIZE(ciphertext),
+  };
+  TRY(otcrypto_rsa_encrypt(
+      &public_key, kTestHashMode,
+      (otcrypto_const_byte_buf_t){.data = kTestMessage,
+                                  .len = sizeof(kTestMessage)},
+      label, ciphertext_buf));
+
+  // Decrypt it with the CRT private key.
+  otcrypto_blinded_key_t private_key = {
+      .config = api_key_config(kOtcryptoKeyModeRsaEncryptOaep),
+      .keyblob = api_keyblob,
+      .keyblob_length = kOtcryptoRsa2048CrtPrivateKeyblobBytes,
+  };
+  TRY(api_private_key_construct(kTestQ, &private_key));
+  uint8_t plaintext[kRsa2048NumWords * sizeof(uint32_t)];
+  size_t plaintext_len;
+  uint64_t t_start = profile_start();
+  TRY(otcrypto_rsa_decrypt(
+      &private_key, kTestHashMode,
+      word32_buf(ciphertext, ARRAYSIZE(ciphertext)), label,
+      (otcrypto_byte_buf_t){.data = plaintext, .len = sizeof(plaintext)},
+      &plaintext_len));
+  profile_end_and_print(t_start, "RSA-2048 CRT otcrypto_rsa_decrypt");
+
+  TRY_CHECK(plaintext_len == sizeof(kTestMessage));
+  TRY_CHECK_ARRAYS_EQ(plaintext, kTestMessage, sizeof(kTestMessage));
+  return OK_STATUS();
+}
+
+static status_t api_keyblob_integrity_test(void) {
+  otcrypto_hash_digest_t digest = {
+      .mode = kOtcryptoHashModeSha256,
+      .data = kTestDigest,
+      .len = ARRAYSIZE(kTestDigest),
+  };
+  uint32_t signature[kRsa2048NumWords];
+  otcrypto_word32_buf_t signature_buf = {
+      .data = signature,
+      .len = ARRAYSIZE(signature),
+  };
+  otcrypto_blinded_key_t private_key = {
+      .config = api_key_config(kOtcryptoKeyModeRsaSignPkcs),
+      .keyblob = api_keyblob,
+      .keyblob_length = kOtcryptoRsa2048CrtPrivateKeyblobBytes,
+  };
+  TRY(api_private_key_construct(kTestQ, &private_key));
+
+  // A modified keyblob must fail the integrity check.
+  api_keyblob[0] ^= 1;
+  TRY_CHECK(status_err(otcrypto_rsa_sign(&private_key, digest,
+                                         kOtcryptoRsaPaddingPkcs,
+                                         signature_buf)) == kInvalidArgument);
+  api_keyblob[0] ^= 1;
+
+  // So must a modified checksum.
+  private_key.checksum ^= 1;
+  TRY_CHECK(status_err(otcrypto_rsa_sign(&private_key, digest,
+                                         kOtcryptoRsaPaddingPkcs,
+                                         signature_buf)) == kInvalidArgument);
+  private_key.checksum ^= 1;
+
+  // A CRT keyblob cannot hold a key in the standard form.
+  TRY_CHECK(status_err(otcrypto_rsa_private_key_from_exponents(
+                kOtcryptoRsaSize2048,
+                word32_buf(kTestModulus, ARRAYSIZE(kTestModulus)),
+                word32_buf(kTestModulus, ARRAYSIZE(kTestModulus)),
+                word32_buf(kTestModulus, ARRAYSIZE(kTestModulus)),
+                &private_key)) == kInvalidArgument);
+
+  // Primes that do not fill their limbs are rejected.
+  uint32_t short_q[ARRAYSIZE(kTestQ)];
+  memcpy(short_q, kTestQ, sizeof(kTestQ));
+  short_q[ARRAYSIZE(short_q) - 1] >>= 1;
+  TRY_CHECK(status_err(api_private_key_construct(short_q, &private_key)) ==
+            kInvalidArgument);
+  return OK_STATUS();
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  status_t test_result = OK_STATUS();
+  CHECK_STATUS_OK(entropy_complex_init());
+  test_key_init();
+  EXECUTE_TEST(test_result, modexp_crt_test);
+  EXECUTE_TEST(test_result, sign_crt_test);
+  EXECUTE_TEST(test_result, api_sign_test);
+  EXECUTE_TEST(test_result, api_decrypt_test);
+  EXECUTE_TEST(test_result, api_keyblob_integrity_test);
+  return status_ok(test_result);
+}
@@ -0,0 +1,283 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/impl/rsa/rsa_datatypes.h"
+#include "sw/device/lib/crypto/impl/rsa/rsa_encryption.h"
+#include "sw/device/lib/crypto/impl/rsa/rsa_signature.h"
+#include "sw/device/lib/crypto/impl/rsa/run_rsa.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/profile.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Module for status messages.
+#define MODULE_ID MAKE_MODULE_ID('t', 's', 't')
+
+// Note: The key and the test vectors were generated out-of-band with Python.
+// The CRT exponents d_p and d_q belong to e = 65537 and were split into two
+// random XOR shares each.
+//
+// n =
+// 0xb3f40dc76dc95b3973144671aca899672d5280c009e77b4d96fe30cebb8b5b3542c4720183e13f3f39599c59775a3de0d7f01afd539a7847540f25d37cd00699cd2aa2c82123e053ed5211486e673e60706149c48fcb7eb62e6721c0e6be9a514e115b68a9e92f0ddf25a1289736eb50230502eca85b7881010afc32fede1779fdd842343bac0838ce6bead9a48a6ea381e2e1fa4e9e0c28393805ead6367090177a9fd5df00b0b3b1072348ebdb63156ea34202377383d6b21e343513c42d802a71048475ad35522a4f2a3da11a50a832879375d15410efb3e30cedcfb29414cd6c60c58a357828782ce8df753768a962b102dab5d96756e4efabc24c90fda3881028cc0ea18a16cb1d3178f1e4f507c205481c26834ee5071a0353157b6756bb826c5f443dffbc6c0ec4394c4e22f9cdff365610dfc8f2856f80d14401896ea3992dda99eb56667a6c783b29660b1bbb6b30047ba771adf679a26b80867c789f3936736bdebe86753bb866ff1fe7b68685f117f933b167fcc6661fd3f02bfd
+// d =
+// 0xdc76e0cab5d392a7a237f220778a0c7be8d2c304831dcdba692fa756c9fdc3bda4bc4ccffe64df0f9e3b62deae3d28c210cbb61a80bfd121274d723cd514d1d6c112130c0ca334c49db8dae3af740814d9442d14064c7b98c6e622e6d4757f54a21d870230928b75fb2f7c198be8af5c7bb5900cfad5d59f214aa15ff8a4d9d8e3087ca8c6d279e033ef92c71706b78ad4d36ef73234a9c03dc447bb9aba677d4b7137e62afcb57f45759be24d7d776407d53646c6435ca9e8de32d289678c35030521308e0a1c12ff270527d9663a1831b9157d4211f07591dea9cdadfd0bdc06ae1752ad724e14005209bd03e7600a055ce2feceed2db2aeb4c5e6ec9644c19d1f3169dff316af5617f35fb56d5d6cfdeea6742bf0a56aef427cd21b5a560597f29c0db606cf63bafb481738d908b15b421ef1f44cde64e9a73ef3ae4c25be66a4354970a7246f1cc3827786b7e90838d57c2e4115558fa5d10ae489fb7903f8daa264396695f2a978208642ceb0e72158e496671623aa707e2f2541a91d1
+
+// Test RSA-3072 private key in CRT form (all values in little-endian form).
+static const uint32_t kTestP[kRsa3072NumWords / 2] = {
+    0x9f86ad19, 0x2ab8a57a, 0x7cb9a179, 0x8b493c24, 0xdc87e868, 0xce8e8428,
+    0x78a25bb9, 0x0960d7af, 0x091a8b58, 0xeeb68d54, 0x9f1b2dbe, 0x2eda882b,
+    0xe7cdb00b, 0x2d51d786, 0x17bbd99f, 0x68c2bf42, 0xdf138f98, 0xe5cd6b17,
+    0xd3e2fe74, 0xcd940a46, 0x3ed8258f, 0x28745d79, 0x5aa3d432, 0x65ccd059,
+    0x47f2834b, 0x6c7e18cb, 0x3fc5c08d, 0x39367bf4, 0xb4f5d99d, 0xf3158964,
+    0x8f236703, 0x5a77d612, 0x0d80e83a, 0x5006198b, 0x49351059, 0x74ecad39,
+    0x8cb0e151, 0xac2e407e, 0x24b5a4ca, 0xcb7daa50, 0x9c57fe4b, 0x55143fac,
+    0x657f98e8, 0x3edb741d, 0xf7ab030b, 0x758c405b, 0x6044b7c8, 0xd0f6eac3,
+};
+static const uint32_t kTestQ[kRsa3072NumWords / 2] = {
+    0x84c3ee85, 0xf12dde0d, 0x18ba8b62, 0x12319342, 0x7a2b8b9a, 0x0e5d0b92,
+    0x8c801c26, 0x878a3f76, 0x180a8dcb, 0xab33c7ad, 0x40639e98, 0x99372b21,
+    0xafd91c71, 0x63f9c907, 0xbcbd6d8e, 0x3f1d5243, 0xf4b07d8a, 0xac24dbe5,
+    0x9838efe9, 0xcf067f05, 0xfccb9897, 0x2b2ff0e5, 0x6cd709ee, 0x65e38f97,
+    0x8fc8ca6f, 0x597230ad, 0x38687592, 0x34d7d481, 0xf333a0af, 0xdffb6202,
+    0xed910678, 0x9751fee0, 0xf2c9b236, 0x38fe8602, 0x88e202a1, 0xf57b6cc7,
+    0xbfda531d, 0x4637109a, 0xb5babead, 0x9aa12b17, 0x6813c9b2, 0x42954e18,
+    0xa44134ff, 0x19ede42e, 0x15a49a33, 0x928ee1c6, 0x4c64b9be, 0xdc756fb4,
+};
+static const uint32_t kTestDP0[kRsa3072NumWords / 2] = {
+    0xf0d543b1, 0xec6d4382, 0x75a2491b, 0xd1f9e923, 0xa11eb028, 0x041d2dc5,
+    0xf3b7dc90, 0x870c0e8b, 0x5c656ce7, 0xeadb55a2, 0x95174517, 0x8230155c,
+    0x98403003, 0xc5631643, 0x404a46a0, 0xc14265b6, 0x697455c6, 0x14a35ae1,
+    0x4bce15ca, 0x93317c4e, 0xef4f283e, 0x5e9d0f04, 0xf50462d1, 0xec90638b,
+    0x1b186d3c, 0x4c78a2e0, 0xeffc2d53, 0x49b9517c, 0x17619939, 0x87ce2778,
+    0x320974f5, 0x7d5ea5d7, 0x79f83b69, 0x134c4db6, 0x785cc5e4, 0xeb295c6e,
+    0x14624472, 0xee5ec06a, 0xf9875482, 0xbab8f209, 0xcdc34cd2, 0xe776e1c7,
+    0xcf04cdc9, 0x0fd88e46, 0x45d77f43, 0xd8238283, 0xd4025803, 0xd0e0a3c2,
+};
+static const uint32_t kTestDP1[kRsa3072NumWords / 2] = {
+    0x50da24c0, 0xe08a656a, 0x3ce5e922, 0xc8fec6ae, 0x339ec100, 0xe9d6e1ce,
+    0xae8c5b2b, 0xa906c000, 0xdd3a79c1, 0x4d9bf942, 0x039154a2, 0x172b1b21,
+    0x9414f9a5, 0xb546a546, 0x11cd474f, 0x0faeaf2f, 0x428fa242, 0x011519ec,
+    0x44200281, 0x0394d00c, 0x09f62302, 0x63326e13, 0x393b1ddc, 0x129a2583,
+    0xa6c9a9b3, 0x38697d2a, 0x2e02d932, 0x274792b3, 0xf1015900, 0xd369bd00,
+    0xab24fc73, 0x76d5fbde, 0xa5a36ad8, 0x98992946, 0xe576c0e3, 0x443e61e7,
+    0x3b796a96, 0x0495fc2a, 0xe28b017f, 0x11a3edf5, 0xd55d4fc5, 0x52bca086,
+    0xe81507ec, 0x5bca8154, 0xbd85a590, 0xb6c951e4, 0xcfdf8c1f, 0xcb10a4ed,
+};
+static const uint32_t kTestDQ0[kRsa3072NumWords / 2] = {
+    0x0a2f388e, 0x6a11badc, 0x73fa05a0, 0x088db06b, 0x56d9b5a4, 0x3d5a6043,
+    0x365587e9, 0x03ac4a7d, 0x1b163f51, 0xf2816e0d, 0x8b5e9d8d, 0x45befa11,
+    0x631a9728, 0xc240e3a8, 0xa206e889, 0x7f10dac6, 0x9eb0dae5, 0x3c0d41c6,
+    0x9109aa33, 0xfc16858a, 0x95d37f8e, 0x08286e34, 0xe095cae4, 0xc265d3a5,
+    0x796eb4a6, 0xdda37663, 0x9e402182, 0xbf857f6f, 0x9932d928, 0xce8cbb65,
+    0xde4791d9, 0x422d0ba6, 0x0b858e0b, 0x7c48a942, 0xdcace6f0, 0x4e66bb0b,
+    0x6ff79252, 0x143c585b, 0xb3ac7432, 0xa2500890, 0x94113aad, 0x5d9b8ccf,
+    0xa9bed417, 0xc3caee97, 0xc67dbd2e, 0x8276c641, 0xcb21e822, 0x32fd0d8d,
+};
+static const uint32_t kTestDQ1[kRsa3072NumWords / 2] = {
+    0x285633fb, 0x720cad32, 0x58a67878, 0xc8c2a5f1, 0x4ff3783c, 0x5ebe26a5,
+    0xa6813cea, 0xdf8cb7a6, 0x88689a10, 0xd5259107, 0x9ae10d9d, 0x8d5ad05b,
+    0x74d076d8, 0x37b9ea12, 0xe695d7ff, 0xeefad8e9, 0x63de3f3e, 0x73a623a0,
+    0xbfc9b458, 0x30e08336, 0x1c1c8a9a, 0xe5353230, 0x2331b2d0, 0x694fcf43,
+    0x49bdae36, 0x3d09461d, 0x99bc8cbe, 0xfa2c646d, 0xfebd1631, 0x0d6278a1,
+    0xee19b572, 0x5158e6c5, 0xfc0b77ae, 0x18dc6ec1, 0xe2be8a96, 0x33c3cb3b,
+    0x25d4ad57, 0xa82c879e, 0xd04f39d9, 0xab08ff81, 0x04e752f5, 0xf7a6822d,
+    0x9626d61b, 0xf4343f04, 0x30094b8c, 0x1d92f24f, 0x01b6898d, 0xb52b4dd3,
+};
+static const uint32_t kTestIQ[kRsa3072NumWords / 2] = {
+    0xfb6bbc80, 0xc4c9fd4e, 0x6a9dac19, 0x010a211b, 0xb8b61ed8, 0x32033e6c,
+    0x79262c27, 0xad67f21a, 0x0afdb5b5, 0x51453eeb, 0xf6f2b143, 0xff436b45,
+    0x6ddbac2e, 0xa4b72c54, 0x12e9accb, 0xfcb56a4b, 0x068228d4, 0x706e594d,
+    0x08ba75d3, 0x585d4fe2, 0xa4eeed35, 0x96c66149, 0xccdce481, 0x937f9f1e,
+    0x3e9507f4, 0x105f82d9, 0x4eee800c, 0x9cc39126, 0x7ac4e888, 0xb38ed2da,
+    0x032c4781, 0x5c77d3bd, 0x663a9884, 0x3e2e1db8, 0x64013e3d, 0x089df3bb,
+    0xee35bfe5, 0x64574106, 0xe9ebb193, 0x1d4a91fc, 0x93725586, 0x74626365,
+    0x5201f9fc, 0x664b73fb, 0x2db11603, 0x2b3536ea, 0xb2bab1ff, 0x7fc334e6,
+};
+static const uint32_t kTestModulus[kRsa3072NumWords] = {
+    0xd3f02bfd, 0xfcc6661f, 0xf933b167, 0x8685f117, 0xff1fe7b6, 0x753bb866,
+    0x6bdebe86, 0x9f393673, 0x80867c78, 0xf679a26b, 0x7ba771ad, 0xbb6b3004,
+    0x29660b1b, 0x7a6c783b, 0x99eb5666, 0xa3992dda, 0x4401896e, 0x856f80d1,
+    0x10dfc8f2, 0xcdff3656, 0x4c4e22f9, 0x6c0ec439, 0x443dffbc, 0xbb826c5f,
+    0x157b6756, 0x071a0353, 0x26834ee5, 0xc205481c, 0xf1e4f507, 0xcb1d3178,
+    0x0ea18a16, 0x881028cc, 0x4c90fda3, 0xe4efabc2, 0xb5d96756, 0x62b102da,
+    0x753768a9, 0x782ce8df, 0x8a357828, 0xcd6c60c5, 0xcfb29414, 0xb3e30ced,
+    0xd15410ef, 0x32879375, 0xa11a50a8, 0x2a4f2a3d, 0x75ad3552, 0x2a710484,
+    0x13c42d80, 0xb21e3435, 0x377383d6, 0x6ea34202, 0xebdb6315, 0xb1072348,
+    0xdf00b0b3, 0x177a9fd5, 0xd6367090, 0x393805ea, 0x4e9e0c28, 0x81e2e1fa,
+    0xa48a6ea3, 0xce6bead9, 0x3bac0838, 0xfdd84234, 0xfede1779, 0x010afc32,
+    0xa85b7881, 0x230502ec, 0x9736eb50, 0xdf25a128, 0xa9e92f0d, 0x4e115b68,
+    0xe6be9a51, 0x2e6721c0, 0x8fcb7eb6, 0x706149c4, 0x6e673e60, 0xed521148,
+    0x2123e053, 0xcd2aa2c8, 0x7cd00699, 0x540f25d3, 0x539a7847, 0xd7f01afd,
+    0x775a3de0, 0x39599c59, 0x83e13f3f, 0x42c47201, 0xbb8b5b35, 0x96fe30ce,
+    0x09e77b4d, 0x2d5280c0, 0xaca89967, 0x73144671, 0x6dc95b39, 0xb3f40dc7,
+};
+
+// Exponentiation base, less than n.
+static const uint32_t kTestBase[kRsa3072NumWords] = {
+    0x92f614a7, 0xd5ede152, 0x4f272395, 0x3aa3709b, 0x63139354, 0x86ebcdde,
+    0x4599cb7e, 0x91f022f5, 0x3cbdceac, 0x192da724, 0xcfcbb28a, 0x560646d6,
+    0x3bca2b15, 0x52362f1b, 0x05a260b6, 0x79553c68, 0x873647b0, 0x9276bfec,
+    0x73d84d58, 0x3d43ac8e, 0xba16b29b, 0xe6f022ec, 0x49523c58, 0xf7079960,
+    0xb4d3fd1e, 0x19aa6443, 0xe2ee829e, 0x5d0c1b9d, 0x79278544, 0x3604d57f,
+    0x22171b5a, 0x3c94db85, 0x413e15fc, 0x0d2ce27c, 0xa2ed894c, 0x80c279ae,
+    0xab1f53ea, 0x38c5101f, 0xb6ab8461, 0xe20e1726, 0xfab8da49, 0xb99d7675,
+    0xc024e51e, 0x25cbafc8, 0xd9e013e2, 0xaace33a9, 0xb19f14ca, 0x336b3470,
+    0xab7120e3, 0xb0c9a6a8, 0xe3b3edbd, 0x09723d57, 0x14bc1e9d, 0xbd7aee03,
+    0x8126b690, 0xd8f0deb3, 0x6a76be6e, 0x19ac893f, 0x59d242f8, 0x5ca69456,
+    0xf629efe8, 0x1ad2904c, 0xc6e484f0, 0x8c43b728, 0x94b8be09, 0x850a1d92,
+    0x36b6ef05, 0x16eda9ee, 0x3ceb3d18, 0xb6297fd3, 0x65042a92, 0x4017d170,
+    0x8d5b9225, 0xc18096b1, 0x8bc8938a, 0x3d7b933e, 0xa0673f08, 0x54f0adbf,
+    0x146abe29, 0x7353514f, 0x69ca1cfc, 0x855edd49, 0xaa97e919, 0x9f5f8e51,
+    0xdd3c0bcb, 0x446512cf, 0x2b0db8e2, 0x1a74988b, 0x4c4d8218, 0x531437a9,
+    0x16282350, 0x8b2569a1, 0x2a7fb0df, 0x7d036b66, 0x06f6d96e, 0x7f66d7c7,
+};
+
+// Expected result, base^d mod n.
+static const uint32_t kTestResult[kRsa3072NumWords] = {
+    0x7a263107, 0xfdaa2082, 0xf5602a23, 0xf5f14db5, 0xfc632fc9, 0x2de6faec,
+    0x5fb873ad, 0x2ad8a59b, 0xf4b4fa68, 0x41788bde, 0x02870670, 0x5e1b6037,
+    0xd2855ab0, 0x57ef498f, 0xf91d5142, 0xee0a3e4a, 0xc04045ac, 0xfcdbaaf1,
+    0x53c9e982, 0x838cc389, 0xaec74d13, 0x1673eedc, 0xc47c7854, 0xddd217d1,
+    0xa2eb45e6, 0xc2c1e6ca, 0x64f6f280, 0xb3da8ee5, 0x584d161f, 0x6bdd65be,
+    0x5f943735, 0x62caa578, 0xce5fb229, 0x5225f015, 0x389bab2f, 0x976113a6,
+    0x36538028, 0xf2e64111, 0x2499dc8f, 0xf990a0ff, 0xd9ec396c, 0xaeb4eea1,
+    0xc2c9b82f, 0xec5d3164, 0xd4ecc37d, 0xf2c1430d, 0x6d9f6c20, 0x958f6dde,
+    0x3623b4b3, 0xa3a11004, 0x439c414c, 0xe63643aa, 0x934815bc, 0xdbf3115c,
+    0xcf0f94a6, 0xd2d00dbb, 0xac3c5203, 0x9b5ddd35, 0x59127652, 0x962fae86,
+    0xd9c0a616, 0x31bd09e4, 0x6d8b2c6b, 0x38b5839d, 0x338705f5, 0x4e0cf0b0,
+    0xce0c4dd6, 0x1a6c5333, 0x34ae508a, 0x0f0624c7, 0xbbf4de53, 0x21ab3873,
+    0x8edb1d46, 0x884e04ca, 0x029b8e6b, 0x854f282a, 0x0720fff1, 0x0eef0884,
+    0xdc439e3d, 0x2ddb3571, 0xf17bb520, 0x8837c3f4, 0xd18e5182, 0x02d33de8,
+    0xc3ee3fd6, 0x2aa76acb, 0x1a9f33e3, 0x3fbe7674, 0x035fcfc2, 0xab18549b,
+    0xc0e36239, 0xd47bea2e, 0xff7aa09f, 0xd562a8cb, 0x6b0c2ed1, 0xae9a2bea,
+};
+
+// Arbitrary SHA-256 digest for the signature test.
+static uint32_t kTestDigest[] = {
+    0x4f8b42c2, 0x2dd3729b, 0x519ba6f6, 0x8d2da34c,
+    0xc0ffee00, 0x1b0fb3a8, 0x0d6b5d61, 0x7e9a8b2f,
+};
+
+// Message and OAEP label for the decryption test.
+static const unsigned char kTestMessage[] = "Test message.";
+static const size_t kTestMessageLen = sizeof(kTestMessage) - 1;
+static const unsigned char kTestLabel[] = "Test label.";
+static const size_t kTestLabelLen = sizeof(kTestLabel) - 1;
+
+enum {
+  // Maximum OAEP plaintext length with SHA-256 (see IETF RFC 8017).
+  kMaxPlaintextBytes = kRsa3072NumBytes - 2 * (256 / 8) - 2,
+};
+
+// The test private key in the form that the CRT functions expect.
+static rsa_3072_crt_private_key_t test_key;
+
+static void test_key_init(void) {
+  memcpy(test_key.p.data, kTestP, sizeof(kTestP));
+  memcpy(test_key.q.data, kTestQ, sizeof(kTestQ));
+  memcpy(test_key.d_p0.data, kTestDP0, sizeof(kTestDP0));
+  memcpy(test_key.d_p1.data, kTestDP1, sizeof(kTestDP1));
+  memcpy(test_key.d_q0.data, kTestDQ0, sizeof(kTestDQ0));
+  memcpy(test_key.d_q1.data, kTestDQ1, sizeof(kTestDQ1));
+  memcpy(test_key.i_q.data, kTestIQ, sizeof(kTestIQ));
+  memcpy(test_key.n.data, kTestModulus, sizeof(kTestModulus));
+}
+
+static status_t modexp_crt_test(void) {
+  rsa_3072_int_t base;
+  memcpy(base.data, kTestBase, sizeof(kTestBase));
+
+  rsa_3072_int_t result;
+  uint64_t t_start = profile_start();
+  TRY(rsa_modexp_crt_3072_start(&base, &test_key));
+  TRY(rsa_modexp_3072_finalize(&result));
+  profile_end_and_print(t_start, "RSA-3072 CRT modexp");
+
+  TRY_CHECK_ARRAYS_EQ(result.data, kTestResult, ARRAYSIZE(kTestResult));
+  return OK_STATUS();
+}
+
+static status_t sign_crt_test(void) {
+  otcrypto_hash_digest_t digest = {
+      .mode = kOtcryptoHashModeSha256,
+      .data = kTestDigest,
+      .len = ARRAYSIZE(kTestDigest),
+  };
+
+  rsa_3072_int_t signature;
+  uint64_t t_start = profile_start();
+  TRY(rsa_signature_generate_crt_3072_start(&test_key, digest,
+                                           kRsaSignaturePaddingPkcs1v15));
+  TRY(rsa_signature_generate_3072_finalize(&signature));
+  profile_end_and_print(t_start, "RSA-3072 CRT signature generation");
+
+  // Check the signature with the public key.
+  rsa_3072_public_key_t public_key = {.n = test_key.n};
+  hardened_bool_t verification_result;
+  TRY(rsa_signature_verify_3072_start(&public_key, &signature));
+  TRY(rsa_signature_verify_finalize(digest, kRsaSignaturePaddingPkcs1v15,
+                                    &verification_result));
+  TRY_CHECK(verification_result == kHardenedBoolTrue);
+  return OK_STATUS();
+}
+
+static status_t decrypt_crt_test(void) {
+  rsa_3072_public_key_t public_key = {.n = test_key.n};
+  rsa_3072_int_t ciphertext;
+  TRY(rsa_encrypt_3072_start(&public_key, kOtcryptoHashModeSha256,
+                             kTestMessage, kTestMessageLen, kTestLabel,
+                             kTestLabelLen));
+  TRY(rsa_encrypt_3072_finalize(&ciphertext));
+
+  uint8_t plaintext[kMaxPlaintextBytes];
+  size_t plaintext_len;
+  uint64_t t_start = profile_start();
+  TRY(rsa_decrypt_crt_3072_start(&test_key, &ciphertext));
+  TRY(rsa_decrypt_finalize(kOtcryptoHashModeSha256, kTestLabel, kTestLabelLen,
+                           sizeof(plaintext), plaintext, &plaintext_len));
+  profile_end_and_print(t_start, "RSA-3072 CRT decryption");
+
+  TRY_CHECK(plaintext_len == kTestMessageLen);
+  TRY_CHECK_ARRAYS_EQ(plaintext, kTestMessage, kTestMessageLen);
+  return OK_STATUS();
+}
+
+/**
+ * Corrupts one exponent share so that the exponentiation modulo p is wrong.
+ *
+ * OTBN must catch this with its e = 65537 re-encryption check and stop with
+ * an illegal instruction instead of returning the faulty result, which would
+ * reveal a factor of n.
+ */
+static status_t fault_check_test(void) {
+  rsa_3072_crt_private_key_t faulty_key = test_key;
+  // Flip bit 1 so that d_p stays odd.
+  faulty_key.d_p1.data[0] ^= 1 << 1;
+
+  rsa_3072_int_t base;
+  memcpy(base.data, kTestBase, sizeof(kTestBase));
+
+  rsa_3072_int_t result;
+  TRY(rsa_modexp_crt_3072_start(&base, &faulty_key));
+  status_t err = rsa_modexp_3072_finalize(&result);
+  TRY_CHECK(err.value == OTCRYPTO_RECOV_ERR.value);
+
+  // OTBN must still be usable after the failed check.
+  return modexp_crt_test();
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  status_t test_result = OK_STATUS();
+  CHECK_STATUS_OK(entropy_complex_init());
+  test_key_init();
+  EXECUTE_TEST(test_result, modexp_crt_test);
+  EXECUTE_TEST(test_result, sign_crt_test);
+  EXECUTE_TEST(test_result, decrypt_crt_test);
+  EXECUTE_TEST(test_result, fault_check_test);
+  return status_ok(test_result);
+}
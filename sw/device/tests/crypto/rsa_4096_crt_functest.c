@@ -0,0 +1,263 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/impl/rsa/rsa_datatypes.h"
+#include "sw/device/lib/crypto/impl/rsa/rsa_signature.h"
+#include "sw/device/lib/crypto/impl/rsa/run_rsa.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/profile.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Module for status messages.
+#define MODULE_ID MAKE_MODULE_ID('t', 's', 't')
+
+// Note: The key and the test vectors were generated out-of-band with Python.
+// The CRT exponents d_p and d_q belong to e = 65537 and were split into two
+// random XOR shares each.
+//
+// n =
+// 0xa7ef5de40273e5e3c8ce87faa9438e21da0517f4129c475e1d5e242504e24213b7fceb5a15bbcbc29991d1621f464704dd6b0ca5195821bc8e874c1e619b0e0eacb94995e2bc874de1f8ab187c43655c802f8306c8d079fdea47958527484c9654f81c360565797cf63323a2a91a5b36d93fde35bc5aa15ddbe1f05c5421476573bb30ef01ef307e31d7b986e157699f27e1f521877dc0f3b119dde845544745314bf7802e72433bfc3b8786f78898f02684e97fd15dfa4b84164d92f15e2389dca2399488b14cd37d8628e8dd8f4bdedc8ca3522a45e61c6146aeea2afe0777d6ec2c6a8d237d110e95eecaf5e884f0c57021c5ea76471f9c96af640dffbf46d14716c21aa9beb84a7e98f247214d536c587393838f8b4f4e7a175c674b9e9804b412186e049f4559352730952504d7493aff72a03d339d887528a352da24583ea547dd1b29de60a3497dbd650d8eff741656c76f2025adde8aca6efb0a25fb2b82b3d2afc9f275b3e55ac23e73f9a766a65c4e8483e4e9556f7f533a0c4b5833e731c50492fa801284f9ff9dece9287ab5a1c777ee678129c3869a496e50d476193d98ee8f955916aac132aefaef7218c114f348ec243690705efc56feff0678a34d1395f678a759e9455db06ae364a9d6a41dc50a04e55496cff4c31363c8ebf6e704d0d4925304e845809019fa1454044dfecb5c67fa2f45fa1c5f2ec553
+// d =
+// 0x40a82be59c3e242e51c396de1eea482067711b9a58c9fbbe541f495a4969959842f7e9636b47bd3944e83c0e03cd8a8d68748d4f49954193f7ea4697d1eba17b6bec00d569113e24f1d24c89a65a4a7dd54ab5af5884cfdb3fa6e4fdf9b45fec67758963112bd31d162b75566cb61d955e0ab592c9dcb9114a95d075b3dc86411cd05f143e91e98144ce727b686a3fdbcbbeb722fc2822309128cce3df418619315436cc0ed5e6660384a5f70479feac43a05bc85f03485967d73071d9656dd867eebbada0fd667f6cee48f4f34cf720ac98a74efcc0a1ca9e7758e406be7c809aea9e653dc702a19d1483f677bc58e6dc95822351d4cd28722120112d44a0cf5306f0f6d185055f45e5c12cbf912a7c7f64e77ee6540e6b688165b5032e372dba33c2d1aab669e8f16224397dd6f05a2ab226d129fe92dd13eb2366a29a770e5c36e03c25d02647717cfac3911eeb8a12b7b27ecf9a117cf1b6a2a8a25345815b487af385f42e5948b3354df21954664660db5adcf3e5569904d7d7b31d279a711034582e08e3c17fbde2c9f9c45cf16b88330bc4f34ca4a95aaa28d7b819c7caaa134f0e0617256fbcb225f4da1610cf6f91921a15ba3fbb5352229e659c2bf6594c6932576e3a193e5d07a2eb31d15515314eaec355181252ad6ae573bc43b643fea97c7ffd3c8680edb461b1308550924b4e14bf515103a1d2014cc2b801
+
+// Test RSA-4096 private key in CRT form (all values in little-endian form).
+static const uint32_t kTestP[kRsa4096NumWords / 2] = {
+    0x55f9f801, 0x9e3feddf, 0x5151c800, 0x3780c078, 0x57e9df52, 0x3b9816dd,
+    0xa7d6308b, 0xc5a7e5b6, 0x6ae95996, 0xa32e9e9d, 0x0aa10301, 0xb243ce01,
+    0x62f20c91, 0x951cfa03, 0x329272d3, 0x4a86ed40, 0x046497bd, 0x8207f358,
+    0xef07e888, 0x34ea8e5c, 0x94f048bc, 0x458bc18a, 0x75db03f9, 0xc12a9fd5,
+    0x4177a6b7, 0xd2aab45d, 0xe0961c5b, 0xaf046974, 0x9f337417, 0x4b826d80,
+    0x3ad23acd, 0xe2b872cd, 0x5aece5b5, 0x32ec9a17, 0x7d473467, 0x4fd34b55,
+    0xa79c6015, 0xee701ed8, 0x07198a49, 0x41ffafdf, 0x5b85e210, 0x8f44c1b1,
+    0x14be796d, 0xb398da6d, 0xf829c898, 0x76645adf, 0x59da115d, 0xd04b77a8,
+    0x5a967d02, 0x6ff7609c, 0x30917574, 0x735cd515, 0x10f6a477, 0x5b71191d,
+    0xbcef44b3, 0xe72a8113, 0x9523a65f, 0x4717682e, 0x113c448b, 0x51a0459b,
+    0xa636b398, 0x86e37b7c, 0xa421fb51, 0xd65d1633,
+};
+static const uint32_t kTestQ[kRsa4096NumWords / 2] = {
+    0x080b5d53, 0x09ed06fa, 0xb04e77db, 0xc275c422, 0x56dccfca, 0x91b0af79,
+    0x59efbfe1, 0x0e3c68ab, 0x977a0e6c, 0x10a82899, 0x2db71d76, 0xeb30c8ef,
+    0x27f09f0e, 0xe6dcc73b, 0x3a532e27, 0xef372031, 0x7b9ea22c, 0xe56f25be,
+    0x25e97c34, 0xd903896d, 0xd9f0e46a, 0xd8061b83, 0x9c51f5ea, 0x462b198c,
+    0x30e442a3, 0x006b5db7, 0xb58709e5, 0xc2455496, 0x0aded39e, 0xa5528fe8,
+    0x0118c264, 0x278b1b98, 0x0132c1fd, 0x7fd4e0f5, 0xbb8d914f, 0x16fafb62,
+    0x76bbc685, 0xc0eedd74, 0x1ef46e2e, 0x1ad62433, 0x495c5d3c, 0xeb78551d,
+    0x6d0bb152, 0xfc384ce9, 0xbf076e24, 0x01b4b178, 0xbf25ce9c, 0x0c098186,
+    0x2b7a7d3f, 0xcfd9f4d5, 0xb48ffda7, 0x138cd531, 0xa14645c8, 0x9e6a8c8b,
+    0x9b0fbca7, 0x6f332549, 0x8044b033, 0xaf432b75, 0xc5cdda85, 0xf611bdca,
+    0xdf8bdd70, 0x16efd87f, 0x798f7852, 0xc88dafe1,
+};
+static const uint32_t kTestDP0[kRsa4096NumWords / 2] = {
+    0x0d35f53b, 0xef66ce21, 0x8e2e5b7b, 0xeef4fc17, 0xc07f75eb, 0xc77c8870,
+    0x63eda8ba, 0x9749c630, 0xcc62bdd1, 0xc4891565, 0x6f5f28c0, 0xe8b29d15,
+    0xdb3e79d6, 0x2dbf97bf, 0x16a1498d, 0x93954bbb, 0xf2f44189, 0x721d352b,
+    0xe8d8b508, 0xa8047282, 0xc8e72e6f, 0xd4eb21a2, 0x7f5fdfb3, 0x6299095c,
+    0xfa94a40f, 0xc74412fa, 0x3e59c951, 0x0ed494fa, 0xc177ff32, 0x9728c7e6,
+    0x8a863214, 0xf47c30ee, 0x5db23a78, 0xbac8e0e4, 0xe56ed3bc, 0xdcbabd8f,
+    0xffdf47e9, 0x51a39b69, 0x9552bc65, 0xcba25a64, 0xf3b7ba57, 0x674b1178,
+    0x690ba52e, 0x376c527e, 0xf560307c, 0xb886e5f1, 0xdf53b2e4, 0xb2724fd8,
+    0x762df69b, 0xb4a9db06, 0x14162d0a, 0x8236c485, 0x124cf45a, 0xd35d4aec,
+    0xfefc3ca4, 0x529214b4, 0xe92e9eeb, 0x59254b60, 0x17dadbf6, 0x9332a70d,
+    0xf19ee70d, 0x9f9d5f94, 0x9c1a566a, 0xe0e7c718,
+};
+static const uint32_t kTestDP1[kRsa4096NumWords / 2] = {
+    0x9dccd53a, 0xac487c4a, 0xaeccf27f, 0xc5a0d995, 0x3c589ac0, 0x1604b39a,
+    0x9f5f8289, 0xce3a85d5, 0xff701c20, 0x9003e212, 0xaeeed705, 0xbf8b07ce,
+    0x3791cdd6, 0x940f799b, 0xa2f1044c, 0xe789012e, 0x5b4046e7, 0xf3bea669,
+    0x5316d14a, 0x26a6c4ac, 0xaabefdee, 0xbd6d29db, 0xb32fde01, 0xfb81654d,
+    0x869add20, 0xbb31f6b3, 0xd4e5eeca, 0xa999a739, 0x9e25a326, 0x1ddd5115,
+    0x66d1d27c, 0x6640ad52, 0xe669a551, 0x76eec9ee, 0x15ad8bd6, 0x4fcb07df,
+    0xdf09d6c8, 0x804801dc, 0x77a18574, 0x54d78838, 0x7f0f2337, 0x12c7ca29,
+    0xef527da4, 0x7546a835, 0x00255331, 0x4557836e, 0xa780007e, 0x19a1aaa1,
+    0x2c35a129, 0xd6cae875, 0xe70dae64, 0x02d8df8b, 0x8cb7d000, 0x4216b073,
+    0xb1670e90, 0xaa73e55d, 0x3efdcd58, 0x8b5d5413, 0x509b01e0, 0xeec5ffeb,
+    0x9a1254fe, 0xf378dbc7, 0x42857996, 0xf0618363,
+};
+static const uint32_t kTestDQ0[kRsa4096NumWords / 2] = {
+    0xd7874380, 0xeedc16d5, 0x1f656edd, 0x8060fecc, 0xba17ff43, 0x9374aa6a,
+    0x100c21f2, 0x5ed869f8, 0x890d2978, 0xed4bc7c7, 0x2fdec8e5, 0xeb28a8f4,
+    0xe8d9c1ee, 0x61acf0d4, 0xcc48304e, 0x3aed555f, 0x825ad8b2, 0xeb63ad88,
+    0x14e01dd6, 0xe4955b01, 0xc2b12715, 0xad831c38, 0x6398be1a, 0x79813606,
+    0x3f399b2d, 0x5b9ab6ef, 0x56c8f4a3, 0x54cf2a6c, 0x80db1253, 0xa665600f,
+    0x8ac06c5b, 0x91c8e19d, 0x75eacd1b, 0x4deb40e5, 0x15c0a4fc, 0xbf59df9d,
+    0x1587f120, 0x8ef396e5, 0x449aea9a, 0xf1bbef2e, 0x21306c95, 0xbd717658,
+    0x61067dc5, 0x43dd96ef, 0x44096461, 0x7d692fad, 0x4ec0d7d4, 0xfa597b36,
+    0x03073cb9, 0x5c0ef457, 0xfdd11d87, 0x87583676, 0x314a7637, 0xd53c150d,
+    0x639e6878, 0xdd23475f, 0xcd4abd4b, 0x92fd25f7, 0x4de34557, 0xe931cc62,
+    0xccc8a189, 0xb4e25a38, 0x2cabc477, 0x23551fd6,
+};
+static const uint32_t kTestDQ1[kRsa4096NumWords / 2] = {
+    0x9eb8d127, 0x4ab3a7e0, 0x5a941e35, 0xc6cb06c8, 0x56464142, 0x1bc15d17,
+    0x55e8c41b, 0x5c73da1e, 0xc542983c, 0x77e58116, 0xb18cc894, 0xee5fe958,
+    0xadeca4a9, 0x18bda962, 0x2ca6bab1, 0x5265b47d, 0x7cf09e59, 0xbf44ebd8,
+    0xd9e24050, 0xce120d64, 0x60072df3, 0xecb6f493, 0xc173b5c2, 0x8b705c9d,
+    0x6d167db8, 0x6b36db5c, 0xd0d4e6fa, 0x3c6c0cc3, 0xab765368, 0x647d8750,
+    0x8c730a7f, 0x7ce6a6d1, 0x3a8bcbc2, 0x097c7be1, 0x70483119, 0x5588498b,
+    0xb9b1b1d5, 0x7569534d, 0x841538df, 0xad5bf7b6, 0x8ff3868f, 0x0049e129,
+    0xaafbfd35, 0x005d78c1, 0x06b58af0, 0xfa777ee9, 0x09647902, 0xebfee9c7,
+    0xcd2211a0, 0xc30d3e75, 0x90086ec2, 0xc1ec6087, 0xa708a4a9, 0x803f2e0b,
+    0xe33f5ecd, 0x5ea78367, 0x6552dd10, 0xabe9c83f, 0x562fd1b1, 0x678bc9b1,
+    0xb6966d79, 0x051aa4bf, 0x48118994, 0x93e85b77,
+};
+static const uint32_t kTestIQ[kRsa4096NumWords / 2] = {
+    0x621ef7e3, 0x8e9efa63, 0x74644566, 0x26938a22, 0xb27b3974, 0x6c08e8ad,
+    0xc44a024d, 0xbc2b33e6, 0x1a254bb7, 0xfa1adf18, 0x47c09564, 0xcdddb3a7,
+    0xb5fb07c5, 0x68610de4, 0x620899f0, 0xdc660654, 0x51cb4534, 0x06450abc,
+    0xb9fe5068, 0xd955a67a, 0x06e1f3cf, 0xc9e06960, 0x47adb059, 0x0985bb44,
+    0xd3baa73f, 0x00e78b86, 0xbb3856d1, 0x64abd46e, 0x839f9e05, 0x6d03917a,
+    0xb862bb70, 0x1723a906, 0xe77d5060, 0x996f7a2f, 0xfa691ca7, 0xdaf5794a,
+    0x348b684a, 0xe22ddc14, 0xdf86cf47, 0x157bb787, 0x349c9eb9, 0x75181c5f,
+    0x12c87298, 0x1231ffca, 0x7a8318ba, 0x16f9e938, 0x01b9b1ba, 0x99b6d99c,
+    0x3cfa712a, 0xc9115d36, 0xb45b00dc, 0xacb9c736, 0x74e458b3, 0xfe78b4be,
+    0xbdd4c245, 0x95915aa6, 0x6347e26f, 0x385e7041, 0x26ea6aff, 0x0bd46468,
+    0xbedfe40d, 0x6d746f8c, 0xd00efd22, 0xb04d7450,
+};
+static const uint32_t kTestModulus[kRsa4096NumWords] = {
+    0x5f2ec553, 0x2f45fa1c, 0xcb5c67fa, 0x54044dfe, 0x9019fa14, 0x04e84580,
+    0xd0d49253, 0xebf6e704, 0xc31363c8, 0x5496cff4, 0xc50a04e5, 0xa9d6a41d,
+    0xb06ae364, 0x59e9455d, 0x95f678a7, 0x78a34d13, 0x56feff06, 0x90705efc,
+    0x48ec2436, 0x18c114f3, 0xaefaef72, 0x16aac132, 0xee8f9559, 0x76193d98,
+    0x496e50d4, 0x29c3869a, 0x77ee6781, 0x7ab5a1c7, 0x9dece928, 0x1284f9ff,
+    0x0492fa80, 0x33e731c5, 0x3a0c4b58, 0x556f7f53, 0x8483e4e9, 0x66a65c4e,
+    0x3e73f9a7, 0xb3e55ac2, 0xafc9f275, 0x2b82b3d2, 0xfb0a25fb, 0xde8aca6e,
+    0x6f2025ad, 0x741656c7, 0x650d8eff, 0xa3497dbd, 0x1b29de60, 0x3ea547dd,
+    0x52da2458, 0x887528a3, 0xa03d339d, 0x493aff72, 0x952504d7, 0x59352730,
+    0x6e049f45, 0x04b41218, 0x674b9e98, 0x4e7a175c, 0x838f8b4f, 0x6c587393,
+    0x47214d53, 0x4a7e98f2, 0x1aa9beb8, 0xd14716c2, 0x0dffbf46, 0x9c96af64,
+    0xea76471f, 0xc57021c5, 0xf5e884f0, 0x0e95eeca, 0x8d237d11, 0xd6ec2c6a,
+    0x2afe0777, 0x6146aeea, 0x2a45e61c, 0xdc8ca352, 0xdd8f4bde, 0x7d8628e8,
+    0x88b14cd3, 0xdca23994, 0xf15e2389, 0x84164d92, 0xd15dfa4b, 0x2684e97f,
+    0xf78898f0, 0xfc3b8786, 0x2e72433b, 0x314bf780, 0x45544745, 0xb119dde8,
+    0x877dc0f3, 0x27e1f521, 0xe157699f, 0x31d7b986, 0x01ef307e, 0x73bb30ef,
+    0x54214765, 0xdbe1f05c, 0xbc5aa15d, 0xd93fde35, 0xa91a5b36, 0xf63323a2,
+    0x0565797c, 0x54f81c36, 0x27484c96, 0xea479585, 0xc8d079fd, 0x802f8306,
+    0x7c43655c, 0xe1f8ab18, 0xe2bc874d, 0xacb94995, 0x619b0e0e, 0x8e874c1e,
+    0x195821bc, 0xdd6b0ca5, 0x1f464704, 0x9991d162, 0x15bbcbc2, 0xb7fceb5a,
+    0x04e24213, 0x1d5e2425, 0x129c475e, 0xda0517f4, 0xa9438e21, 0xc8ce87fa,
+    0x0273e5e3, 0xa7ef5de4,
+};
+
+// Exponentiation base, less than n.
+static const uint32_t kTestBase[kRsa4096NumWords] = {
+    0xcc4b77f6, 0xba325e75, 0x7eb685c7, 0xb3748813, 0xa56e699a, 0xc40543f3,
+    0xb8e9125f, 0xa61ba226, 0x86d50f53, 0x7a462555, 0x9754172d, 0x259000d9,
+    0x5bae32a7, 0xd9269759, 0x2ab680e6, 0x1d2d6087, 0x0fe49758, 0x763cb0dd,
+    0xc5b1dafb, 0xe448af68, 0x78a5126b, 0xadb52bcd, 0x9f0bb768, 0xa87f096a,
+    0xdd03f6fa, 0xbb11b64c, 0xaeb1becc, 0x8f2f9ba3, 0x12b9929a, 0x1e2cc215,
+    0xc7a9ece6, 0x44738968, 0x91784242, 0x2eba743b, 0xc28b0c1e, 0x5b87cf7c,
+    0x2117281e, 0xb12e6925, 0x3251035a, 0x7987af75, 0x1715b74d, 0x357f4805,
+    0x5f6d0108, 0x2ed88639, 0x85bdd53f, 0xc5ab1f15, 0xeca9a79c, 0xbffd7565,
+    0xaea9cbf6, 0xd94eea1a, 0xbe36b0b5, 0x42ee0780, 0xac492a32, 0xf192080d,
+    0x8406180b, 0x17a03c9c, 0xcc625118, 0x3f06a47f, 0x14413314, 0x3698492d,
+    0xff6a579e, 0xc6bb677d, 0xc0895e70, 0xe6e90449, 0x4c15ca4d, 0xd02cf152,
+    0xc7bab1f2, 0x8313c833, 0x09aed226, 0xa801b1e8, 0xd5de64f5, 0x619a74e0,
+    0x1fd7f7e4, 0x3109f03f, 0xf04f67ed, 0xa43d3f67, 0xd1e0c6ec, 0xdf13adf5,
+    0xabf3af19, 0x50a6a512, 0x1743d4fa, 0xefbf223f, 0xcae98a4a, 0x320a1c90,
+    0x13d3e1d8, 0x88cc2588, 0x83d06db5, 0x747051e1, 0x86ac18bd, 0xf0b6f4c0,
+    0x65042294, 0x2acd025e, 0x23157d03, 0x177d101d, 0x438f9fbe, 0x4db3d895,
+    0xb6016fe5, 0x710e56a6, 0x3cf92a38, 0xb3b89032, 0x91d35713, 0x7a912166,
+    0xbfd1502b, 0x19026af9, 0x8d73d1c9, 0x7b566de6, 0x3b45c370, 0xbf084aa0,
+    0x56f089d4, 0x80d9da33, 0x0ae59e53, 0xbace7a4f, 0x8e1fbc7f, 0xb64cd2b7,
+    0xba92b7c1, 0xf4237581, 0x6f8b6ae0, 0xc18ccf90, 0xa22445c9, 0x33fd140b,
+    0xa33ec209, 0xfbda85b7, 0x63d940a2, 0x7f898295, 0x5fdd85cb, 0x9d604c65,
+    0x5800c743, 0x7a44f146,
+};
+
+// Expected result, base^d mod n.
+static const uint32_t kTestResult[kRsa4096NumWords] = {
+    0xe88853ac, 0x81854bb8, 0xea2bcc39, 0x0d857d3b, 0x137804fe, 0xd3bf5a0c,
+    0xca285a69, 0x0df6c537, 0xfd407455, 0xdce3538b, 0xda7c4e73, 0xab290f62,
+    0x969716ea, 0xb19b0415, 0xec312f11, 0x0ebf31bd, 0x6745d63c, 0x92208b3c,
+    0x28df71da, 0xa227f47a, 0x3ae85a82, 0x2f98aa73, 0xe1d781a7, 0xa7652b72,
+    0x11a9bfb4, 0x1c780180, 0x246278d6, 0x985debba, 0xfd725034, 0x1a3fb3b0,
+    0xf0e47f58, 0x2b40d2b4, 0xa093cb61, 0x6289e39a, 0x9707c11c, 0x415798f8,
+    0x093f8a4f, 0x77cf8309, 0x465e80db, 0x87d1009c, 0x76d97b68, 0x20687765,
+    0xcea78c6e, 0x69912cd8, 0x2886d886, 0x7ba20723, 0x89623c63, 0xa5504a34,
+    0x3cdb3348, 0x27578ea7, 0x06b50e2f, 0x51f01b0a, 0x61868dee, 0x1c6edcbb,
+    0x1e823cd0, 0x7873518a, 0x0a5fc4f4, 0xdad74754, 0xd0cbeafa, 0xf57cf630,
+    0x66502dcc, 0x9d498ba7, 0xfd3c51d5, 0x2af75953, 0xabb56a82, 0x58e3f573,
+    0xdc47aa17, 0xea2fbfee, 0xd74f9667, 0x9613108d, 0x04fa7cc3, 0xe3275015,
+    0x56d46480, 0xdcb0d3e4, 0x2461f79a, 0x516e812d, 0x90b3896f, 0x8212160a,
+    0x82751d53, 0xe23bb881, 0x651fcbd4, 0x6dc0bfa7, 0x9221ac75, 0xa3c3b760,
+    0xbbda6808, 0x09f1b5ee, 0xc62da942, 0x7928629f, 0x3a0472b3, 0x518abe45,
+    0x8fbc05b4, 0xb077216a, 0xa527a31a, 0xbccbed3a, 0x4f4658c6, 0xae10552b,
+    0xcaffd68d, 0xd00ac562, 0x4cbc6cde, 0x3ad215ec, 0x7238d19f, 0xefa0c689,
+    0x56086c0b, 0xde8e7f60, 0x24e9c02b, 0xdf3983cd, 0x3bb3c425, 0xbc3e7c3d,
+    0xbe76fc97, 0x6a47493d, 0xfea34c75, 0x8e282ab4, 0x34e42714, 0xbdba8443,
+    0xb441ec3b, 0x70e6e5b6, 0x3cc5b9ab, 0x8bc3ab17, 0xd17f261a, 0x34b1d549,
+    0xfaa1c699, 0xf5a49c73, 0x89ca8f94, 0xa98b5ce7, 0x5c374f04, 0x6c32d9b9,
+    0x85477e77, 0xa55482c3,
+};
+
+// Arbitrary SHA-256 digest for the signature test.
+static uint32_t kTestDigest[] = {
+    0x4f8b42c2, 0x2dd3729b, 0x519ba6f6, 0x8d2da34c,
+    0xc0ffee00, 0x1b0fb3a8, 0x0d6b5d61, 0x7e9a8b2f,
+};
+
+// The test private key in the form that the CRT functions expect.
+static rsa_4096_crt_private_key_t test_key;
+
+static void test_key_init(void) {
+  memcpy(test_key.p.data, kTestP, sizeof(kTestP));
+  memcpy(test_key.q.data, kTestQ, sizeof(kTestQ));
+  memcpy(test_key.d_p0.data, kTestDP0, sizeof(kTestDP0));
+  memcpy(test_key.d_p1.data, kTestDP1, sizeof(kTestDP1));
+  memcpy(test_key.d_q0.data, kTestDQ0, sizeof(kTestDQ0));
+  memcpy(test_key.d_q1.data, kTestDQ1, sizeof(kTestDQ1));
+  memcpy(test_key.i_q.data, kTestIQ, sizeof(kTestIQ));
+  memcpy(test_key.n.data, kTestModulus, sizeof(kTestModulus));
+}
+
+static status_t modexp_crt_test(void) {
+  rsa_4096_int_t base;
+  memcpy(base.data, kTestBase, sizeof(kTestBase));
+
+  rsa_4096_int_t result;
+  uint64_t t_start = profile_start();
+  TRY(rsa_modexp_crt_4096_start(&base, &test_key));
+  TRY(rsa_modexp_4096_finalize(&result));
+  profile_end_and_print(t_start, "RSA-4096 CRT modexp");
+
+  TRY_CHECK_ARRAYS_EQ(result.data, kTestResult, ARRAYSIZE(kTestResult));
+  return OK_STATUS();
+}
+
+static status_t sign_crt_test(void) {
+  otcrypto_hash_digest_t digest = {
+      .mode = kOtcryptoHashModeSha256,
+      .data = kTestDigest,
+      .len = ARRAYSIZE(kTestDigest),
+  };
+
+  rsa_4096_int_t signature;
+  uint64_t t_start = profile_start();
+  TRY(rsa_signature_generate_crt_4096_start(&test_key, digest,
+                                           kRsaSignaturePaddingPkcs1v15));
+  TRY(rsa_signature_generate_4096_finalize(&signature));
+  profile_end_and_print(t_start, "RSA-4096 CRT signature generation");
+
+  // Check the signature with the public key.
+  rsa_4096_public_key_t public_key = {.n = test_key.n};
+  hardened_bool_t verification_result;
+  TRY(rsa_signature_verify_4096_start(&public_key, &signature));
+  TRY(rsa_signature_verify_finalize(digest, kRsaSignaturePaddingPkcs1v15,
+                                    &verification_result));
+  TRY_CHECK(verification_result == kHardenedBoolTrue);
+  return OK_STATUS();
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  status_t test_result = OK_STATUS();
+  CHECK_STATUS_OK(entropy_complex_init());
+  test_key_init();
+  EXECUTE_TEST(test_result, modexp_crt_test);
+  EXECUTE_TEST(test_result, sign_crt_test);
+  return status_ok(test_result);
+}
@@ -18,6 +18,7 @@ with_unknown! {
     pub enum RescueType: u32 [default = Self::None] {
         None = 0,
         Xmodem = u32::from_le_bytes(*b"XMDM"),
+        Spi = u32::from_le_bytes(*b"SPID"),
     }
 
     pub enum CommandTag: u32 [default = Self::Unknown] {
@@ -52,7 +53,7 @@ pub struct OwnerRescueConfig {
         default = "OwnerRescueConfig::default_header"
     )]
     pub header: TlvHeader,
-    /// The type of rescue protocol to use (ie: Xmodem).
+    /// The type of rescue protocol to use (ie: Xmodem or Spi).
     pub rescue_type: RescueType,
     /// The start of the rescue flash region (in pages).
     pub start: u16,
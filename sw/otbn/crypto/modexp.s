@@ -5,6 +5,8 @@
 .text
 .globl modexp_65537
 .globl modexp
+.globl montmul_mul1
+.globl cond_sub_to_dmem
 
 /**
  * Constant-time, conditional swap of two general-purpose registers
@@ -0,0 +1,395 @@
+/* Copyright lowRISC contributors (OpenTitan project). */
+/* Licensed under the Apache License, Version 2.0, see LICENSE for details. */
+/* SPDX-License-Identifier: Apache-2.0 */
+
+.text
+.globl modexp_crt
+
+/**
+ * RSA private key operation using the Chinese Remainder Theorem
+ *
+ * Calculates: m = c^d mod n, where n = p*q
+ *
+ * Instead of one exponentiation with a full-size exponent modulo n, this
+ * routine runs two exponentiations with half-size exponents d_p = d mod (p-1)
+ * and d_q = d mod (q-1) modulo the half-size primes p and q and recombines the
+ * results with Garner's formula:
+ *
+ *   m_p = c^d_p mod p
+ *   m_q = c^d_q mod q
+ *   h   = (m_p - m_q) * i_q mod p, where i_q = q^-1 mod p
+ *   m   = m_q + h * q
+ *
+ * Since the cost of an exponentiation is roughly cubic in the size of the
+ * operands, this is about four times faster than `modexp` with the full
+ * modulus. Both exponentiations are done by `modexp` and so use the same
+ * masked exponent shares and message blinding as the non-CRT operation.
+ *
+ * Because a fault injected into one of the two half-size exponentiations
+ * would reveal a factor of n (Bellcore attack), the result is checked by
+ * recomputing m^65537 mod n and comparing it with c before returning. The
+ * routine fails with an `unimp` if the check does not pass. This also means
+ * that it can only be used for keys with the public exponent 65537, and that
+ * c must be fully reduced modulo n.
+ *
+ * The inputs are expected at the `rsa_crt_*` locations defined in
+ * `run_rsa_mem.s`. All other buffers of that file are used as scratch space.
+ * The primes p and q must be exactly h limbs long (i.e. have their most
+ * significant bit set) and the exponent shares must combine to odd values.
+ *
+ * @param[in]  x30: h, number of limbs per prime (half the limbs of n)
+ * @param[in]  w31: all-zero
+ * @param[in]  dmem[rsa_crt_p]: p, first prime (h limbs)
+ * @param[in]  dmem[rsa_crt_q]: q, second prime (h limbs)
+ * @param[in]  dmem[rsa_crt_d_p0]: first share of d_p (h limbs)
+ * @param[in]  dmem[rsa_crt_d_p1]: second share of d_p (h limbs)
+ * @param[in]  dmem[rsa_crt_d_q0]: first share of d_q (h limbs)
+ * @param[in]  dmem[rsa_crt_d_q1]: second share of d_q (h limbs)
+ * @param[in]  dmem[rsa_crt_i_q]: i_q, q^-1 mod p (h limbs)
+ * @param[in]  dmem[rsa_crt_c_lo]: lower half of c (h limbs)
+ * @param[in]  dmem[rsa_crt_c_hi]: upper half of c (h limbs)
+ * @param[out] dmem[inout]: m, c^d mod n (2*h limbs)
+ *
+ * Clobbered registers: x2 to x25, x27, x29, x31
+ *                      w0 to w30
+ * Clobbered flag groups: FG0, FG1
+ */
+modexp_crt:
+  # Both q and the second share of d_p live in buffers that are overwritten
+  # by the exponentiation modulo q, so move them to the scratchpad first.
+  li   x4, 2
+  la   x2, rsa_crt_q
+  la   x3, rsa_crt_q_copy
+  loop x30, 2
+    bn.lid x4, 0(x2++)
+    bn.sid x4, 0(x3++)
+  la   x2, rsa_crt_d_p1
+  la   x3, rsa_crt_d_p1_copy
+  loop x30, 2
+    bn.lid x4, 0(x2++)
+    bn.sid x4, 0(x3++)
+
+  # Compute m_q = c^d_q mod q. At this point q is already in place at rsa_n
+  # and d_q in rsa_d0 and rsa_d1.
+  la  x16, rsa_n
+  la  x17, RR
+  jal x1, modload
+  jal x1, crt_reduce
+  li  x29, 1
+  jal x1, modexp
+
+  # Save m_q.
+  la   x2, r0
+  la   x3, rsa_crt_m_q
+  loop x30, 2
+    bn.lid x4, 0(x2++)
+    bn.sid x4, 0(x3++)
+
+  # Move p and d_p into place for the exponentiation modulo p.
+  la   x2, rsa_crt_p
+  la   x3, rsa_n
+  loop x30, 2
+    bn.lid x4, 0(x2++)
+    bn.sid x4, 0(x3++)
+  la   x2, rsa_crt_d_p0
+  la   x3, rsa_d0
+  loop x30, 2
+    bn.lid x4, 0(x2++)
+    bn.sid x4, 0(x3++)
+  la   x2, rsa_crt_d_p1_copy
+  la   x3, rsa_d1
+  loop x30, 2
+    bn.lid x4, 0(x2++)
+    bn.sid x4, 0(x3++)
+
+  # Compute m_p = c^d_p mod p.
+  la  x16, rsa_n
+  la  x17, RR
+  jal x1, modload
+  jal x1, crt_reduce
+  li  x29, 1
+  jal x1, modexp
+
+  # The message blinding in modexp uses RR as scratch space, so recompute the
+  # Montgomery constants for p.
+  la  x16, rsa_n
+  la  x17, RR
+  jal x1, modload
+
+  jal x1, crt_garner
+
+  # Compute n = p * q for the fault check. This overwrites the copy of p at
+  # rsa_n and i_q, both of which are not needed anymore.
+  la  x10, rsa_crt_p
+  la  x11, rsa_crt_q_copy
+  la  x12, rsa_n
+  addi x31, x30, 0
+  jal x1, bignum_mul
+
+  # From here on we operate on full-size numbers. x27 keeps h.
+  addi x27, x30, 0
+  add  x30, x30, x30
+
+  la  x16, rsa_n
+  la  x17, RR
+  jal x1, modload
+
+  # Compute m^65537 mod n into work_buf. modexp_65537 modifies its input, so
+  # run it on a copy of m in r2.
+  li   x4, 2
+  la   x2, inout
+  la   x3, r2
+  loop x30, 2
+    bn.lid x4, 0(x2++)
+    bn.sid x4, 0(x3++)
+  la  x14, r2
+  la  x2, work_buf
+  la  x16, rsa_n
+  la  x17, RR
+  jal x1, modexp_65537
+
+  # Compare the result with c, accumulating differences in w4.
+  bn.xor w4, w4, w4
+  li     x4, 2
+  li     x5, 3
+  la     x2, work_buf
+  la     x3, rsa_crt_c_lo
+  loop   x27, 4
+    bn.lid x4, 0(x2++)
+    bn.lid x5, 0(x3++)
+    bn.xor w2, w2, w3
+    bn.or  w4, w4, w2
+  la     x3, rsa_crt_c_hi
+  loop   x27, 4
+    bn.lid x4, 0(x2++)
+    bn.lid x5, 0(x3++)
+    bn.xor w2, w2, w3
+    bn.or  w4, w4, w2
+
+  # Restore h.
+  addi x30, x27, 0
+
+  # Fail if any bit differs (FG0.Z is bit 3 of the flags CSR).
+  bn.cmp w4, w31
+  csrrs  x2, FG0, x0
+  andi   x2, x2, 8
+  bne    x2, x0, _modexp_crt_check_ok
+  unimp
+  unimp
+  unimp
+
+_modexp_crt_check_ok:
+  ret
+
+/**
+ * Reduce the full-size input c modulo the current prime
+ *
+ * Returns: A = c mod M, in [0, R)
+ *
+ * Writes c = c_hi * R + c_lo, reduced modulo the half-size modulus M at
+ * rsa_n, to r0 where `modexp` expects its base. The result is congruent to c
+ * modulo M but not necessarily fully reduced, which is fine as the first
+ * thing `modexp` does is to convert it to the Montgomery domain.
+ *
+ * This uses montmul_mul1 to get c_lo * R^-1 mod M, adds c_hi and then
+ * multiplies by RR: (c_lo * R^-1 + c_hi) * RR * R^-1 = c_lo + c_hi * R = c.
+ *
+ * @param[in]  x30: N, number of limbs of M
+ * @param[in]  x31: N-1, number of limbs minus one
+ * @param[in]   w1: m0', Montgomery constant
+ * @param[in]  w31: all-zero
+ * @param[in]  dmem[rsa_n]: M, modulus
+ * @param[in]  dmem[RR]: RR, squared Montgomery modulus
+ * @param[in]  dmem[rsa_crt_c_lo]: lower half of c
+ * @param[in]  dmem[rsa_crt_c_hi]: upper half of c, must be < R
+ * @param[out] dmem[r0]: A
+ *
+ * Clobbered registers: x2 to x13, x16, x19 to x22
+ *                      w2, w3, w4 to w[4+N-1], w24 to w30
+ * Clobbered flag groups: FG0, FG1
+ */
+crt_reduce:
+  li  x8, 4
+  li  x9, 3
+  li  x10, 4
+  li  x11, 2
+
+  # dmem[work_buf] <= c_lo * R^-1 mod M, fully reduced.
+  la  x16, rsa_n
+  la  x19, rsa_crt_c_lo
+  la  x21, work_buf
+  jal x1, montmul_mul1
+
+  # [w[4+N-1]:w4] <= dmem[work_buf] + c_hi. The sum is less than M + R.
+  li     x8, 4
+  la     x2, work_buf
+  la     x3, rsa_crt_c_hi
+  bn.add w31, w31, w31
+  loop   x30, 4
+    bn.lid  x11, 0(x2++)
+    bn.lid  x9, 0(x3++)
+    bn.addc w2, w2, w3
+    bn.movr x8++, x11
+
+  # Move the final carry into FG1.C and clear FG0.
+  bn.addc w2, w31, w31
+  bn.cmp  w31, w2, FG1
+  bn.add  w31, w31, w31
+
+  # Subtract M if the addition overflowed, which brings the sum below R.
+  li  x8, 4
+  la  x16, rsa_n
+  la  x21, work_buf
+  jal x1, cond_sub_to_dmem
+
+  # [w[4+N-1]:w4] <= montmul(dmem[work_buf], RR)
+  li  x8, 4
+  la  x16, rsa_n
+  la  x19, work_buf
+  la  x20, RR
+  jal x1, montmul
+
+  addi x2, x8, 0
+  la   x3, r0
+  loop x30, 2
+    bn.sid x2, 0(x3++)
+    addi   x2, x2, 1
+
+  ret
+
+/**
+ * Garner recombination of the two half-size results
+ *
+ * Returns: m = m_q + ((m_p - m_q) * i_q mod p) * q
+ *
+ * All intermediate values modulo p are fully reduced, so that m < p * q.
+ *
+ * @param[in]  x30: h, number of limbs per prime
+ * @param[in]  x31: h-1, number of limbs minus one
+ * @param[in]   w1: m0', Montgomery constant for p
+ * @param[in]  w31: all-zero
+ * @param[in]  dmem[rsa_n]: p
+ * @param[in]  dmem[RR]: RR, squared Montgomery modulus for p
+ * @param[in]  dmem[r0]: m_p, c^d_p mod p
+ * @param[in]  dmem[rsa_crt_m_q]: m_q, c^d_q mod q
+ * @param[in]  dmem[rsa_crt_i_q]: i_q, q^-1 mod p
+ * @param[in]  dmem[rsa_crt_q_copy]: q
+ * @param[out] dmem[inout]: m (2*h limbs)
+ *
+ * Clobbered registers: x2 to x13, x16, x19 to x23, x31
+ *                      w2, w3, w4 to w[4+h-1], w20 to w30
+ * Clobbered flag groups: FG0, FG1
+ */
+crt_garner:
+  li  x8, 4
+  li  x9, 3
+  li  x10, 4
+  li  x11, 2
+
+  # m_q may be larger than p, so reduce it first:
+  #   dmem[r2] <= montmul(montmul(m_q, RR), 1) = m_q mod p
+  la  x16, rsa_n
+  la  x19, rsa_crt_m_q
+  la  x20, RR
+  jal x1, montmul
+  addi x2, x8, 0
+  la   x3, work_buf
+  loop x30, 2
+    bn.sid x2, 0(x3++)
+    addi   x2, x2, 1
+  la  x19, work_buf
+  la  x21, r2
+  jal x1, montmul_mul1
+
+  # dmem[work_buf] <= (m_p - m_q) mod p. Both operands are in [0, p), so
+  # adding p once if the subtraction underflows is enough.
+  la     x2, r0
+  la     x3, r2
+  la     x4, work_buf
+  bn.add w31, w31, w31
+  loop   x30, 4
+    bn.lid  x11, 0(x2++)
+    bn.lid  x9, 0(x3++)
+    bn.subb w2, w2, w3
+    bn.sid  x11, 0(x4++)
+
+  # FG1.C <= borrow of the subtraction.
+  bn.subb w3, w31, w31
+  bn.cmp  w31, w3, FG1
+  bn.add  w31, w31, w31
+
+  la     x2, rsa_n
+  la     x4, work_buf
+  loop   x30, 5
+    bn.lid  x9, 0(x2++)
+    bn.sel  w3, w3, w31, FG1.C
+    bn.lid  x11, 0(x4)
+    bn.addc w2, w2, w3
+    bn.sid  x11, 0(x4++)
+
+  # Compute h = (m_p - m_q) * i_q mod p, fully reduced:
+  #   dmem[r2] <= montmul((m_p - m_q), i_q) = (m_p - m_q) * i_q * R^-1
+  #   dmem[r2] <= montmul(dmem[r2], RR) = (m_p - m_q) * i_q
+  #   dmem[r2] <= montmul(dmem[r2], RR) = (m_p - m_q) * i_q * R
+  #   dmem[r2] <= montmul_mul1(dmem[r2]) = h
+  li  x8, 4
+  la  x16, rsa_n
+  la  x19, work_buf
+  la  x20, rsa_crt_i_q
+  jal x1, montmul
+  addi x2, x8, 0
+  la   x3, r2
+  loop x30, 2
+    bn.sid x2, 0(x3++)
+    addi   x2, x2, 1
+
+  la  x19, r2
+  la  x20, RR
+  jal x1, montmul
+  addi x2, x8, 0
+  la   x3, r2
+  loop x30, 2
+    bn.sid x2, 0(x3++)
+    addi   x2, x2, 1
+
+  la  x19, r2
+  la  x20, RR
+  jal x1, montmul
+  addi x2, x8, 0
+  la   x3, r2
+  loop x30, 2
+    bn.sid x2, 0(x3++)
+    addi   x2, x2, 1
+
+  la  x19, r2
+  la  x21, r2
+  jal x1, montmul_mul1
+
+  # dmem[inout] <= h * q
+  la   x10, r2
+  la   x11, rsa_crt_q_copy
+  la   x12, inout
+  addi x31, x30, 0
+  jal  x1, bignum_mul
+
+  # dmem[inout] <= dmem[inout] + m_q, propagating the carry through the upper
+  # half. No carry out of the top limb is possible because m < n.
+  li     x4, 2
+  li     x5, 3
+  la     x2, inout
+  la     x3, rsa_crt_m_q
+  bn.add w31, w31, w31
+  loop   x30, 4
+    bn.lid  x4, 0(x2)
+    bn.lid  x5, 0(x3++)
+    bn.addc w2, w2, w3
+    bn.sid  x4, 0(x2++)
+  loop   x30, 3
+    bn.lid  x4, 0(x2)
+    bn.addc w2, w2, w31
+    bn.sid  x4, 0(x2++)
+
+  # Restore N-1 for the Montgomery routines.
+  addi x31, x30, -1
+
+  ret
@@ -28,28 +28,30 @@ msg:
 
 /* Signature R. */
 .globl r
-.balign 32
 r:
   .zero 64
 
 /* Signature S. */
 .globl s
-.balign 32
 s:
   .zero 64
 
 /* Public key x-coordinate. */
 .globl x
-.balign 32
 x:
   .zero 64
 
 /* Public key y-coordinate. */
 .globl y
-.balign 32
 y:
   .zero 64
 
+/* The batch verification copies each item over msg, r, s, x and y as a single
+   block, so they must stay contiguous and in this order. */
+.if (r - msg) != 64 || (s - r) != 64 || (x - s) != 64 || (y - x) != 64
+  .error "msg, r, s, x and y must be contiguous"
+.endif
+
 /* Private key input/output buffer. */
 .globl d0_io
 .balign 32
@@ -113,6 +115,33 @@ p_temp1:
 p_temp2:
   .zero 192
 
+/* Number of items in a signature batch (at most 3). */
+.globl batch_len
+.balign 4
+batch_len:
+  .zero 4
+
+/* Index of the next item to verify in a signature batch. Must directly follow
+   `batch_len`. */
+.globl batch_next
+batch_next:
+  .zero 4
+.if (batch_next - batch_len) != 4
+  .error "batch_next must directly follow batch_len"
+.endif
+
+/* Signature batch: one record of msg, r, s, x and y per item. */
+.globl batch_items
+.balign 32
+batch_items:
+  .zero 960
+
+/* Verification results x_r for a signature batch. */
+.globl batch_x_r
+.balign 32
+batch_x_r:
+  .zero 192
+
 .section .scratchpad
 /* 704 bytes of scratchpad memory */
 .balign 32
@@ -13,6 +13,7 @@
  * 5. MODE_SIDELOAD_KEYGEN: generate a keypair from a sideloaded seed
  * 6. MODE_SIDELOAD_SIGN: generate an ECDSA signature using sideloaded secret key/seed
  * 7. MODE_SIDELOAD_ECDH: ECDH key exchange using a secret key from a sideloaded seed
+ * 8. MODE_VERIFY_BATCH: verify a batch of ECDSA signatures
  */
 
 /**
@@ -36,6 +37,12 @@
 .equ MODE_SIDELOAD_SIGN, 0x45e
 .equ MODE_SIDELOAD_ECDH, 0x72c
 
+/**
+ * The generator above cannot add an eighth 11-bit value at distance 6, so
+ * this one was picked by hand at distance at least 5 from the others.
+ */
+.equ MODE_VERIFY_BATCH, 0x1a6
+
 /**
  * Make the mode constants visible to Ibex.
  */
@@ -46,6 +53,7 @@
 .globl MODE_SIDELOAD_KEYGEN
 .globl MODE_SIDELOAD_SIGN
 .globl MODE_SIDELOAD_ECDH
+.globl MODE_VERIFY_BATCH
 
 /**
  * Hardened boolean values.
@@ -68,6 +76,9 @@ start:
   addi  x3, x0, MODE_VERIFY
   beq   x2, x3, ecdsa_verify
 
+  addi  x3, x0, MODE_VERIFY_BATCH
+  beq   x2, x3, ecdsa_verify_batch
+
   addi  x3, x0, MODE_SIDELOAD_KEYGEN
   beq   x2, x3, sideload_keygen
 
@@ -205,6 +216,82 @@ ecdsa_verify:
 
   ecall
 
+/**
+ * Verify a batch of signatures.
+ *
+ * Runs `ecdsa_verify` on items dmem[batch_next] to dmem[batch_len] - 1. Each
+ * item is a record of message, r, s, x and y (256 bits each) in the same
+ * order as the single-signature buffers, so it can be copied over them in
+ * one go; the item's `x_r` is copied out to dmem[batch_x_r] afterwards.
+ *
+ * An item that fails the basic validity checks ends the program early, just
+ * like `ecdsa_verify`, with dmem[ok] false and dmem[batch_next] still holding
+ * its index. The caller should treat that item as invalid, increment
+ * dmem[batch_next] and run the program again to continue with the rest of the
+ * batch; DMEM is not touched in between. If the program ends with
+ * dmem[batch_next] equal to dmem[batch_len], all remaining items passed the
+ * basic checks and dmem[ok] is true.
+ *
+ * The batch buffers hold up to 4 items. The caller must ensure
+ * batch_next <= batch_len <= 4.
+ *
+ * @param[in]     dmem[batch_len]:   number of items N (32 bits)
+ * @param[in,out] dmem[batch_next]:  index of the next item to verify (32 bits)
+ * @param[in]     dmem[batch_items]: N records of msg, r, s, x, y
+ * @param[out]    dmem[ok]:          success code of the last item's checks
+ * @param[out]    dmem[batch_x_r]:   N reduced x_r-coordinates (256 bits each)
+ */
+ecdsa_verify_batch:
+  /* Load the batch length and the index of the next item.
+       x3 <= dmem[batch_len]
+       x4 <= dmem[batch_next] */
+  la       x2, batch_len
+  lw       x3, 0(x2)
+  lw       x4, 4(x2)
+
+  /* End the program once all items are done. */
+  bne      x4, x3, _verify_batch_item
+  ecall
+
+  _verify_batch_item:
+  /* Copy the item over the single-signature buffers, one wide word at a
+     time through w0.
+       dmem[msg:y] <= dmem[batch_items + x4 * 160] */
+  slli     x5, x4, 7
+  slli     x6, x4, 5
+  add      x5, x5, x6
+  la       x2, batch_items
+  add      x2, x2, x5
+  la       x3, msg
+  loopi    5, 2
+    bn.lid   x0, 0(x2++)
+    bn.sid   x0, 0(x3++)
+
+  /* Validate the public key (ends the program on failure). */
+  jal      x1, p256_check_public_key
+
+  /* Verify the signature (compute x_r). */
+  jal      x1, p256_verify
+
+  /* Reload the item index, which the calls above clobber, and copy out the
+     result.
+       x4 <= dmem[batch_next]
+       dmem[batch_x_r + x4 * 32] <= dmem[x_r] */
+  la       x2, batch_next
+  lw       x4, 0(x2)
+  slli     x5, x4, 5
+  la       x3, batch_x_r
+  add      x3, x3, x5
+  la       x5, x_r
+  bn.lid   x0, 0(x5)
+  bn.sid   x0, 0(x3)
+
+  /* Advance to the next item.
+       dmem[batch_next] <= x4 + 1 */
+  addi     x4, x4, 1
+  sw       x4, 0(x2)
+  jal      x0, ecdsa_verify_batch
+
 /**
  * Generate a shared key from a secret and public key (ECDH).
  *
@@ -368,28 +455,30 @@ msg:
 
 /* Signature R. */
 .globl r
-.balign 32
 r:
   .zero 32
 
 /* Signature S. */
 .globl s
-.balign 32
 s:
   .zero 32
 
 /* Public key x-coordinate. */
 .globl x
-.balign 32
 x:
   .zero 32
 
 /* Public key y-coordinate. */
 .globl y
-.balign 32
 y:
   .zero 32
 
+/* The batch verification copies each item over msg, r, s, x and y as a single
+   block, so they must stay contiguous and in this order. */
+.if (r - msg) != 32 || (s - r) != 32 || (x - s) != 32 || (y - x) != 32
+  .error "msg, r, s, x and y must be contiguous"
+.endif
+
 /* Public key z-coordinate. */
 .globl z
 .balign 32
@@ -412,6 +501,33 @@ d1_io:
 x_r:
   .zero 32
 
+/* Number of items in a signature batch (at most 4). */
+.globl batch_len
+.balign 4
+batch_len:
+  .zero 4
+
+/* Index of the next item to verify in a signature batch. Must directly follow
+   `batch_len`. */
+.globl batch_next
+batch_next:
+  .zero 4
+.if (batch_next - batch_len) != 4
+  .error "batch_next must directly follow batch_len"
+.endif
+
+/* Signature batch: one record of msg, r, s, x and y per item. */
+.globl batch_items
+.balign 32
+batch_items:
+  .zero 640
+
+/* Verification results x_r for a signature batch. */
+.globl batch_x_r
+.balign 32
+batch_x_r:
+  .zero 128
+
 .section .scratchpad
 
 /* Secret scalar (k) in two shares: k = (k0 + k1) mod n */
@@ -13,6 +13,7 @@
  * 5. MODE_SIDELOAD_KEYGEN: generate a keypair from a sideloaded seed
  * 6. MODE_SIDELOAD_SIGN: generate an ECDSA signature using sideloaded secret key/seed
  * 7. MODE_SIDELOAD_ECDH: ECDH key exchange using a secret key from a sideloaded seed
+ * 8. MODE_VERIFY_BATCH: verify a batch of ECDSA signatures
  */
 
 /**
@@ -35,6 +36,12 @@
 .equ MODE_SIDELOAD_SIGN, 0x786
 .equ MODE_SIDELOAD_ECDH, 0x36a
 
+/**
+ * The generator above cannot add an eighth 11-bit value at distance 6, so
+ * this one was picked by hand at distance at least 5 from the others.
+ */
+.equ MODE_VERIFY_BATCH, 0x136
+
 /**
  * Make the mode constants visible to Ibex.
  */
@@ -45,6 +52,7 @@
 .globl MODE_SIDELOAD_KEYGEN
 .globl MODE_SIDELOAD_SIGN
 .globl MODE_SIDELOAD_ECDH
+.globl MODE_VERIFY_BATCH
 
 /**
  * Hardened boolean values.
@@ -67,6 +75,9 @@ start:
   addi  x3, x0, MODE_VERIFY
   beq   x2, x3, ecdsa_verify
 
+  addi  x3, x0, MODE_VERIFY_BATCH
+  beq   x2, x3, ecdsa_verify_batch
+
   addi  x3, x0, MODE_SIDELOAD_KEYGEN
   beq   x2, x3, keypair_from_seed
 
@@ -246,6 +257,83 @@ ecdsa_verify:
 
   ecall
 
+/**
+ * Verify a batch of signatures.
+ *
+ * Runs `ecdsa_verify` on items dmem[batch_next] to dmem[batch_len] - 1. Each
+ * item is a record of message, r, s, x and y (512 bits each) in the same
+ * order as the single-signature buffers, so it can be copied over them in
+ * one go; the item's `x_r` is copied out to dmem[batch_x_r] afterwards.
+ *
+ * An item that fails the basic validity checks ends the program early, just
+ * like `ecdsa_verify`, with dmem[ok] false and dmem[batch_next] still holding
+ * its index. The caller should treat that item as invalid, increment
+ * dmem[batch_next] and run the program again to continue with the rest of the
+ * batch; DMEM is not touched in between. If the program ends with
+ * dmem[batch_next] equal to dmem[batch_len], all remaining items passed the
+ * basic checks and dmem[ok] is true.
+ *
+ * The batch buffers hold up to 3 items. The caller must ensure
+ * batch_next <= batch_len <= 3.
+ *
+ * @param[in]     dmem[batch_len]:   number of items N (32 bits)
+ * @param[in,out] dmem[batch_next]:  index of the next item to verify (32 bits)
+ * @param[in]     dmem[batch_items]: N records of msg, r, s, x, y
+ * @param[out]    dmem[ok]:          success code of the last item's checks
+ * @param[out]    dmem[batch_x_r]:   N reduced x_r-coordinates (512 bits each)
+ */
+ecdsa_verify_batch:
+  /* Load the batch length and the index of the next item.
+       x3 <= dmem[batch_len]
+       x4 <= dmem[batch_next] */
+  la       x2, batch_len
+  lw       x3, 0(x2)
+  lw       x4, 4(x2)
+
+  /* End the program once all items are done. */
+  bne      x4, x3, _verify_batch_item
+  ecall
+
+  _verify_batch_item:
+  /* Copy the item over the single-signature buffers, one wide word at a
+     time through w0.
+       dmem[msg:y] <= dmem[batch_items + x4 * 320] */
+  slli     x5, x4, 8
+  slli     x6, x4, 6
+  add      x5, x5, x6
+  la       x2, batch_items
+  add      x2, x2, x5
+  la       x3, msg
+  loopi    10, 2
+    bn.lid   x0, 0(x2++)
+    bn.sid   x0, 0(x3++)
+
+  /* Validate the public key (ends the program on failure). */
+  jal      x1, p384_check_public_key
+
+  /* Verify the signature (compute x_r). */
+  jal      x1, p384_verify
+
+  /* Reload the item index, which the calls above clobber, and copy out the
+     result.
+       x4 <= dmem[batch_next]
+       dmem[batch_x_r + x4 * 64] <= dmem[x_r] */
+  la       x2, batch_next
+  lw       x4, 0(x2)
+  slli     x5, x4, 6
+  la       x3, batch_x_r
+  add      x3, x3, x5
+  la       x5, x_r
+  loopi    2, 2
+    bn.lid   x0, 0(x5++)
+    bn.sid   x0, 0(x3++)
+
+  /* Advance to the next item.
+       dmem[batch_next] <= x4 + 1 */
+  addi     x4, x4, 1
+  sw       x4, 0(x2)
+  jal      x0, ecdsa_verify_batch
+
 
 /**
  * Generate a shared key from a secret and public key.
@@ -9,7 +9,7 @@
 
 /**
  * Mode magic values generated with
- * $ ./util/design/sparse-fsm-encode.py -d 4 -m 14 -n 11 \
+ * $ ./util/design/sparse-fsm-encode.py -d 4 -m 18 -n 11 \
  *    -s 347912204 --avoid-zero
  *
  * Call the same utility with the same arguments and a higher -m to generate
@@ -45,6 +45,15 @@
 .equ MODE_RSA_4096_MODEXP,    0x361
 .equ MODE_RSA_4096_MODEXP_F4, 0x3d4
 
+# Decryption/Signature modes using the CRT
+
+# Testing only! These key lengths are not supported by the cryptolib.
+.equ MODE_RSA_1024_MODEXP_CRT, 0x47b
+# Supported key lengths.
+.equ MODE_RSA_2048_MODEXP_CRT, 0x0a3
+.equ MODE_RSA_3072_MODEXP_CRT, 0x159
+.equ MODE_RSA_4096_MODEXP_CRT, 0x684
+
 /**
  * Make the mode constants visible to Ibex.
  */
@@ -62,6 +71,10 @@
 .globl MODE_RSA_3072_MODEXP_F4
 .globl MODE_RSA_4096_MODEXP
 .globl MODE_RSA_4096_MODEXP_F4
+.globl MODE_RSA_1024_MODEXP_CRT
+.globl MODE_RSA_2048_MODEXP_CRT
+.globl MODE_RSA_3072_MODEXP_CRT
+.globl MODE_RSA_4096_MODEXP_CRT
 
 .section .text.start
 start:
@@ -114,6 +127,18 @@ start:
   addi    x3, x0, MODE_RSA_4096_MODEXP_F4
   beq     x2, x3, rsa_4096_modexp_f4
 
+  addi    x3, x0, MODE_RSA_1024_MODEXP_CRT
+  beq     x2, x3, rsa_1024_modexp_crt
+
+  addi    x3, x0, MODE_RSA_2048_MODEXP_CRT
+  beq     x2, x3, rsa_2048_modexp_crt
+
+  addi    x3, x0, MODE_RSA_3072_MODEXP_CRT
+  beq     x2, x3, rsa_3072_modexp_crt
+
+  addi    x3, x0, MODE_RSA_4096_MODEXP_CRT
+  beq     x2, x3, rsa_4096_modexp_crt
+
   /* Unsupported mode; fail. */
   unimp
   unimp
@@ -232,6 +257,34 @@ rsa_4096_modexp_f4:
   /* Tail-call modexp_f4. */
   jal     x0, do_modexp_f4
 
+rsa_1024_modexp_crt:
+  /* Set the number of limbs for each prime (1024 / 2 / 256 = 2). */
+  li      x30, 2
+
+  /* Tail-call modexp_crt. */
+  jal     x0, do_modexp_crt
+
+rsa_2048_modexp_crt:
+  /* Set the number of limbs for each prime (2048 / 2 / 256 = 4). */
+  li      x30, 4
+
+  /* Tail-call modexp_crt. */
+  jal     x0, do_modexp_crt
+
+rsa_3072_modexp_crt:
+  /* Set the number of limbs for each prime (3072 / 2 / 256 = 6). */
+  li      x30, 6
+
+  /* Tail-call modexp_crt. */
+  jal     x0, do_modexp_crt
+
+rsa_4096_modexp_crt:
+  /* Set the number of limbs for each prime (4096 / 2 / 256 = 8). */
+  li      x30, 8
+
+  /* Tail-call modexp_crt. */
+  jal     x0, do_modexp_crt
+
 /**
  * Invoke the RSA key generation algorithm.
  *
@@ -323,3 +376,27 @@ do_modexp_f4:
     bn.sid x0, 0(x4++)
 
   ecall
+
+/**
+ * Run the CRT form of the private key operation.
+ *
+ * Calls `ecall` when done; should be tail-called by mode-specific routines
+ * after the number of limbs is set.
+ *
+ * See `modexp_crt` for the DMEM locations of the inputs.
+ *
+ * @param[in]          x30: number of limbs for each prime
+ * @param[out] dmem[inout]: result, c^d mod n
+ */
+do_modexp_crt:
+  # Save mode indicator in register.
+  la x16, mode
+  lw x28, 0(x16)
+
+  jal x1, modexp_crt
+
+  # Restore mode indicator in DMEM.
+  la x16, mode
+  sw x28, 0(x16)
+
+  ecall
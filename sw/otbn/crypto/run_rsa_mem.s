@@ -9,99 +9,140 @@
 .bss
 
 /* RSA modulus (n), up to 4096 bits. */
-.globl rsa_n
+/* CRT: Second prime (q) and q^-1 mod p (i_q). */
+.globl rsa_n, rsa_crt_q, rsa_crt_i_q
 .balign 32
+/*----------------+----------+-------------+----------*
+ |                |          |             |          |
+ |      256B      |          |  rsa_crt_q  |          |
+ |                |          |             |          |
+ +----------------+    n     +-------------+    n     |
+ |                |          |             |          |
+ |      256B      |          | rsa_crt_i_q |          |
+ |                |          |             |          |
+ *----------------+----------+-------------+----------*/
 rsa_n:
-.zero 512
+rsa_crt_q:
+.zero 256
+rsa_crt_i_q:
+.zero 256
 
 # Enc/Sign: First private exponent share (d) up to 4096 bits.
 # Keygen: Temp storage for rsa_p and second exponent share for primality tests.
-.globl rsa_d0, rsa_p
+# CRT: First share of d_q and lower half of the input (c).
+.globl rsa_d0, rsa_p, rsa_crt_d_q0, rsa_crt_c_lo
 .balign 32
-/*----------------+----------+----------*
- |                |          |          |
- |      256B      |    d0    |          |
- |                |          |          |
- +----------------+----------+    d0    |
- |                |          |          |
- |      256B      |  rsa_p   |          |
- |                |          |          |
- *----------------+----------+----------*/
+/*----------------+----------+----------+--------------*
+ |                |          |          |              |
+ |      256B      |    d0    |          | rsa_crt_d_q0 |
+ |                |          |          |              |
+ +----------------+----------+    d0    +--------------+
+ |                |          |          |              |
+ |      256B      |  rsa_p   |          | rsa_crt_c_lo |
+ |                |          |          |              |
+ *----------------+----------+----------+--------------*/
 rsa_d0:
+rsa_crt_d_q0:
 .zero 256
 rsa_p:
+rsa_crt_c_lo:
 .zero 256
 
 # Enc/Sign: Second private exponent share (d) for signing, up to 4096 bits.
 # Keygen: Temp storage for rsa_q and second exponent share for primality tests.
-.globl rsa_d1, rsa_q
+# CRT: Second share of d_q and upper half of the input (c).
+.globl rsa_d1, rsa_q, rsa_crt_d_q1, rsa_crt_c_hi
 .balign 32
-/*----------------+----------+----------*
- |                |          |          |
- |      256B      |    d1    |          |
- |                |          |          |
- +----------------+----------+    d1    |
- |                |          |          |
- |      256B      |  rsa_q   |          |
- |                |          |          |
- *----------------+----------+----------*/
+/*----------------+----------+----------+--------------*
+ |                |          |          |              |
+ |      256B      |    d1    |          | rsa_crt_d_q1 |
+ |                |          |          |              |
+ +----------------+----------+    d1    +--------------+
+ |                |          |          |              |
+ |      256B      |  rsa_q   |          | rsa_crt_c_hi |
+ |                |          |          |              |
+ *----------------+----------+----------+--------------*/
 rsa_d1:
+rsa_crt_d_q1:
 .zero 256
 rsa_q:
+rsa_crt_c_hi:
 .zero 256
 
 # r0, r1, r2 are the primary three 4096-bit computation regision for `modexp`.
+# CRT: First share of d_p in the upper half of r0.
 .balign 32
 .globl r0
 .globl inout
+.globl rsa_crt_d_p0
+/*----------------+----------+--------------*
+ |                |          |              |
+ |      256B      |          |              |
+ |                |          |              |
+ +----------------+ r0/inout +--------------+
+ |                |          |              |
+ |      256B      |          | rsa_crt_d_p0 |
+ |                |          |              |
+ *----------------+----------+--------------*/
 r0:
 inout:
-.zero 512
+.zero 256
+rsa_crt_d_p0:
+.zero 256
 
-.globl r1, mode, rsa_g
+# CRT: First prime (p) in the upper half of r1.
+.globl r1, mode, rsa_g, rsa_crt_p
 .balign 32
-/*----------------+----------+----------*
- |                |    r1    |          |
- |      256B      |  (mode)  |          |
- |                |          |          |
- +----------------+----------+    r1    |
- |                |          |          |
- |      256B      |  rsa_g   |          |
- |                |          |          |
- *----------------+----------+----------*/
+/*----------------+----------+----------+-----------*
+ |                |    r1    |          |           |
+ |      256B      |  (mode)  |          |           |
+ |                |          |          |           |
+ +----------------+----------+    r1    +-----------+
+ |                |          |          |           |
+ |      256B      |  rsa_g   |          | rsa_crt_p |
+ |                |          |          |           |
+ *----------------+----------+----------+-----------*/
 r1:
 mode:
 .zero 256
 rsa_g:
+rsa_crt_p:
 .zero 256
 
-.globl r2, rsa_h
+# CRT: Second share of d_p and, internally, c^d_q mod q (m_q).
+.globl r2, rsa_h, rsa_crt_d_p1, rsa_crt_m_q
 .balign 32
-/*----------------+----------+----------*
- |                |          |          |
- |      256B      |    r2    |          |
- |                |          |          |
- +----------------+----------+    r2    |
- |                |          |          |
- |      256B      |  rsa_h   |          |
- |                |          |          |
- *----------------+----------+----------*/
+/*----------------+----------+----------+--------------*
+ |                |          |          |              |
+ |      256B      |    r2    |          | rsa_crt_d_p1 |
+ |                |          |          |              |
+ +----------------+----------+    r2    +--------------+
+ |                |          |          |              |
+ |      256B      |  rsa_h   |          | rsa_crt_m_q  |
+ |                |          |          |              |
+ *----------------+----------+----------+--------------*/
 r2:
+rsa_crt_d_p1:
 .zero 256
 rsa_h:
+rsa_crt_m_q:
 .zero 256
 
 .section .scratchpad
 
 /* Montgomery constant RR. Filled by `modload`. */
+/* CRT: The upper half keeps a copy of q. */
 .balign 32
-.globl RR
+.globl RR, rsa_crt_q_copy
 RR:
-.zero 512
+.zero 256
+rsa_crt_q_copy:
+.zero 256
 
 /* Scratchpad working buffer. */
 .balign 32
 .globl work_buf, buf0, buf1, buf2, buf3, buf4, buf5, buf6, buf7
+.globl rsa_crt_d_p1_copy
 work_buf:
 buf0:
 .zero 64
@@ -111,7 +152,9 @@ buf2:
 .zero 64
 buf3:
 .zero 64
+/* CRT: The upper half keeps a copy of the second share of d_p. */
 buf4:
+rsa_crt_d_p1_copy:
 .zero 64
 buf5:
 .zero 64
@@ -0,0 +1,36 @@
+/* Copyright lowRISC contributors (OpenTitan project). */
+/* Licensed under the Apache License, Version 2.0, see LICENSE for details. */
+/* SPDX-License-Identifier: Apache-2.0 */
+
+
+.section .text.start
+
+/**
+ * Standalone RSA 1024 decrypt using the CRT
+ *
+ * Uses the OTBN modexp_crt routine to decrypt the message given in the test's
+ * DMEM inputs with the CRT form of the private key (p, q, d_p, d_q, i_q).
+ *
+ * Copies the decrypted message to wide registers for comparison (starting at
+ * w0). See the .hjson file for the expected values.
+ */
+ main:
+  /* Init all-zero register. */
+  bn.xor  w31, w31, w31
+
+  /* Load number of limbs per prime (1024 / 2 / 256 = 2). */
+  li  x30, 2
+
+  /* Run the CRT exponentiation.
+       dmem[inout] = c^d mod (p*q) */
+  jal      x1, modexp_crt
+
+  /* copy all limbs of result to wide reg file */
+  la       x21, inout
+  li       x8, 0
+  li       x2, 4
+  loop     x2, 2
+    bn.lid   x8, 0(x21++)
+    addi     x8, x8, 1
+
+  ecall
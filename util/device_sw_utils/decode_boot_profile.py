@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+# Copyright lowRISC contributors (OpenTitan project).
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+"""Decode the boot profile left in the retention SRAM by the ROM and ROM_EXT.
+
+When the ROM and ROM_EXT are built with `--copt=-DBOOT_PROFILE`, they record
+the low 32 bits of `mcycle` at a fixed set of milestones into a
+`boot_profile_t` in the silicon creator area of the retention SRAM (see
+sw/device/silicon_creator/lib/boot_profile.h). This script reads an image of
+the retention SRAM and prints the duration of each boot phase.
+
+The image can be a raw binary file or a text file of 32-bit hex words with
+optional `@<word address>` markers (as written by `$writememh` or a DV memory
+backdoor dump). In both cases the image must start at the base of the
+retention SRAM and must not be scrambled.
+"""
+
+import argparse
+import json
+import string
+import struct
+import sys
+
+# Offset of `retention_sram_t.creator.boot_profile`.
+BOOT_PROFILE_OFFSET = 4 + 1844
+# ASCII "BPRF".
+BOOT_PROFILE_IDENTIFIER = 0x46525042
+
+# Must match `boot_profile_milestone_t`.
+MILESTONES = [
+    'rom_init',
+    'rom_boot_data_read',
+    'rom_verify_start',
+    'rom_digest_done',
+    'rom_spx_done',
+    'rom_ecdsa_done',
+    'rom_boot_start',
+    'rom_ext_jump',
+    'rom_ext_start',
+    'rom_ext_ownership_done',
+    'rom_ext_verify_start',
+    'rom_ext_digest_done',
+    'rom_ext_spx_done',
+    'rom_ext_ecdsa_done',
+    'rom_ext_dice_done',
+    'bl0_jump',
+]
+
+# (phase, start milestone, end milestone)
+#
+# The ECDSA verification runs on OTBN while the SPHINCS+ verification runs on
+# Ibex, so `*_sigverify_ecdsa` overlaps `*_sigverify_spx` when both are present
+# and `*_sigverify_ecdsa_wait` is the time spent waiting on OTBN afterwards.
+PHASES = [
+    ('rom_boot_data', 'rom_init', 'rom_boot_data_read'),
+    ('rom_verify_digest', 'rom_verify_start', 'rom_digest_done'),
+    ('rom_sigverify_spx', 'rom_digest_done', 'rom_spx_done'),
+    ('rom_sigverify_ecdsa', 'rom_digest_done', 'rom_ecdsa_done'),
+    ('rom_sigverify_ecdsa_wait', 'rom_spx_done', 'rom_ecdsa_done'),
+    ('rom_boot', 'rom_boot_start', 'rom_ext_jump'),
+    ('rom_total', 'rom_init', 'rom_ext_jump'),
+    ('rom_ext_init', 'rom_ext_jump', 'rom_ext_start'),
+    ('rom_ext_ownership', 'rom_ext_start', 'rom_ext_ownership_done'),
+    ('rom_ext_verify_digest', 'rom_ext_verify_start', 'rom_ext_digest_done'),
+    ('rom_ext_sigverify_spx', 'rom_ext_digest_done', 'rom_ext_spx_done'),
+    ('rom_ext_sigverify_ecdsa', 'rom_ext_digest_done', 'rom_ext_ecdsa_done'),
+    ('rom_ext_sigverify_ecdsa_wait', 'rom_ext_spx_done',
+     'rom_ext_ecdsa_done'),
+    ('rom_ext_dice', 'rom_ext_ecdsa_done', 'rom_ext_dice_done'),
+    ('rom_ext_lockdown', 'rom_ext_dice_done', 'bl0_jump'),
+    ('rom_ext_total', 'rom_ext_jump', 'bl0_jump'),
+]
+
+
+def read_image(path):
+    '''Returns the contents of a binary or hex word retention SRAM image.'''
+    with open(path, 'rb') as f:
+        data = f.read()
+    if not all(chr(b) in string.printable for b in data):
+        return data
+
+    words = {}
+    addr = 0
+    for line in data.decode('ascii').splitlines():
+        line = line.split('//')[0]
+        for token in line.split():
+            if token.startswith('@'):
+                addr = int(token[1:], 16)
+            else:
+                words[addr] = int(token, 16)
+                addr += 1
+    if not words:
+        return b''
+    image = bytearray(4 * (max(words) + 1))
+    for addr, word in words.items():
+        struct.pack_into('<I', image, 4 * addr, word)
+    return bytes(image)
+
+
+def decode(image, offset):
+    '''Returns a {milestone: cycles} dict for the milestones that were hit.'''
+    fmt = '<I{}I'.format(len(MILESTONES))
+    if len(image) < offset + struct.calcsize(fmt):
+        raise ValueError('image too short for a boot profile at {:#x}'.format(
+            offset))
+    identifier, *cycles = struct.unpack_from(fmt, image, offset)
+    if identifier != BOOT_PROFILE_IDENTIFIER:
+        raise ValueError(
+            'bad boot profile identifier {:#010x}; was the ROM built with '
+            '-DBOOT_PROFILE?'.format(identifier))
+    return {m: c for m, c in zip(MILESTONES, cycles) if c != 0}
+
+
+def phases(stamps):
+    '''Returns a {phase: cycles} dict for the phases that can be computed.'''
+    durations = {}
+    for name, start, end in PHASES:
+        if start in stamps and end in stamps:
+            durations[name] = (stamps[end] - stamps[start]) & 0xffffffff
+    return durations
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('image', help='retention SRAM image')
+    parser.add_argument('--offset',
+                        type=lambda x: int(x, 0),
+                        default=BOOT_PROFILE_OFFSET,
+                        help='byte offset of the boot profile in the image')
+    parser.add_argument('--json',
+                        action='store_true',
+                        help='print milestones and phases as JSON')
+    args = parser.parse_args()
+
+    try:
+        stamps = decode(read_image(args.image), args.offset)
+    except ValueError as e:
+        print('error: {}'.format(e), file=sys.stderr)
+        return 1
+    durations = phases(stamps)
+
+    if args.json:
+        print(json.dumps({
+            'milestones': stamps,
+            'phases': durations
+        }, indent=2))
+        return 0
+
+    print('Milestones (mcycle):')
+    for name, cycles in stamps.items():
+        print('  {:<30} {:>12}'.format(name, cycles))
+    print('Phases (cycles):')
+    for name, cycles in durations.items():
+        print('  {:<30} {:>12}'.format(name, cycles))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,165 @@
+# Copyright lowRISC contributors (OpenTitan project).
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+
+import contextlib
+import io
+import json
+import os
+import struct
+import tempfile
+import unittest
+from unittest.mock import patch
+
+import decode_boot_profile
+
+OFFSET = decode_boot_profile.BOOT_PROFILE_OFFSET
+IDENTIFIER = decode_boot_profile.BOOT_PROFILE_IDENTIFIER
+NUM_MILESTONES = len(decode_boot_profile.MILESTONES)
+
+
+def make_image(stamps, identifier=IDENTIFIER, offset=OFFSET):
+    '''Returns a retention SRAM image holding a boot profile.'''
+    cycles = [stamps.get(m, 0) for m in decode_boot_profile.MILESTONES]
+    profile = struct.pack('<I{}I'.format(NUM_MILESTONES), identifier, *cycles)
+    return bytes(offset) + profile
+
+
+def to_hex_words(image):
+    '''Returns `image` as lines of 32-bit hex words.'''
+    words = struct.unpack('<{}I'.format(len(image) // 4), image)
+    return '\n'.join('{:08x}'.format(w) for w in words) + '\n'
+
+
+class TestDecode(unittest.TestCase):
+
+    def test_milestones(self):
+        stamps = {'rom_init': 100, 'rom_ext_jump': 5000, 'bl0_jump': 9000}
+        self.assertEqual(decode_boot_profile.decode(make_image(stamps), OFFSET),
+                         stamps)
+
+    def test_profile_size(self):
+        # One identifier word followed by one word per milestone, as in
+        # `boot_profile_t`.
+        self.assertEqual(NUM_MILESTONES, 16)
+        self.assertEqual(len(make_image({})) - OFFSET, 4 * (1 + 16))
+
+    def test_bad_identifier(self):
+        image = make_image({'rom_init': 1}, identifier=0)
+        with self.assertRaisesRegex(ValueError, 'identifier'):
+            decode_boot_profile.decode(image, OFFSET)
+
+    def test_image_too_short(self):
+        image = make_image({'rom_init': 1})[:-4]
+        with self.assertRaisesRegex(ValueError, 'too short'):
+            decode_boot_profile.decode(image, OFFSET)
+
+
+class TestPhases(unittest.TestCase):
+
+    def test_complete_phases_only(self):
+        stamps = {
+            'rom_digest_done': 1000,
+            'rom_spx_done': 4000,
+            'rom_ecdsa_done': 4500,
+        }
+        self.assertEqual(
+            decode_boot_profile.phases(stamps), {
+                'rom_sigverify_spx': 3000,
+                'rom_sigverify_ecdsa': 3500,
+                'rom_sigverify_ecdsa_wait': 500,
+            })
+
+    def test_counter_wrap(self):
+        stamps = {'rom_ext_jump': 0xfffffff0, 'bl0_jump': 0x10}
+        self.assertEqual(
+            decode_boot_profile.phases(stamps)['rom_ext_total'], 0x20)
+
+    def test_phase_milestones_exist(self):
+        for name, start, end in decode_boot_profile.PHASES:
+            self.assertIn(start, decode_boot_profile.MILESTONES, name)
+            self.assertIn(end, decode_boot_profile.MILESTONES, name)
+
+
+class TestReadImage(unittest.TestCase):
+
+    def setUp(self):
+        self.tmpdir = tempfile.TemporaryDirectory()
+        self.addCleanup(self.tmpdir.cleanup)
+
+    def write(self, name, data):
+        path = os.path.join(self.tmpdir.name, name)
+        with open(path, 'wb') as f:
+            f.write(data)
+        return path
+
+    def test_binary(self):
+        image = make_image({'rom_init': 0x0a0d2009})
+        path = self.write('ret.bin', image)
+        self.assertEqual(decode_boot_profile.read_image(path), image)
+
+    def test_hex_words(self):
+        image = make_image({'rom_init': 7, 'bl0_jump': 70})
+        path = self.write('ret.vmem', to_hex_words(image).encode('ascii'))
+        self.assertEqual(decode_boot_profile.read_image(path), image)
+
+    def test_hex_words_with_address_markers(self):
+        text = '// comment\n@2 deadbeef\n@0 00000001 00000002 // trailing\n'
+        path = self.write('ret.vmem', text.encode('ascii'))
+        self.assertEqual(decode_boot_profile.read_image(path),
+                         struct.pack('<3I', 1, 2, 0xdeadbeef))
+
+
+class TestMain(unittest.TestCase):
+
+    def run_main(self, *args):
+        stdout = io.StringIO()
+        stderr = io.StringIO()
+        with patch('sys.argv', ['decode_boot_profile', *args]), \
+                contextlib.redirect_stdout(stdout), \
+                contextlib.redirect_stderr(stderr):
+            ret = decode_boot_profile.main()
+        return ret, stdout.getvalue(), stderr.getvalue()
+
+    def write_image(self, image):
+        f = tempfile.NamedTemporaryFile(suffix='.bin', delete=False)
+        self.addCleanup(os.remove, f.name)
+        f.write(image)
+        f.close()
+        return f.name
+
+    def test_json(self):
+        path = self.write_image(
+            make_image({
+                'rom_init': 10,
+                'rom_ext_jump': 110
+            }))
+        ret, out, _ = self.run_main(path, '--json')
+        self.assertEqual(ret, 0)
+        self.assertEqual(
+            json.loads(out), {
+                'milestones': {
+                    'rom_init': 10,
+                    'rom_ext_jump': 110
+                },
+                'phases': {
+                    'rom_total': 100
+                },
+            })
+
+    def test_offset(self):
+        path = self.write_image(make_image({'bl0_jump': 1}, offset=64))
+        ret, out, _ = self.run_main(path, '--offset', '0x40')
+        self.assertEqual(ret, 0)
+        self.assertIn('bl0_jump', out)
+
+    def test_error(self):
+        path = self.write_image(make_image({}, identifier=0))
+        ret, out, err = self.run_main(path)
+        self.assertEqual(ret, 1)
+        self.assertEqual(out, '')
+        self.assertIn('error:', err)
+
+
+if __name__ == '__main__':
+    unittest.main()